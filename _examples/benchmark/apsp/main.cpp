@@ -0,0 +1,76 @@
+#include <ogdf/basic/CSRGraph.h>
+#include <ogdf/basic/graph_generators.h>
+#include <ogdf/basic/Stopwatch.h>
+#include <ogdf/basic/Thread.h>
+#include <ogdf/graphalg/ShortestPathAlgorithms.h>
+
+using namespace ogdf;
+
+// Compares all-pairs shortest paths into nested node arrays with the
+// flat NodeMatrix and its multithreaded drivers.
+
+static void report(const char *name, unsigned int numThreads, const StopwatchWallClock &sw)
+{
+	cout << name << " (" << numThreads << " threads): " << sw.milliSeconds() << " ms" << endl;
+}
+
+int main(int argc, char **argv)
+{
+	int n = (argc > 1) ? atoi(argv[1]) : 4000;
+	int m = (argc > 2) ? atoi(argv[2]) : 3*n;
+	unsigned int maxThreads = (argc > 3) ? atoi(argv[3]) : max(1u, Thread::hardware_concurrency());
+
+	Graph G;
+	randomGraph(G, n, m);
+	cout << "n = " << G.numberOfNodes() << ", m = " << G.numberOfEdges() << endl;
+
+	CSRGraph C(G);
+	EdgeArray<double> cost(G);
+	for(edge e : G.edges) {
+		cost[e] = randomDouble(1, 10);
+	}
+
+	StopwatchWallClock sw;
+	{
+		sw.start();
+		NodeArray<NodeArray<double>> dist(G);
+		for(node v : G.nodes) {
+			dist[v].init(G, numeric_limits<double>::infinity());
+		}
+		bfs_SPAP(C, dist, 1.0);
+		sw.stop();
+		report("bfs_SPAP      NodeArray", 1, sw);
+
+		sw.start(true);
+		dijkstra_SPAP(C, dist, cost);
+		sw.stop();
+		report("dijkstra_SPAP NodeArray", 1, sw);
+	}
+
+	for(unsigned int numThreads = 1; numThreads <= maxThreads; numThreads *= 2) {
+		NodeMatrix<double> dist;
+		NodeMatrix<float> distF;
+
+		sw.start(true);
+		bfs_SPAP(C, dist, 1.0, numThreads);
+		sw.stop();
+		report("bfs_SPAP      double   ", numThreads, sw);
+
+		sw.start(true);
+		bfs_SPAP(C, distF, 1.0f, numThreads);
+		sw.stop();
+		report("bfs_SPAP      float    ", numThreads, sw);
+
+		sw.start(true);
+		dijkstra_SPAP(C, dist, cost, numThreads);
+		sw.stop();
+		report("dijkstra_SPAP double   ", numThreads, sw);
+
+		sw.start(true);
+		dijkstra_SPAP(C, distF, cost, numThreads);
+		sw.stop();
+		report("dijkstra_SPAP float    ", numThreads, sw);
+	}
+
+	return 0;
+}
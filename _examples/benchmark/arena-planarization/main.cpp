@@ -0,0 +1,95 @@
+#include <ogdf/fileformats/GraphIO.h>
+#include <ogdf/planarity/SubgraphPlanarizer.h>
+#include <ogdf/planarity/FastPlanarSubgraph.h>
+#include <ogdf/planarity/FixedEmbeddingInserter.h>
+#include <ogdf/basic/MemoryArena.h>
+#include <ogdf/basic/Stopwatch.h>
+
+using namespace ogdf;
+
+// Runs the planarization pipeline (SubgraphPlanarizer with FixedEmbeddingInserter)
+// on Rome graphs with and without arena scopes for the temporary data of the
+// edge insertion, and reports wall time and number of pool allocations.
+
+static size_t poolAllocations()
+{
+	size_t n = 0;
+	for(int sc = 0; sc < PoolMemoryAllocator::eNumSizeClasses; ++sc)
+		n += PoolMemoryAllocator::statistics(sc).m_allocations;
+	return n;
+}
+
+static int planarize(const Array<Graph*> &graphs, int rounds)
+{
+	SubgraphPlanarizer crossMin;
+	crossMin.permutations(4);
+	crossMin.maxThreads(1);
+	crossMin.setSubgraph(new FastPlanarSubgraph);
+	FixedEmbeddingInserter *inserter = new FixedEmbeddingInserter;
+	inserter->removeReinsert(rrAll);
+	crossMin.setInserter(inserter);
+
+	int crossings = 0;
+	for(int r = 0; r < rounds; ++r) {
+		for(const Graph *G : graphs) {
+			PlanRep PR(*G);
+			for(int i = 0; i < PR.numberOfCCs(); ++i) {
+				PR.initCC(i);
+				int cr;
+				crossMin.call(PR, i, cr);
+				crossings += cr;
+			}
+		}
+	}
+	return crossings;
+}
+
+int main(int argc, char **argv)
+{
+	int rounds = (argc > 1) ? atoi(argv[1]) : 20;
+
+	Array<string> files;
+	if(argc > 2) {
+		files.init(argc-2);
+		for(int i = 2; i < argc; ++i)
+			files[i-2] = argv[i];
+	} else {
+		files = {
+			"../../test/resources/rome/grafo3703.45.lgr.gml.pun",
+			"../../test/resources/rome/grafo5745.50.lgr.gml.pun"
+		};
+	}
+
+	Array<Graph*> graphs(files.size());
+	for(int i = 0; i < files.size(); ++i) {
+		graphs[i] = new Graph;
+		if(!GraphIO::read(*graphs[i], files[i])) {
+			cerr << "could not read " << files[i] << endl;
+			return 1;
+		}
+	}
+
+	cout << files.size() << " graph(s), " << rounds << " round(s)" << endl;
+
+	for(bool arenas : {false, true}) {
+		ArenaScope::setEnabled(arenas);
+		setSeed(42);
+
+		size_t allocs = poolAllocations();
+		StopwatchWallClock sw;
+		sw.start();
+		int crossings = planarize(graphs, rounds);
+		sw.stop();
+		allocs = poolAllocations() - allocs;
+
+		cout << (arenas ? "with arenas:    " : "without arenas: ")
+			<< sw.milliSeconds() << " ms, "
+			<< allocs << " pool allocations, "
+			<< crossings << " crossings" << endl;
+	}
+
+	for(Graph *G : graphs)
+		delete G;
+
+	return 0;
+}
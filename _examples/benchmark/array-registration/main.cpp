@@ -0,0 +1,47 @@
+#include <ogdf/basic/graph_generators.h>
+#include <ogdf/basic/Stopwatch.h>
+#include <thread>
+#include <vector>
+
+using namespace ogdf;
+
+// Measures the throughput of creating and destroying temporary node and edge
+// arrays on a shared graph from several threads at once; this stresses the
+// array registration of Graph.
+
+static void worker(const Graph &G, int rounds)
+{
+	for(int i = 0; i < rounds; i++) {
+		NodeArray<int> a(G, 0);
+		EdgeArray<int> b(G, 0);
+		NodeArray<int> c(std::move(a));
+	}
+}
+
+int main(int argc, char **argv)
+{
+	int rounds = (argc > 1) ? atoi(argv[1]) : 200000;
+	int maxThreads = (argc > 2) ? atoi(argv[2]) : std::max(1u, std::thread::hardware_concurrency());
+
+	// keep the graph small, so the time is dominated by the registration
+	Graph G;
+	randomGraph(G, 16, 32);
+
+	cout << "rounds per thread = " << rounds << endl;
+
+	for(int t = 1; t <= maxThreads; t *= 2) {
+		StopwatchWallClock sw;
+		sw.start();
+
+		std::vector<std::thread> threads;
+		for(int i = 0; i < t; i++)
+			threads.push_back(std::thread(worker, std::cref(G), rounds));
+		for(std::thread &th : threads)
+			th.join();
+
+		sw.stop();
+		cout << t << " thread(s): " << sw.milliSeconds() << " ms" << endl;
+	}
+
+	return 0;
+}
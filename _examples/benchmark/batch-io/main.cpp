@@ -0,0 +1,67 @@
+#include <ogdf/fileformats/GraphIO.h>
+#include <ogdf/basic/graph_generators.h>
+#include <ogdf/basic/Stopwatch.h>
+#include <ogdf/basic/Thread.h>
+
+using namespace ogdf;
+
+// Reads and writes a corpus of small graphs (similar to the Rome graphs) with
+// GraphIO::readBatch() and GraphIO::writeBatch() using an increasing number of
+// threads, and reports the speedup over a single thread.
+
+int main(int argc, char **argv)
+{
+	int numFiles = (argc > 1) ? atoi(argv[1]) : 5000;
+	unsigned int maxThreads = (argc > 2) ? atoi(argv[2]) : max(1u, Thread::hardware_concurrency());
+
+	setSeed(42);
+	Array<string> filenames(numFiles);
+	Array<Graph> graphs(numFiles);
+	Array<GraphAttributes> attrs(numFiles);
+	for(int i = 0; i < numFiles; ++i) {
+		filenames[i] = "batch-io-" + to_string(i) + ".gml";
+		int n = randomNumber(10, 100);
+		randomGraph(graphs[i], n, randomNumber(n, 2*n));
+		attrs[i].init(graphs[i], GraphAttributes::nodeGraphics | GraphAttributes::edgeGraphics | GraphAttributes::nodeLabel);
+		for(node v : graphs[i].nodes) {
+			attrs[i].x(v) = randomDouble(0, 1000);
+			attrs[i].y(v) = randomDouble(0, 1000);
+			attrs[i].label(v) = to_string(v->index());
+		}
+	}
+
+	cout << numFiles << " files" << endl;
+
+	double writeTime1 = 0, readTime1 = 0;
+	for(unsigned int threads = 1; threads <= maxThreads; threads *= 2) {
+		Array<GraphIO::BatchResult> results;
+		StopwatchWallClock sw;
+
+		sw.start();
+		int written = GraphIO::writeBatch(filenames, attrs, results, GraphIO::writeGML, threads);
+		sw.stop();
+		double writeTime = double(sw.milliSeconds());
+
+		Array<Graph> graphsRead;
+		Array<GraphAttributes> attrsRead;
+		sw.start(true);
+		int read = GraphIO::readBatch(filenames, attrs[0].attributes(), graphsRead, attrsRead, results, GraphIO::readGML, threads);
+		sw.stop();
+		double readTime = double(sw.milliSeconds());
+
+		if(threads == 1) {
+			writeTime1 = writeTime;
+			readTime1 = readTime;
+		}
+
+		cout << threads << " threads: write " << writeTime << " ms (speedup " << writeTime1 / writeTime
+			<< "), read " << readTime << " ms (speedup " << readTime1 / readTime << ")"
+			<< (written == numFiles && read == numFiles ? "" : " (failed)") << endl;
+	}
+
+	for(const string &filename : filenames) {
+		std::remove(filename.c_str());
+	}
+
+	return 0;
+}
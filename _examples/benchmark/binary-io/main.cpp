@@ -0,0 +1,68 @@
+#include <ogdf/fileformats/GraphIO.h>
+#include <ogdf/basic/graph_generators.h>
+#include <ogdf/basic/Stopwatch.h>
+#include <fstream>
+
+using namespace ogdf;
+
+// Compares loading a large graph with coordinates and edge weights from GML,
+// GraphML and the binary format, and reports load time and file size.
+
+static long fileSize(const string &filename)
+{
+	std::ifstream is(filename, std::ios::binary | std::ios::ate);
+	return long(is.tellg());
+}
+
+int main(int argc, char **argv)
+{
+	int n = (argc > 1) ? atoi(argv[1]) : 200000;
+	int m = (argc > 2) ? atoi(argv[2]) : 4*n;
+
+	setSeed(42);
+	Graph G;
+	randomGraph(G, n, m);
+	GraphAttributes GA(G, GraphAttributes::nodeGraphics | GraphAttributes::edgeGraphics | GraphAttributes::edgeDoubleWeight);
+	for(node v : G.nodes) {
+		GA.x(v) = randomDouble(0, 1000);
+		GA.y(v) = randomDouble(0, 1000);
+	}
+	for(edge e : G.edges)
+		GA.doubleWeight(e) = randomDouble(1, 10);
+
+	cout << "n = " << n << ", m = " << m << endl;
+
+	struct Format {
+		const char *name;
+		const char *filename;
+		bool (*write)(const GraphAttributes&, const string&);
+		bool (*read)(GraphAttributes&, Graph&, const string&);
+	};
+	const Format formats[] = {
+		{ "GML",     "binary-io.gml",     GraphIO::writeGML,     GraphIO::readGML },
+		{ "GraphML", "binary-io.graphml", GraphIO::writeGraphML, GraphIO::readGraphML },
+		{ "binary",  "binary-io.ogdfbin", GraphIO::writeBinary,  GraphIO::readBinary }
+	};
+
+	for(const Format &f : formats) {
+		if(!f.write(GA, f.filename)) {
+			cerr << "could not write " << f.filename << endl;
+			return 1;
+		}
+
+		Graph H;
+		GraphAttributes HA(H, GA.attributes());
+		StopwatchWallClock sw;
+		sw.start();
+		bool ok = f.read(HA, H, f.filename);
+		sw.stop();
+
+		cout << f.name << ": " << sw.milliSeconds() << " ms, "
+			<< fileSize(f.filename) / 1024 << " KiB"
+			<< (ok && H.numberOfEdges() == m ? "" : " (read failed)") << endl;
+
+		std::remove(f.filename);
+	}
+
+	return 0;
+}
@@ -0,0 +1,64 @@
+#include <ogdf/packing/ComponentSplitterLayout.h>
+#include <ogdf/energybased/FMMMLayout.h>
+#include <ogdf/basic/graph_generators.h>
+#include <ogdf/basic/simple_graph_alg.h>
+#include <ogdf/basic/Stopwatch.h>
+#include <ogdf/basic/TaskScheduler.h>
+
+using namespace ogdf;
+
+// Measures ComponentSplitterLayout with FMMMLayout on a graph with many
+// connected components of very different sizes, sequentially and with
+// parallel component layouts on an increasing number of threads.
+
+// Adds a random connected simple graph with n nodes and m edges to G.
+static void addComponent(Graph &G, int n, int m)
+{
+	Graph H;
+	randomSimpleGraph(H, n, min(m, n * (n - 1) / 2));
+	makeConnected(H);
+
+	NodeArray<node> copy(H);
+	for(node v : H.nodes)
+		copy[v] = G.newNode();
+	for(edge e : H.edges)
+		G.newEdge(copy[e->source()], copy[e->target()]);
+}
+
+int main(int argc, char **argv)
+{
+	int numComponents = (argc > 1) ? atoi(argv[1]) : 2000;
+	unsigned int maxThreads = (argc > 2) ? atoi(argv[2]) : TaskScheduler::global().concurrency();
+
+	// a few large components and many small ones (sizes roughly follow a power law)
+	Graph G;
+	for(int i = 1; i <= numComponents; ++i) {
+		int n = max(2, 20000 / (i * i) + randomNumber(2, 12));
+		addComponent(G, n, 2 * n);
+	}
+	cout << "n = " << G.numberOfNodes() << ", m = " << G.numberOfEdges()
+	     << ", " << numComponents << " components" << endl;
+
+	auto measure = [&](ComponentSplitterLayout &csl) {
+		GraphAttributes GA(G);
+		StopwatchWallClock sw;
+		sw.start();
+		csl.call(GA);
+		sw.stop();
+		return sw.milliSeconds();
+	};
+
+	ComponentSplitterLayout sequential;
+	sequential.setLayoutModule(new FMMMLayout);
+	cout << "  sequential:  " << measure(sequential) << " ms" << endl;
+
+	// one thread means sequential layout, so the parallel runs start at two threads
+	for(unsigned int numThreads = 2; numThreads <= max(2u, maxThreads); numThreads *= 2) {
+		ComponentSplitterLayout parallel;
+		parallel.setLayoutModuleFactory([] { return new FMMMLayout; });
+		parallel.setNumberOfThreads(numThreads);
+		cout << "  " << numThreads << " threads:   " << measure(parallel) << " ms" << endl;
+	}
+
+	return 0;
+}
@@ -0,0 +1,55 @@
+#include <ogdf/energybased/FastMultipoleEmbedder.h>
+#include <ogdf/basic/graph_generators.h>
+#include <ogdf/basic/simple_graph_alg.h>
+#include <ogdf/basic/Stopwatch.h>
+
+using namespace ogdf;
+
+// Measures FastMultipoleEmbedder on random graphs of growing size for
+// several multipole precisions and reports the times of its phases. The
+// expansion kernels are chosen by the instruction sets of the CPU.
+
+int main(int argc, char **argv)
+{
+	int maxNodes = (argc > 1) ? atoi(argv[1]) : 32000;
+	int iterations = (argc > 2) ? atoi(argv[2]) : 100;
+
+	cout << "AVX2: " << (System::cpuSupports(cpufAVX2) && System::cpuSupports(cpufFMA) ? "yes" : "no")
+	     << ", AVX-512F: " << (System::cpuSupports(cpufAVX512F) ? "yes" : "no")
+	     << ", " << iterations << " iterations" << endl;
+
+	for(int n = 4000; n <= maxNodes; n *= 2) {
+		Graph G;
+		randomSimpleGraph(G, n, 2 * n);
+		makeConnected(G);
+		cout << "n = " << G.numberOfNodes() << ", m = " << G.numberOfEdges() << endl;
+
+		for(uint32_t precision = 4; precision <= 8; precision += 2) {
+			GraphAttributes GA(G);
+			int i = 0;
+			for(node v : G.nodes) {
+				GA.x(v) = (i * 37) % 1009;
+				GA.y(v) = (i * 53) % 997;
+				++i;
+			}
+
+			FastMultipoleEmbedder fme;
+			fme.setNumIterations(iterations);
+			fme.setMultipolePrec(precision);
+			fme.setRandomize(false);
+			fme.setNumberOfThreads(1);
+			StopwatchWallClock sw;
+			sw.start();
+			fme.call(GA);
+			sw.stop();
+
+			const FMEPhaseTimes &times = fme.phaseTimes();
+			cout << "  precision " << precision << ": " << sw.milliSeconds() << " ms"
+			     << " (per iteration: build " << 1000.0 * times.build / times.numIterations
+			     << " ms, expansion " << 1000.0 * times.expansion / times.numIterations
+			     << " ms, force " << 1000.0 * times.force / times.numIterations << " ms)" << endl;
+		}
+	}
+
+	return 0;
+}
@@ -0,0 +1,54 @@
+#include <ogdf/energybased/SpringEmbedderFRExact.h>
+#include <ogdf/basic/graph_generators.h>
+#include <ogdf/basic/simple_graph_alg.h>
+#include <ogdf/basic/Stopwatch.h>
+#include <ogdf/basic/Thread.h>
+
+using namespace ogdf;
+
+// Measures SpringEmbedderFRExact on random graphs of growing size for an
+// increasing number of threads, in double and in single precision.
+
+int main(int argc, char **argv)
+{
+	int maxNodes = (argc > 1) ? atoi(argv[1]) : 50000;
+	int iterations = (argc > 2) ? atoi(argv[2]) : 10;
+	unsigned int maxThreads = (argc > 3) ? atoi(argv[3]) : max(1u, Thread::hardware_concurrency());
+
+	cout << "AVX: " << (System::cpuSupports(cpufAVX) ? "yes" : "no")
+	     << ", " << iterations << " iterations" << endl;
+
+	for(int n = 5000; n <= maxNodes; n *= 2) {
+		Graph G;
+		randomSimpleGraph(G, n, 2 * n);
+		makeConnected(G);
+		cout << "n = " << G.numberOfNodes() << ", m = " << G.numberOfEdges() << endl;
+
+		for(int single = 0; single <= 1; ++single) {
+			for(unsigned int numThreads = 1; numThreads <= maxThreads; numThreads *= 2) {
+				GraphAttributes GA(G);
+				int i = 0;
+				for(node v : G.nodes) {
+					GA.x(v) = (i * 37) % 1009;
+					GA.y(v) = (i * 53) % 997;
+					++i;
+				}
+
+				SpringEmbedderFRExact fr;
+				fr.iterations(iterations);
+				fr.checkConvergence(false);
+				fr.numberOfThreads(numThreads);
+				fr.singlePrecision(single != 0);
+				StopwatchWallClock sw;
+				sw.start();
+				fr.call(GA);
+				sw.stop();
+
+				cout << "  " << (single ? "float,  " : "double, ") << numThreads << " threads: "
+				     << sw.milliSeconds() << " ms" << endl;
+			}
+		}
+	}
+
+	return 0;
+}
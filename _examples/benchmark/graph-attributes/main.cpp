@@ -0,0 +1,80 @@
+#include <ogdf/basic/GraphAttributes.h>
+#include <ogdf/basic/graph_generators.h>
+#include <ogdf/basic/Stopwatch.h>
+#include <malloc.h>
+
+using namespace ogdf;
+
+// Measures the memory used by GraphAttributes for a large graph of which only
+// the node positions and sizes are set, and the time of a pass over the node
+// coordinates. Memory is measured as the heap memory in use (glibc only).
+
+static double heapMiB()
+{
+	struct mallinfo2 info = mallinfo2();
+	return double(info.uordblks + info.hblkhd) / (1024 * 1024);
+}
+
+static void setGeometry(GraphAttributes &GA)
+{
+	for(GraphAttributes::NodeGeometry &g : GA.geometry()) {
+		g.m_x = randomDouble(0, 1000);
+		g.m_y = randomDouble(0, 1000);
+	}
+}
+
+static void report(const char *name, double before, GraphAttributes &GA)
+{
+	StopwatchCPU sw;
+	sw.start();
+	for(int i = 0; i < 10; ++i) {
+		GA.translateToNonNeg();
+		GA.scale(0.5, 0.5, true);
+	}
+	sw.stop();
+
+	cout << name << ": " << heapMiB() - before << " MiB, coordinate passes " << sw.milliSeconds() << " ms" << endl;
+}
+
+int main(int argc, char **argv)
+{
+	int n = (argc > 1) ? atoi(argv[1]) : 1000000;
+	int m = (argc > 2) ? atoi(argv[2]) : n;
+	const long drawing = GraphAttributes::nodeGraphics | GraphAttributes::edgeGraphics
+		| GraphAttributes::nodeStyle | GraphAttributes::edgeStyle
+		| GraphAttributes::nodeLabel | GraphAttributes::edgeLabel | GraphAttributes::nodeTemplate;
+
+	setSeed(42);
+	Graph G;
+	randomGraph(G, n, m);
+	cout << n << " nodes, " << m << " edges" << endl;
+
+	double before = heapMiB();
+	{
+		GraphAttributes GA(G, GraphAttributes::nodeGraphics);
+		setGeometry(GA);
+		report("nodeGraphics", before, GA);
+	}
+	{
+		// all drawing attributes enabled, but only the geometry is written
+		GraphAttributes GA(G, drawing);
+		setGeometry(GA);
+		report("all drawing attributes, geometry written", before, GA);
+
+		// writing one label, style and bend allocates these arrays completely,
+		// which is what all drawing attributes used to cost
+		node v = G.firstNode();
+		edge e = G.firstEdge();
+		GA.strokeWidth(v) = 2;
+		GA.fillColor(v) = Color::Name::Red;
+		GA.label(v) = GA.templateNode(v) = "v";
+		if(e != nullptr) {
+			GA.strokeWidth(e) = 2;
+			GA.label(e) = "e";
+			GA.bends(e).pushBack(DPoint(0, 0));
+		}
+		report("all drawing attributes, all written", before, GA);
+	}
+
+	return 0;
+}
@@ -0,0 +1,62 @@
+#include <ogdf/basic/graph_generators.h>
+#include <ogdf/basic/Stopwatch.h>
+#include <random>
+
+using namespace ogdf;
+
+// Compares building a graph edge by edge (as graph_generators.cpp used to do)
+// with the bulk construction API of Graph.
+
+static void incrementalBuild(Graph &G, int n, const Array<std::pair<int,int>> &edgeList)
+{
+	Array<node> v(n);
+	for(int i = 0; i < n; i++)
+		v[i] = G.newNode();
+
+	for(const std::pair<int,int> &p : edgeList)
+		G.newEdge(v[p.first], v[p.second]);
+}
+
+int main(int argc, char **argv)
+{
+	int n = (argc > 1) ? atoi(argv[1]) : 1000000;
+	int m = (argc > 2) ? atoi(argv[2]) : 4*n;
+
+	std::minstd_rand rng(42);
+	std::uniform_int_distribution<> dist(0,n-1);
+	Array<std::pair<int,int>> edgeList(m);
+	for(int i = 0; i < m; i++) {
+		int v1 = dist(rng);
+		int v2 = dist(rng);
+		edgeList[i] = std::pair<int,int>(v1,v2);
+	}
+
+	cout << "n = " << n << ", m = " << m << endl;
+
+	for(int round = 0; round < 3; ++round) {
+		{
+			Graph G;
+			NodeArray<double> x(G), y(G);
+			EdgeArray<int> weight(G);
+
+			StopwatchWallClock sw;
+			sw.start();
+			incrementalBuild(G, n, edgeList);
+			sw.stop();
+			cout << "incremental:        " << sw.milliSeconds() << " ms" << endl;
+		}
+		{
+			Graph G;
+			NodeArray<double> x(G), y(G);
+			EdgeArray<int> weight(G);
+
+			StopwatchWallClock sw;
+			sw.start();
+			G.buildFromEdgeList(n, edgeList);
+			sw.stop();
+			cout << "buildFromEdgeList:  " << sw.milliSeconds() << " ms" << endl;
+		}
+	}
+
+	return 0;
+}
@@ -0,0 +1,78 @@
+#include <ogdf/energybased/SpringEmbedderGridVariant.h>
+#include <ogdf/basic/graph_generators.h>
+#include <ogdf/basic/simple_graph_alg.h>
+#include <ogdf/basic/Stopwatch.h>
+#include <ogdf/basic/TaskScheduler.h>
+#include <random>
+
+using namespace ogdf;
+
+// Measures SpringEmbedderGridVariant on clustered graphs for an increasing
+// number of threads. The initial drawing places each cluster into a disc
+// whose radius grows with the fourth root of its size, so the grid cells of
+// large clusters contain many more nodes than the others. The nodes of a cluster are consecutive in the node list, hence a
+// split of the nodes into contiguous ranges of equal size leaves most of the
+// repulsion work to a few threads.
+
+int main(int argc, char **argv)
+{
+	int numClusters = (argc > 1) ? atoi(argv[1]) : 200;
+	int iterations = (argc > 2) ? atoi(argv[2]) : 100;
+	unsigned int maxThreads = (argc > 3) ? atoi(argv[3]) : TaskScheduler::global().concurrency();
+
+	std::mt19937 rng(42);
+	std::normal_distribution<double> offset(0.0, 1.0);
+	std::uniform_real_distribution<double> center(0.0, 5000.0);
+
+	// cluster sizes roughly follow a power law, all clusters in one connected component
+	Graph G;
+	ArrayBuffer<DPoint> positions;
+	node previous = nullptr;
+	for(int i = 1; i <= numClusters; ++i) {
+		int n = max(10, 20000 / (i * i) + randomNumber(10, 50));
+		double radius = 20 * pow(n, 0.25);
+
+		Graph H;
+		randomSimpleGraph(H, n, 2 * n);
+		makeConnected(H);
+
+		NodeArray<node> copy(H);
+		DPoint c(center(rng), center(rng));
+		for(node v : H.nodes) {
+			copy[v] = G.newNode();
+			positions.push(c + DPoint(radius * offset(rng), radius * offset(rng)));
+		}
+		for(edge e : H.edges)
+			G.newEdge(copy[e->source()], copy[e->target()]);
+
+		if(previous != nullptr)
+			G.newEdge(previous, copy[H.firstNode()]);
+		previous = copy[H.lastNode()];
+	}
+	cout << "n = " << G.numberOfNodes() << ", m = " << G.numberOfEdges()
+	     << ", " << numClusters << " clusters, " << iterations << " iterations" << endl;
+
+	for(unsigned int numThreads = 1; numThreads <= maxThreads; numThreads *= 2) {
+		GraphAttributes GA(G);
+		int i = 0;
+		for(node v : G.nodes) {
+			GA.x(v) = positions[i].m_x;
+			GA.y(v) = positions[i].m_y;
+			++i;
+		}
+
+		SpringEmbedderGridVariant sem;
+		sem.scaling(SpringEmbedderGridVariant::Scaling::input);
+		sem.iterations(iterations);
+		sem.iterationsImprove(iterations / 2);
+		sem.maxThreads(numThreads);
+		StopwatchWallClock sw;
+		sw.start();
+		sem.call(GA);
+		sw.stop();
+
+		cout << "  " << numThreads << " threads: " << sw.milliSeconds() << " ms" << endl;
+	}
+
+	return 0;
+}
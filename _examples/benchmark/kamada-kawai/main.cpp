@@ -0,0 +1,52 @@
+#include <ogdf/energybased/SpringEmbedderKK.h>
+#include <ogdf/basic/graph_generators.h>
+#include <ogdf/basic/Stopwatch.h>
+#include <ogdf/basic/Thread.h>
+
+using namespace ogdf;
+
+// Measures SpringEmbedderKK on grids of growing size for an increasing
+// number of threads and checks that the layouts do not depend on it.
+
+int main(int argc, char **argv)
+{
+	int maxSide = (argc > 1) ? atoi(argv[1]) : 48;
+	unsigned int maxThreads = (argc > 2) ? atoi(argv[2]) : max(1u, Thread::hardware_concurrency());
+
+	for(int side = 16; side <= maxSide; side *= 2) {
+		Graph G;
+		gridGraph(G, side, side, false, false);
+		cout << "n = " << G.numberOfNodes() << ", m = " << G.numberOfEdges() << endl;
+
+		GraphAttributes first(G);
+		for(unsigned int numThreads = 1; numThreads <= maxThreads; numThreads *= 2) {
+			GraphAttributes GA(G);
+			int i = 0;
+			for(node v : G.nodes) {
+				GA.x(v) = (i * 37) % 101;
+				GA.y(v) = (i * 53) % 97;
+				++i;
+			}
+
+			SpringEmbedderKK kk;
+			kk.setNumberOfThreads(numThreads);
+			StopwatchWallClock sw;
+			sw.start();
+			kk.call(GA);
+			sw.stop();
+
+			bool same = true;
+			if(numThreads == 1) {
+				first = GA;
+			} else {
+				for(node v : G.nodes) {
+					same &= GA.x(v) == first.x(v) && GA.y(v) == first.y(v);
+				}
+			}
+			cout << "  " << numThreads << " threads: " << sw.milliSeconds() << " ms"
+			     << (same ? "" : " (layout differs)") << endl;
+		}
+	}
+
+	return 0;
+}
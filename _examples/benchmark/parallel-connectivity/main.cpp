@@ -0,0 +1,67 @@
+#include <ogdf/basic/CSRGraph.h>
+#include <ogdf/basic/simple_graph_alg.h>
+#include <ogdf/basic/graph_generators.h>
+#include <ogdf/basic/Stopwatch.h>
+#include <ogdf/basic/Thread.h>
+
+using namespace ogdf;
+
+// Compares the sequential connectivity tests and topological sorting on
+// CSRGraph with their multithreaded variants on a large sparse graph.
+
+static void report(const char *name, unsigned int numThreads, const StopwatchWallClock &sw)
+{
+	cout << name << " (" << numThreads << " threads): " << sw.milliSeconds() << " ms" << endl;
+}
+
+int main(int argc, char **argv)
+{
+	int n = (argc > 1) ? atoi(argv[1]) : 1000000;
+	int m = (argc > 2) ? atoi(argv[2]) : 3*n;
+	unsigned int maxThreads = (argc > 3) ? atoi(argv[3]) : max(1u, Thread::hardware_concurrency());
+
+	Graph G;
+	randomGraph(G, n, m);
+	cout << "n = " << G.numberOfNodes() << ", m = " << G.numberOfEdges() << endl;
+
+	// orient the edges by node index (makeAcyclicByReverse recurses too deep here)
+	Graph D(G);
+	makeLoopFree(D);
+	for(edge e : D.edges) {
+		if(e->source()->index() > e->target()->index()) {
+			D.reverseEdge(e);
+		}
+	}
+
+	CSRGraph C(G), CD(D);
+	NodeArray<int> comp(G), num(D);
+	EdgeArray<int> bicomp(G);
+
+	for(unsigned int numThreads = 1; numThreads <= maxThreads; numThreads *= 2) {
+		StopwatchWallClock sw;
+
+		sw.start();
+		int numComp = connectedComponents(C, comp, numThreads);
+		sw.stop();
+		report("connectedComponents  ", numThreads, sw);
+
+		sw.start(true);
+		int numBicomp = biconnectedComponents(C, bicomp, numThreads);
+		sw.stop();
+		report("biconnectedComponents", numThreads, sw);
+
+		sw.start(true);
+		bool acyclic = isAcyclic(CD, numThreads);
+		sw.stop();
+		report("isAcyclic            ", numThreads, sw);
+
+		sw.start(true);
+		topologicalNumbering(CD, num, numThreads);
+		sw.stop();
+		report("topologicalNumbering ", numThreads, sw);
+
+		cout << "  " << numComp << " components, " << numBicomp << " blocks, acyclic: " << acyclic << endl;
+	}
+
+	return 0;
+}
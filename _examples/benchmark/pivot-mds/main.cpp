@@ -0,0 +1,42 @@
+#include <ogdf/energybased/PivotMDS.h>
+#include <ogdf/basic/graph_generators.h>
+#include <ogdf/basic/simple_graph_alg.h>
+#include <ogdf/basic/Stopwatch.h>
+#include <ogdf/basic/Thread.h>
+
+using namespace ogdf;
+
+// Measures PivotMDS on random graphs of growing size for an increasing
+// number of threads, with the pivot matrix in double and in single precision.
+
+int main(int argc, char **argv)
+{
+	int maxNodes = (argc > 1) ? atoi(argv[1]) : 160000;
+	unsigned int maxThreads = (argc > 2) ? atoi(argv[2]) : max(1u, Thread::hardware_concurrency());
+
+	for(int n = 10000; n <= maxNodes; n *= 4) {
+		Graph G;
+		randomGraph(G, n, 2 * n);
+		makeSimpleUndirected(G);
+		makeConnected(G);
+		cout << "n = " << G.numberOfNodes() << ", m = " << G.numberOfEdges() << endl;
+
+		for(int single = 0; single <= 1; ++single) {
+			for(unsigned int numThreads = 1; numThreads <= maxThreads; numThreads *= 2) {
+				GraphAttributes GA(G);
+				PivotMDS pivotMDS;
+				pivotMDS.setNumberOfThreads(numThreads);
+				pivotMDS.useSinglePrecision(single != 0);
+				StopwatchWallClock sw;
+				sw.start();
+				pivotMDS.call(GA);
+				sw.stop();
+
+				cout << "  " << (single ? "float,  " : "double, ") << numThreads << " threads: "
+				     << sw.milliSeconds() << " ms" << endl;
+			}
+		}
+	}
+
+	return 0;
+}
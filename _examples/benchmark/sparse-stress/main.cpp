@@ -0,0 +1,82 @@
+#include <ogdf/energybased/StressMinimization.h>
+#include <ogdf/basic/graph_generators.h>
+#include <ogdf/basic/simple_graph_alg.h>
+#include <ogdf/basic/Stopwatch.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+using namespace ogdf;
+
+// Measures time and peak memory of stress minimization with the full and the
+// sparse stress model on connected random graphs with 1k to 1M nodes, using a
+// fixed number of iterations. Every run happens in a child process so that the
+// peak resident set size (Linux only) is attributed to a single call.
+
+static double residentMiB()
+{
+	long pages = 0, resident = 0;
+	FILE *f = fopen("/proc/self/statm", "r");
+	if(f) {
+		if(fscanf(f, "%ld %ld", &pages, &resident) != 2) {
+			resident = 0;
+		}
+		fclose(f);
+	}
+	return double(resident) * sysconf(_SC_PAGESIZE) / (1024 * 1024);
+}
+
+static double peakMiB()
+{
+	struct rusage usage;
+	getrusage(RUSAGE_SELF, &usage);
+	return double(usage.ru_maxrss) / 1024;
+}
+
+static void run(int n, bool sparse, int iterations)
+{
+	setSeed(n);
+	Graph G;
+	randomGraph(G, n, 2*n);
+	makeConnected(G);
+	GraphAttributes GA(G);
+
+	StressMinimization sm;
+	sm.useSparseStress(sparse);
+	sm.setIterations(iterations);
+
+	double before = residentMiB();
+	StopwatchWallClock sw;
+	sw.start();
+	sm.call(GA);
+	sw.stop();
+
+	cout << (sparse ? "sparse" : "full  ") << " n = " << n << ": "
+	     << sw.milliSeconds() << " ms, " << max(0.0, peakMiB() - before) << " MiB" << endl;
+}
+
+int main(int argc, char **argv)
+{
+	int maxN = (argc > 1) ? atoi(argv[1]) : 1000000;
+	int maxFullN = (argc > 2) ? atoi(argv[2]) : 4000;
+	int iterations = (argc > 3) ? atoi(argv[3]) : 50;
+
+	for(int n = 1000; n <= maxN; n *= 4) {
+		for(int sparse = 0; sparse < 2; ++sparse) {
+			if(!sparse && n > maxFullN) {
+				continue;
+			}
+			cout.flush();
+			if(fork() == 0) {
+				run(n, sparse != 0, iterations);
+				return 0;
+			}
+			wait(nullptr);
+		}
+		if(n < maxN && 4*n > maxN) {
+			n = maxN / 4;
+		}
+	}
+
+	return 0;
+}
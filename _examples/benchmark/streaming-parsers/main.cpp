@@ -0,0 +1,118 @@
+#include <ogdf/fileformats/GraphIO.h>
+#include <ogdf/basic/graph_generators.h>
+#include <ogdf/basic/Stopwatch.h>
+#include <fstream>
+#include <functional>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+using namespace ogdf;
+
+// Compares the tree-based and the streaming GML and GraphML parsers on a large
+// attributed graph. Every file is read in a forked process so that the peak
+// resident set size reported by wait4() belongs to that single read.
+
+static long fileSize(const string &filename)
+{
+	std::ifstream is(filename, std::ios::binary | std::ios::ate);
+	return long(is.tellg());
+}
+
+struct Measurement {
+	bool ok;
+	double milliSeconds;
+	long maxRssKiB;
+};
+
+// Runs read() in a child process and measures its wall-clock time and peak memory.
+static Measurement measure(std::function<bool()> read)
+{
+	Measurement result = { false, 0, 0 };
+	StopwatchWallClock sw;
+	sw.start();
+
+	pid_t pid = fork();
+	if(pid == 0) {
+		_exit(read() ? 0 : 1);
+	}
+
+	int status;
+	struct rusage usage;
+	if(pid > 0 && wait4(pid, &status, 0, &usage) == pid) {
+		sw.stop();
+		result.ok = WIFEXITED(status) && WEXITSTATUS(status) == 0;
+		result.milliSeconds = double(sw.milliSeconds());
+		result.maxRssKiB = usage.ru_maxrss;
+	}
+	return result;
+}
+
+int main(int argc, char **argv)
+{
+	int n = (argc > 1) ? atoi(argv[1]) : 100000;
+	int m = (argc > 2) ? atoi(argv[2]) : 4*n;
+	const long attributes = GraphAttributes::nodeGraphics | GraphAttributes::edgeGraphics
+		| GraphAttributes::nodeLabel | GraphAttributes::edgeDoubleWeight;
+
+	struct Format {
+		const char *name;
+		const char *filename;
+		bool (*write)(const GraphAttributes&, const string&);
+		bool (*read)(GraphAttributes&, Graph&, const string&);
+	};
+	const Format formats[] = {
+		{ "GML",     "streaming-parsers.gml",     GraphIO::writeGML,     GraphIO::readGML },
+		{ "GraphML", "streaming-parsers.graphml", GraphIO::writeGraphML, GraphIO::readGraphML }
+	};
+
+	{
+		setSeed(42);
+		Graph G;
+		randomGraph(G, n, m);
+		GraphAttributes GA(G, attributes);
+		for(node v : G.nodes) {
+			GA.x(v) = randomDouble(0, 1000);
+			GA.y(v) = randomDouble(0, 1000);
+			GA.label(v) = "v" + to_string(v->index());
+		}
+		for(edge e : G.edges)
+			GA.doubleWeight(e) = randomDouble(1, 10);
+
+		for(const Format &f : formats) {
+			if(!f.write(GA, f.filename)) {
+				cerr << "could not write " << f.filename << endl;
+				return 1;
+			}
+		}
+	}
+
+	cout << "n = " << n << ", m = " << m << endl;
+
+	// the memory of a process that reads nothing
+	long baseline = measure([]() { return true; }).maxRssKiB;
+
+	for(const Format &f : formats) {
+		double megaBytes = fileSize(f.filename) / (1024.0 * 1024.0);
+		cout << f.name << " (" << long(megaBytes) << " MiB)" << endl;
+
+		for(bool streaming : { false, true }) {
+			Measurement r = measure([&]() {
+				GraphIO::setStreamingParsers(streaming);
+				Graph H;
+				GraphAttributes HA(H, attributes);
+				return f.read(HA, H, f.filename) && H.numberOfEdges() == m;
+			});
+
+			cout << "  " << (streaming ? "streaming: " : "tree:      ")
+				<< r.milliSeconds << " ms, "
+				<< megaBytes / (r.milliSeconds / 1000.0) << " MiB/s, "
+				<< (r.maxRssKiB - baseline) / 1024 << " MiB peak"
+				<< (r.ok ? "" : " (read failed)") << endl;
+		}
+
+		std::remove(f.filename);
+	}
+
+	return 0;
+}
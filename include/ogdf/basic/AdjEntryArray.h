@@ -46,11 +46,8 @@ namespace ogdf {
  * Use the parameterized class AdjEntryArray for creating adjacency arrays.
  */
 class AdjEntryArrayBase {
-	/**
-	 * Pointer to list element in the list of all registered adjacency
-	 * entry arrays which references this array.
-	 */
-	ListIterator<AdjEntryArrayBase*> m_it;
+	//! The registration of this array at the associated graph.
+	Graph::AdjEntryArrayHandle m_it;
 
 public:
 	const Graph *m_pGraph; //!< The associated graph.
@@ -67,7 +64,7 @@ public:
 	AdjEntryArrayBase(AdjEntryArrayBase &base) : m_it(base.m_it), m_pGraph(base.m_pGraph) {
 		if(m_pGraph) m_pGraph->moveRegisterArray(m_it, this);
 		base.m_pGraph = nullptr;
-		base.m_it     = ListIterator<AdjEntryArrayBase*>();
+		base.m_it     = Graph::AdjEntryArrayHandle();
 	}
 
 	// destructor, unregisters the array
@@ -97,7 +94,7 @@ public:
 		m_pGraph = base.m_pGraph;
 		m_it     = base.m_it;
 		base.m_pGraph = nullptr;
-		base.m_it     = ListIterator<AdjEntryArrayBase*>();
+		base.m_it     = Graph::AdjEntryArrayHandle();
 		if (m_pGraph != nullptr)
 			m_pGraph->moveRegisterArray(m_it, this);
 	}
@@ -37,6 +37,7 @@
 
 #include <ogdf/basic/comparer.h>
 #include <ogdf/basic/memory.h>
+#include <ogdf/basic/MemoryArena.h>
 #include <ogdf/basic/exceptions.h>
 #include <random>
 #include <type_traits>
@@ -74,18 +75,18 @@ public:
 	typedef E *iterator;
 
 	//! Creates an array with empty index set.
-	Array() { construct(0,-1); }
+	Array() : m_arena(MemoryArena::current()) { construct(0,-1); }
 
 	//! Creates an array with index set [0..\a s-1].
 	explicit Array(INDEX s) : Array(0, s - 1) { }
 
 	//! Creates an array with index set [\a a..\a b].
-	Array(INDEX a, INDEX b) {
+	Array(INDEX a, INDEX b) : m_arena(MemoryArena::current()) {
 		construct(a,b); initialize();
 	}
 
 	//! Creates an array with index set [\a a..\a b] and initializes each element with \a x.
-	Array(INDEX a, INDEX b, const E &x) {
+	Array(INDEX a, INDEX b, const E &x) : m_arena(MemoryArena::current()) {
 		construct(a,b); initialize(x);
 	}
 
@@ -93,13 +94,13 @@ public:
 	/**
 	 * The index set of the array is set to 0, ..., number of elements in \a initList - 1.
 	 */
-	Array(std::initializer_list<E> initList) {
+	Array(std::initializer_list<E> initList) : m_arena(MemoryArena::current()) {
 		construct(0, ((INDEX) initList.size()) - 1);
 		initialize(initList);
 	}
 
 	//! Creates an array that is a copy of \a A.
-	Array(const Array<E,INDEX> &A) {
+	Array(const Array<E,INDEX> &A) : m_arena(MemoryArena::current()) {
 		copy(A);
 	}
 
@@ -107,10 +108,8 @@ public:
 	/**
 	 * The array \a A is empty afterwards.
 	 */
-	Array(Array<E,INDEX> &&A)
-		: m_vpStart(A.m_vpStart), m_pStart(A.m_pStart), m_pStop(A.m_pStop), m_low(A.m_low), m_high(A.m_high)
-	{
-		A.construct(0,-1);
+	Array(Array<E,INDEX> &&A) : m_arena(MemoryArena::current()) {
+		moveFrom(A);
 	}
 
 	//! Creates an array that is a copy of \a A. The array-size is set to be the number of elements (not the capacity) of the buffer.
@@ -293,14 +292,7 @@ public:
 	 */
 	Array<E,INDEX> &operator=(Array<E,INDEX> &&A) {
 		deconstruct();
-
-		m_vpStart = A.m_vpStart;
-		m_pStart  = A.m_pStart;
-		m_pStop   = A.m_pStop;
-		m_low     = A.m_low;
-		m_high    = A.m_high;
-
-		A.construct(0,-1);
+		moveFrom(A);
 		return *this;
 	}
 
@@ -498,6 +490,44 @@ private:
 	E *m_pStop;   //!< Successor of last element (address of A[m_high+1]).
 	INDEX m_low;    //!< The lowest index.
 	INDEX m_high;   //!< The highest index.
+	MemoryArena *m_arena; //!< The arena the array is allocated from (nullptr if allocated with malloc()).
+
+	//! Allocates memory for \a s elements.
+	E *allocateStorage(INDEX s) {
+		void *p = (m_arena == nullptr) ? malloc(s*sizeof(E)) : m_arena->allocate(s*sizeof(E), alignof(E));
+		if (p == nullptr) OGDF_THROW(InsufficientMemoryException);
+		return static_cast<E *>(p);
+	}
+
+	//! Frees memory \a p allocated for \a s elements.
+	void releaseStorage(E *p, INDEX s) {
+		if (m_arena == nullptr)
+			free(p);
+		else
+			m_arena->deallocate(p, s*sizeof(E));
+	}
+
+	//! Takes over the elements of \a A, which is empty afterwards.
+	/**
+	 * The memory block of \a A is stolen if it belongs to the same arena;
+	 * otherwise the elements are moved into a new block.
+	 */
+	void moveFrom(Array<E,INDEX> &A) {
+		if (m_arena == A.m_arena) {
+			m_vpStart = A.m_vpStart;
+			m_pStart  = A.m_pStart;
+			m_pStop   = A.m_pStop;
+			m_low     = A.m_low;
+			m_high    = A.m_high;
+		} else {
+			construct(A.m_low, A.m_high);
+			internal::ArenaInheritance<E> inherit(m_arena);
+			for (E *pSrc = A.m_pStart, *pDest = m_pStart; pDest < m_pStop; ++pSrc, ++pDest)
+				new (pDest) E(std::move(*pSrc));
+			A.deconstruct();
+		}
+		A.construct(0,-1);
+	}
 
 	//! Allocates new array with index set [\a a..\a b].
 	void construct(INDEX a, INDEX b);
@@ -574,15 +604,17 @@ void Array<E, INDEX>::expandArray(INDEX add)
 #else
 		if (std::is_trivially_copyable<E>::value) {
 #endif
-			E *p = static_cast<E *>( realloc(m_pStart, sNew*sizeof(E)) );
+			E *p = (m_arena == nullptr)
+				? static_cast<E *>( realloc(m_pStart, sNew*sizeof(E)) )
+				: static_cast<E *>( m_arena->reallocate(m_pStart, sOld*sizeof(E), sNew*sizeof(E), alignof(E)) );
 			if (p == nullptr) OGDF_THROW(InsufficientMemoryException);
 			m_pStart = p;
 
 		// otherwise allocate new block, move elements, and free old block
 		} else {
-			E *p = static_cast<E *>( malloc(sNew*sizeof(E)) );
-			if (p == nullptr) OGDF_THROW(InsufficientMemoryException);
+			E *p = allocateStorage(sNew);
 
+			internal::ArenaInheritance<E> inherit(m_arena);
 			for (int i = 0; i < min(sOld,sNew); ++i) {
 				new (&p[i]) E(std::move(m_pStart[i]));
 			}
@@ -592,8 +624,7 @@ void Array<E, INDEX>::expandArray(INDEX add)
 		}
 
 	} else {
-		m_pStart = static_cast<E *>( malloc(sNew*sizeof(E)) );
-		if (m_pStart == nullptr) OGDF_THROW(InsufficientMemoryException);
+		m_pStart = allocateStorage(sNew);
 	}
 
 	m_vpStart = m_pStart - m_low;
@@ -611,6 +642,7 @@ void Array<E,INDEX>::grow(INDEX add, const E &x)
 	expandArray(add);
 
 	// initialize new array entries
+	internal::ArenaInheritance<E> inherit(m_arena);
 	for (E *pDest = m_pStart+sOld; pDest < m_pStop; pDest++)
 		new (pDest) E(x);
 }
@@ -625,6 +657,7 @@ void Array<E,INDEX>::grow(INDEX add)
 	expandArray(add);
 
 	// initialize new array entries
+	internal::ArenaInheritance<E> inherit(m_arena);
 	for (E *pDest = m_pStart+sOld; pDest < m_pStop; pDest++)
 		new (pDest) E;
 }
@@ -639,8 +672,7 @@ void Array<E,INDEX>::construct(INDEX a, INDEX b)
 		m_pStart = m_vpStart = m_pStop = nullptr;
 
 	} else {
-		m_pStart = static_cast<E *>( malloc(s*sizeof(E)) );
-		if (m_pStart == nullptr) OGDF_THROW(InsufficientMemoryException);
+		m_pStart = allocateStorage(s);
 
 		m_vpStart = m_pStart - a;
 		m_pStop = m_pStart + s;
@@ -651,6 +683,7 @@ void Array<E,INDEX>::construct(INDEX a, INDEX b)
 template<class E, class INDEX>
 void Array<E,INDEX>::initialize()
 {
+	internal::ArenaInheritance<E> inherit(m_arena);
 	E *pDest = m_pStart;
 	try {
 		for (; pDest < m_pStop; pDest++)
@@ -658,7 +691,7 @@ void Array<E,INDEX>::initialize()
 	} catch (...) {
 		while(--pDest >= m_pStart)
 			pDest->~E();
-		free(m_pStart);
+		releaseStorage(m_pStart, INDEX(m_pStop - m_pStart));
 		throw;
 	}
 }
@@ -667,6 +700,7 @@ void Array<E,INDEX>::initialize()
 template<class E, class INDEX>
 void Array<E,INDEX>::initialize(const E &x)
 {
+	internal::ArenaInheritance<E> inherit(m_arena);
 	E *pDest = m_pStart;
 	try {
 		for (; pDest < m_pStop; pDest++)
@@ -674,7 +708,7 @@ void Array<E,INDEX>::initialize(const E &x)
 	} catch (...) {
 		while(--pDest >= m_pStart)
 			pDest->~E();
-		free(m_pStart);
+		releaseStorage(m_pStart, INDEX(m_pStop - m_pStart));
 		throw;
 	}
 }
@@ -683,6 +717,7 @@ void Array<E,INDEX>::initialize(const E &x)
 template<class E, class INDEX>
 void Array<E, INDEX>::initialize(std::initializer_list<E> initList)
 {
+	internal::ArenaInheritance<E> inherit(m_arena);
 	E *pDest = m_pStart;
 	try {
 		for (const E &x : initList)
@@ -691,7 +726,7 @@ void Array<E, INDEX>::initialize(std::initializer_list<E> initList)
 	catch (...) {
 		while (--pDest >= m_pStart)
 			pDest->~E();
-		free(m_pStart);
+		releaseStorage(m_pStart, INDEX(m_pStop - m_pStart));
 		throw;
 	}
 }
@@ -704,7 +739,7 @@ void Array<E,INDEX>::deconstruct()
 		for (E *pDest = m_pStart; pDest < m_pStop; pDest++)
 			pDest->~E();
 	}
-	free(m_pStart);
+	releaseStorage(m_pStart, size());
 }
 
 
@@ -714,6 +749,7 @@ void Array<E,INDEX>::copy(const Array<E,INDEX> &array2)
 	construct(array2.m_low, array2.m_high);
 
 	if (m_pStart != nullptr) {
+		internal::ArenaInheritance<E> inherit(m_arena);
 		E *pSrc = array2.m_pStop;
 		E *pDest = m_pStop;
 		while(pDest > m_pStart)
@@ -795,7 +831,7 @@ void Array<E,INDEX>::leftShift(ArrayBuffer<INDEX, INDEX> &ind) {
 }
 
 template<class E, class INDEX>
-Array<E,INDEX>::Array(const ArrayBuffer<E, INDEX> &A) {
+Array<E,INDEX>::Array(const ArrayBuffer<E, INDEX> &A) : m_arena(MemoryArena::current()) {
 	construct(0,-1);
 	A.compactCopy(*this);
 }
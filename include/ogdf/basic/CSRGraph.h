@@ -0,0 +1,196 @@
+/** \file
+ * \brief Declaration of class CSRGraph, an immutable compressed-sparse-row snapshot of a Graph.
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.txt in the root directory of the OGDF installation for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ *
+ * \see  http://www.gnu.org/copyleft/gpl.html
+ ***************************************************************/
+
+#pragma once
+
+#include <ogdf/basic/NodeArray.h>
+#include <ogdf/basic/EdgeArray.h>
+
+
+namespace ogdf {
+
+//! Immutable compressed-sparse-row (CSR) snapshot of a Graph.
+/**
+ * @ingroup graphs
+ *
+ * A CSRGraph stores the topology of a Graph in a few contiguous integer
+ * arrays. Nodes and edges are numbered densely (0, ..., n-1 and 0, ..., m-1)
+ * in the order of the lists \c G.nodes and \c G.edges; the adjacency entries of
+ * node \a i are stored consecutively in the range
+ * [adjBegin(\a i) .. adjEnd(\a i)) in the order of the adjacency list of the
+ * corresponding node in \a G. Additionally, the outgoing edges of each node are
+ * kept in a separate range [outBegin(\a i) .. outEnd(\a i)).
+ *
+ * Traversal-heavy algorithms that do not modify the graph can iterate over these
+ * arrays instead of following the linked lists of NodeElement and AdjElement.
+ * Results can be mapped back to NodeArray and EdgeArray objects of the original
+ * graph with original() and originalEdge(), or via id().
+ *
+ * The snapshot does not observe the graph, i.e., it becomes invalid as soon as
+ * the original graph is modified. Call init() again in this case.
+ */
+class OGDF_EXPORT CSRGraph {
+
+	const Graph *m_pGraph; //!< The graph this snapshot was built from.
+
+	int m_numNodes; //!< The number of nodes.
+	int m_numEdges; //!< The number of edges.
+
+	Array<node> m_node; //!< Maps dense node ids to nodes in the original graph.
+	Array<edge> m_edge; //!< Maps dense edge ids to edges in the original graph.
+	Array<int> m_nodeId; //!< Maps node indices of the original graph to dense ids (-1 if unused).
+	Array<int> m_edgeId; //!< Maps edge indices of the original graph to dense ids (-1 if unused).
+
+	Array<int> m_source; //!< The source of each edge.
+	Array<int> m_target; //!< The target of each edge.
+
+	Array<int> m_adjStart; //!< Start of the adjacency range of each node (size n+1).
+	Array<int> m_adjNode;  //!< The opposite node of each adjacency entry.
+	Array<int> m_adjEdge;  //!< The edge of each adjacency entry.
+
+	Array<int> m_outStart; //!< Start of the range of outgoing edges of each node (size n+1).
+	Array<int> m_outNode;  //!< The target node of each outgoing edge entry.
+	Array<int> m_outEdge;  //!< The edge of each outgoing edge entry.
+
+public:
+	//! Creates an empty snapshot associated with no graph.
+	CSRGraph() : m_pGraph(nullptr), m_numNodes(0), m_numEdges(0) { }
+
+	//! Creates a snapshot of \a G.
+	explicit CSRGraph(const Graph &G) { init(G); }
+
+	//! Reinitializes the snapshot with graph \a G in time O(n + m).
+	void init(const Graph &G);
+
+	//! Returns the graph this snapshot was built from.
+	const Graph &constGraph() const { return *m_pGraph; }
+
+	//! Returns the number of nodes.
+	int numberOfNodes() const { return m_numNodes; }
+
+	//! Returns the number of edges.
+	int numberOfEdges() const { return m_numEdges; }
+
+	//! Returns true iff the snapshot contains no nodes.
+	bool empty() const { return m_numNodes == 0; }
+
+	/**
+	 * @name Mapping between the snapshot and the original graph
+	 */
+	//@{
+
+	//! Returns the node of the original graph with dense id \a i.
+	node original(int i) const { return m_node[i]; }
+
+	//! Returns the edge of the original graph with dense id \a e.
+	edge originalEdge(int e) const { return m_edge[e]; }
+
+	//! Returns the dense id of node \a v of the original graph.
+	int id(node v) const { return m_nodeId[v->index()]; }
+
+	//! Returns the dense id of edge \a e of the original graph.
+	int id(edge e) const { return m_edgeId[e->index()]; }
+
+	//@}
+	/**
+	 * @name Access to the topology
+	 */
+	//@{
+
+	//! Returns the dense id of the source of edge \a e.
+	int source(int e) const { return m_source[e]; }
+
+	//! Returns the dense id of the target of edge \a e.
+	int target(int e) const { return m_target[e]; }
+
+	//! Returns the degree of node \a i.
+	int degree(int i) const { return m_adjStart[i+1] - m_adjStart[i]; }
+
+	//! Returns the outdegree of node \a i.
+	int outdeg(int i) const { return m_outStart[i+1] - m_outStart[i]; }
+
+	//! Returns the indegree of node \a i.
+	int indeg(int i) const { return degree(i) - outdeg(i); }
+
+	//! Returns the position of the first adjacency entry of node \a i.
+	int adjBegin(int i) const { return m_adjStart[i]; }
+
+	//! Returns the position following the last adjacency entry of node \a i.
+	int adjEnd(int i) const { return m_adjStart[i+1]; }
+
+	//! Returns the opposite node of the adjacency entry at position \a a.
+	int adjNode(int a) const { return m_adjNode[a]; }
+
+	//! Returns the edge of the adjacency entry at position \a a.
+	int adjEdge(int a) const { return m_adjEdge[a]; }
+
+	//! Returns the position of the first outgoing edge entry of node \a i.
+	int outBegin(int i) const { return m_outStart[i]; }
+
+	//! Returns the position following the last outgoing edge entry of node \a i.
+	int outEnd(int i) const { return m_outStart[i+1]; }
+
+	//! Returns the target node of the outgoing edge entry at position \a a.
+	int outNode(int a) const { return m_outNode[a]; }
+
+	//! Returns the edge of the outgoing edge entry at position \a a.
+	int outEdge(int a) const { return m_outEdge[a]; }
+
+	//@}
+	/**
+	 * @name Raw array access
+	 * The arrays returned by these methods are contiguous and may be used
+	 * directly in tight loops.
+	 */
+	//@{
+
+	//! Returns the adjacency start array (size n+1).
+	const int *adjStart() const { return m_adjStart.begin(); }
+
+	//! Returns the opposite node array of all adjacency entries (size 2m).
+	const int *adjNodes() const { return m_adjNode.begin(); }
+
+	//! Returns the edge array of all adjacency entries (size 2m).
+	const int *adjEdges() const { return m_adjEdge.begin(); }
+
+	//! Returns the start array of the outgoing edge entries (size n+1).
+	const int *outStart() const { return m_outStart.begin(); }
+
+	//! Returns the target node array of all outgoing edge entries (size m).
+	const int *outNodes() const { return m_outNode.begin(); }
+
+	//@}
+
+	OGDF_NEW_DELETE
+};
+
+} // end namespace ogdf
@@ -0,0 +1,120 @@
+/** \file
+ * \brief Declaration and implementation of ConcurrentDisjointSets, a lock-free Union/Find data structure.
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.txt in the root directory of the OGDF installation for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ *
+ * \see  http://www.gnu.org/copyleft/gpl.html
+ ***************************************************************/
+
+#pragma once
+
+#include <ogdf/basic/Array.h>
+#include <atomic>
+
+
+namespace ogdf {
+
+//! A lock-free Union/Find data structure that may be used by several threads concurrently.
+/**
+ * @ingroup threads
+ *
+ * The elements are 0, ..., \a n-1 and initially form singleton sets. In contrast
+ * to DisjointSets, the sets are fixed at construction time, and find() and
+ * quickUnion() may be called concurrently without locking.
+ *
+ * Sets are linked by index, i.e., the representative of a set is always its
+ * smallest element; find() uses path halving. Both operations rely on
+ * compare-and-swap only.
+ */
+class ConcurrentDisjointSets
+{
+	Array<std::atomic<int>> m_parent; //!< Maps an element to its parent.
+
+public:
+	//! Creates \a n singleton sets {0}, ..., {\a n-1}.
+	explicit ConcurrentDisjointSets(int n = 0) : m_parent(n) {
+		for (int i = 0; i < n; ++i) {
+			m_parent[i].store(i, std::memory_order_relaxed);
+		}
+	}
+
+	//! Returns the number of elements.
+	int size() const { return m_parent.size(); }
+
+	//! Returns the representative (the smallest element) of the set containing \a i.
+	int find(int i) {
+		int p = m_parent[i].load(std::memory_order_relaxed);
+		while (p != i) {
+			int gp = m_parent[p].load(std::memory_order_relaxed);
+			if (gp != p) {
+				// path halving; a failed exchange only means someone else shortened the path
+				m_parent[i].compare_exchange_weak(p, gp, std::memory_order_relaxed);
+			}
+			i = gp;
+			p = m_parent[i].load(std::memory_order_relaxed);
+		}
+		return i;
+	}
+
+	//! Returns the representative of the set containing \a i without modifying the structure.
+	/**
+	 * Must not be called concurrently with quickUnion().
+	 */
+	int findConst(int i) const {
+		int p;
+		while ((p = m_parent[i].load(std::memory_order_relaxed)) != i) {
+			i = p;
+		}
+		return i;
+	}
+
+	//! Unions the sets containing \a i and \a j.
+	/**
+	 * @return true iff \a i and \a j were in different sets before.
+	 */
+	bool quickUnion(int i, int j) {
+		for (;;) {
+			i = find(i);
+			j = find(j);
+			if (i == j) {
+				return false;
+			}
+			if (i < j) {
+				std::swap(i, j);
+			}
+			// link the larger representative below the smaller one
+			int expected = i;
+			if (m_parent[i].compare_exchange_strong(expected, j, std::memory_order_relaxed)) {
+				return true;
+			}
+		}
+	}
+
+	OGDF_NEW_DELETE
+};
+
+} // end namespace ogdf
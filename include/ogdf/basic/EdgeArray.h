@@ -46,11 +46,8 @@ namespace ogdf {
  * Use the parameterized class EdgeArray for creating edge arrays.
  */
 class EdgeArrayBase {
-	/**
-	 * Pointer to list element in the list of all registered edge
-	 * arrays which references this array.
-	 */
-	ListIterator<EdgeArrayBase*> m_it;
+	//! The registration of this array at the associated graph.
+	Graph::EdgeArrayHandle m_it;
 
 public:
 	const Graph *m_pGraph; //!< The associated graph.
@@ -67,7 +64,7 @@ public:
 	EdgeArrayBase(EdgeArrayBase &base) : m_it(base.m_it), m_pGraph(base.m_pGraph) {
 		if(m_pGraph) m_pGraph->moveRegisterArray(m_it, this);
 		base.m_pGraph = nullptr;
-		base.m_it     = ListIterator<EdgeArrayBase*>();
+		base.m_it     = Graph::EdgeArrayHandle();
 	}
 
 	// destructor, unregisters the array
@@ -95,7 +92,7 @@ public:
 		m_pGraph = base.m_pGraph;
 		m_it     = base.m_it;
 		base.m_pGraph = nullptr;
-		base.m_it     = ListIterator<EdgeArrayBase*>();
+		base.m_it     = Graph::EdgeArrayHandle();
 		if (m_pGraph != nullptr)
 			m_pGraph->moveRegisterArray(m_it, this);
 	}
@@ -65,9 +65,16 @@ namespace ogdf {
  *
  * Which arrays are initialized is specified by a bit vector; each bit in this
  * bit vector corresponds to one or more attributes. E.g., \a #nodeGraphics
- * corresponds to the attributes \a #m_x, \a #m_y, \a #m_width, and \a #m_height;
+ * corresponds to the attributes \a #m_geometry and \a #m_nodeShape;
  * whereas \a #edgeDoubleWeight only corresponds to the attribute \a #m_doubleWeight.
  *
+ * The position and size of the nodes are stored interleaved in a single
+ * node array (see geometry()), so that layout algorithms touch only one
+ * contiguous block of memory when they access the node coordinates.
+ * Labels, templates, strokes, fills, and bend points are allocated lazily on
+ * the first non-const access; until then, the const accessors return the
+ * default values.
+ *
  * Attributes can be initialized by the constructor GraphAttributes(const Graph &,long)
  * or the function initAttributes(); attributes can also be deinitialized by
  * calling destroyAttributes().
@@ -75,25 +82,38 @@ namespace ogdf {
 
 class OGDF_EXPORT GraphAttributes {
 
+public:
+	//! Position and size of a node.
+	struct NodeGeometry {
+		double m_x;      //!< x-coordinate of the center
+		double m_y;      //!< y-coordinate of the center
+		double m_width;  //!< width of the bounding box
+		double m_height; //!< height of the bounding box
+
+		//! Creates a geometry at the origin with size 0.
+		NodeGeometry() : m_x(0.0), m_y(0.0), m_width(0.0), m_height(0.0) { }
+
+		//! Creates a geometry with center (\a x, \a y) and size \a width x \a height.
+		NodeGeometry(double x, double y, double width, double height)
+			: m_x(x), m_y(y), m_width(width), m_height(height) { }
+	};
+
 protected:
 	const Graph *m_pGraph; //!< associated graph
 
 	bool m_directed; //!< whether or not the graph is directed
 
 	// graphical representation of nodes
-	NodeArray<double>       m_x;				//!< x-coordinate of a node
-	NodeArray<double>       m_y;				//!< y-coordinate of a node
+	NodeArray<NodeGeometry> m_geometry;			//!< position and size of a node
 	NodeArray<double>       m_z;				//!< z-coordinate of a node
 	NodeArray<double>       m_nodeLabelPosX;		//!< x-coordinate of a node label
 	NodeArray<double>       m_nodeLabelPosY;		//!< y-coordinate of a node label
 	NodeArray<double>       m_nodeLabelPosZ;		//!< z-coordinate of a node label
-	NodeArray<double>       m_width;			//!< width of a node's bounding box
-	NodeArray<double>       m_height;			//!< height of a nodes's bounding box
 	NodeArray<Shape>        m_nodeShape;		//!< shape of a node
-	NodeArray<string>       m_nodeLabel;		//!< label of a node
-	NodeArray<Stroke>       m_nodeStroke;		//!< stroke of a node
-	NodeArray<Fill>         m_nodeFill;			//!< fill of a node
-	NodeArray<string>       m_nodeTemplate;		//!< name of template of a node
+	NodeArray<string>       m_nodeLabel;		//!< label of a node (lazily allocated)
+	NodeArray<Stroke>       m_nodeStroke;		//!< stroke of a node (lazily allocated)
+	NodeArray<Fill>         m_nodeFill;			//!< fill of a node (lazily allocated)
+	NodeArray<string>       m_nodeTemplate;		//!< name of template of a node (lazily allocated)
 
 	// other node attributes
 	NodeArray<int>             m_nodeId;		//!< user ID of a node
@@ -101,10 +121,10 @@ protected:
 	NodeArray<Graph::NodeType> m_vType;			//!< type (vertex, dummy, generalizationMerger)
 
 	// graphical representation of edges
-	EdgeArray<DPolyline>       m_bends;			//!< list of bend points of an edge
-	EdgeArray<string>          m_edgeLabel;		//!< label of an edge
+	EdgeArray<DPolyline>       m_bends;			//!< list of bend points of an edge (lazily allocated)
+	EdgeArray<string>          m_edgeLabel;		//!< label of an edge (lazily allocated)
 	EdgeArray<EdgeArrow>       m_edgeArrow;		//!< arrow type of an edge
-	EdgeArray<Stroke>          m_edgeStroke;	//!< stroke of an edge
+	EdgeArray<Stroke>          m_edgeStroke;	//!< stroke of an edge (lazily allocated)
 
 	// other edge attributes
 	EdgeArray<int>             m_intWeight;		//!< (integer) weight of an edge
@@ -112,12 +132,35 @@ protected:
 	EdgeArray<Graph::EdgeType> m_eType;			//!< type of an edge (association or generalization)
 	EdgeArray<uint32_t>        m_subGraph;		//!< is element of subgraphs given by bitvector
 
+	// default values of the lazily allocated attributes
+	Stroke m_nodeStrokeDefault;	//!< stroke of a node before m_nodeStroke is allocated
+	Fill   m_nodeFillDefault;	//!< fill of a node before m_nodeFill is allocated
+	Stroke m_edgeStrokeDefault;	//!< stroke of an edge before m_edgeStroke is allocated
+
+	static const string    s_emptyString;		//!< label and template before they are allocated
+	static const DPolyline s_emptyPolyline;		//!< bend points before m_bends is allocated
+
 	long m_attributes;	//!< bit vector of currently used attributes
 
+	//! Returns \a a[\a key] or \a def if the lazily allocated array \a a is not allocated yet.
+	template<class ArrayType, class Key, class T>
+	static const T &lazyGet(const ArrayType &a, Key key, const T &def) {
+		return a.graphOf() == nullptr ? def : a[key];
+	}
+
+	//! Returns \a a[\a key] and allocates the lazily allocated array \a a with default \a def if necessary.
+	template<class ArrayType, class Key, class T>
+	T &lazyGet(ArrayType &a, Key key, const T &def) {
+		if (a.graphOf() == nullptr) {
+			a.init(*m_pGraph, def);
+		}
+		return a[key];
+	}
+
 public:
 	//! Bits for specifying attributes.
 	enum {
-		nodeGraphics     = 0x00001, //!< node attributes m_x, m_y, m_width, m_height, m_nodeShape
+		nodeGraphics     = 0x00001, //!< node attributes m_geometry, m_nodeShape
 		edgeGraphics     = 0x00002, //!< edge attribute  m_bends
 		edgeIntWeight    = 0x00004, //!< edge attribute  m_intWeight
 		edgeDoubleWeight = 0x00008, //!< edge attribute  m_doubleWeight
@@ -221,7 +264,7 @@ public:
 			throw PreconditionViolatedException();
 		}
 #endif
-		return m_x[v];
+		return m_geometry[v].m_x;
 	}
 
 
@@ -235,7 +278,7 @@ public:
 			throw PreconditionViolatedException();
 		}
 #endif
-		return m_x[v];
+		return m_geometry[v].m_x;
 	}
 
 
@@ -249,7 +292,7 @@ public:
 			throw PreconditionViolatedException();
 		}
 #endif
-		return m_y[v];
+		return m_geometry[v].m_y;
 	}
 
 
@@ -263,7 +306,7 @@ public:
 			throw PreconditionViolatedException();
 		}
 #endif
-		return m_y[v];
+		return m_geometry[v].m_y;
 	}
 
 
@@ -386,7 +429,7 @@ public:
 			throw PreconditionViolatedException();
 		}
 #endif
-		return m_width[v];
+		return m_geometry[v].m_width;
 	}
 
 	//! Returns the width of the bounding box of node \a v.
@@ -399,34 +442,7 @@ public:
 			throw PreconditionViolatedException();
 		}
 #endif
-		return m_width[v];
-	}
-
-
-	//! Returns a reference to the node array \a m_width.
-	/**
-	 * \pre \a nodeGraphics is enabled
-	 */
-	const NodeArray<double> &width() const {
-#ifdef OGDF_DEBUG
-		if(!has(nodeGraphics)){
-			throw PreconditionViolatedException();
-		}
-#endif
-		return m_width;
-	}
-
-	//! Returns a reference to the node array \a m_width.
-	/**
-	 * \pre \a nodeGraphics is enabled
-	 */
-	NodeArray<double> &width() {
-#ifdef OGDF_DEBUG
-		if(!has(nodeGraphics)){
-			throw PreconditionViolatedException();
-		}
-#endif
-		return m_width;
+		return m_geometry[v].m_width;
 	}
 
 
@@ -440,7 +456,7 @@ public:
 			throw PreconditionViolatedException();
 		}
 #endif
-		return m_height[v];
+		return m_geometry[v].m_height;
 	}
 
 	//! Returns the height of the bounding box of node \a v.
@@ -453,34 +469,40 @@ public:
 			throw PreconditionViolatedException();
 		}
 #endif
-		return m_height[v];
+		return m_geometry[v].m_height;
 	}
 
 
-	//! Returns a reference to the node array \a m_height.
+	//! Returns the positions and sizes of all nodes.
 	/**
+	 * This gives layout algorithms direct access to the interleaved node
+	 * coordinates without copying them.
+	 *
 	 * \pre \a nodeGraphics is enabled
 	 */
-	const NodeArray<double> &height() const {
+	const NodeArray<NodeGeometry> &geometry() const {
 #ifdef OGDF_DEBUG
 		if(!has(nodeGraphics)){
 			throw PreconditionViolatedException();
 		}
 #endif
-		return m_height;
+		return m_geometry;
 	}
 
-	//! Returns a reference to the node array \a m_height.
+	//! Returns the positions and sizes of all nodes.
 	/**
+	 * This gives layout algorithms direct access to the interleaved node
+	 * coordinates without copying them.
+	 *
 	 * \pre \a nodeGraphics is enabled
 	 */
-	NodeArray<double> &height() {
+	NodeArray<NodeGeometry> &geometry() {
 #ifdef OGDF_DEBUG
 		if(!has(nodeGraphics)){
 			throw PreconditionViolatedException();
 		}
 #endif
-		return m_height;
+		return m_geometry;
 	}
 
 
@@ -521,7 +543,7 @@ public:
 			throw PreconditionViolatedException();
 		}
 #endif
-		return m_nodeStroke[v].m_type;
+		return lazyGet(m_nodeStroke, v, m_nodeStrokeDefault).m_type;
 	}
 
 	//! Sets the stroke type of node \a v to \a st.
@@ -534,7 +556,7 @@ public:
 			throw PreconditionViolatedException();
 		}
 #endif
-		m_nodeStroke[v].m_type = st;
+		lazyGet(m_nodeStroke, v, m_nodeStrokeDefault).m_type = st;
 	}
 
 
@@ -548,7 +570,7 @@ public:
 			throw PreconditionViolatedException();
 		}
 #endif
-		return m_nodeStroke[v].m_color;
+		return lazyGet(m_nodeStroke, v, m_nodeStrokeDefault).m_color;
 	}
 
 	//! Returns the stroke color of node \a v.
@@ -561,7 +583,7 @@ public:
 			throw PreconditionViolatedException();
 		}
 #endif
-		return m_nodeStroke[v].m_color;
+		return lazyGet(m_nodeStroke, v, m_nodeStrokeDefault).m_color;
 	}
 
 
@@ -575,7 +597,7 @@ public:
 			throw PreconditionViolatedException();
 		}
 #endif
-		return m_nodeStroke[v].m_width;
+		return lazyGet(m_nodeStroke, v, m_nodeStrokeDefault).m_width;
 	}
 
 	//! Returns the stroke width of node \a v.
@@ -588,7 +610,7 @@ public:
 			throw PreconditionViolatedException();
 		}
 #endif
-		return m_nodeStroke[v].m_width;
+		return lazyGet(m_nodeStroke, v, m_nodeStrokeDefault).m_width;
 	}
 
 
@@ -602,7 +624,7 @@ public:
 			throw PreconditionViolatedException();
 		}
 #endif
-		return m_nodeFill[v].m_pattern;
+		return lazyGet(m_nodeFill, v, m_nodeFillDefault).m_pattern;
 	}
 
 	//! Sets the fill pattern of node \a v to \a fp.
@@ -615,7 +637,7 @@ public:
 			throw PreconditionViolatedException();
 		}
 #endif
-		m_nodeFill[v].m_pattern = fp;
+		lazyGet(m_nodeFill, v, m_nodeFillDefault).m_pattern = fp;
 	}
 
 
@@ -629,7 +651,7 @@ public:
 			throw PreconditionViolatedException();
 		}
 #endif
-		return m_nodeFill[v].m_color;
+		return lazyGet(m_nodeFill, v, m_nodeFillDefault).m_color;
 	}
 
 	//! Returns the fill color of node \a v.
@@ -642,7 +664,7 @@ public:
 			throw PreconditionViolatedException();
 		}
 #endif
-		return m_nodeFill[v].m_color;
+		return lazyGet(m_nodeFill, v, m_nodeFillDefault).m_color;
 	}
 
 
@@ -656,7 +678,7 @@ public:
 			throw PreconditionViolatedException();
 		}
 #endif
-		return m_nodeFill[v].m_bgColor;
+		return lazyGet(m_nodeFill, v, m_nodeFillDefault).m_bgColor;
 	}
 
 	//! Returns the background color of fill patterns for node \a v.
@@ -669,7 +691,7 @@ public:
 			throw PreconditionViolatedException();
 		}
 #endif
-		return m_nodeFill[v].m_bgColor;
+		return lazyGet(m_nodeFill, v, m_nodeFillDefault).m_bgColor;
 	}
 
 
@@ -683,7 +705,7 @@ public:
 			throw PreconditionViolatedException();
 		}
 #endif
-		return m_nodeLabel[v];
+		return lazyGet(m_nodeLabel, v, s_emptyString);
 	}
 
 	//! Returns the label of node \a v.
@@ -696,7 +718,7 @@ public:
 			throw PreconditionViolatedException();
 		}
 #endif
-		return m_nodeLabel[v];
+		return lazyGet(m_nodeLabel, v, s_emptyString);
 	}
 
 
@@ -710,7 +732,7 @@ public:
 			throw PreconditionViolatedException();
 		}
 #endif
-		return m_nodeTemplate[v];
+		return lazyGet(m_nodeTemplate, v, s_emptyString);
 	}
 
 	//! Returns the template name of node \a v.
@@ -723,7 +745,7 @@ public:
 			throw PreconditionViolatedException();
 		}
 #endif
-		return m_nodeTemplate[v];
+		return lazyGet(m_nodeTemplate, v, s_emptyString);
 	}
 
 
@@ -824,7 +846,7 @@ public:
 			throw PreconditionViolatedException();
 		}
 #endif
-		return m_bends[e];
+		return lazyGet(m_bends, e, s_emptyPolyline);
 	}
 
 	//! Returns the list of bend points of edge \a e.
@@ -837,7 +859,7 @@ public:
 			throw PreconditionViolatedException();
 		}
 #endif
-		return m_bends[e];
+		return lazyGet(m_bends, e, s_emptyPolyline);
 	}
 
 
@@ -878,7 +900,7 @@ public:
 			throw PreconditionViolatedException();
 		}
 #endif
-		return m_edgeStroke[e].m_type;
+		return lazyGet(m_edgeStroke, e, m_edgeStrokeDefault).m_type;
 	}
 
 	//! Sets the stroke type of edge \a e to \a st.
@@ -891,7 +913,7 @@ public:
 			throw PreconditionViolatedException();
 		}
 #endif
-		m_edgeStroke[e].m_type = st;
+		lazyGet(m_edgeStroke, e, m_edgeStrokeDefault).m_type = st;
 	}
 
 
@@ -905,7 +927,7 @@ public:
 			throw PreconditionViolatedException();
 		}
 #endif
-		return m_edgeStroke[e].m_color;
+		return lazyGet(m_edgeStroke, e, m_edgeStrokeDefault).m_color;
 	}
 
 	//! Returns the stroke color of edge \a e.
@@ -918,7 +940,7 @@ public:
 			throw PreconditionViolatedException();
 		}
 #endif
-		return m_edgeStroke[e].m_color;
+		return lazyGet(m_edgeStroke, e, m_edgeStrokeDefault).m_color;
 	}
 
 
@@ -932,7 +954,7 @@ public:
 			throw PreconditionViolatedException();
 		}
 #endif
-		return m_edgeStroke[e].m_width;
+		return lazyGet(m_edgeStroke, e, m_edgeStrokeDefault).m_width;
 	}
 
 	//! Returns the stroke width of edge \a e.
@@ -945,7 +967,7 @@ public:
 			throw PreconditionViolatedException();
 		}
 #endif
-		return m_edgeStroke[e].m_width;
+		return lazyGet(m_edgeStroke, e, m_edgeStrokeDefault).m_width;
 	}
 
 
@@ -959,7 +981,7 @@ public:
 			throw PreconditionViolatedException();
 		}
 #endif
-		return m_edgeLabel[e];
+		return lazyGet(m_edgeLabel, e, s_emptyString);
 	}
 
 	//! Returns the label of edge \a e.
@@ -972,7 +994,7 @@ public:
 			throw PreconditionViolatedException();
 		}
 #endif
-		return m_edgeLabel[e];
+		return lazyGet(m_edgeLabel, e, s_emptyString);
 	}
 
 
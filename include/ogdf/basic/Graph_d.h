@@ -39,6 +39,7 @@
 
 #include <ogdf/basic/GraphList.h>
 #include <ogdf/internal/basic/graph_iterators.h>
+#include <ogdf/internal/basic/ArrayRegistry.h>
 #include <mutex>
 
 
@@ -444,13 +445,13 @@ private:
 	int m_nodeArrayTableSize; //!< The current table size of node arrays associated with this graph.
 	int m_edgeArrayTableSize; //!< The current table size of edge arrays associated with this graph.
 
-	mutable ListPure<NodeArrayBase*> m_regNodeArrays; //!< The registered node arrays.
-	mutable ListPure<EdgeArrayBase*> m_regEdgeArrays; //!< The registered edge arrays.
-	mutable ListPure<AdjEntryArrayBase*> m_regAdjArrays;  //!< The registered adjEntry arrays.
+	mutable internal::ArrayRegistry<NodeArrayBase> m_regNodeArrays; //!< The registered node arrays.
+	mutable internal::ArrayRegistry<EdgeArrayBase> m_regEdgeArrays; //!< The registered edge arrays.
+	mutable internal::ArrayRegistry<AdjEntryArrayBase> m_regAdjArrays;  //!< The registered adjEntry arrays.
 	mutable ListPure<GraphObserver*> m_regStructures; //!< The registered graph structures.
 
 #ifndef OGDF_MEMORY_POOL_NTS
-	mutable std::mutex m_mutexRegArrays; //!< The critical section for protecting shared acces to register/unregister methods.
+	mutable std::mutex m_mutexRegArrays; //!< The critical section for protecting shared acces to register/unregister methods of graph structures.
 #endif
 
 	List<HiddenEdgeSet*> m_hiddenEdgeSets; //!< The list of hidden edges.
@@ -471,6 +472,13 @@ public:
 	//! Provides a bidirectional iterator to an entry in an adjacency list.
 	typedef internal::GraphIterator<adjEntry> adjEntry_iterator;
 
+	//! Identifies the registration of a node array.
+	typedef internal::ArrayRegistry<NodeArrayBase>::Handle NodeArrayHandle;
+	//! Identifies the registration of an edge array.
+	typedef internal::ArrayRegistry<EdgeArrayBase>::Handle EdgeArrayHandle;
+	//! Identifies the registration of an adjEntry array.
+	typedef internal::ArrayRegistry<AdjEntryArrayBase>::Handle AdjEntryArrayHandle;
+
 	//@}
 	/**
 	* @name Enumerations
@@ -683,6 +691,57 @@ public:
 	 */
 	edge newEdge(adjEntry adjSrc, node w);
 
+	//@}
+	/**
+	 * @name Bulk construction
+	 * These methods are meant for building large graphs at once, e.g., when
+	 * reading a graph from an edge list.
+	 */
+	//@{
+
+	//! Prepares the graph for the creation of \a n further nodes.
+	/**
+	 * The table size of all registered node arrays is enlarged at once so that
+	 * creating \a n new nodes does not resize the node arrays repeatedly, and the
+	 * memory for the node elements is reserved in contiguous blocks of the memory pool.
+	 *
+	 * @param n is the number of nodes that will be created.
+	 */
+	void reserveNodes(int n);
+
+	//! Prepares the graph for the creation of \a m further edges.
+	/**
+	 * The table size of all registered edge arrays and adjEntry arrays is enlarged
+	 * at once, and the memory for the edge and adjacency elements is reserved in
+	 * contiguous blocks of the memory pool.
+	 *
+	 * @param m is the number of edges that will be created.
+	 */
+	void reserveEdges(int m);
+
+	//! Creates \a n new nodes and the edges in \a edgeList between them.
+	/**
+	 * Each pair (\a i, \a j) in \a edgeList creates an edge from the \a i-th to the
+	 * \a j-th new node (0 <= \a i, \a j < \a n). Edges are created in the order of
+	 * \a edgeList, so the resulting adjacency lists are the same as for a loop calling
+	 * newEdge(). Existing nodes and edges are not affected.
+	 *
+	 * @param n        is the number of nodes that will be created.
+	 * @param edgeList is the list of edges given as pairs of node numbers.
+	 * @param newNodes is assigned the newly created nodes in order.
+	 */
+	void buildFromEdgeList(int n, const Array<std::pair<int,int>> &edgeList, Array<node> &newNodes);
+
+	//! Creates \a n new nodes and the edges in \a edgeList between them.
+	/**
+	 * @param n        is the number of nodes that will be created.
+	 * @param edgeList is the list of edges given as pairs of node numbers.
+	 */
+	void buildFromEdgeList(int n, const Array<std::pair<int,int>> &edgeList) {
+		Array<node> newNodes;
+		buildFromEdgeList(n, edgeList, newNodes);
+	}
+
 
 	//@}
 	/**
@@ -1107,21 +1166,24 @@ public:
 	/**
 	 * \remark This method is automatically called by node arrays; it should not be called manually.
 	 *
+	 * Registration of arrays is thread-safe and scales with the number of threads: each thread
+	 * registers its arrays in its own shard of the registry, see internal::ArrayRegistry.
+	 *
 	 * @param pNodeArray is a pointer to the node array's base; this node array must be associated with this graph.
-	 * @return an iterator pointing to the entry for the registered node array in the list of registered node arrays.
-	 *         This iterator is required for unregistering the node array again.
+	 * @return a handle for the registration of the node array.
+	 *         This handle is required for unregistering the node array again.
 	 */
-	ListIterator<NodeArrayBase*> registerArray(NodeArrayBase *pNodeArray) const;
+	NodeArrayHandle registerArray(NodeArrayBase *pNodeArray) const;
 
 	//! Registers an edge array.
 	/**
 	 * \remark This method is automatically called by edge arrays; it should not be called manually.
 	 *
 	 * @param pEdgeArray is a pointer to the edge array's base; this edge array must be associated with this graph.
-	 * @return an iterator pointing to the entry for the registered edge array in the list of registered edge arrays.
-	 *         This iterator is required for unregistering the edge array again.
+	 * @return a handle for the registration of the edge array.
+	 *         This handle is required for unregistering the edge array again.
 	 */
-	ListIterator<EdgeArrayBase*> registerArray(EdgeArrayBase *pEdgeArray) const;
+	EdgeArrayHandle registerArray(EdgeArrayBase *pEdgeArray) const;
 
 	//! Registers an adjEntry array.
 	/**
@@ -1129,10 +1191,10 @@ public:
 	 *
 	 * @param pAdjArray is a pointer to the adjacency entry array's base; this adjacency entry array must be
 	 *                  associated with this graph.
-	 * @return an iterator pointing to the entry for the registered adjacency entry array in the list of registered
-	 *         adjacency entry arrays. This iterator is required for unregistering the adjacency entry array again.
+	 * @return a handle for the registration of the adjacency entry array.
+	 *         This handle is required for unregistering the adjacency entry array again.
 	 */
-	ListIterator<AdjEntryArrayBase*> registerArray(AdjEntryArrayBase *pAdjArray) const;
+	AdjEntryArrayHandle registerArray(AdjEntryArrayBase *pAdjArray) const;
 
 	//! Registers a graph observer (e.g. a ClusterGraph).
 	/**
@@ -1145,24 +1207,21 @@ public:
 
 	//! Unregisters a node array.
 	/**
-	 * @param it is an iterator pointing to the entry in the list of registered node arrays for the node array to
-	 *        be unregistered.
+	 * @param h is the handle returned when registering the node array.
 	 */
-	void unregisterArray(ListIterator<NodeArrayBase*> it) const;
+	void unregisterArray(const NodeArrayHandle &h) const;
 
 	//! Unregisters an edge array.
 	/**
-	 * @param it is an iterator pointing to the entry in the list of registered edge arrays for the edge array to
-	 *        be unregistered.
+	 * @param h is the handle returned when registering the edge array.
 	 */
-	void unregisterArray(ListIterator<EdgeArrayBase*> it) const;
+	void unregisterArray(const EdgeArrayHandle &h) const;
 
 	//! Unregisters an adjEntry array.
 	/**
-	 * @param it is an iterator pointing to the entry in the list of registered adjacency entry arrays for the
-	 *           adjacency entry array to be unregistered.
+	 * @param h is the handle returned when registering the adjacency entry array.
 	 */
-	void unregisterArray(ListIterator<AdjEntryArrayBase*> it) const;
+	void unregisterArray(const AdjEntryArrayHandle &h) const;
 
 	//! Unregisters a graph observer.
 	/**
@@ -1171,14 +1230,14 @@ public:
 	 */
 	void unregisterStructure(ListIterator<GraphObserver*> it) const;
 
-	//! Move the registration \a it of a node array to \a pNodeArray (used with move semantics for node arrays).
-	void moveRegisterArray(ListIterator<NodeArrayBase*> it, NodeArrayBase *pNodeArray) const;
+	//! Move the registration \a h of a node array to \a pNodeArray (used with move semantics for node arrays).
+	void moveRegisterArray(const NodeArrayHandle &h, NodeArrayBase *pNodeArray) const;
 
-	//! Move the registration \a it of an edge array to \a pEdgeArray (used with move semantics for edge arrays).
-	void moveRegisterArray(ListIterator<EdgeArrayBase*> it, EdgeArrayBase *pEdgeArray) const;
+	//! Move the registration \a h of an edge array to \a pEdgeArray (used with move semantics for edge arrays).
+	void moveRegisterArray(const EdgeArrayHandle &h, EdgeArrayBase *pEdgeArray) const;
 
-	//! Move the registration \a it of an adjEntry array to \a pAdjArray (used with move semantics for adjEntry arrays).
-	void moveRegisterArray(ListIterator<AdjEntryArrayBase*> it, AdjEntryArrayBase *pAdjArray) const;
+	//! Move the registration \a h of an adjEntry array to \a pAdjArray (used with move semantics for adjEntry arrays).
+	void moveRegisterArray(const AdjEntryArrayHandle &h, AdjEntryArrayBase *pAdjArray) const;
 
 	//! Resets the edge id count to \a maxId.
 	/**
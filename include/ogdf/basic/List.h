@@ -35,6 +35,7 @@
 #pragma once
 
 #include <ogdf/internal/basic/list_templates.h>
+#include <ogdf/basic/MemoryArena.h>
 #include <random>
 
 
@@ -269,6 +270,7 @@ protected:
 
 	ListElement<E> *m_head; //!< Pointer to first element.
 	ListElement<E> *m_tail; //!< Pointer to last element.
+	MemoryArena *m_arena;   //!< The arena the elements are allocated from (nullptr if they are allocated from the pool).
 
 public:
 	//! Represents the data type stored in a list element.
@@ -283,16 +285,16 @@ public:
 	typedef ListIterator<E> iterator;
 
 	//! Constructs an empty doubly linked list.
-	ListPure() : m_head(nullptr), m_tail(nullptr) { }
+	ListPure() : m_head(nullptr), m_tail(nullptr), m_arena(MemoryArena::current()) { }
 
 	//! Constructs a doubly linked list containing the elements in \a init.
-	ListPure(std::initializer_list<E> init) : m_head(nullptr), m_tail(nullptr) {
+	ListPure(std::initializer_list<E> init) : m_head(nullptr), m_tail(nullptr), m_arena(MemoryArena::current()) {
 		for (const E &x : init)
 			pushBack(x);
 	}
 
 	//! Constructs a doubly linked list that is a copy of \a L.
-	ListPure(const ListPure<E> &L) : m_head(nullptr), m_tail(nullptr) {
+	ListPure(const ListPure<E> &L) : m_head(nullptr), m_tail(nullptr), m_arena(MemoryArena::current()) {
 		copy(L);
 	}
 
@@ -300,8 +302,14 @@ public:
 	/**
 	 * The list \a L is empty afterwards.
 	 */
-	ListPure(ListPure<E> &&L) : m_head(L.m_head), m_tail(L.m_tail) {
-		L.m_head = L.m_tail = nullptr;
+	ListPure(ListPure<E> &&L) : m_head(nullptr), m_tail(nullptr), m_arena(MemoryArena::current()) {
+		if (m_arena == L.m_arena) {
+			m_head = L.m_head;
+			m_tail = L.m_tail;
+			L.m_head = L.m_tail = nullptr;
+		} else {
+			moveElements(L);
+		}
 	}
 
 	//! Destructor.
@@ -535,9 +543,13 @@ public:
 	 */
 	ListPure<E> &operator=(ListPure<E> &&L) {
 		clear();
-		m_head = L.m_head;
-		m_tail = L.m_tail;
-		L.m_head = L.m_tail = nullptr;
+		if (m_arena == L.m_arena) {
+			m_head = L.m_head;
+			m_tail = L.m_tail;
+			L.m_head = L.m_tail = nullptr;
+		} else {
+			moveElements(L);
+		}
 		return *this;
 	}
 
@@ -568,7 +580,7 @@ public:
 
 	//! Adds element \a x at the beginning of the list.
 	iterator pushFront(const E &x) {
-		ListElement<E> *pX = OGDF_NEW ListElement<E>(x,m_head,nullptr);
+		ListElement<E> *pX = newElement(x,m_head,nullptr);
 		if (m_head)
 			m_head = m_head->m_prev = pX;
 		else
@@ -582,7 +594,7 @@ public:
 	 */
 	template<class ... Args>
 	iterator emplaceFront(Args && ... args) {
-		ListElement<E> *pX = OGDF_NEW ListElement<E>(m_head, nullptr, std::forward<Args>(args)...);
+		ListElement<E> *pX = newElement(m_head, nullptr, std::forward<Args>(args)...);
 		if (m_head)
 			m_head = m_head->m_prev = pX;
 		else
@@ -592,7 +604,7 @@ public:
 
 	//! Adds element \a x at the end of the list.
 	iterator pushBack(const E &x) {
-		ListElement<E> *pX = OGDF_NEW ListElement<E>(x,nullptr,m_tail);
+		ListElement<E> *pX = newElement(x,nullptr,m_tail);
 		if (m_head)
 			m_tail = m_tail->m_next = pX;
 		else
@@ -606,7 +618,7 @@ public:
 	*/
 	template<class ... Args>
 	iterator emplaceBack(Args && ... args) {
-		ListElement<E> *pX = OGDF_NEW ListElement<E>(nullptr, m_tail, std::forward<Args>(args)...);
+		ListElement<E> *pX = newElement(nullptr, m_tail, std::forward<Args>(args)...);
 		if (m_head)
 			m_tail = m_tail->m_next = pX;
 		else
@@ -628,12 +640,12 @@ public:
 		ListElement<E> *pY = it, *pX;
 		if (dir == after) {
 			ListElement<E> *pYnext = pY->m_next;
-			pY->m_next = pX = OGDF_NEW ListElement<E>(x,pYnext,pY);
+			pY->m_next = pX = newElement(x,pYnext,pY);
 			if (pYnext) pYnext->m_prev = pX;
 			else m_tail = pX;
 		} else {
 			ListElement<E> *pYprev = pY->m_prev;
-			pY->m_prev = pX = OGDF_NEW ListElement<E>(x,pY,pYprev);
+			pY->m_prev = pX = newElement(x,pY,pYprev);
 			if (pYprev) pYprev->m_next = pX;
 			else m_head = pX;
 		}
@@ -648,7 +660,7 @@ public:
 		OGDF_ASSERT(it.valid())
 		ListElement<E> *pY = it, *pX;
 		ListElement<E> *pYprev = pY->m_prev;
-		pY->m_prev = pX = OGDF_NEW ListElement<E>(x,pY,pYprev);
+		pY->m_prev = pX = newElement(x,pY,pYprev);
 		if (pYprev) pYprev->m_next = pX;
 		else m_head = pX;
 		return pX;
@@ -662,7 +674,7 @@ public:
 		OGDF_ASSERT(it.valid())
 		ListElement<E> *pY = it, *pX;
 		ListElement<E> *pYnext = pY->m_next;
-		pY->m_next = pX = OGDF_NEW ListElement<E>(x,pYnext,pY);
+		pY->m_next = pX = newElement(x,pYnext,pY);
 		if (pYnext) pYnext->m_prev = pX;
 		else m_tail = pX;
 		return pX;
@@ -684,7 +696,7 @@ public:
 		OGDF_ASSERT(m_head != nullptr)
 		ListElement<E> *pX = m_head;
 		m_head = m_head->m_next;
-		delete pX;
+		deleteElement(pX);
 		if (m_head) m_head->m_prev = nullptr;
 		else m_tail = nullptr;
 	}
@@ -707,7 +719,7 @@ public:
 		OGDF_ASSERT(m_tail != nullptr)
 		ListElement<E> *pX = m_tail;
 		m_tail = m_tail->m_prev;
-		delete pX;
+		deleteElement(pX);
 		if (m_tail) m_tail->m_next = nullptr;
 		else m_head = nullptr;
 	}
@@ -729,7 +741,7 @@ public:
 	void del(iterator it) {
 		OGDF_ASSERT(it.valid())
 		ListElement<E> *pX = it, *pPrev = pX->m_prev, *pNext = pX->m_next;
-		delete pX;
+		deleteElement(pX);
 		if (pPrev) pPrev->m_next = pNext;
 		else m_head = pNext;
 		if (pNext) pNext->m_prev = pPrev;
@@ -759,7 +771,8 @@ public:
 			for(ListElement<E> *pX = m_head; pX != nullptr; pX = pX->m_next)
 				pX->m_x.~E();
 		}
-		OGDF_ALLOCATOR::deallocateList(sizeof(ListElement<E>),m_head,m_tail);
+		if (m_arena == nullptr)
+			OGDF_ALLOCATOR::deallocateList(sizeof(ListElement<E>),m_head,m_tail);
 
 		m_head = m_tail = nullptr;
 	}
@@ -904,6 +917,7 @@ public:
 	void moveToFront(iterator it, ListPure<E> &L2) {
 		OGDF_ASSERT(it.valid())
 		OGDF_ASSERT(this != &L2)
+		OGDF_ASSERT(m_arena == L2.m_arena)
 		// remove it
 		ListElement<E> *pX = it, *pPrev = pX->m_prev, *pNext = pX->m_next;
 		if (pPrev) pPrev->m_next = pNext;
@@ -925,6 +939,7 @@ public:
 	void moveToBack(iterator it, ListPure<E> &L2) {
 		OGDF_ASSERT(it.valid())
 		OGDF_ASSERT(this != &L2)
+		OGDF_ASSERT(m_arena == L2.m_arena)
 		// remove it
 		ListElement<E> *pX = it, *pPrev = pX->m_prev, *pNext = pX->m_next;
 		if (pPrev) pPrev->m_next = pNext;
@@ -948,6 +963,7 @@ public:
 		OGDF_ASSERT(it.valid());
 		OGDF_ASSERT(itBefore.valid());
 		OGDF_ASSERT(this != &L2)
+		OGDF_ASSERT(m_arena == L2.m_arena)
 		// remove it
 		ListElement<E> *pX = it, *pPrev = pX->m_prev, *pNext = pX->m_next;
 		if (pPrev) pPrev->m_next = pNext;
@@ -971,6 +987,7 @@ public:
 		OGDF_ASSERT(it.valid());
 		OGDF_ASSERT(itAfter.valid());
 		OGDF_ASSERT(this != &L2)
+		OGDF_ASSERT(m_arena == L2.m_arena)
 		// remove it
 		ListElement<E> *pX = it, *pPrev = pX->m_prev, *pNext = pX->m_next;
 		if (pPrev) pPrev->m_next = pNext;
@@ -988,6 +1005,10 @@ public:
 	//! Appends \a L2 to this list and makes \a L2 empty.
 	void conc(ListPure<E> &L2) {
 		OGDF_ASSERT(this != &L2)
+		if (m_arena != L2.m_arena) {
+			moveElements(L2);
+			return;
+		}
 		if (m_head)
 			m_tail->m_next = L2.m_head;
 		else
@@ -1002,6 +1023,12 @@ public:
 	//! Prepends \a L2 to this list and makes \a L2 empty.
 	void concFront(ListPure<E> &L2) {
 		OGDF_ASSERT(this != &L2)
+		if (m_arena != L2.m_arena) {
+			ListPure<E> L(std::move(*this));
+			moveElements(L2);
+			moveElements(L);
+			return;
+		}
 		if (m_head)
 			m_head->m_prev = L2.m_tail;
 		else
@@ -1015,8 +1042,15 @@ public:
 
 	//! Exchanges the contents of this list and \a other in constant time.
 	void swap(ListPure<E> &other) {
-		std::swap(m_head, other.m_head);
-		std::swap(m_tail, other.m_tail);
+		if (m_arena == other.m_arena) {
+			std::swap(m_head, other.m_head);
+			std::swap(m_tail, other.m_tail);
+		} else {
+			// elements have to stay in the arena of their list
+			ListPure<E> L(std::move(*this));
+			*this = std::move(other);
+			other = std::move(L);
+		}
 	}
 
 	//! Splits the list at element \a it into lists \a L1 and \a L2.
@@ -1030,6 +1064,8 @@ public:
 	 */
 
 	void split(iterator it,ListPure<E> &L1,ListPure<E> &L2,Direction dir = before) {
+		OGDF_ASSERT(m_arena == L1.m_arena)
+		OGDF_ASSERT(m_arena == L2.m_arena)
 		if (&L1 != this) L1.clear();
 		if (&L2 != this) L2.clear();
 
@@ -1061,6 +1097,7 @@ public:
 	void splitAfter(iterator it, ListPure<E> &L2) {
 		OGDF_ASSERT(it.valid())
 		OGDF_ASSERT(this != &L2)
+		OGDF_ASSERT(m_arena == L2.m_arena)
 		L2.clear();
 		ListElement<E> *pX = it;
 		if (pX != m_tail) {
@@ -1075,6 +1112,7 @@ public:
 	void splitBefore(iterator it, ListPure<E> &L2) {
 		OGDF_ASSERT(it.valid())
 		OGDF_ASSERT(this != &L2)
+		OGDF_ASSERT(m_arena == L2.m_arena)
 		L2.clear();
 		ListElement<E> *pX = it;
 		L2.m_head = pX; L2.m_tail = m_tail;
@@ -1225,6 +1263,33 @@ protected:
 			pushBack(pX->m_x);
 	}
 
+	//! Moves the elements of \a L (which uses another arena) to the end of this list.
+	void moveElements(ListPure<E> &L) {
+		for(ListElement<E> *pX = L.m_head; pX != nullptr; pX = pX->m_next)
+			emplaceBack(std::move(pX->m_x));
+		L.clear();
+	}
+
+	//! Creates a new list element in the arena of the list or in the memory pool.
+	template<class ... Args>
+	ListElement<E> *newElement(Args && ... args) {
+		internal::ArenaInheritance<E> inherit(m_arena);
+		if (m_arena == nullptr)
+			return OGDF_NEW ListElement<E>(std::forward<Args>(args)...);
+		return new (m_arena->allocate(sizeof(ListElement<E>), alignof(ListElement<E>)))
+			ListElement<E>(std::forward<Args>(args)...);
+	}
+
+	//! Destroys list element \a pX created with newElement().
+	void deleteElement(ListElement<E> *pX) {
+		if (m_arena == nullptr) {
+			delete pX;
+		} else {
+			pX->~ListElement<E>();
+			m_arena->deallocate(pX, sizeof(ListElement<E>));
+		}
+	}
+
 	template<class RNG>
 	void permute(const int n, RNG &rng);
 
@@ -0,0 +1,262 @@
+/** \file
+ * \brief Declaration of MemoryArena and ArenaScope for monotonic allocation of temporary containers
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.txt in the root directory of the OGDF installation for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ *
+ * \see  http://www.gnu.org/copyleft/gpl.html
+ ***************************************************************/
+
+#pragma once
+
+#include <ogdf/basic/basic.h>
+#include <atomic>
+#include <type_traits>
+
+
+namespace ogdf {
+
+//! Monotonic memory arena for temporary data structures.
+/**
+ * @ingroup containers
+ *
+ * An arena hands out memory by bumping a pointer through large chunks and
+ * releases all of it at once (in release() or on destruction); deallocating
+ * single objects only reclaims memory if it was the most recent allocation.
+ *
+ * Arenas are usually not used directly but installed for a scope with
+ * ArenaScope. The containers List, SList and Array (hence also NodeArray,
+ * EdgeArray, AdjEntryArray, ...) remember the arena that was installed when
+ * they were created, and allocate their elements from it. Containers created
+ * as elements of another container always use the arena of the enclosing
+ * container.
+ *
+ * \warning Elements must not be moved between lists of different arenas
+ *          (e.g., with ListPure::conc() or ListPure::moveToBack()), and all
+ *          containers using an arena have to be destroyed before the arena is
+ *          released.
+ */
+class OGDF_EXPORT MemoryArena {
+public:
+	enum {
+		eAlignment = 2 * sizeof(void*), //!< The default alignment of allocated memory.
+		eMinChunkSize = 16 * 1024,      //!< The size of the first chunk.
+		eMaxChunkSize = 1024 * 1024     //!< The maximal size of chunks (except for huge requests).
+	};
+
+	//! Creates an empty arena (no memory is allocated before the first request).
+	MemoryArena() : m_ptr(nullptr), m_end(nullptr), m_last(nullptr), m_chunks(nullptr),
+		m_nextChunkSize(eMinChunkSize), m_numAllocations(0), m_bytesAllocated(0) { }
+
+	//! Releases all memory of the arena.
+	~MemoryArena() { release(); }
+
+	//! Allocates \a nBytes bytes aligned to \a alignment (which must be a power of two).
+	void *allocate(size_t nBytes, size_t alignment = eAlignment) {
+		char *p = align(m_ptr, alignment);
+		if (OGDF_UNLIKELY(m_ptr == nullptr || p + nBytes > m_end))
+			p = allocateChunk(nBytes, alignment);
+		m_last = p;
+		m_ptr = p + nBytes;
+		++m_numAllocations;
+		m_bytesAllocated += nBytes;
+		return p;
+	}
+
+	//! Resizes the memory block \a p of \a oldBytes bytes to \a newBytes bytes.
+	/**
+	 * If \a p is the most recent allocation and there is enough room left in
+	 * the current chunk, the block is resized in place; otherwise a new block
+	 * is allocated and the contents are copied.
+	 */
+	void *reallocate(void *p, size_t oldBytes, size_t newBytes, size_t alignment = eAlignment);
+
+	//! Returns the memory block \a p of \a nBytes bytes to the arena.
+	/**
+	 * The memory can only be reused if \a p is the most recent allocation.
+	 */
+	void deallocate(void *p, size_t nBytes) {
+		if (p == m_last && static_cast<char*>(p) + nBytes == m_ptr) {
+			m_ptr = m_last;
+			m_last = nullptr;
+		}
+	}
+
+	//! Frees all memory allocated by the arena.
+	void release();
+
+	//! Returns the number of allocations served so far.
+	size_t numberOfAllocations() const { return m_numAllocations; }
+
+	//! Returns the number of bytes handed out so far.
+	size_t bytesAllocated() const { return m_bytesAllocated; }
+
+	//! Returns the number of bytes the arena allocated from the system.
+	size_t memoryInChunks() const;
+
+	//! Returns the arena installed for the calling thread, or nullptr if none is installed.
+	static MemoryArena *current() {
+		return OGDF_LIKELY(s_numScopes.load(std::memory_order_relaxed) == 0) ? nullptr : installed();
+	}
+
+	//! Returns true iff an arena scope is active in any thread.
+	static bool scopesActive() {
+		return s_numScopes.load(std::memory_order_relaxed) != 0;
+	}
+
+	//! Installs \a arena for the calling thread and returns the previously installed arena.
+	/**
+	 * This is a low-level function; usually ArenaScope should be used instead.
+	 */
+	static MemoryArena *exchangeCurrent(MemoryArena *arena);
+
+private:
+	struct Chunk {
+		Chunk *m_next;  //!< The previously allocated chunk.
+		size_t m_size;  //!< The size of this chunk (including this header).
+	};
+
+	char  *m_ptr;            //!< The next free byte in the current chunk.
+	char  *m_end;            //!< The end of the current chunk.
+	char  *m_last;           //!< The most recent allocation.
+	Chunk *m_chunks;         //!< The list of allocated chunks.
+	size_t m_nextChunkSize;  //!< The size of the next chunk.
+	size_t m_numAllocations; //!< The number of allocations served so far.
+	size_t m_bytesAllocated; //!< The number of bytes handed out so far.
+
+	static std::atomic<int> s_numScopes; //!< The number of active scopes (of all threads).
+
+	static char *align(char *p, size_t alignment) {
+		return reinterpret_cast<char*>((reinterpret_cast<uintptr_t>(p) + alignment - 1) & ~uintptr_t(alignment - 1));
+	}
+
+	char *allocateChunk(size_t nBytes, size_t alignment);
+
+	static MemoryArena *installed();
+
+	friend class ArenaScope;
+
+	// prevent copying
+	MemoryArena(const MemoryArena &);
+	MemoryArena &operator=(const MemoryArena &);
+};
+
+
+//! Installs a MemoryArena for the calling thread during the lifetime of the scope object.
+/**
+ * @ingroup containers
+ *
+ * Containers created while the scope is alive allocate their elements from the arena,
+ * which is released in one shot when the scope ends:
+ *
+ * \code
+ * {
+ *     ArenaScope scope;            // creates and installs a new arena
+ *     NodeArray<int> dist(G, -1);  // allocated from the arena
+ *     SListPure<node> queue;       // ... as well as its elements
+ *     ...
+ * }                                // everything is released here
+ * \endcode
+ *
+ * Since local variables are destroyed in reverse order of their creation, all
+ * containers declared after the scope object are destroyed before the arena is
+ * released. Containers created before the scope are not affected, even if elements
+ * are added to them while the scope is alive.
+ */
+class OGDF_EXPORT ArenaScope {
+public:
+	//! Creates a new arena and installs it; the arena is released when the scope ends.
+	ArenaScope() : m_arena(&m_ownArena) { install(); }
+
+	//! Installs the given \a arena (which is not released when the scope ends).
+	explicit ArenaScope(MemoryArena &arena) : m_arena(&arena) { install(); }
+
+	//! Restores the previously installed arena.
+	~ArenaScope();
+
+	//! Returns the arena of this scope.
+	MemoryArena &arena() { return *m_arena; }
+
+	//! Enables or disables the effect of all arena scopes created afterwards (enabled by default).
+	/**
+	 * A disabled scope does not install its arena; containers then use the usual memory
+	 * allocators. This is useful for debugging and for measuring the effect of arenas.
+	 */
+	static void setEnabled(bool enabled) { s_enabled.store(enabled, std::memory_order_relaxed); }
+
+	//! Returns whether arena scopes are enabled.
+	static bool enabled() { return s_enabled.load(std::memory_order_relaxed); }
+
+private:
+	MemoryArena  m_ownArena; //!< The arena created by the default constructor.
+	MemoryArena *m_arena;    //!< The arena of this scope.
+	MemoryArena *m_previous; //!< The arena installed before.
+	bool m_installed;        //!< Whether the scope installed its arena.
+
+	static std::atomic<bool> s_enabled;
+
+	void install();
+
+	// prevent copying
+	ArenaScope(const ArenaScope &);
+	ArenaScope &operator=(const ArenaScope &);
+};
+
+
+namespace internal {
+
+//! Installs the arena of a container while its elements of type \a E are created.
+/**
+ * Elements that are containers themselves thus inherit the arena of the enclosing
+ * container instead of the one of the current scope. This is a no-op for types
+ * which are trivially destructible (and hence cannot own memory).
+ */
+template<class E, bool = std::is_trivially_destructible<E>::value>
+class ArenaInheritance {
+	MemoryArena *m_previous;
+	bool m_active;
+
+public:
+	explicit ArenaInheritance(MemoryArena *arena) : m_previous(nullptr), m_active(MemoryArena::scopesActive()) {
+		if (m_active)
+			m_previous = MemoryArena::exchangeCurrent(arena);
+	}
+
+	~ArenaInheritance() {
+		if (m_active)
+			MemoryArena::exchangeCurrent(m_previous);
+	}
+};
+
+template<class E>
+class ArenaInheritance<E, true> {
+public:
+	explicit ArenaInheritance(MemoryArena *) { }
+};
+
+}
+
+}
@@ -46,11 +46,8 @@ namespace ogdf {
  * Use the parameterized class NodeArray for creating node arrays.
  */
 class NodeArrayBase {
-	/**
-	 * Pointer to list element in the list of all registered node
-	 * arrays which references this array.
-	 */
-	ListIterator<NodeArrayBase*> m_it;
+	//! The registration of this array at the associated graph.
+	Graph::NodeArrayHandle m_it;
 
 public:
 	const Graph *m_pGraph; //!< The associated graph.
@@ -67,7 +64,7 @@ public:
 	NodeArrayBase(NodeArrayBase &base) : m_it(base.m_it), m_pGraph(base.m_pGraph) {
 		if(m_pGraph) m_pGraph->moveRegisterArray(m_it, this);
 		base.m_pGraph = nullptr;
-		base.m_it     = ListIterator<NodeArrayBase*>();
+		base.m_it     = Graph::NodeArrayHandle();
 	}
 
 	// destructor, unregisters the array
@@ -95,7 +92,7 @@ public:
 		m_pGraph = base.m_pGraph;
 		m_it     = base.m_it;
 		base.m_pGraph = nullptr;
-		base.m_it     = ListIterator<NodeArrayBase*>();
+		base.m_it     = Graph::NodeArrayHandle();
 		if (m_pGraph != nullptr)
 			m_pGraph->moveRegisterArray(m_it, this);
 	}
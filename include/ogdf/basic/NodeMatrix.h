@@ -0,0 +1,122 @@
+/** \file
+ * \brief Declaration and implementation of class NodeMatrix, a flat n x n matrix indexed by pairs of nodes.
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.txt in the root directory of the OGDF installation for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ *
+ * \see  http://www.gnu.org/copyleft/gpl.html
+ ***************************************************************/
+
+#pragma once
+
+#include <ogdf/basic/Graph_d.h>
+#include <ogdf/basic/Array.h>
+#include <ogdf/basic/Array2D.h>
+
+
+namespace ogdf {
+
+
+//! Dense matrix indexed by pairs of nodes, e.g., for all-pairs shortest paths.
+/**
+ * @ingroup graph-containers
+ *
+ * The nodes of the graph are numbered 0, ..., n-1 in the order of the node list,
+ * which is the numbering of CSRGraph, and the matrix is stored row by row in a
+ * single allocation. Hence row(i) points to n contiguous elements, which is
+ * considerably faster to traverse than a NodeArray<NodeArray<T>>.
+ *
+ * Unlike NodeArray, a NodeMatrix is not registered at its graph and does not
+ * grow with it; call init() again after adding nodes.
+ *
+ * @tparam T is the element type, e.g., double or (to halve the memory) float.
+ */
+template<class T>
+class NodeMatrix {
+	const Graph *m_pGraph;	//!< The associated graph.
+	Array<node> m_node;		//!< Maps row indices to nodes.
+	Array<int> m_id;		//!< Maps node indices to row indices.
+	Array2D<T> m_matrix;	//!< The entries.
+
+public:
+	//! Creates a matrix not associated with any graph.
+	NodeMatrix() : m_pGraph(nullptr) { }
+
+	//! Creates a matrix for the nodes of \a G with all entries set to \a x.
+	explicit NodeMatrix(const Graph &G, const T &x = T()) { init(G, x); }
+
+	//! Reinitializes the matrix for the nodes of \a G with all entries set to \a x.
+	void init(const Graph &G, const T &x = T()) {
+		m_pGraph = &G;
+		const int n = G.numberOfNodes();
+		m_node.init(n);
+		m_id.init(0, G.maxNodeIndex(), -1);
+		int i = 0;
+		for (node v : G.nodes) {
+			m_node[i] = v;
+			m_id[v->index()] = i++;
+		}
+		m_matrix.init(0, n-1, 0, n-1, x);
+	}
+
+	//! Sets all entries to \a x.
+	void fill(const T &x) { m_matrix.fill(x); }
+
+	//! Returns a pointer to the associated graph.
+	const Graph *graphOf() const { return m_pGraph; }
+
+	//! Returns the number of rows (and columns), i.e., the number of nodes.
+	int size() const { return m_node.size(); }
+
+	//! Returns the row (and column) index of node \a v.
+	int id(node v) const {
+		OGDF_ASSERT(v->graphOf() == m_pGraph);
+		return m_id[v->index()];
+	}
+
+	//! Returns the node with row (and column) index \a i.
+	node original(int i) const { return m_node[i]; }
+
+	//! Returns the entry in row \a i and column \a j.
+	const T &operator()(int i, int j) const { return m_matrix(i, j); }
+
+	//! Returns the entry in row \a i and column \a j.
+	T &operator()(int i, int j) { return m_matrix(i, j); }
+
+	//! Returns the entry of the pair (\a v, \a w).
+	const T &operator()(node v, node w) const { return m_matrix(id(v), id(w)); }
+
+	//! Returns the entry of the pair (\a v, \a w).
+	T &operator()(node v, node w) { return m_matrix(id(v), id(w)); }
+
+	//! Returns a pointer to the size() contiguous entries of row \a i.
+	const T *row(int i) const { return &m_matrix(i, 0); }
+
+	//! Returns a pointer to the size() contiguous entries of row \a i.
+	T *row(int i) { return &m_matrix(i, 0); }
+};
+
+}
@@ -37,6 +37,7 @@
 #pragma once
 
 #include <ogdf/internal/basic/list_templates.h>
+#include <ogdf/basic/MemoryArena.h>
 
 
 namespace ogdf {
@@ -231,6 +232,7 @@ public:
 template<class E> class SListPure {
 	SListElement<E> *m_head; //!< Pointer to first element.
 	SListElement<E> *m_tail; //!< Pointer to last element.
+	MemoryArena *m_arena;    //!< The arena the elements are allocated from (nullptr if they are allocated from the pool).
 
 public:
 	//! Represents the data type stored in a list element.
@@ -245,15 +247,15 @@ public:
 	typedef SListIterator<E> iterator;
 
 	//! Constructs an empty singly linked list.
-	SListPure() : m_head(nullptr), m_tail(nullptr) { }
+	SListPure() : m_head(nullptr), m_tail(nullptr), m_arena(MemoryArena::current()) { }
 
 	//! Constructs a singly linked list containing the elements in \a init.
-	SListPure(std::initializer_list<E> init) : m_head(nullptr), m_tail(nullptr) {
+	SListPure(std::initializer_list<E> init) : m_head(nullptr), m_tail(nullptr), m_arena(MemoryArena::current()) {
 		for (const E &x : init)
 			pushBack(x);
 	}
 	//! Constructs a singly linked list that is a copy of \a L.
-	SListPure(const SListPure<E> &L) : m_head(nullptr), m_tail(nullptr) {
+	SListPure(const SListPure<E> &L) : m_head(nullptr), m_tail(nullptr), m_arena(MemoryArena::current()) {
 		copy(L);
 	}
 
@@ -261,8 +263,14 @@ public:
 	/**
 	 * The list \a L is empty afterwards.
 	 */
-	SListPure(SListPure<E> &&L) : m_head(L.m_head), m_tail(L.m_tail) {
-		L.m_head = L.m_tail = nullptr;
+	SListPure(SListPure<E> &&L) : m_head(nullptr), m_tail(nullptr), m_arena(MemoryArena::current()) {
+		if (m_arena == L.m_arena) {
+			m_head = L.m_head;
+			m_tail = L.m_tail;
+			L.m_head = L.m_tail = nullptr;
+		} else {
+			moveElements(L);
+		}
 	}
 
 	//! Destructor.
@@ -461,9 +469,13 @@ public:
 	 */
 	SListPure<E> &operator=(SListPure<E> &&L) {
 		clear();
-		m_head = L.m_head;
-		m_tail = L.m_tail;
-		L.m_head = L.m_tail = nullptr;
+		if (m_arena == L.m_arena) {
+			m_head = L.m_head;
+			m_tail = L.m_tail;
+			L.m_head = L.m_tail = nullptr;
+		} else {
+			moveElements(L);
+		}
 		return *this;
 	}
 
@@ -494,7 +506,7 @@ public:
 
 	//! Adds element \a x at the beginning of the list.
 	iterator pushFront(const E &x) {
-		m_head = OGDF_NEW SListElement<E>(x,m_head);
+		m_head = newElement(x,m_head);
 		if (m_tail == nullptr) m_tail = m_head;
 		return m_head;
 	}
@@ -505,14 +517,14 @@ public:
 	*/
 	template<class ... Args>
 	iterator emplaceFront(Args && ... args) {
-		m_head = OGDF_NEW SListElement<E>(m_head, std::forward<Args>(args)...);
+		m_head = newElement(m_head, std::forward<Args>(args)...);
 		if (m_tail == nullptr) m_tail = m_head;
 		return m_head;
 	}
 
 	//! Adds element \a x at the end of the list.
 	iterator pushBack(const E &x) {
-		SListElement<E> *pNew = OGDF_NEW SListElement<E>(x);
+		SListElement<E> *pNew = newElement(x);
 		if (m_head == nullptr)
 			m_head = m_tail = pNew;
 		else
@@ -526,7 +538,7 @@ public:
 	*/
 	template<class ... Args>
 	iterator emplaceBack(Args && ... args) {
-		SListElement<E> *pNew = OGDF_NEW SListElement<E>(nullptr, std::forward<Args>(args)...);
+		SListElement<E> *pNew = newElement(nullptr, std::forward<Args>(args)...);
 		if (m_head == nullptr)
 			m_head = m_tail = pNew;
 		else
@@ -541,7 +553,7 @@ public:
 	iterator insertAfter(const E &x, iterator itBefore) {
 		SListElement<E> *pBefore = itBefore;
 		OGDF_ASSERT(pBefore != nullptr)
-		SListElement<E> *pNew = OGDF_NEW SListElement<E>(x,pBefore->m_next);
+		SListElement<E> *pNew = newElement(x,pBefore->m_next);
 		if (pBefore == m_tail) m_tail = pNew;
 		return (pBefore->m_next = pNew);
 	}
@@ -562,7 +574,7 @@ public:
 		OGDF_ASSERT(m_head != nullptr)
 		SListElement<E> *pX = m_head;
 		if ((m_head = m_head->m_next) == nullptr) m_tail = nullptr;
-		delete pX;
+		deleteElement(pX);
 	}
 
 	//! Removes the first element from the list and returns it.
@@ -585,7 +597,7 @@ public:
 		SListElement<E> *pDel = pBefore->m_next;
 		OGDF_ASSERT(pDel != nullptr)
 		if ((pBefore->m_next = pDel->m_next) == nullptr) m_tail = pBefore;
-		delete pDel;
+		deleteElement(pDel);
 	}
 
 	//! Removes all elements from the list.
@@ -596,7 +608,8 @@ public:
 			for(SListElement<E> *pX = m_head; pX != nullptr; pX = pX->m_next)
 				pX->m_x.~E();
 		}
-		OGDF_ALLOCATOR::deallocateList(sizeof(SListElement<E>),m_head,m_tail);
+		if (m_arena == nullptr)
+			OGDF_ALLOCATOR::deallocateList(sizeof(SListElement<E>),m_head,m_tail);
 
 		m_head = m_tail = nullptr;
 	}
@@ -613,6 +626,7 @@ public:
 	void moveFrontToFront(SListPure<E> &L2) {
 		OGDF_ASSERT(m_head != nullptr)
 		OGDF_ASSERT(this != &L2)
+		OGDF_ASSERT(m_arena == L2.m_arena)
 		SListElement<E> *pX = m_head;
 		if ((m_head = m_head->m_next) == nullptr) m_tail = nullptr;
 		pX->m_next = L2.m_head;
@@ -624,6 +638,7 @@ public:
 	void moveFrontToBack(SListPure<E> &L2) {
 		OGDF_ASSERT(m_head != nullptr)
 		OGDF_ASSERT(this != &L2)
+		OGDF_ASSERT(m_arena == L2.m_arena)
 		SListElement<E> *pX = m_head;
 		if ((m_head = m_head->m_next) == nullptr) m_tail = nullptr;
 		pX->m_next = nullptr;
@@ -640,6 +655,7 @@ public:
 	void moveFrontToSucc(SListPure<E> &L2, iterator itBefore) {
 		OGDF_ASSERT(m_head != nullptr)
 		OGDF_ASSERT(this != &L2)
+		OGDF_ASSERT(m_arena == L2.m_arena)
 		SListElement<E> *pBefore = itBefore;
 		SListElement<E> *pX = m_head;
 		if ((m_head = m_head->m_next) == nullptr) m_tail = nullptr;
@@ -650,6 +666,10 @@ public:
 
 	//! Appends \a L2 to this list and makes \a L2 empty.
 	void conc(SListPure<E> &L2) {
+		if (m_arena != L2.m_arena) {
+			moveElements(L2);
+			return;
+		}
 		if (m_head)
 			m_tail->m_next = L2.m_head;
 		else
@@ -801,6 +821,33 @@ protected:
 			pushBack(pX->m_x);
 	}
 
+	//! Moves the elements of \a L (which uses another arena) to the end of this list.
+	void moveElements(SListPure<E> &L) {
+		for(SListElement<E> *pX = L.m_head; pX != nullptr; pX = pX->m_next)
+			emplaceBack(std::move(pX->m_x));
+		L.clear();
+	}
+
+	//! Creates a new list element in the arena of the list or in the memory pool.
+	template<class ... Args>
+	SListElement<E> *newElement(Args && ... args) {
+		internal::ArenaInheritance<E> inherit(m_arena);
+		if (m_arena == nullptr)
+			return OGDF_NEW SListElement<E>(std::forward<Args>(args)...);
+		return new (m_arena->allocate(sizeof(SListElement<E>), alignof(SListElement<E>)))
+			SListElement<E>(std::forward<Args>(args)...);
+	}
+
+	//! Destroys list element \a pX created with newElement().
+	void deleteElement(SListElement<E> *pX) {
+		if (m_arena == nullptr) {
+			delete pX;
+		} else {
+			pX->~SListElement<E>();
+			m_arena->deallocate(pX, sizeof(SListElement<E>));
+		}
+	}
+
 	template<class RNG>
 	void permute(const int n, RNG &rng);
 
@@ -121,7 +121,11 @@ enum CPUFeature {
 	cpufVMX,    //!< Virtual Machine Extensions
 	cpufSMX,    //!< Safer Mode Extensions
 	cpufEST,    //!< Enhanced Intel SpeedStep Technology
-	cpufMONITOR //!< Processor supports MONITOR/MWAIT instructions
+	cpufMONITOR, //!< Processor supports MONITOR/MWAIT instructions
+	cpufAVX,    //!< Advanced Vector Extensions (AVX), also enabled by the operating system
+	cpufFMA,    //!< Fused multiply-add (FMA3), usable if AVX is
+	cpufAVX2,   //!< Advanced Vector Extensions 2 (AVX2), usable if AVX is
+	cpufAVX512F //!< AVX-512 Foundation, also enabled by the operating system
 };
 
 //! Bit mask for CPU features.
@@ -139,7 +143,11 @@ enum CPUFeatureMask {
 	cpufmVMX     = 1 << cpufVMX,    //!< Virtual Machine Extensions
 	cpufmSMX     = 1 << cpufSMX,    //!< Safer Mode Extensions
 	cpufmEST     = 1 << cpufEST,    //!< Enhanced Intel SpeedStep Technology
-	cpufmMONITOR = 1 << cpufMONITOR //!< Processor supports MONITOR/MWAIT instructions
+	cpufmMONITOR = 1 << cpufMONITOR, //!< Processor supports MONITOR/MWAIT instructions
+	cpufmAVX     = 1 << cpufAVX,     //!< Advanced Vector Extensions (AVX), also enabled by the operating system
+	cpufmFMA     = 1 << cpufFMA,     //!< Fused multiply-add (FMA3), usable if AVX is
+	cpufmAVX2    = 1 << cpufAVX2,    //!< Advanced Vector Extensions 2 (AVX2), usable if AVX is
+	cpufmAVX512F = 1 << cpufAVX512F  //!< AVX-512 Foundation, also enabled by the operating system
 };
 
 
@@ -0,0 +1,291 @@
+/** \file
+ * \brief Declaration of class TaskScheduler, a work-stealing thread pool.
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.txt in the root directory of the OGDF installation for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ *
+ * \see  http://www.gnu.org/copyleft/gpl.html
+ ***************************************************************/
+
+#pragma once
+
+#include <ogdf/basic/Array.h>
+#include <ogdf/basic/ArrayBuffer.h>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <vector>
+
+
+namespace ogdf {
+
+//! A work-stealing thread pool shared by OGDF's parallel algorithms.
+/**
+ * @ingroup threads
+ *
+ * The scheduler owns a fixed set of worker threads. Every worker has its own
+ * task queue; it executes the tasks it spawned itself newest first and steals
+ * the oldest tasks of other queues when its own queue runs empty. Threads
+ * waiting for a TaskGroup execute pending tasks meanwhile, so nested parallel
+ * calls (e.g., a parallel layout algorithm called for each connected component
+ * in parallel) are executed by the existing threads instead of starting new ones.
+ *
+ * Algorithms whose threads must run concurrently, e.g., because they
+ * synchronize with a Barrier, reserve idle workers by a Gang. A gang never
+ * waits for busy workers; it just gets fewer threads.
+ *
+ * Workers set up OGDF's memory management when they start and return the
+ * memory cached by them to the global pool whenever they run out of work.
+ */
+class OGDF_EXPORT TaskScheduler {
+public:
+	class TaskGroup;
+	class Gang;
+
+	//! Creates a scheduler with \a numWorkers worker threads.
+	/**
+	 * The thread calling the scheduler takes part in the work, so a scheduler
+	 * with 0 workers executes everything sequentially.
+	 */
+	explicit TaskScheduler(unsigned int numWorkers);
+
+	//! Terminates the worker threads; all gangs of the scheduler must have been destroyed.
+	~TaskScheduler();
+
+	//! Returns the scheduler used by OGDF's algorithms.
+	/**
+	 * It has one worker less than the number of hardware threads (and no
+	 * workers if OGDF's memory manager is not thread-safe).
+	 */
+	static TaskScheduler &global();
+
+	//! Returns the number of worker threads.
+	unsigned int numberOfWorkers() const { return m_numWorkers; }
+
+	//! Returns the maximum number of threads working at the same time (the workers and the caller).
+	unsigned int concurrency() const { return m_numWorkers + 1; }
+
+	//! Calls \a body(b, e) for disjoint ranges [b, e) covering [\a begin, \a end).
+	/**
+	 * The ranges have at most \a grainSize elements and are handed out
+	 * dynamically to at most \a maxThreads threads (0 = #concurrency()).
+	 * If only one thread is used, \a body is called once for the whole range.
+	 * Exceptions thrown by \a body are passed on to the caller.
+	 */
+	void parallelFor(int begin, int end, int grainSize,
+		const std::function<void(int, int)> &body, unsigned int maxThreads = 0);
+
+	//! Combines the results \a body(b, e) of the ranges [b, e) of \a grainSize elements covering [\a begin, \a end).
+	/**
+	 * The results are combined in the order of the ranges, starting with
+	 * \a identity, so the result does not depend on the number of threads.
+	 */
+	template<typename T, typename Body, typename Combine>
+	T parallelReduce(int begin, int end, int grainSize, const T &identity,
+		Body body, Combine combine, unsigned int maxThreads = 0)
+	{
+		if (begin >= end) {
+			return identity;
+		}
+		grainSize = max(1, grainSize);
+		const int numRanges = (end - begin - 1) / grainSize + 1;
+
+		Array<T> partial(numRanges);
+		parallelFor(0, numRanges, 1, [&](int first, int last) {
+			for (int r = first; r < last; ++r) {
+				const int b = begin + r * grainSize;
+				partial[r] = body(b, end - b > grainSize ? b + grainSize : end);
+			}
+		}, maxThreads);
+
+		T result = identity;
+		for (const T &x : partial) {
+			result = combine(result, x);
+		}
+		return result;
+	}
+
+	//! Sorts [\a first, \a last) stably according to \a comp.
+	/**
+	 * Runs of \a grainSize elements are sorted by at most \a maxThreads threads
+	 * (0 = #concurrency()) and merged pairwise in parallel. Since the order of a
+	 * stable sort is unique, the result does not depend on the number of threads.
+	 */
+	template<typename RandomIt, typename Compare>
+	void parallelStableSort(RandomIt first, RandomIt last, Compare comp,
+		int grainSize, unsigned int maxThreads = 0)
+	{
+		const int n = int(last - first);
+		grainSize = max(1, grainSize);
+		if (n <= grainSize || maxThreads == 1) {
+			std::stable_sort(first, last, comp);
+			return;
+		}
+
+		const int numRuns = (n - 1) / grainSize + 1;
+		parallelFor(0, numRuns, 1, [&](int b, int e) {
+			for (int r = b; r < e; ++r) {
+				std::stable_sort(first + r * grainSize, first + min(n, (r + 1) * grainSize), comp);
+			}
+		}, maxThreads);
+
+		// merge runs of doubling width, alternating between the range and a buffer
+		std::vector<typename std::iterator_traits<RandomIt>::value_type> buffer(first, last);
+		bool inBuffer = false;
+		for (int width = grainSize; width < n; width *= 2) {
+			const int numMerges = (n - 1) / (2 * width) + 1;
+			parallelFor(0, numMerges, 1, [&](int b, int e) {
+				for (int k = b; k < e; ++k) {
+					const int lo = 2 * k * width;
+					const int mid = min(n, lo + width);
+					const int hi = min(n, lo + 2 * width);
+					if (inBuffer) {
+						std::merge(buffer.begin() + lo, buffer.begin() + mid,
+							buffer.begin() + mid, buffer.begin() + hi, first + lo, comp);
+					} else {
+						std::merge(first + lo, first + mid,
+							first + mid, first + hi, buffer.begin() + lo, comp);
+					}
+				}
+			}, maxThreads);
+			inBuffer = !inBuffer;
+		}
+		if (inBuffer) {
+			std::copy(buffer.begin(), buffer.end(), first);
+		}
+	}
+
+private:
+	struct Task;
+	struct TaskQueue;
+	struct Worker;
+	struct GangJob;
+
+	unsigned int m_numWorkers;
+	Array<TaskQueue*> m_queues;		//!< The queues of the workers, followed by the queue of all other threads.
+	Array<Worker*> m_workers;
+
+	std::atomic<int> m_numQueued;	//!< The number of tasks in all queues.
+	std::atomic<int> m_numIdle;		//!< The number of sleeping, unreserved workers.
+	std::atomic<int> m_numBusy;		//!< The number of workers executing a task.
+
+	std::mutex m_idleMutex;				//!< Protects the idle list and the states of the workers.
+	ArrayBuffer<unsigned int> m_idle;	//!< The sleeping, unreserved workers.
+	unsigned int m_numReserved;			//!< The number of workers reserved by gangs.
+	bool m_shutdown;
+
+	//! Returns the queue of the calling thread.
+	unsigned int currentQueue() const;
+
+	void workerMain(unsigned int i);
+	void spawn(Task *task);
+	Task *findTask(unsigned int queue);
+	Task *popFront(unsigned int queue);
+	Task *popBack(unsigned int queue);
+	void execute(Task *task);
+	void helpUntilDone(TaskGroup &group);
+	void runGangMember(GangJob &job, unsigned int index);
+
+	void reserve(unsigned int numWorkers, ArrayBuffer<unsigned int> &members);
+	void release(unsigned int worker);
+	void startGangJob(const ArrayBuffer<unsigned int> &members, GangJob &job);
+};
+
+
+//! A group of tasks spawned in a TaskScheduler that can be waited for.
+/**
+ * @ingroup threads
+ */
+class OGDF_EXPORT TaskScheduler::TaskGroup {
+	friend class TaskScheduler;
+
+	TaskScheduler &m_scheduler;
+	std::atomic<int> m_pending;		//!< The number of spawned tasks not finished yet.
+	std::mutex m_exceptionMutex;
+	std::exception_ptr m_exception;	//!< The first exception thrown by a task.
+
+public:
+	//! Creates an empty task group in \a scheduler.
+	explicit TaskGroup(TaskScheduler &scheduler = TaskScheduler::global())
+		: m_scheduler(scheduler), m_pending(0) { }
+
+	//! Waits for the tasks of the group; exceptions thrown by them are dropped.
+	~TaskGroup();
+
+	//! Spawns \a work as a task of this group.
+	void run(std::function<void()> work);
+
+	//! Executes pending tasks until all tasks of this group are finished.
+	/**
+	 * If a task of the group threw an exception, the first one is rethrown.
+	 */
+	void wait();
+
+	TaskGroup(const TaskGroup &) = delete;
+	TaskGroup &operator=(const TaskGroup &) = delete;
+};
+
+
+//! Workers of a TaskScheduler reserved for running concurrently.
+/**
+ * @ingroup threads
+ *
+ * Reserved workers do not execute tasks; they run the functions passed to
+ * run() until the gang is destroyed.
+ */
+class OGDF_EXPORT TaskScheduler::Gang {
+	TaskScheduler &m_scheduler;
+	ArrayBuffer<unsigned int> m_members;	//!< The reserved workers.
+
+public:
+	//! Reserves up to \a maxThreads - 1 idle workers of \a scheduler (0 = as many as possible).
+	explicit Gang(unsigned int maxThreads, TaskScheduler &scheduler = TaskScheduler::global());
+
+	//! Releases the reserved workers.
+	~Gang();
+
+	//! Returns the number of threads of the gang, i.e., the reserved workers and the caller.
+	unsigned int size() const { return m_members.size() + 1; }
+
+	//! Releases workers such that the gang has at most \a numThreads threads.
+	void shrink(unsigned int numThreads);
+
+	//! Calls \a work(i) for i = 0, ..., size()-1 concurrently and waits for all calls.
+	/**
+	 * The caller runs \a work(0). If a call throws an exception, the first
+	 * one is rethrown after all calls have finished.
+	 */
+	void run(const std::function<void(unsigned int)> &work);
+
+	Gang(const Gang &) = delete;
+	Gang &operator=(const Gang &) = delete;
+};
+
+} // end namespace ogdf
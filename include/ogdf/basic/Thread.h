@@ -49,9 +49,10 @@ namespace ogdf {
  * that worker functions correctly call thread-specific initialization and clean-up
  * functions for OGDF's memory management.
  *
- * If you use OGDF data structures in your threads you have to use the Thread class
- * (instead of just using std::thread), or you need to the initThread() and flushPool()
- * functions of the memory allocator manually (see Thread's constructor for an example).
+ * OGDF data structures can also be used in threads that are not created via this class
+ * (e.g., \c std::thread or threads of a thread pool), since the memory allocator creates
+ * and releases thread caches automatically. Using Thread returns the memory cached by the
+ * thread to the global pool already when the worker function finishes.
  */
 class Thread : public std::thread
 {
@@ -37,6 +37,7 @@
 #include <ogdf/basic/EdgeArray.h>
 #include <ogdf/basic/SList.h>
 #include <ogdf/basic/BoundedStack.h>
+#include <ogdf/basic/CSRGraph.h>
 
 namespace ogdf {
 
@@ -447,6 +448,16 @@ inline void makeSimpleUndirected(Graph &G) {
 OGDF_EXPORT bool isConnected(const Graph &G);
 
 
+//! Returns true iff the graph represented by the snapshot \a G is connected.
+/**
+ * @ingroup ga-connectivity
+ *
+ * @param G is the input graph snapshot.
+ * @return true if \a G is connected, false otherwise.
+ */
+OGDF_EXPORT bool isConnected(const CSRGraph &G);
+
+
 //! Makes \a G connected by adding a minimum number of edges.
 /**
  * @ingroup ga-connectivity
@@ -483,6 +494,36 @@ inline void makeConnected(Graph &G) {
 OGDF_EXPORT int connectedComponents(const Graph &G, NodeArray<int> &component);
 
 
+//! Computes the connected components of the graph represented by the snapshot \a G.
+/**
+ * @ingroup ga-connectivity
+ *
+ * Yields the same component numbers as connectedComponents(const Graph&, NodeArray<int>&)
+ * applied to the original graph.
+ *
+ * @param G         is the input graph snapshot.
+ * @param component is assigned a mapping from nodes of the original graph to component numbers.
+ * @return the number of connected components.
+ */
+OGDF_EXPORT int connectedComponents(const CSRGraph &G, NodeArray<int> &component);
+
+
+//! Computes the connected components of the graph represented by the snapshot \a G using \a numThreads threads.
+/**
+ * @ingroup ga-connectivity
+ *
+ * The edges are processed concurrently by a lock-free union-find structure.
+ * Yields the same component numbers as connectedComponents(const Graph&, NodeArray<int>&)
+ * applied to the original graph.
+ *
+ * @param G          is the input graph snapshot.
+ * @param component  is assigned a mapping from nodes of the original graph to component numbers.
+ * @param numThreads is the number of threads; 0 uses one thread per core, 1 runs the sequential algorithm.
+ * @return the number of connected components.
+ */
+OGDF_EXPORT int connectedComponents(const CSRGraph &G, NodeArray<int> &component, unsigned int numThreads);
+
+
 //! Computes the connected components of \a G and returns the list of isolated nodes.
 /**
  * @ingroup ga-connectivity
@@ -525,6 +566,29 @@ inline bool isBiconnected(const Graph &G) {
 }
 
 
+//! Returns true iff the graph represented by the snapshot \a G is biconnected.
+/**
+ * @ingroup ga-connectivity
+ *
+ * @param G is the input graph snapshot.
+ * @param cutVertex If false is returned, \a cutVertex is assigned either 0 if \a G is not connected,
+ *                  or a cut vertex of the original graph.
+ */
+OGDF_EXPORT bool isBiconnected(const CSRGraph &G, node &cutVertex);
+
+
+//! Returns true iff the graph represented by the snapshot \a G is biconnected.
+/**
+ * @ingroup ga-connectivity
+ *
+ * @param G is the input graph snapshot.
+ */
+inline bool isBiconnected(const CSRGraph &G) {
+	node cutVertex;
+	return isBiconnected(G,cutVertex);
+}
+
+
 //! Makes \a G biconnected by adding edges.
 /**
  * @ingroup ga-connectivity
@@ -561,6 +625,37 @@ inline void makeBiconnected(Graph &G) {
 OGDF_EXPORT int biconnectedComponents(const Graph &G, EdgeArray<int> &component);
 
 
+//! Computes the biconnected components of the graph represented by the snapshot \a G.
+/**
+ * @ingroup ga-connectivity
+ *
+ * Yields the same component numbers as biconnectedComponents(const Graph&, EdgeArray<int>&)
+ * applied to the original graph, but uses an explicit stack instead of recursion.
+ *
+ * @param G         is the input graph snapshot.
+ * @param component is assigned a mapping from edges of the original graph to component numbers.
+ * @return the number of biconnected components (including isolated nodes).
+ */
+OGDF_EXPORT int biconnectedComponents(const CSRGraph &G, EdgeArray<int> &component);
+
+
+//! Computes the biconnected components of the graph represented by the snapshot \a G using \a numThreads threads.
+/**
+ * @ingroup ga-connectivity
+ *
+ * Uses the algorithm of Tarjan and Vishkin on a breadth-first spanning forest that is
+ * built level by level in parallel. The partition of the edges into biconnected
+ * components is the same as for biconnectedComponents(const Graph&, EdgeArray<int>&),
+ * but the components may be numbered differently. Self-loops are not assigned a component.
+ *
+ * @param G          is the input graph snapshot.
+ * @param component  is assigned a mapping from edges of the original graph to component numbers.
+ * @param numThreads is the number of threads; 0 uses one thread per core, 1 runs the sequential algorithm.
+ * @return the number of biconnected components (including isolated nodes).
+ */
+OGDF_EXPORT int biconnectedComponents(const CSRGraph &G, EdgeArray<int> &component, unsigned int numThreads);
+
+
 //! Returns true iff \a G is triconnected.
 /**
  * @ingroup ga-connectivity
@@ -669,6 +764,29 @@ inline bool isAcyclic(const Graph &G) {
 }
 
 
+//! Returns true iff the digraph represented by the snapshot \a G is acyclic.
+/**
+ * @ingroup ga-digraph
+ *
+ * @param G is the input graph snapshot.
+ * @return true if \a G contains no directed cycle, false otherwise.
+ */
+OGDF_EXPORT bool isAcyclic(const CSRGraph &G);
+
+
+//! Returns true iff the digraph represented by the snapshot \a G is acyclic; uses \a numThreads threads.
+/**
+ * @ingroup ga-digraph
+ *
+ * Runs Kahn's algorithm and processes the nodes of each level in parallel.
+ *
+ * @param G          is the input graph snapshot.
+ * @param numThreads is the number of threads; 0 uses one thread per core, 1 runs the sequential algorithm.
+ * @return true if \a G contains no directed cycle, false otherwise.
+ */
+OGDF_EXPORT bool isAcyclic(const CSRGraph &G, unsigned int numThreads);
+
+
 //! Returns true iff the undirected graph \a G is acyclic.
 /**
  * @ingroup ga-digraph
@@ -807,6 +925,39 @@ inline bool isStGraph(const Graph &G) {
 OGDF_EXPORT void topologicalNumbering(const Graph &G, NodeArray<int> &num);
 
 
+//! Computes a topological numbering of the acyclic digraph represented by the snapshot \a G.
+/**
+ * @ingroup ga-digraph
+ *
+ * Yields the same numbering as topologicalNumbering(const Graph&, NodeArray<int>&)
+ * applied to the original graph.
+ *
+ * \pre \a G is an acyclic directed graph.
+ *
+ * @param G   is the input graph snapshot.
+ * @param num is assigned the topological numbering (0, 1, ...) of the nodes of the original graph.
+ */
+OGDF_EXPORT void topologicalNumbering(const CSRGraph &G, NodeArray<int> &num);
+
+
+//! Computes a topological numbering of the acyclic digraph represented by the snapshot \a G using \a numThreads threads.
+/**
+ * @ingroup ga-digraph
+ *
+ * Runs Kahn's algorithm and processes the nodes of each level in parallel. With more
+ * than one thread, the nodes are numbered level by level, i.e., a node gets a larger
+ * number than all nodes of smaller levels, where the level of a node is the length of
+ * a longest path ending in it. The order within a level may differ from run to run.
+ *
+ * \pre \a G is an acyclic directed graph.
+ *
+ * @param G          is the input graph snapshot.
+ * @param num        is assigned the topological numbering (0, 1, ...) of the nodes of the original graph.
+ * @param numThreads is the number of threads; 0 uses one thread per core, 1 runs the sequential algorithm.
+ */
+OGDF_EXPORT void topologicalNumbering(const CSRGraph &G, NodeArray<int> &num, unsigned int numThreads);
+
+
 //! Computes the strongly connected components of the digraph \a G.
 /**
  * @ingroup ga-connectivity
@@ -109,6 +109,9 @@ namespace ogdf {
  *     <td><i>maxIntPosExponent</i><td>int<td>40
  *     <td>Defines the exponent used if allowedPositions == apExponent.
  *   </tr><tr>
+ *     <td><i>numberOfThreads</i><td>unsigned int<td>1
+ *     <td>The number of threads calculating the forces (0 = all threads).
+ *   </tr><tr>
  *     <th colspan="4" align="center"><b>Divide et impera step</b>
  *   </tr><tr>
  *     <td><i>pageRatio</i><td>double<td>1.0
@@ -521,6 +524,19 @@ public:
 		m_maxIntPosExponent = (((e >= 31)&&(e<=51))? e : 31);
 	}
 
+	//! Returns the number of threads calculating the forces (0 = all threads of the global TaskScheduler).
+	unsigned int numberOfThreads() const { return m_numberOfThreads; }
+
+	//! Sets the number of threads calculating the forces to \a n (0 = all threads of the global TaskScheduler).
+	/**
+	 * For any value other than 1, the attractive forces and the steps of the
+	 * New Multipole Method following the quadtree construction are calculated
+	 * in parallel. The drawing does not depend on \a n then, but it may differ
+	 * slightly from the drawing computed by a single thread. The multilevel
+	 * coarsening and the quadtree construction are sequential.
+	 */
+	void numberOfThreads(unsigned int n) { m_numberOfThreads = n; }
+
 
 	/** @}
 	 *  @name Options for the divide et impera step
@@ -932,6 +948,7 @@ private:
 	EdgeLengthMeasurement m_edgeLengthMeasurement; //!< The option for edge length measurement.
 	AllowedPositions      m_allowedPositions; //!< The option for allowed positions.
 	int                   m_maxIntPosExponent; //!< The option for the used	exponent.
+	unsigned int          m_numberOfThreads; //!< The number of threads calculating the forces.
 
 	//options for divide et impera step
 	double                m_pageRatio; //!< The desired page ratio.
@@ -98,6 +98,13 @@ public:
 #endif
 	}
 
+	//! returns the accumulated times of the build, expansion and force phases of the last call
+	/**
+	 * The times are only measured for graphs with at least 100 nodes which are laid out using the
+	 * quadtree. For smaller graphs all times are zero.
+	 */
+	const FMEPhaseTimes& phaseTimes() const { return m_phaseTimes; }
+
 	//void setEnablePostProcessing(bool b) { m_doPostProcessing = b; }
 private:
 	void initOptions();
@@ -134,6 +141,8 @@ private:
 	uint32_t m_numberOfThreads;
 
 	uint32_t m_maxNumberOfThreads;
+
+	FMEPhaseTimes m_phaseTimes;
 };
 
 
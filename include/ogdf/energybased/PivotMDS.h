@@ -38,6 +38,7 @@
 #pragma once
 
 #include <ogdf/basic/simple_graph_alg.h>
+#include <ogdf/basic/Array2D.h>
 #include <ogdf/graphalg/ShortestPathAlgorithms.h>
 #include <ogdf/module/LayoutModule.h>
 
@@ -59,7 +60,8 @@ inline bool isinf(T value)
  */
 class OGDF_EXPORT PivotMDS : public LayoutModule {
 public:
-	PivotMDS() : m_numberOfPivots(250), m_edgeCosts(100), m_hasEdgeCostsAttribute(false) { }
+	PivotMDS() : m_numberOfPivots(250), m_edgeCosts(100), m_hasEdgeCostsAttribute(false),
+		m_numberOfThreads(0), m_singlePrecision(false) { }
 
 	virtual ~PivotMDS() { }
 
@@ -87,6 +89,35 @@ public:
 		return m_hasEdgeCostsAttribute;
 	}
 
+	//! Sets the number of threads to \a n (0 = one thread per core).
+	/**
+	 * The threads compute the distances from the pivots and the products with the pivot
+	 * matrix. With several threads, the pivots are chosen in rounds of up to one pivot
+	 * per thread (see MAX_PIVOTS_PER_ROUND), so the layout depends on the number of
+	 * threads; a single thread uses the exact max-min strategy.
+	 */
+	void setNumberOfThreads(unsigned int n) {
+		m_numberOfThreads = n;
+	}
+
+	//! Returns the number of threads (0 = one thread per core).
+	unsigned int numberOfThreads() const {
+		return m_numberOfThreads;
+	}
+
+	//! Sets whether the pivot distance matrix is stored in single precision.
+	/**
+	 * This halves the memory of the matrix, which dominates for large graphs;
+	 * all sums are still computed in double precision.
+	 */
+	void useSinglePrecision(bool singlePrecision) {
+		m_singlePrecision = singlePrecision;
+	}
+
+	bool useSinglePrecision() const {
+		return m_singlePrecision;
+	}
+
 private:
 
 	//! The dimension count determines the number of evecs that
@@ -94,7 +125,23 @@ private:
 	//! with the highest eigenwert into account.
 	const static int DIMENSION_COUNT = 2;
 
-	//! Convergence factor used for power iteration.
+	//! The number of additional vectors of the subspace iteration.
+	/**
+	 * The leading eigenvectors converge with the ratio of the eigenvalues
+	 * DIMENSION_COUNT + OVERSAMPLING + 1 and DIMENSION_COUNT instead of
+	 * DIMENSION_COUNT + 1 and DIMENSION_COUNT.
+	 */
+	const static int OVERSAMPLING = 4;
+
+	//! The maximum number of pivots whose distances are computed concurrently.
+	/**
+	 * The pivots of a round are chosen by the max-min strategy, but distances
+	 * to pivots of the same round are estimated from the previous round, which
+	 * spreads the pivots less evenly the larger a round is.
+	 */
+	const static int MAX_PIVOTS_PER_ROUND = 8;
+
+	//! Convergence factor used for the subspace iteration.
 	const static double EPSILON;
 
 	//! Factor used to center the pivot matrix.
@@ -113,25 +160,35 @@ private:
 	//! edge costs attribute
 	bool m_hasEdgeCostsAttribute;
 
+	//! The number of threads (0 = one thread per core).
+	unsigned int m_numberOfThreads;
+
+	//! Tells whether the pivot matrix is stored in single precision.
+	bool m_singlePrecision;
+
 	//! Centers the pivot matrix.
-	void centerPivotmatrix(Array<Array<double> >& pivotMatrix);
+	template<typename T>
+	void centerPivotmatrix(Array2D<T>& pivotMatrix);
 
 	//! Computes the pivot mds layout of the given connected graph of \a GA.
 	void pivotMDSLayout(GraphAttributes& GA);
 
-	void copySPSS(Array<double>& copyTo, NodeArray<double>& copyFrom);
+	//! Computes the coordinates of the pivot mds layout with a pivot matrix of type \a T.
+	template<typename T>
+	void pivotMDSCoordinates(const GraphAttributes& GA, Array<Array<double> >& coord);
 
 	//! Computes the layout of a path.
 	void doPathLayout(GraphAttributes& GA, const node& v);
 
-	//! Computes the eigen value decomposition based on power iteration.
+	//! Computes the eigen value decomposition based on subspace iteration.
 	void eigenValueDecomposition(
-		Array<Array<double> >& K,
+		const Array2D<double>& K,
 		Array<Array<double> >& eVecs,
 		Array<double>& eValues);
 
 	//! Computes the pivot distance matrix based on the maxmin strategy
-	void getPivotDistanceMatrix(const GraphAttributes& GA, Array<Array<double> >& pivDistMatrix);
+	template<typename T>
+	void getPivotDistanceMatrix(const GraphAttributes& GA, Array2D<T>& pivDistMatrix);
 
 	//! Checks whether the given graph is a path or not.
 	node getRootedPath(const Graph& G);
@@ -146,11 +203,13 @@ private:
 	void randomize(Array<Array<double> >& matrix);
 
 	//! Computes the self product of \a d.
-	void selfProduct(const Array<Array<double> >&d, Array<Array<double> >& result);
+	template<typename T>
+	void selfProduct(const Array2D<T>& d, Array2D<double>& result);
 
 	//! Computes the singular value decomposition of matrix \a K.
+	template<typename T>
 	void singularValueDecomposition(
-		Array<Array<double> >& K,
+		const Array2D<T>& K,
 		Array<Array<double> >& eVecs,
 		Array<double>& eVals);
 };
@@ -114,6 +114,25 @@ public:
 	bool checkConvergence() {return m_checkConvergence;}
 	void convTolerance(double tol) {m_convTolerance = tol;}
 
+	//! Returns the number of threads computing the repulsive forces (0 = number of cores).
+	unsigned int numberOfThreads() const { return m_numberOfThreads; }
+
+	//! Sets the number of threads computing the repulsive forces to \a n (0 = number of cores).
+	/**
+	 * Small graphs use fewer threads. The layout does not depend on \a n.
+	 */
+	void numberOfThreads(unsigned int n) { m_numberOfThreads = n; }
+
+	//! Returns whether repulsive forces are computed in single precision.
+	bool singlePrecision() const { return m_singlePrecision; }
+
+	//! Sets whether repulsive forces are computed in single precision.
+	/**
+	 * Single precision processes twice as many node pairs per vector
+	 * instruction; positions are still updated in double precision.
+	 */
+	void singlePrecision(bool on) { m_singlePrecision = on; }
+
 private:
 	class ArrayGraph
 	{
@@ -159,8 +178,8 @@ private:
 	}
 
 	void initialize(ArrayGraph &component);
+	template<typename T>
 	void mainStep(ArrayGraph &component);
-	void mainStep_sse3(ArrayGraph &component);
 
 	// Fruchterman, Reingold
 	//double f_att(double d) { return d*d / m_idealEdgeLength; }
@@ -195,6 +214,8 @@ private:
 	bool m_useNodeWeight;
 	bool m_checkConvergence; //<! If set to true, computation is stopped if movement falls below threshold
 	double m_convTolerance; //<! Fraction of ideal edge length below which convergence is achieved
+	unsigned int m_numberOfThreads; //!< The number of threads computing repulsive forces (0 = number of cores).
+	bool m_singlePrecision; //!< Compute repulsive forces in single precision?
 };
 
 
@@ -271,11 +271,11 @@ private:
 
 		int m_gridX;
 		int m_gridY;
-
-		ListIterator<int> m_lit;
 	};
 
 
+	class Grid;
+
 	class ForceModelBase;
 	class ForceModelFR;
 	class ForceModelFRModAttr;
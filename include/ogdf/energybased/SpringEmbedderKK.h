@@ -37,6 +37,7 @@
 
 #include <ogdf/module/LayoutModule.h>
 #include <ogdf/basic/Array2D.h>
+#include <ogdf/basic/NodeMatrix.h>
 #include <ogdf/basic/tuples.h>
 #include <ogdf/basic/GraphCopyAttributes.h>
 
@@ -92,7 +93,7 @@ public:
 	//! Constructor: Constructs instance of Kamada Kawai Layout
 	SpringEmbedderKK() : m_tolerance(0.001), m_ltolerance(0.0001), m_computeMaxIt(true),
 		m_K(5.0), m_desLength(0.0), m_distFactor(2.0), m_useLayout(true),
-		m_gItBaseVal(50), m_gItFactor(16)
+		m_gItBaseVal(50), m_gItFactor(16), m_numberOfThreads(0)
 	{
 		m_maxLocalIt = m_maxGlobalIt = maxVal;
 	}
@@ -155,6 +156,15 @@ public:
 	{
 		m_computeMaxIt = b;
 	}
+
+	//! Sets the number of threads to \a numThreads.
+	//! The value 0 (default) uses all hardware threads. The threads compute the all-pairs
+	//! shortest paths and update the partial derivatives of the nodes (at least 256 nodes
+	//! per thread). The layout does not depend on the number of threads.
+	void setNumberOfThreads(unsigned int numThreads) {m_numberOfThreads = numThreads;}
+	//! Returns the number of threads.
+	unsigned int numberOfThreads() const {return m_numberOfThreads;}
+
 	//We could add some noise to the computation
 	// Returns the current setting of nodes.
 	//bool noise() const {
@@ -223,26 +233,26 @@ protected:
 	dpair computeParDer(node m,
 		node u,
 		GraphAttributes& GA,
-		NodeArray< NodeArray<double> >& ss,
-		NodeArray< NodeArray<double> >& dist);
+		NodeMatrix<double>& ss,
+		NodeMatrix<double>& dist);
 	//! Compute partial derivative for v
 	dpair computeParDers(node v,
 		GraphAttributes& GA,
-		NodeArray< NodeArray<double> >& ss,
-		NodeArray< NodeArray<double> >& dist);
+		NodeMatrix<double>& ss,
+		NodeMatrix<double>& dist);
 	//! Does the necessary initialization work for the call functions
 	void initialize(GraphAttributes& GA,
 		NodeArray<dpair>& partialDer,
 		const EdgeArray<double>& eLength,
-		NodeArray< NodeArray<double> >& oLength,
-		NodeArray< NodeArray<double> >& sstrength,
+		NodeMatrix<double>& oLength,
+		NodeMatrix<double>& sstrength,
 		double & maxDist,
 		bool simpleBFS);
 	//! Main computation loop, nodes are moved here
 	void mainStep(GraphAttributes& GA,
 		NodeArray<dpair>& partialDer,
-		NodeArray< NodeArray<double> >& oLength,
-		NodeArray< NodeArray<double> >& sstrength,
+		NodeMatrix<double>& oLength,
+		NodeMatrix<double>& sstrength,
 		const double maxDist);
 	//! Does the scaling if no edge lengths are given but node sizes
 	//! are respected
@@ -268,6 +278,7 @@ private:
 	bool m_useLayout; //!< use positions or allow to shuffle nodes to avoid degeneration
 	int m_gItBaseVal; //!< minimum number of global iterations
 	int m_gItFactor;  //!< factor for global iterations: m_gItBaseVal+m_gItFactor*|V|
+	unsigned int m_numberOfThreads; //!< number of threads (0 = number of hardware threads)
 
 	static const double startVal;
 	static const double minVal;
@@ -275,9 +286,11 @@ private:
 	//! Smaller values are treated as zero
 	static const int maxVal; //! defines infinite upper bound for iteration number
 
-	double allpairsspBFS(const Graph& G, NodeArray< NodeArray<double> >& distance);
+	double allpairsspBFS(const Graph& G, NodeMatrix<double>& distance);
 	double allpairssp(const Graph& G, const EdgeArray<double>& eLengths,
-		NodeArray< NodeArray<double> >& distance,	const double threshold = numeric_limits<double>::max());
+		NodeMatrix<double>& distance);
+	//! Returns the maximum finite entry of \a distance.
+	static double maxFiniteDistance(const NodeMatrix<double>& distance);
 };//SpringEmbedderKK
 
 //Things that potentially could be added
@@ -65,7 +65,8 @@ public:
 			m_hasEdgeCostsAttribute(false), m_hasInitialLayout(false), m_numberOfIterations(
 					200), m_edgeCosts(100), m_avgEdgeCosts(-1), m_componentLayout(
 					false), m_terminationCriterion(NONE), m_fixXCoords(false), m_fixYCoords(
-					false), m_fixZCoords(false) {
+					false), m_fixZCoords(false), m_sparseStress(false), m_numberOfPivots(
+					DEFAULT_NUMBER_OF_SPARSE_PIVOTS), m_neighborhoodDepth(1) {
 	}
 
 	//! Destructor.
@@ -108,6 +109,27 @@ public:
 	//! Tells whether the edge costs are uniform or defined by some edge costs attribute.
 	inline void useEdgeCostsAttribute(bool useEdgeCostsAttribute);
 
+	//! Sets whether the sparse stress model is minimized instead of the full stress.
+	/**
+	 * The full stress has a term for every pair of nodes and needs quadratic time
+	 * and memory. In the sparse stress model (Ortmann, Klimenta, Brandes:
+	 * A Sparse Stress Model, 2016) only pairs of nodes within
+	 * setNeighborhoodDepth() hops contribute exact terms. All other pairs are
+	 * approximated by the terms of each node and the setNumberOfPivots() pivots,
+	 * weighted by the number of nodes the pivot represents. This needs
+	 * O(k(n+m)) time to set up and O(kn) memory for k pivots, plus the
+	 * neighborhood terms.
+	 */
+	inline void useSparseStress(bool sparseStress);
+
+	//! Sets the number of pivots of the sparse stress model. If the new value is smaller or equal
+	//! 0 the default value (200) is used.
+	inline void setNumberOfPivots(int numberOfPivots);
+
+	//! Sets the number of hops up to which node pairs contribute exact terms to the sparse
+	//! stress model. If the new value is smaller or equal 0 the default value (1) is used.
+	inline void setNeighborhoodDepth(int depth);
+
 private:
 
 	//! Convergence constant.
@@ -116,6 +138,9 @@ private:
 	//! Default number of pivots used for the initial Pivot-MDS layout
 	const static int DEFAULT_NUMBER_OF_PIVOTS;
 
+	//! Default number of pivots of the sparse stress model.
+	const static int DEFAULT_NUMBER_OF_SPARSE_PIVOTS = 200;
+
 	//! Tells whether the stress minimization is based on uniform edge costs or a
 	//! edge costs attribute
 	bool m_hasEdgeCostsAttribute;
@@ -148,21 +173,33 @@ private:
 	//! Indicates whether the z coordinates will be modified or not.
 	bool m_fixZCoords;
 
+	//! Indicates whether the sparse stress model is used.
+	bool m_sparseStress;
+
+	//! The number of pivots of the sparse stress model.
+	int m_numberOfPivots;
+
+	//! The number of hops up to which node pairs contribute exact terms to the sparse stress model.
+	int m_neighborhoodDepth;
+
 	//! Calculates the stress for the given layout
 	double calcStress(const GraphAttributes& GA,
-			NodeArray<NodeArray<double> >& shortestPathMatrix,
-			NodeArray<NodeArray<double> >& weightMatrix);
+			NodeMatrix<double>& shortestPathMatrix,
+			NodeMatrix<double>& weightMatrix);
 
 	//! Runs the stress for a given Graph, shortest path and weight matrix.
 	void call(GraphAttributes& GA,
-			NodeArray<NodeArray<double> >& shortestPathMatrix,
-			NodeArray<NodeArray<double> >& weightMatrix);
+			NodeMatrix<double>& shortestPathMatrix,
+			NodeMatrix<double>& weightMatrix);
 
 	//! Calculates the weight matrix of the shortest path matrix. This is done by w_ij = s_ij^{-2}
 	void calcWeights(const Graph& G,
 			const int dimension,
-			NodeArray<NodeArray<double> >& shortestPathMatrix,
-			NodeArray<NodeArray<double> >& weightMatrix);
+			NodeMatrix<double>& shortestPathMatrix,
+			NodeMatrix<double>& weightMatrix);
+
+	//! Minimizes the sparse stress model of the graph of \a GA.
+	void callSparse(GraphAttributes& GA);
 
 	//! Calculates the intial layout of the graph if necessary.
 	void computeInitialLayout(GraphAttributes& GA);
@@ -181,26 +218,21 @@ private:
 			NodeArray<double>& prevXCoords, NodeArray<double>& prevYCoords,
 			const double prevStress, const double curStress);
 
-	//! Convenience method to initialize the matrices.
-	void initMatrices(const Graph& G,
-			NodeArray<NodeArray<double> >& shortestPathMatrix,
-			NodeArray<NodeArray<double> >& weightMatrix);
-
 	//! Minimizes the stress for each component separately given
 	//! the shortest path matrix and the weight matrix.
 	void minimizeStress(GraphAttributes& GA,
-			NodeArray<NodeArray<double> >& shortestPathMatrix,
-			NodeArray<NodeArray<double> >& weightMatrix);
+			NodeMatrix<double>& shortestPathMatrix,
+			NodeMatrix<double>& weightMatrix);
 
 	//! Runs the next iteration of the stress minimization process. Note that serial update
 	//! is used.
 	void nextIteration(GraphAttributes& GA,
-			NodeArray<NodeArray<double> >& shortestPathMatrix,
-			NodeArray<NodeArray<double> >& weightMatrix);
+			NodeMatrix<double>& shortestPathMatrix,
+			NodeMatrix<double>& weightMatrix);
 
 	//! Replaces infinite distances to the given value
 	void replaceInfinityDistances(
-			NodeArray<NodeArray<double> >& shortestPathMatrix, double newVal);
+			NodeMatrix<double>& shortestPathMatrix, double newVal);
 
 }
 ;
@@ -237,4 +269,16 @@ void StressMinimization::useEdgeCostsAttribute(bool useEdgeCostsAttribute) {
 	m_hasEdgeCostsAttribute = useEdgeCostsAttribute;
 }
 
+void StressMinimization::useSparseStress(bool sparseStress) {
+	m_sparseStress = sparseStress;
+}
+
+void StressMinimization::setNumberOfPivots(int numberOfPivots) {
+	m_numberOfPivots = (numberOfPivots > 0) ? numberOfPivots : DEFAULT_NUMBER_OF_SPARSE_PIVOTS;
+}
+
+void StressMinimization::setNeighborhoodDepth(int depth) {
+	m_neighborhoodDepth = (depth > 0) ? depth : 1;
+}
+
 } // end namespace
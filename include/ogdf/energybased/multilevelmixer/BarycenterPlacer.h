@@ -52,6 +52,8 @@ public:
 
 	void placeOneLevel(MultilevelGraph &MLG);
 	void placeOneNode(MultilevelGraph &MLG);
+	//! Places all reinserted nodes of a compact level at once, on several threads.
+	void prolongateOneLevel(MultilevelGraph &MLG) override;
 	void weightedPositionPriority(bool on);
 };
 
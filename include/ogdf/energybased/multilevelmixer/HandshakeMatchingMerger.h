@@ -0,0 +1,88 @@
+/** \file
+ * \brief Coarsens a graph by parallel handshake matchings
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.txt in the root directory of the OGDF installation for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ *
+ * \see  http://www.gnu.org/copyleft/gpl.html
+ ***************************************************************/
+
+#pragma once
+
+#include <ogdf/energybased/multilevelmixer/MultilevelBuilder.h>
+
+namespace ogdf {
+
+//! The handshake matching merger for multilevel layout.
+/**
+ * @ingroup gd-multi
+ *
+ * Every level is the contraction of a matching that is computed by handshakes:
+ * every unmatched node proposes to its best unmatched neighbour, and mutual
+ * proposals are matched. Edges are rated by the product of the merge weights
+ * of their end nodes, rounded to a power of two; lighter edges are preferred and
+ * ties are broken randomly.
+ *
+ * Unlike the other mergers, the levels are not built by single node merges but
+ * as compact graphs (see CompactGraph) that are contracted on several threads.
+ * Placers expand them with InitialPlacer::prolongateOneLevel().
+ * Coarsening stops when at most three nodes are left or a matching reduces the
+ * number of nodes by less than five percent.
+ * Multiple edges between two coarse nodes are merged into one with their mean
+ * weight, to which the edge length adjustment factor times the mean length of
+ * the contracted edges at its end nodes is added.
+ */
+class OGDF_EXPORT HandshakeMatchingMerger : public MultilevelBuilder
+{
+	unsigned int m_numberOfThreads;
+
+	bool buildOneLevel(MultilevelGraph &MLG) override;
+
+	//! Contracts a matching of \a fine into \a coarse and stores the parents in \a parent.
+	/**
+	 * Returns false if \a fine cannot be coarsened any further.
+	 */
+	bool coarsen(const CompactGraph &fine, std::vector<int> &parent, CompactGraph &coarse);
+
+	//! Computes a matching of \a fine; \a mate is -1 for unmatched nodes and \a matchEdge is the matched edge.
+	void computeMatching(const CompactGraph &fine, std::vector<int> &mate, std::vector<int> &matchEdge);
+
+public:
+	HandshakeMatchingMerger();
+
+	void buildAllLevels(MultilevelGraph &MLG) override;
+
+	//! Returns the number of threads used for coarsening (0 = all available).
+	unsigned int numberOfThreads() const { return m_numberOfThreads; }
+
+	//! Sets the number of threads used for coarsening (0 = all available).
+	/**
+	 * The levels do not depend on the number of threads.
+	 */
+	void numberOfThreads(unsigned int n) { m_numberOfThreads = n; }
+};
+
+} // namespace ogdf
@@ -36,6 +36,7 @@
 
 #include <ogdf/basic/Graph.h>
 #include <ogdf/internal/energybased/MultilevelGraph.h>
+#include <vector>
 
 namespace ogdf {
 
@@ -54,11 +55,22 @@ public:
 
 	virtual void placeOneLevel(MultilevelGraph &MLG) = 0;
 
+	//! Expands the last compact level of \a MLG (see MultilevelGraph::expandCompactLevel()) and places its nodes.
+	/**
+	 * The default implementation places every reinserted node at the position
+	 * of its representative.
+	 */
+	virtual void prolongateOneLevel(MultilevelGraph &MLG);
+
 	void setRandomOffset(bool on)
 	{
 		m_randomOffset = on;
 	}
 
+protected:
+	//! Places \a inserted[i] at (\a x[i], \a y[i]), moved by a random offset in [-\a range, \a range] if enabled.
+	void placeInserted(MultilevelGraph &MLG, const std::vector<node> &inserted,
+		const std::vector<double> &x, const std::vector<double> &y, double range = 1.0);
 };
 
 } // namespace ogdf
@@ -46,6 +46,8 @@ class OGDF_EXPORT MedianPlacer : public InitialPlacer
 {
 public:
 	void placeOneLevel(MultilevelGraph &MLG);
+	//! Places all reinserted nodes of a compact level at once, on several threads.
+	void prolongateOneLevel(MultilevelGraph &MLG) override;
 
 private:
 	void placeOneNode(MultilevelGraph &MLG);
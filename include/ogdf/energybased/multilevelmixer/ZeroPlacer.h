@@ -51,6 +51,7 @@ class OGDF_EXPORT ZeroPlacer : public InitialPlacer
 public:
 
 	void placeOneLevel(MultilevelGraph &MLG);
+	void prolongateOneLevel(MultilevelGraph &MLG) override;
 	ZeroPlacer();
 	void setRandomRange(double range);
 };
@@ -0,0 +1,149 @@
+/** \file
+ * \brief Declaration of class GmlStreamParser, a GML parser without parse tree.
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.txt in the root directory of the OGDF installation for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ *
+ * \see  http://www.gnu.org/copyleft/gpl.html
+ ***************************************************************/
+
+#pragma once
+
+#include <ogdf/fileformats/InputBuffer.h>
+#include <ogdf/basic/GraphAttributes.h>
+#include <ogdf/cluster/ClusterGraph.h>
+#include <ogdf/cluster/ClusterGraphAttributes.h>
+#include <unordered_map>
+
+
+namespace ogdf {
+
+//! Reads GML files in a single pass without building a parse tree.
+/**
+ * In contrast to GmlParser, which first builds the complete GmlObject tree,
+ * this parser creates nodes and edges and sets their attributes while
+ * scanning the input. Only the attributes of the current node, edge or
+ * cluster are kept, hence the memory used besides the resulting graph is
+ * bounded by the input window and the mapping of node ids.
+ *
+ * The accepted input is the same as for GmlParser with the following
+ * exceptions:
+ *   - lines are not limited to 254 characters;
+ *   - a \c rootcluster list has to follow the \c graph list;
+ *   - ambiguous sources or targets of edges, unterminated strings and
+ *     vertices of clusters that do not refer to nodes are reported as
+ *     errors in all modes;
+ *   - invalid colors leave the default color unchanged.
+ */
+class OGDF_EXPORT GmlStreamParser {
+public:
+	//! Creates a parser reading from \p is.
+	explicit GmlStreamParser(istream &is);
+
+	//! Reads a graph.
+	bool read(Graph &G) {
+		return doRead(G, nullptr, nullptr, nullptr);
+	}
+
+	//! Reads a graph with attributes.
+	bool read(Graph &G, GraphAttributes &GA) {
+		return doRead(G, &GA, nullptr, nullptr);
+	}
+
+	//! Reads a clustered graph.
+	bool read(Graph &G, ClusterGraph &C) {
+		return doRead(G, nullptr, &C, nullptr);
+	}
+
+	//! Reads a clustered graph with attributes.
+	bool read(Graph &G, ClusterGraph &C, ClusterGraphAttributes &CA) {
+		return doRead(G, &CA, &C, &CA);
+	}
+
+	//! Returns the message describing the last error.
+	const string &errorString() const { return m_errorString; }
+
+private:
+	enum Symbol { sInt, sDouble, sString, sListBegin, sListEnd, sKey, sEOF, sError };
+
+	// ids of the keys we are interested in; all others are skipped
+	enum Key { kUnknown, kId, kLabel, kGraph, kDirected, kNode, kEdge, kGraphics,
+		kX, kY, kW, kH, kType, kWidth, kHeight, kSource, kTarget, kArrow, kLine,
+		kLineLower, kPoint, kGeneralization, kSubgraph, kFill, kCluster, kRootCluster,
+		kVertex, kColor, kStipple, kPattern, kLineWidth, kTemplate, kWeight };
+
+	bool doRead(Graph &G, GraphAttributes *GA, ClusterGraph *C, ClusterGraphAttributes *CA);
+
+	bool readGraph(Graph &G, GraphAttributes *GA);
+	bool readNode(Graph &G, GraphAttributes *GA);
+	bool readEdge(Graph &G, GraphAttributes *GA);
+	bool readLine(DPolyline &bends);
+	bool readCluster(ClusterGraph &C, ClusterGraphAttributes *CA, cluster c);
+	bool readClusterGraphics(ClusterGraphAttributes &CA, cluster c);
+
+	//! Scans the next symbol; its value is stored in the members below.
+	Symbol nextSymbol();
+	//! Scans the next symbol, which has to be a key or the end of the current list.
+	bool nextKey(Key &key, bool &listEnd);
+	//! Skips the value of type \p symbol, i.e., the rest of a list if it is sListBegin.
+	bool skipValue(Symbol symbol);
+
+	Symbol scanString();
+	Symbol scanNumber(size_t len);
+	static Key toKey(const char *str, size_t len);
+
+	//! Returns the node with GML id \p id, creating it if necessary.
+	node mapNode(Graph &G, int id, bool declared);
+	//! Returns the node with GML id \p id or \c nullptr.
+	node findNode(int id) const;
+
+	bool setError(const char *message);
+
+	InputBuffer m_input;
+	bool m_lineStart; //!< Whether only whitespace has been seen in the current line.
+
+	// value of the last symbol; strings point into the window of #m_input
+	int m_int;
+	double m_double;
+	const char *m_string;
+	size_t m_stringLength;
+	Key m_key;
+
+	// mapping of GML ids to nodes; dense for small non-negative ids
+	std::vector<node> m_denseIds;
+	std::unordered_map<int,node> m_sparseIds;
+	std::vector<int> m_implicitIds; //!< Ids used by edges but possibly not declared.
+	int m_minId, m_maxId;
+	bool m_anyId; //!< Whether a node with id has been declared.
+
+	// attribute values of the current element, kept to reuse their memory
+	string m_label, m_template, m_fill, m_stroke, m_shape, m_arrow;
+	DPolyline m_bends;
+
+	string m_errorString;
+};
+
+}
@@ -40,6 +40,7 @@
 #include <ogdf/cluster/ClusterGraphAttributes.h>
 #include <ogdf/internal/steinertree/EdgeWeightedGraph.h>
 #include <sstream>
+#include <functional>
 
 
 namespace ogdf {
@@ -52,7 +53,32 @@ namespace ogdf {
 class OGDF_EXPORT GraphIO
 {
 public:
-	static Logger logger;
+	//! Logger of the readers and writers.
+	/**
+	 * Within the threads of readBatch() and writeBatch(), the logging-output
+	 * is not written to the world stream but collected per file, see BatchResult.
+	 */
+	class OGDF_EXPORT IOLogger : public Logger
+	{
+	public:
+		//! Returns the stream for logging-output (local).
+		std::ostream &lout(Level l = LL_DEFAULT) const;
+	};
+
+	static IOLogger logger;
+
+	//! Outcome of reading or writing a single file with readBatch() or writeBatch().
+	struct BatchResult
+	{
+		string filename;	//!< The name of the file.
+		bool   success;		//!< Whether the file was read or written successfully.
+		string message;		//!< The logging-output produced for this file (never empty for failures).
+	};
+
+	typedef bool (*ReaderFunc)(Graph&, istream&);
+	typedef bool (*AttributesReaderFunc)(GraphAttributes&, Graph&, istream&);
+	typedef bool (*WriterFunc)(const Graph&, ostream&);
+	typedef bool (*AttributesWriterFunc)(const GraphAttributes&, ostream&);
 
 	class SVGSettings
 	{
@@ -148,6 +174,7 @@ public:
 	//! Reads graph \a G of arbitrary graph format form \a filename.
 	/**
 	 * The following file formats are currently supported:
+	 *  - OGDF binary format
 	 *  - DOT
 	 *  - GML
 	 *  - TLP
@@ -183,6 +210,8 @@ public:
 	 * <a href="http://www.fim.uni-passau.de/fileadmin/files/lehrstuhl/brandenburg/projekte/gml/gml-technical-report.pdf">this
 	 * technical report</a>.
 	 *
+	 * Large files should be read with the streaming parser, see setStreamingParsers().
+	 *
 	 * \sa writeGML(const Graph &G, ostream &os)
 	 *
 	 * @param G   is assigned the read graph.
@@ -1088,6 +1117,8 @@ public:
 
 	//! Reads graph \a G in GraphML format from input stream \a is.
 	/**
+	 * Large files should be read with the streaming parser, see setStreamingParsers().
+	 *
 	 * \sa writeGraphML(const Graph &G, ostream &os)
 	 *
 	 * @param G   is assigned the read graph.
@@ -1959,6 +1990,187 @@ public:
 	 */
 	static bool writeDL(const GraphAttributes &A, ostream &os);
 
+	//@}
+	/**
+	 * @name Binary format
+	 * These functions read and write graphs in OGDF's own binary format, which is meant
+	 * for loading large graphs as fast as possible rather than for exchange with other tools.
+	 *
+	 * A file consists of a fixed-size header followed by a sequence of arrays (fixed-width,
+	 * little-endian integers and IEEE doubles, each padded to a multiple of 8 bytes): the
+	 * source and target node of each edge, the adjacency lists of all nodes (hence the order
+	 * of adjacency entries is preserved), and optionally the graph attributes enabled when
+	 * writing as well as the cluster tree. Since the data is stored as it is laid out in
+	 * memory, files are memory-mapped if read by file name and no parsing is involved
+	 * beyond copying the arrays into the graph structures.
+	 *
+	 * Nodes and edges are stored in the order of their lists and clusters in breadth-first
+	 * order; their indices are not preserved. Files written on a big-endian machine cannot
+	 * be read (and vice versa).
+	 */
+	//@{
+
+	//! Reads graph \a G in binary format from file \a filename.
+	/**
+	 * The file is memory-mapped if the system supports it.
+	 * \sa readBinary(Graph &G, istream &is) for more details.<br>
+	 *     writeBinary(const Graph &G, const string &filename)
+	 *
+	 * @param G        is assigned the read graph.
+	 * @param filename is the name of the file to be read.
+	 * @return true if successful, false otherwise.
+	 */
+	static bool readBinary(Graph &G, const string &filename);
+
+	//! Reads graph \a G in binary format from input stream \a is.
+	/**
+	 * Attributes and clusters stored in the file are ignored.
+	 *
+	 * \sa writeBinary(const Graph &G, ostream &os)
+	 *
+	 * @param G   is assigned the read graph.
+	 * @param is  is the input stream to be read; it should have been opened in binary mode.
+	 * @return true if successful, false otherwise.
+	 */
+	static bool readBinary(Graph &G, istream &is);
+
+	//! Reads clustered graph (\a C, \a G) in binary format from file \a filename.
+	/**
+	 * \sa readBinary(ClusterGraph &C, Graph &G, istream &is)
+	 *
+	 * @param C        is assigned the read clustered graph (cluster information).
+	 * @param G        is assigned the read clustered graph (graph structure).
+	 * @param filename is the name of the file to be read.
+	 * @return true if successful, false otherwise.
+	 */
+	static bool readBinary(ClusterGraph &C, Graph &G, const string &filename);
+
+	//! Reads clustered graph (\a C, \a G) in binary format from input stream \a is.
+	/**
+	 * If the file contains no cluster tree, all nodes are assigned to the root cluster.
+	 * \pre \a C is a clustered graph associated with \a G.
+	 *
+	 * @param C   is assigned the read clustered graph (cluster information).
+	 * @param G   is assigned the read clustered graph (graph structure).
+	 * @param is  is the input stream to be read.
+	 * @return true if successful, false otherwise.
+	 */
+	static bool readBinary(ClusterGraph &C, Graph &G, istream &is);
+
+	//! Reads graph \a G with attributes \a A in binary format from file \a filename.
+	/**
+	 * \sa readBinary(GraphAttributes &A, Graph &G, istream &is)
+	 *
+	 * @param A        is assigned the graph's attributes.
+	 * @param G        is assigned the read graph.
+	 * @param filename is the name of the file to be read.
+	 * @return true if successful, false otherwise.
+	 */
+	static bool readBinary(GraphAttributes &A, Graph &G, const string &filename);
+
+	//! Reads graph \a G with attributes \a A in binary format from input stream \a is.
+	/**
+	 * Only the attributes enabled in \a A are read; attributes that are enabled
+	 * in \a A but not stored in the file keep their default values.
+	 * \pre \a A is associated with \a G.
+	 *
+	 * @param A   is assigned the graph's attributes.
+	 * @param G   is assigned the read graph.
+	 * @param is  is the input stream to be read.
+	 * @return true if successful, false otherwise.
+	 */
+	static bool readBinary(GraphAttributes &A, Graph &G, istream &is);
+
+	//! Reads clustered graph (\a C, \a G) with attributes \a A in binary format from file \a filename.
+	/**
+	 * \sa readBinary(ClusterGraphAttributes &A, ClusterGraph &C, Graph &G, istream &is)
+	 *
+	 * @param A        is assigned the graph's attributes.
+	 * @param C        is assigned the read clustered graph (cluster information).
+	 * @param G        is assigned the read clustered graph (graph structure).
+	 * @param filename is the name of the file to be read.
+	 * @return true if successful, false otherwise.
+	 */
+	static bool readBinary(ClusterGraphAttributes &A, ClusterGraph &C, Graph &G, const string &filename);
+
+	//! Reads clustered graph (\a C, \a G) with attributes \a A in binary format from input stream \a is.
+	/**
+	 * \pre \a C is associated with \a G, and \a A is associated with \a C.
+	 *
+	 * @param A   is assigned the graph's attributes.
+	 * @param C   is assigned the read clustered graph (cluster information).
+	 * @param G   is assigned the read clustered graph (graph structure).
+	 * @param is  is the input stream to be read.
+	 * @return true if successful, false otherwise.
+	 */
+	static bool readBinary(ClusterGraphAttributes &A, ClusterGraph &C, Graph &G, istream &is);
+
+	//! Writes graph \a G in binary format to file \a filename.
+	/**
+	 * @param G        is the graph to be written.
+	 * @param filename is the name of the file to which the graph will be written.
+	 * @return true if successful, false otherwise.
+	 */
+	static bool writeBinary(const Graph &G, const string &filename);
+
+	//! Writes graph \a G in binary format to output stream \a os.
+	/**
+	 * @param G   is the graph to be written.
+	 * @param os  is the output stream to which the graph will be written; it should have been opened in binary mode.
+	 * @return true if successful, false otherwise.
+	 */
+	static bool writeBinary(const Graph &G, ostream &os);
+
+	//! Writes clustered graph \a C in binary format to file \a filename.
+	/**
+	 * @param C        is the clustered graph to be written.
+	 * @param filename is the name of the file to which the clustered graph will be written.
+	 * @return true if successful, false otherwise.
+	 */
+	static bool writeBinary(const ClusterGraph &C, const string &filename);
+
+	//! Writes clustered graph \a C in binary format to output stream \a os.
+	/**
+	 * @param C   is the clustered graph to be written.
+	 * @param os  is the output stream to which the clustered graph will be written.
+	 * @return true if successful, false otherwise.
+	 */
+	static bool writeBinary(const ClusterGraph &C, ostream &os);
+
+	//! Writes graph with attributes \a A in binary format to file \a filename.
+	/**
+	 * @param A        specifies the graph and its attributes to be written.
+	 * @param filename is the name of the file to which the graph will be written.
+	 * @return true if successful, false otherwise.
+	 */
+	static bool writeBinary(const GraphAttributes &A, const string &filename);
+
+	//! Writes graph with attributes \a A in binary format to output stream \a os.
+	/**
+	 * All attributes enabled in \a A are written.
+	 *
+	 * @param A   specifies the graph and its attributes to be written.
+	 * @param os  is the output stream to which the graph will be written.
+	 * @return true if successful, false otherwise.
+	 */
+	static bool writeBinary(const GraphAttributes &A, ostream &os);
+
+	//! Writes clustered graph with attributes \a A in binary format to file \a filename.
+	/**
+	 * @param A        specifies the clustered graph and its attributes to be written.
+	 * @param filename is the name of the file to which the clustered graph will be written.
+	 * @return true if successful, false otherwise.
+	 */
+	static bool writeBinary(const ClusterGraphAttributes &A, const string &filename);
+
+	//! Writes clustered graph with attributes \a A in binary format to output stream \a os.
+	/**
+	 * @param A   specifies the clustered graph and its attributes to be written.
+	 * @param os  is the output stream to which the clustered graph will be written.
+	 * @return true if successful, false otherwise.
+	 */
+	static bool writeBinary(const ClusterGraphAttributes &A, ostream &os);
+
 	//@}
 	/**
 	 * @name SteinLib instances
@@ -2578,6 +2790,108 @@ public:
 	//! Prints indentation for indentation \a depth to output stream \a os and returns \a os.
 	static ostream &indent(ostream &os, int depth);
 
+	//! @}
+	/**
+	 * @name Batch processing
+	 * These functions read or write many files concurrently, each file by a single
+	 * thread. The threads take the next pending file when they are done, so the work
+	 * is balanced even if the sizes of the files differ.
+	 *
+	 * A failure does not affect the other files. The outcome and the logging-output
+	 * of each file are returned in an array of BatchResult.
+	 *
+	 * The number of threads is limited by \a numThreads, where 0 means one thread
+	 * per processor. If OGDF is compiled with a memory pool that is not thread-safe,
+	 * a single thread is used.
+	 */
+	//! @{
+
+	//! Reads the graphs in \a filenames concurrently.
+	/**
+	 * @param filenames  are the names of the files to be read.
+	 * @param graphs     is assigned the read graphs; \a graphs[i] is read from \a filenames[i].
+	 * @param results    is assigned the outcome for each file.
+	 * @param reader     is the reader used for all files; if 0, the format of each file is
+	 *                   detected as in read(Graph &G, istream &is).
+	 * @param numThreads is the maximal number of threads used.
+	 * @return the number of files read successfully.
+	 */
+	static int readBatch(
+		const Array<string> &filenames,
+		Array<Graph> &graphs,
+		Array<BatchResult> &results,
+		ReaderFunc reader = nullptr,
+		unsigned int numThreads = 0);
+
+	//! Reads the graphs and attributes in \a filenames concurrently.
+	/**
+	 * @param filenames  are the names of the files to be read.
+	 * @param attributes are the attributes enabled in each element of \a attrs.
+	 * @param graphs     is assigned the read graphs; \a graphs[i] is read from \a filenames[i].
+	 * @param attrs      is assigned the read attributes; \a attrs[i] belongs to \a graphs[i].
+	 * @param results    is assigned the outcome for each file.
+	 * @param reader     is the reader used for all files.
+	 * @param numThreads is the maximal number of threads used.
+	 * @return the number of files read successfully.
+	 */
+	static int readBatch(
+		const Array<string> &filenames,
+		long attributes,
+		Array<Graph> &graphs,
+		Array<GraphAttributes> &attrs,
+		Array<BatchResult> &results,
+		AttributesReaderFunc reader,
+		unsigned int numThreads = 0);
+
+	//! Writes the graphs in \a graphs concurrently.
+	/**
+	 * @param filenames  are the names of the files to be written; \a graphs[i] is written to \a filenames[i].
+	 * @param graphs     are the graphs to be written.
+	 * @param results    is assigned the outcome for each file.
+	 * @param writer     is the writer used for all files.
+	 * @param numThreads is the maximal number of threads used.
+	 * @return the number of files written successfully.
+	 */
+	static int writeBatch(
+		const Array<string> &filenames,
+		const Array<Graph> &graphs,
+		Array<BatchResult> &results,
+		WriterFunc writer,
+		unsigned int numThreads = 0);
+
+	//! Writes the graphs with attributes in \a attrs concurrently.
+	/**
+	 * @param filenames  are the names of the files to be written; \a attrs[i] is written to \a filenames[i].
+	 * @param attrs      are the graphs with attributes to be written.
+	 * @param results    is assigned the outcome for each file.
+	 * @param writer     is the writer used for all files.
+	 * @param numThreads is the maximal number of threads used.
+	 * @return the number of files written successfully.
+	 */
+	static int writeBatch(
+		const Array<string> &filenames,
+		const Array<GraphAttributes> &attrs,
+		Array<BatchResult> &results,
+		AttributesWriterFunc writer,
+		unsigned int numThreads = 0);
+
+	//! @}
+	/**
+	 * @name Parser selection
+	 * GML and GraphML input can be read by parsers that build the complete
+	 * parse tree (or XML document) first, or by streaming parsers that create
+	 * the graph while scanning the input (see GmlStreamParser and
+	 * GraphMLStreamParser). The streaming parsers need much less memory
+	 * for large files.
+	 */
+	//! @{
+
+	//! Returns whether GML and GraphML input is read by the streaming parsers.
+	static bool streamingParsers() { return s_streamingParsers; }
+
+	//! Sets whether GML and GraphML input is read by the streaming parsers (default: false).
+	static void setStreamingParsers(bool streaming) { s_streamingParsers = streaming; }
+
 	//! @}
 	//! @name Other utility functions
 	//! @{
@@ -2602,6 +2916,7 @@ public:
 private:
 	static char s_indentChar;	//!< Character used for indentation.
 	static int  s_indentWidth;	//!< Number of indent characters used for indentation.
+	static bool s_streamingParsers;	//!< Whether GML and GraphML are read by the streaming parsers.
 };
 
 
@@ -36,6 +36,7 @@
 
 #include <ogdf/basic/Graph.h>
 #include <ogdf/basic/GraphAttributes.h>
+#include <ogdf/cluster/ClusterGraphAttributes.h>
 #include <ogdf/basic/HashArray.h>
 #include <string>
 
@@ -84,5 +85,19 @@ EdgeArrow toArrow(const std::string &str);
 Graph::NodeType toNodeType(const std::string &str);
 Graph::EdgeType toEdgeType(const std::string &str);
 
+/**
+ * Sets attribute \a attr of node \a v in \a GA to the value given by the data text \a value.
+ *
+ * Attributes that are not enabled in \a GA or do not apply to nodes are ignored.
+ * Returns false if \a value is invalid for \a attr.
+ */
+bool setAttribute(GraphAttributes &GA, node v, Attribute attr, const char *value);
+
+//! Sets attribute \a attr of edge \a e in \a GA to \a value (see setAttribute() for nodes).
+bool setAttribute(GraphAttributes &GA, edge e, Attribute attr, const char *value);
+
+//! Sets attribute \a attr of cluster \a c in \a CA to \a value (see setAttribute() for nodes).
+bool setAttribute(ClusterGraphAttributes &CA, cluster c, Attribute attr, const char *value);
+
 }
 }
@@ -0,0 +1,152 @@
+/** \file
+ * \brief Declaration of class GraphMLStreamParser, a GraphML parser without document tree.
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.txt in the root directory of the OGDF installation for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ *
+ * \see  http://www.gnu.org/copyleft/gpl.html
+ ***************************************************************/
+
+#pragma once
+
+#include <ogdf/fileformats/InputBuffer.h>
+#include <ogdf/fileformats/GraphML.h>
+#include <ogdf/cluster/ClusterGraph.h>
+#include <unordered_map>
+
+
+namespace ogdf {
+
+//! Reads GraphML files in a single pass without building a document tree.
+/**
+ * In contrast to GraphMLParser, which loads the complete XML document with
+ * pugixml, this parser scans the XML input as a sequence of tags and text
+ * and creates nodes, edges and clusters as they are encountered. Besides the
+ * resulting graph, it keeps the input window, the stack of open tags, the
+ * mapping of node ids, and edges whose endpoints are declared later in the
+ * document.
+ *
+ * Node and edge data are interpreted as by GraphMLParser, with the following
+ * differences:
+ *   - \c key elements have to precede the \c graph element (as required by
+ *     the GraphML schema);
+ *   - nested graphs are read completely (as flat graph if no ClusterGraph is
+ *     given);
+ *   - edges referring to nodes declared later are created after all other
+ *     edges.
+ */
+class OGDF_EXPORT GraphMLStreamParser {
+public:
+	//! Creates a parser reading from \p is.
+	explicit GraphMLStreamParser(istream &is);
+
+	//! Reads a graph.
+	bool read(Graph &G) {
+		return doRead(G, nullptr, nullptr, nullptr);
+	}
+
+	//! Reads a graph with attributes.
+	bool read(Graph &G, GraphAttributes &GA) {
+		return doRead(G, &GA, nullptr, nullptr);
+	}
+
+	//! Reads a clustered graph.
+	bool read(Graph &G, ClusterGraph &C) {
+		return doRead(G, nullptr, &C, nullptr);
+	}
+
+	//! Reads a clustered graph with attributes.
+	bool read(Graph &G, ClusterGraph &C, ClusterGraphAttributes &CA) {
+		return doRead(G, &CA, &C, &CA);
+	}
+
+private:
+	//! Events reported by the XML scanner.
+	enum Event { evStart, evEnd, evText, evEOF, evError };
+
+	//! Attribute of the current start tag; both strings point into the input window.
+	struct XmlAttribute {
+		const char *name;
+		const char *value;
+	};
+
+	//! Data values of an element that cannot be assigned yet.
+	typedef std::vector<std::pair<graphml::Attribute, string>> DataList;
+
+	//! An edge whose source or target has not been declared yet.
+	struct PendingEdge {
+		string source, target;
+		DataList data;
+	};
+
+	bool doRead(Graph &G, GraphAttributes *GA, ClusterGraph *C, ClusterGraphAttributes *CA);
+	bool readKey();
+	bool readGraph(Graph &G, GraphAttributes *GA, ClusterGraph *C, ClusterGraphAttributes *CA, cluster c);
+	bool readNode(Graph &G, GraphAttributes *GA, ClusterGraph *C, ClusterGraphAttributes *CA, cluster c);
+	bool readEdge(Graph &G, GraphAttributes *GA);
+	bool readPendingEdges(Graph &G, GraphAttributes *GA);
+
+	//! Reads the current data element; stores its text in #m_data and its attribute in \p attr.
+	bool readData(graphml::Attribute &attr, const char *element);
+	//! Skips the rest of the current element.
+	bool skipElement();
+
+	//! Scans the next tag or text of the XML input.
+	Event nextEvent();
+	//! Returns the value of attribute \p name of the current start tag or \c nullptr.
+	const char *attribute(const char *name) const;
+	//! Returns true if the current start tag is named \p name.
+	bool isTag(const char *name) const;
+
+	Event scanStartTag();
+	Event scanEndTag();
+	bool scanText(bool &isText);
+	//! Returns true if the window starts with \p seq.
+	bool startsWith(const char *seq) const;
+	//! Returns the offset of the first occurrence of \p seq at or behind offset \p from, keeping it in the window.
+	size_t find(const char *seq, size_t from);
+	static char *decode(char *read, const char *stop, char *write, bool attribute);
+
+	bool setError(const char *message);
+
+	InputBuffer m_input;
+
+	// scanner state
+	std::vector<string> m_openTags;
+	bool m_pendingEnd; //!< Whether the current start tag was self-closing.
+	const char *m_tag; //!< Name of the current start tag.
+	std::vector<XmlAttribute> m_attributes;
+	string m_text; //!< Text of the last evText.
+
+	// parser state
+	std::vector<std::pair<string, graphml::Attribute>> m_keys;
+	std::unordered_map<string, node> m_nodeIds;
+	std::vector<PendingEdge> m_pendingEdges;
+	DataList m_nodeData;
+	string m_data;
+};
+
+}
@@ -0,0 +1,130 @@
+/** \file
+ * \brief Declaration of class InputBuffer, the character source of the streaming parsers.
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.txt in the root directory of the OGDF installation for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ *
+ * \see  http://www.gnu.org/copyleft/gpl.html
+ ***************************************************************/
+
+#pragma once
+
+#include <ogdf/basic/basic.h>
+#include <vector>
+
+
+namespace ogdf {
+
+//! Sliding read window over an input stream used by the streaming parsers.
+/**
+ * The buffer holds only a window of the input, which is refilled in chunks
+ * as the scanner advances. Tokens are scanned in place: span() makes sure
+ * that a token is contiguous in the window, so that parsers can use pointers
+ * into the window instead of copying. Such pointers stay valid until the
+ * next call of fill() or span(), which may move the window.
+ *
+ * The character behind the last valid character of the window is always
+ * '\\0', hence a token delimited by a predicate that rejects '\\0' is
+ * always terminated.
+ */
+class OGDF_EXPORT InputBuffer {
+public:
+	//! Creates a buffer reading \p is in chunks of \p chunkSize bytes.
+	explicit InputBuffer(istream &is, size_t chunkSize = 1 << 16);
+
+	//! Returns the current position in the window.
+	char *pos() const { return m_pos; }
+
+	//! Returns the end of the valid data in the window.
+	const char *end() const { return m_end; }
+
+	//! Returns the number of characters available in the window.
+	size_t available() const { return m_end - m_pos; }
+
+	//! Returns the current character, or '\\0' if the input is exhausted.
+	char peek() {
+		return (m_pos < m_end || fill(1)) ? *m_pos : '\0';
+	}
+
+	//! Returns true if the whole input has been consumed.
+	bool atEnd() {
+		return m_pos == m_end && !fill(1);
+	}
+
+	//! Consumes \p n characters, which must be available.
+	void advance(size_t n) {
+		OGDF_ASSERT(n <= available());
+		m_pos += n;
+	}
+
+	//! Makes at least \p n characters available from the current position.
+	/**
+	 * Returns false if the input ends before. Moves the window (and
+	 * invalidates pointers into it) if more data has to be read.
+	 */
+	bool fill(size_t n);
+
+	//! Returns the length of the longest prefix starting at offset \p from whose characters satisfy \p pred.
+	/**
+	 * The prefix and the character following it (if any) are kept contiguous
+	 * in the window.
+	 */
+	template<typename Pred>
+	size_t span(Pred pred, size_t from = 0) {
+		size_t len = from;
+		for(;;) {
+			while (m_pos + len < m_end && pred(m_pos[len])) {
+				++len;
+			}
+			if (m_pos + len < m_end || !fill(len + 1)) {
+				return len;
+			}
+		}
+	}
+
+	//! Consumes all whitespace characters.
+	void skipWhitespace() {
+		advance(span(isWhitespace));
+	}
+
+	//! Returns the number of the line containing the current position (starting with 1).
+	int line() const;
+
+	//! Returns true if \p c is a whitespace character.
+	static bool isWhitespace(char c) {
+		return c == ' ' || c == '\n' || c == '\t' || c == '\r' || c == '\f' || c == '\v';
+	}
+
+private:
+	istream &m_is;
+	size_t m_chunkSize;
+	std::vector<char> m_buffer; //!< The window; always holds a '\\0' behind #m_end.
+	char *m_pos;
+	char *m_end;
+	int m_discardedLines; //!< Number of line breaks before the start of the window.
+};
+
+}
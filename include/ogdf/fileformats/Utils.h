@@ -55,23 +55,30 @@ public:
 
 std::istream &operator >>(std::istream &is, TokenIgnorer token);
 
+//! Maps the string representations of all enum values between \a first and \a last to the values.
 template <typename E>
-static inline E toEnum(
-	const std::string &str, // A string we want to convert.
-	Hashing<std::string, E> &map, // A map to be lazily evaluated.
+static inline Hashing<std::string, E> enumMap(
 	std::string toString(const E&),
-	const E first, const E last, const E def) // Enum informations.
+	const E first, const E last) // Enum informations.
 {
-	if(map.empty()) {
-		//map = new Hashing<std::string, E>();
+	Hashing<std::string, E> map;
 
-		// Iterating over enums is potentially unsafe... (fixable in C++11).
-		for(int it = last; it >= first; it--) {
-			const E e = static_cast<E>(it);
-			map.insert(toString(e), e);
-		}
+	// Iterating over enums is potentially unsafe... (fixable in C++11).
+	for(int it = last; it >= first; it--) {
+		const E e = static_cast<E>(it);
+		map.insert(toString(e), e);
 	}
 
+	return map;
+}
+
+//! Converts \a str to an enum value using a map created by enumMap(), or returns \a def if it is unknown.
+template <typename E>
+static inline E toEnum(
+	const std::string &str, // A string we want to convert.
+	const Hashing<std::string, E> &map,
+	const E def)
+{
 	HashElement<std::string, E> *elem = map.lookup(str);
 	return elem ? elem->info() : def;
 }
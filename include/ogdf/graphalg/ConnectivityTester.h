@@ -37,6 +37,7 @@
 #include <ogdf/module/MaxFlowModule.h>
 #include <ogdf/graphalg/MaxFlowGoldbergTarjan.h>
 #include <ogdf/basic/GraphCopy.h>
+#include <ogdf/basic/NodeMatrix.h>
 
 namespace ogdf {
 
@@ -80,9 +81,10 @@ private:
 	* @param result The connectivity of two nodes each.
 	*               For directed graphs, the first index denotes the source node.
 	*               The connectivity of a node with itself is returned as 0.
+	*               The matrix is (re)initialized for the nodes of the original graph.
 	* @return The minimal connectivity of any two nodes in the graph.
 	*/
-	int computeConnectivity(NodeArray<NodeArray<int>> &result);
+	int computeConnectivity(NodeMatrix<int> &result);
 
 	/**
 	* Makes the graph bi-directed.
@@ -157,7 +159,7 @@ private:
 
 	/**
 	* Computes the connectivity of two nodes.
-	* To reduce duplicate graph transformations, #computeConnectivity(const Graph &graph, NodeArray<NodeArray<int>> &result)
+	* To reduce duplicate graph transformations, #computeConnectivity(const Graph &graph, NodeMatrix<int> &result)
 	* should be used to compute the connectivity of all nodes.
 	*
 	* @param graph The graph to be investigated
@@ -179,7 +181,7 @@ private:
 	*               The connectivity of a node with itself is returned as 0.
 	* @return The minimal connectivity of any two nodes in the graph.
 	*/
-	int computeConnectivity(const Graph &graph, NodeArray<NodeArray<int>> &result) {
+	int computeConnectivity(const Graph &graph, NodeMatrix<int> &result) {
 		prepareGraph(graph);
 
 		return computeConnectivity(result);
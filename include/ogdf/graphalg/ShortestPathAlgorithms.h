@@ -39,6 +39,8 @@
 #include <ogdf/basic/GraphAttributes.h>
 #include <ogdf/basic/NodeArray.h>
 #include <ogdf/basic/Array.h>
+#include <ogdf/basic/CSRGraph.h>
+#include <ogdf/basic/NodeMatrix.h>
 
 
 namespace ogdf {
@@ -105,6 +107,181 @@ void dijkstra_SPSS(
 	const EdgeArray<double>& edgeCosts);
 
 
+//! Computes all-pairs shortest paths in the graph represented by the snapshot \a G using BFS.
+/**
+ * @ingroup ga-sp
+ *
+ * The cost of each edge are \a edgeCosts and the result is stored in \a distance,
+ * which is indexed by nodes of the original graph.
+ */
+OGDF_EXPORT
+void bfs_SPAP(const CSRGraph& G, NodeArray<NodeArray<double> >& distance,
+		double edgeCosts);
+
+
+//! Computes single-source shortest paths from \a s in the graph represented by the snapshot \a G using BFS.
+/**
+ * @ingroup ga-sp
+ *
+ * \a s is a node of the original graph. The cost of each edge are \a edgeCosts
+ * and the result is stored in \a distanceArray.
+ */
+OGDF_EXPORT
+void bfs_SPSS(node s, const CSRGraph& G, NodeArray<double> & distanceArray, double edgeCosts);
+
+
+//! Computes all-pairs shortest paths in the graph represented by the snapshot \a G using Dijkstra's algorithm.
+/**
+ * @ingroup ga-sp
+ *
+ * The cost of an edge are given by \a edgeCosts (an edge array of the original graph)
+ * and the result is stored in \a shortestPathMatrix.
+ */
+OGDF_EXPORT
+void dijkstra_SPAP(
+	const CSRGraph& G,
+	NodeArray<NodeArray<double> >& shortestPathMatrix,
+	const EdgeArray<double>& edgeCosts);
+
+
+//! Computes single-source shortest paths from node \a s in the graph represented by the snapshot \a G using Dijkstra's algorithm.
+/**
+ * @ingroup ga-sp
+ *
+ * \a s is a node of the original graph. The cost of an edge are given by \a edgeCosts
+ * and the result is stored in \a shortestPathMatrix. Unreachable nodes are assigned
+ * std::numeric_limits<double>::max(), like in Dijkstra<T>::call.
+ */
+OGDF_EXPORT
+void dijkstra_SPSS(
+	node s,
+	const CSRGraph& G,
+	NodeArray<double>& shortestPathMatrix,
+	const EdgeArray<double>& edgeCosts);
+
+
+//! Computes all-pairs shortest paths in the graph represented by the snapshot \a G using BFS on \a numThreads threads.
+/**
+ * @ingroup ga-sp
+ *
+ * The cost of each edge are \a edgeCosts. \a distance is reinitialized for the original
+ * graph; row \a i holds the distances from the node with id \a i. Unreachable pairs are
+ * assigned std::numeric_limits<double>::infinity(). The rows are computed independently,
+ * so the result does not depend on the number of threads.
+ *
+ * @param numThreads is the number of threads; 0 uses one thread per core.
+ */
+OGDF_EXPORT
+void bfs_SPAP(const CSRGraph& G, NodeMatrix<double>& distance, double edgeCosts,
+		unsigned int numThreads = 1);
+
+
+//! Computes all-pairs shortest paths in the graph represented by the snapshot \a G using BFS on \a numThreads threads.
+/**
+ * @ingroup ga-sp
+ *
+ * Like the variant for double, but stores the distances as floats, which halves the memory.
+ */
+OGDF_EXPORT
+void bfs_SPAP(const CSRGraph& G, NodeMatrix<float>& distance, float edgeCosts,
+		unsigned int numThreads = 1);
+
+
+//! Computes all-pairs shortest paths in the graph represented by the snapshot \a G using Dijkstra's algorithm on \a numThreads threads.
+/**
+ * @ingroup ga-sp
+ *
+ * The cost of an edge are given by \a edgeCosts (an edge array of the original graph).
+ * \a distance is reinitialized for the original graph; row \a i holds the distances from
+ * the node with id \a i. Unreachable pairs are assigned std::numeric_limits<double>::infinity().
+ * The rows are computed independently, so the result does not depend on the number of threads.
+ *
+ * @param numThreads is the number of threads; 0 uses one thread per core.
+ */
+OGDF_EXPORT
+void dijkstra_SPAP(
+	const CSRGraph& G,
+	NodeMatrix<double>& distance,
+	const EdgeArray<double>& edgeCosts,
+	unsigned int numThreads = 1);
+
+
+//! Computes all-pairs shortest paths in the graph represented by the snapshot \a G using Dijkstra's algorithm on \a numThreads threads.
+/**
+ * @ingroup ga-sp
+ *
+ * Like the variant for double, but stores the distances as floats, which halves the memory.
+ * The distances are computed in double precision.
+ */
+OGDF_EXPORT
+void dijkstra_SPAP(
+	const CSRGraph& G,
+	NodeMatrix<float>& distance,
+	const EdgeArray<double>& edgeCosts,
+	unsigned int numThreads = 1);
+
+
+//! Computes shortest paths from several sources in the graph represented by the snapshot \a G using BFS on \a numThreads threads.
+/**
+ * @ingroup ga-sp
+ *
+ * \a sources are node ids of \a G. The distances from \a sources[\a i] are stored in row \a i of
+ * \a distance, i.e., in the entries \a i * n, ..., (\a i + 1) * n - 1, where n is the number of
+ * nodes; \a distance must have room for \a sources.size() rows. Unreachable nodes are assigned
+ * std::numeric_limits<double>::infinity(). The result does not depend on the number of threads.
+ *
+ * @param numThreads is the number of threads; 0 uses one thread per core.
+ */
+OGDF_EXPORT
+void bfs_SPMS(const CSRGraph& G, const Array<int>& sources, double *distance, double edgeCosts,
+		unsigned int numThreads = 1);
+
+
+//! Computes shortest paths from several sources in the graph represented by the snapshot \a G using BFS on \a numThreads threads.
+/**
+ * @ingroup ga-sp
+ *
+ * Like the variant for double, but stores the distances as floats.
+ */
+OGDF_EXPORT
+void bfs_SPMS(const CSRGraph& G, const Array<int>& sources, float *distance, float edgeCosts,
+		unsigned int numThreads = 1);
+
+
+//! Computes shortest paths from several sources in the graph represented by the snapshot \a G using Dijkstra's algorithm on \a numThreads threads.
+/**
+ * @ingroup ga-sp
+ *
+ * The cost of an edge are given by \a edgeCosts (an edge array of the original graph).
+ * The layout of \a distance is the same as for bfs_SPMS().
+ *
+ * @param numThreads is the number of threads; 0 uses one thread per core.
+ */
+OGDF_EXPORT
+void dijkstra_SPMS(
+	const CSRGraph& G,
+	const Array<int>& sources,
+	double *distance,
+	const EdgeArray<double>& edgeCosts,
+	unsigned int numThreads = 1);
+
+
+//! Computes shortest paths from several sources in the graph represented by the snapshot \a G using Dijkstra's algorithm on \a numThreads threads.
+/**
+ * @ingroup ga-sp
+ *
+ * Like the variant for double, but stores the distances as floats.
+ * The distances are computed in double precision.
+ */
+OGDF_EXPORT
+void dijkstra_SPMS(
+	const CSRGraph& G,
+	const Array<int>& sources,
+	float *distance,
+	const EdgeArray<double>& edgeCosts,
+	unsigned int numThreads = 1);
+
+
 //! Computes all-pairs shortest paths in graph \a G using Floyd-Warshall's algorithm.
 /**
  * @ingroup ga-sp
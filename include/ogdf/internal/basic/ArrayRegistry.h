@@ -0,0 +1,199 @@
+/** \file
+ * \brief Declaration of class ArrayRegistry, which maintains the arrays registered at a graph.
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.txt in the root directory of the OGDF installation for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ *
+ * \see  http://www.gnu.org/copyleft/gpl.html
+ ***************************************************************/
+
+#pragma once
+
+#include <ogdf/basic/List.h>
+
+#ifndef OGDF_MEMORY_POOL_NTS
+#include <mutex>
+#endif
+
+
+namespace ogdf {
+
+namespace internal {
+
+//! Returns the shard of an ArrayRegistry used by the calling thread.
+/**
+ * Every thread is assigned a fixed shard in round-robin order when it registers its first array.
+ */
+OGDF_EXPORT int registryShard();
+
+
+//! Maintains the arrays (or other objects) registered at a graph.
+/**
+ * The registered objects are distributed over #eNumShards lists (shards), each protected
+ * by its own mutex. A thread always registers its objects in the same shard, so threads
+ * that create and destroy temporary arrays concurrently rarely contend on the same lock.
+ *
+ * Iterating over all registered objects (e.g. for enlarging the tables of all node arrays)
+ * is only allowed when no other thread registers or unregisters objects concurrently,
+ * which is the case whenever the graph is modified.
+ *
+ * @tparam T is the registered base type, e.g. NodeArrayBase.
+ */
+template<class T>
+class ArrayRegistry {
+public:
+	enum {
+#ifdef OGDF_MEMORY_POOL_NTS
+		eNumShards = 1
+#else
+		eNumShards = 8
+#endif
+	};
+
+	//! Identifies a registration; required for unregistering.
+	class Handle {
+		friend class ArrayRegistry<T>;
+
+		ListIterator<T*> m_it; //!< The entry in the shard's list.
+		int m_shard;           //!< The shard containing the entry.
+
+	public:
+		//! Creates an invalid handle.
+		Handle() : m_shard(-1) { }
+
+		Handle(ListIterator<T*> it, int shard) : m_it(it), m_shard(shard) { }
+
+		//! Returns true iff the handle refers to a registration.
+		bool valid() const { return m_it.valid(); }
+	};
+
+	//! Iterator over all registered objects (shard by shard).
+	class const_iterator {
+		const ArrayRegistry<T> *m_registry;
+		int m_shard;
+		ListConstIterator<T*> m_it;
+
+		void skipEmpty() {
+			while (!m_it.valid() && ++m_shard < eNumShards)
+				m_it = m_registry->m_shards[m_shard].m_list.begin();
+		}
+
+	public:
+		const_iterator(const ArrayRegistry<T> *registry, int shard)
+			: m_registry(registry), m_shard(shard)
+		{
+			if (m_shard < eNumShards) {
+				m_it = m_registry->m_shards[m_shard].m_list.begin();
+				skipEmpty();
+			}
+		}
+
+		bool operator==(const const_iterator &other) const {
+			return m_shard == other.m_shard && m_it == other.m_it;
+		}
+
+		bool operator!=(const const_iterator &other) const {
+			return !operator==(other);
+		}
+
+		T *operator*() const { return *m_it; }
+
+		const_iterator &operator++() {
+			++m_it;
+			skipEmpty();
+			return *this;
+		}
+	};
+
+	ArrayRegistry() { }
+
+	//! Registers \a p in the shard of the calling thread.
+	Handle add(T *p) {
+		int shard = registryShard() % eNumShards;
+		Shard &s = m_shards[shard];
+#ifndef OGDF_MEMORY_POOL_NTS
+		std::lock_guard<std::mutex> guard(s.m_mutex);
+#endif
+		return Handle(s.m_list.pushBack(p), shard);
+	}
+
+	//! Unregisters the object registered with handle \a h.
+	void remove(const Handle &h) {
+		Shard &s = m_shards[h.m_shard];
+#ifndef OGDF_MEMORY_POOL_NTS
+		std::lock_guard<std::mutex> guard(s.m_mutex);
+#endif
+		s.m_list.del(h.m_it);
+	}
+
+	//! Replaces the object registered with handle \a h by \a p.
+	void move(const Handle &h, T *p) {
+		Shard &s = m_shards[h.m_shard];
+#ifndef OGDF_MEMORY_POOL_NTS
+		std::lock_guard<std::mutex> guard(s.m_mutex);
+#endif
+		*h.m_it = p;
+	}
+
+	//! Returns true iff no object is registered.
+	bool empty() const {
+		for (const Shard &s : m_shards)
+			if (!s.m_list.empty()) return false;
+		return true;
+	}
+
+	//! Removes an arbitrary registered object and returns it.
+	/**
+	 * \pre The registry is not empty.
+	 */
+	T *popFrontRet() {
+		for (Shard &s : m_shards)
+			if (!s.m_list.empty()) return s.m_list.popFrontRet();
+		OGDF_ASSERT(false);
+		return nullptr;
+	}
+
+	const_iterator begin() const { return const_iterator(this, 0); }
+	const_iterator end() const { return const_iterator(this, eNumShards); }
+
+private:
+	struct Shard {
+		ListPure<T*> m_list; //!< The objects registered in this shard.
+#ifndef OGDF_MEMORY_POOL_NTS
+		std::mutex m_mutex;  //!< Protects #m_list.
+#endif
+	};
+
+	Shard m_shards[eNumShards];
+
+	// prevent copying
+	ArrayRegistry(const ArrayRegistry<T> &);
+	ArrayRegistry<T> &operator=(const ArrayRegistry<T> &);
+};
+
+} // end namespace internal
+
+} // end namespace ogdf
@@ -88,6 +88,9 @@ public:
 		}
 	}
 
+	//! Does nothing, since memory is not pooled.
+	static void reserve(size_t /* nBytes */, int /* nElements */) { }
+
 	static void flushPool() { }
 	static void flushPool(uint16_t /* nBytes */) { }
 
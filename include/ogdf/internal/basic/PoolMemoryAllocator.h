@@ -36,8 +36,10 @@
 #pragma once
 
 #include <ogdf/basic/System.h>
+#include <ostream>
 
 #ifndef OGDF_MEMORY_POOL_NTS
+#include <atomic>
 #include <mutex>
 #ifdef OGDF_NO_COMPILER_TLS
 #include <pthread.h>
@@ -64,6 +66,21 @@ namespace ogdf {
  * It is also possible to make the usual \c new operator behave the same
  * way (throwing an InsufficientMemoryException) by defining the
  * macro \c #OGDF_MALLOC_NEW_DELETE in a class declaration.
+ *
+ * <H3>Size classes and thread caches:</H3>
+ *
+ * Requested sizes are rounded up to a multiple of the word size; each
+ * multiple forms a size class with its own free lists. Every thread owns
+ * a cache with one free list per size class. The cache is bounded: if it
+ * holds more than #eMaxCachedBytes bytes of a size class, a batch of
+ * elements is returned to the global pool, and empty thread free lists
+ * are refilled from the global pool block-wise. A thread's cache is created
+ * on first use and returned to the global pool when the thread exits, so
+ * OGDF can be used from arbitrary threads (e.g., \c std::thread or thread
+ * pools); calling initThread() and flushPool() manually is not required.
+ *
+ * For every size class, the allocator counts allocations and the bytes in
+ * use; see statistics() and writeStatistics().
  */
 
 class PoolMemoryAllocator
@@ -82,6 +99,8 @@ class PoolMemoryAllocator
 	struct PoolVector;
 	struct PoolElement;
 	struct BlockChain;
+	struct ThreadCache;
+	struct ThreadGuard;
 	typedef BlockChain *BlockChainPtr;
 
 public:
@@ -89,7 +108,18 @@ public:
 		eMinBytes = sizeof(MemElemPtr),
 		eTableSize = 256,
 		eBlockSize = 8192,
-		ePoolVectorLength = 15
+		ePoolVectorLength = 15,
+		eNumSizeClasses = (eTableSize + eMinBytes - 1) / eMinBytes,
+		eMaxCachedBytes = 2 * eBlockSize
+	};
+
+	//! Usage statistics of a single size class.
+	struct SizeClassStatistics {
+		size_t m_sliceSize;             //!< The size (in bytes) of the memory slices of this class.
+		size_t m_allocations;           //!< The number of allocations served so far.
+		size_t m_bytesInUse;            //!< The number of bytes currently allocated by the user.
+		size_t m_peakBytesInUse;        //!< The high-water mark of #m_bytesInUse.
+		size_t m_bytesInGlobalFreeList; //!< The number of bytes available in the global free list.
 	};
 
 	PoolMemoryAllocator() { }
@@ -98,6 +128,7 @@ public:
 	//! Initializes the memory manager.
 	static OGDF_EXPORT void init();
 
+	//! Creates the cache of the calling thread (optional, this is done on first use anyway).
 	static OGDF_EXPORT void initThread();
 
 	//! Frees all memory blocks allocated by the memory manager.
@@ -107,6 +138,16 @@ public:
 		return nBytes < eTableSize;
 	}
 
+	//! Returns the size class of requests of \a nBytes bytes.
+	static int sizeClass(size_t nBytes) {
+		return int((nBytes - 1) / eMinBytes);
+	}
+
+	//! Returns the size (in bytes) of the memory slices of size class \a sc.
+	static size_t sliceSize(int sc) {
+		return (sc + 1) * eMinBytes;
+	}
+
 	//! Allocates memory of size \a nBytes.
 	static OGDF_EXPORT void *allocate(size_t nBytes);
 
@@ -116,12 +157,21 @@ public:
 	//! Deallocate a complete list starting at \a pHead and ending at \a pTail.
 	/**
 	 * The elements are assumed to be chained using the first word of each element and
-	 * elements are of size \a nBytes. This is much more efficient the deallocating
-	 * each element separately, since the whole chain can be concatenated with the
-	 * free list, requiring only constant effort.
+	 * elements are of size \a nBytes. The whole chain is concatenated with the free list
+	 * of the thread; it is only traversed once for keeping the cache bounded.
 	 */
 	static OGDF_EXPORT void deallocateList(size_t nBytes, void *pHead, void *pTail);
 
+	//! Makes sure that at least \a nElements elements of size \a nBytes are in the thread's free list.
+	/**
+	 * Missing elements are sliced from freshly allocated blocks and put in front of the
+	 * free list in ascending address order, so that a subsequent series of allocations
+	 * of this size is served from contiguous memory. The cache bound of this size class
+	 * is raised accordingly until the thread's cache is trimmed the next time.
+	 */
+	static OGDF_EXPORT void reserve(size_t nBytes, int nElements);
+
+	//! Returns all elements in the calling thread's cache to the global pool.
 	static OGDF_EXPORT void flushPool();
 
 	//! Returns the total amount of memory (in bytes) allocated from the system.
@@ -133,6 +183,20 @@ public:
 	//! Returns the total amount of memory (in bytes) available in the thread's free lists.
 	static OGDF_EXPORT size_t memoryInThreadFreeList();
 
+	//! Returns the usage statistics of size class \a sc.
+	/**
+	 * Allocations and bytes in use are summed up over all threads (including threads
+	 * that have already exited). The high-water mark is sampled whenever memory is
+	 * moved between a thread cache and the global pool as well as on each call of
+	 * this function, hence it may miss short peaks of less than a block per thread.
+	 *
+	 * @param sc is the size class; 0 <= \a sc < #eNumSizeClasses.
+	 */
+	static OGDF_EXPORT SizeClassStatistics statistics(int sc);
+
+	//! Writes the statistics of all size classes that have been used to \a os.
+	static OGDF_EXPORT void writeStatistics(std::ostream &os);
+
 	//! Defragments the global free lists.
 	/**
 	 * This methods sorts the global free lists, so that successive elements come after each
@@ -154,38 +218,50 @@ private:
 #endif
 	}
 
-	static int slicesPerBlock(uint16_t nBytes) {
-		int nWords;
-		return slicesPerBlock(nBytes,nWords);
+	static int slicesPerBlock(int sc) {
+		return (eBlockSize - __SIZEOF_POINTER__) / int(sliceSize(sc));
 	}
 
-	static int slicesPerBlock(uint16_t nBytes, int &nWords) {
-		nWords = (nBytes + __SIZEOF_POINTER__ - 1) / __SIZEOF_POINTER__;
-		return (eBlockSize - __SIZEOF_POINTER__) / (nWords * __SIZEOF_POINTER__);
-	}
+	static ThreadCache &threadCache();
 
-	static void *fillPool(MemElemPtr &pFreeBytes, uint16_t nBytes);
+	static void *fillPool(ThreadCache &tc, int sc);
+	static void trimCache(ThreadCache &tc, int sc);
+	static void registerThread(ThreadCache &tc);
+	static void retireThread(ThreadCache &tc);
+	static void unguardedFlush(ThreadCache &tc, int sc);
+	static void unguardedUpdatePeak(int sc);
+	static size_t unguardedBytesInUse(int sc);
+
+#if !defined(OGDF_MEMORY_POOL_NTS) && defined(OGDF_NO_COMPILER_TLS)
+	static ThreadCache *createThreadCache();
+	static void destroyThreadCache(void *p);
+#endif
 
 	static MemElemPtr allocateBlock();
 	static void makeSlices(MemElemPtr p, int nWords, int nSlices);
 
 	static size_t unguardedMemGlobalFreelist();
 
-	static PoolElement s_pool[eTableSize];
+	static PoolElement s_pool[eNumSizeClasses];
 	static BlockChainPtr s_blocks;
 
+	static ThreadCache *s_threads;                        //!< The registered thread caches.
+	static size_t s_retiredAllocs[eNumSizeClasses];      //!< Allocations of exited threads.
+	static size_t s_retiredDeallocs[eNumSizeClasses];    //!< Deallocations of exited threads.
+	static size_t s_peakBytesInUse[eNumSizeClasses];     //!< Sampled high-water marks.
+
 #ifdef OGDF_DEBUG
 	static size_t s_nettoAlloc;
 #endif
 
 #ifdef OGDF_MEMORY_POOL_NTS
-	static MemElemPtr s_tp[eTableSize];
+	static ThreadCache s_tc;
 #else
 	static std::mutex s_mutex;
 #ifdef OGDF_NO_COMPILER_TLS
 	static pthread_key_t s_tpKey;
 #else
-	static OGDF_DECL_THREAD MemElemPtr s_tp[eTableSize];
+	static OGDF_DECL_THREAD ThreadCache s_tc;
 #endif
 #endif
 
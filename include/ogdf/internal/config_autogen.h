@@ -0,0 +1,28 @@
+#define OGDF_MEMORY_POOL_TS
+
+#ifndef NDEBUG
+  #define OGDF_DEBUG
+#endif
+
+/* #undef BUILD_SHARED_LIBS */
+
+// files *AVX.cpp are compiled with AVX; call them only if System::cpuSupports(cpufAVX)
+#define OGDF_AVX_EXTENSIONS
+// files *AVX2.cpp are compiled with AVX2 and FMA; call them only if the CPU supports both
+#define OGDF_AVX2_EXTENSIONS
+// files *AVX512.cpp are compiled with AVX-512F; call them only if System::cpuSupports(cpufAVX512F)
+#define OGDF_AVX512_EXTENSIONS
+
+#ifdef BUILD_SHARED_LIBS
+	#define OGDF_DLL
+	#define OGDF_INSTALL
+#endif
+
+#define USE_COIN
+#define COIN_OSI_CLP
+
+/* #undef COIN_SOLVER_IS_EXTERNAL */
+
+#ifdef COIN_SOLVER_IS_EXTERNAL
+	#define OSI_CLP
+#endif
@@ -0,0 +1,518 @@
+/** \file
+ * \brief Vectorized expansion and direct evaluation kernels of the fast multipole embedder
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.txt in the root directory of the OGDF installation for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ *
+ * \see  http://www.gnu.org/copyleft/gpl.html
+ ***************************************************************/
+
+#pragma once
+
+#include <ogdf/internal/energybased/FMEKernel.h>
+#include <ogdf/internal/basic/intrinsics.h>
+#include <cstring>
+
+namespace ogdf {
+
+//! Precomputed factors of the expansion kernels of LinearQuadtreeExpansion.
+/**
+ * An expansion of precision \a p consists of the complex coefficients
+ * a_0, ..., a_{p-1}, stored as interleaved real and imaginary parts and
+ * padded with zeros to #stride doubles. The kernels compute all coefficients
+ * of the receiver at once: each source coefficient is multiplied by a vector
+ * of powers of the shift and by the real factors of the corresponding column
+ * in one of the tables below. Every factor is stored twice, for the real and
+ * for the imaginary part, and every column has #stride entries.
+ */
+struct FMEExpansionTables {
+	static const uint32_t padding = 8; //!< The stride is a multiple of this (the widest vector in doubles).
+
+	uint32_t numCoeff; //!< Number of complex coefficients of an expansion.
+	uint32_t stride;   //!< Number of doubles of an expansion including padding.
+	const double *p2m; //!< Factors of (p - z_0)^k in P2M: 1, -1, -1/2, -1/3, ...
+	const double *l2p; //!< Factors of a_k (p - z_0)^(k-1) in L2P: 0, 1, 2, 3, ...
+	const double *m2m; //!< Column k holds the factors of a_k (z_0 - z_1)^(l-k) in M2M.
+	const double *m2l; //!< Column k holds the factors of a_k / (z_0 - z_1)^k in M2L, see fmeM2L().
+	const double *l2l; //!< Column k holds the factors of a_k (z_0 - z_1)^(k-l) in L2L.
+};
+
+//! Scratch space of a kernel, on the stack unless the expansions are very long.
+/**
+ * The class is parameterized by the vector operations only to give it the
+ * linkage of the kernel that uses it (see FMEExpansionKernelAVX2.cpp).
+ */
+template<class Ops>
+class FMEKernelBuffer {
+public:
+	explicit FMEKernelBuffer(uint32_t size) : m_data(size <= stackSize ? m_stack : new double[size]) { }
+
+	~FMEKernelBuffer() {
+		if (m_data != m_stack) {
+			delete[] m_data;
+		}
+	}
+
+	double *data() { return m_data; }
+
+private:
+	static const uint32_t stackSize = 128;
+	double m_stack[stackSize];
+	double *m_data;
+
+	FMEKernelBuffer(const FMEKernelBuffer&);
+	FMEKernelBuffer &operator=(const FMEKernelBuffer&);
+};
+
+//! Writes 1, z, z^2, ..., z^(n-1) for z = (\a re, \a im) to \a dst (interleaved).
+template<class Ops>
+inline void fmeComplexPowers(double *dst, uint32_t n, double re, double im)
+{
+	double pr = 1.0, pi = 0.0;
+	for (uint32_t k = 0; k < n; ++k) {
+		dst[2*k] = pr;
+		dst[2*k + 1] = pi;
+		double t = pr*re - pi*im;
+		pi = pr*im + pi*re;
+		pr = t;
+	}
+}
+
+//! Writes \a n zeros to \a dst.
+template<class Ops>
+inline void fmeZero(double *dst, uint32_t n)
+{
+	for (uint32_t k = 0; k < n; ++k) {
+		dst[k] = 0.0;
+	}
+}
+
+//! Returns the number of vectors covering the coefficients of an expansion.
+template<class Ops>
+inline uint32_t fmeNumVectors(const FMEExpansionTables &t)
+{
+	return (2*t.numCoeff + Ops::width - 1) / Ops::width;
+}
+
+//! Adds the multipole expansion of a point with charge \a q at offset (\a dx, \a dy) from the center to \a coeff.
+template<class Ops>
+void fmeP2M(const FMEExpansionTables &t, double *coeff, double dx, double dy, double q)
+{
+	typedef typename Ops::Vector Vector;
+	const uint32_t numVectors = fmeNumVectors<Ops>(t);
+	FMEKernelBuffer<Ops> buffer(t.stride);
+	double *powers = buffer.data();
+	fmeComplexPowers<Ops>(powers, t.numCoeff, dx, dy);
+	fmeZero<Ops>(powers + 2*t.numCoeff, numVectors*Ops::width - 2*t.numCoeff);
+
+	const Vector charge = Ops::set1(q);
+	for (uint32_t v = 0; v < numVectors; ++v) {
+		const uint32_t i = v*Ops::width;
+		Vector factor = Ops::mul(charge, Ops::load(t.p2m + i));
+		Ops::store(coeff + i, Ops::fmadd(factor, Ops::load(powers + i), Ops::load(coeff + i)));
+	}
+}
+
+//! Shifts the multipole expansion \a source by (\a dx, \a dy) = z_0 - z_1 and adds it to \a receiver.
+template<class Ops>
+void fmeM2M(const FMEExpansionTables &t, double *receiver, const double *source, double dx, double dy)
+{
+	typedef typename Ops::Vector Vector;
+	const uint32_t p = t.numCoeff;
+	const uint32_t numVectors = fmeNumVectors<Ops>(t);
+	// 0, ..., 0 (p times), 1, d, ..., d^(p-1), 0, ...; column k reads d^(l-k) at 2(p-k) + 2l
+	FMEKernelBuffer<Ops> buffer(2*p + t.stride);
+	double *powers = buffer.data();
+	fmeZero<Ops>(powers, 2*p);
+	fmeComplexPowers<Ops>(powers + 2*p, p, dx, dy);
+	fmeZero<Ops>(powers + 4*p, numVectors*Ops::width - 2*p);
+
+	for (uint32_t v = 0; v < numVectors; ++v) {
+		const uint32_t i = v*Ops::width;
+		// column k only contributes to l >= k
+		const uint32_t kEnd = (i + Ops::width) / 2 < p ? (i + Ops::width) / 2 : p;
+		Vector b = Ops::load(receiver + i);
+		for (uint32_t k = 0; k < kEnd; ++k) {
+			Vector shifts = Ops::mul(Ops::load(t.m2m + k*t.stride + i), Ops::load(powers + 2*(p-k) + i));
+			b = Ops::add(b, Ops::cmul(source + 2*k, shifts));
+		}
+		Ops::store(receiver + i, b);
+	}
+}
+
+//! Converts the multipole expansion \a source into a local expansion at distance (\a dx, \a dy) = z_0 - z_1 and adds it to \a receiver.
+/**
+ * With u = 1/(z_0 - z_1) and c_k = a_k u^k, the local coefficient b_l is
+ * u^l times the sum of c_k times the factor in row l and column k of the M2L
+ * table, which is (-1)^l binom(l+k-1, k-1) for k, l > 0, (-1)^(l+1)/l for
+ * k = 0 < l, (-1)^k for l = 0 < k, and 0 for k = l = 0. The logarithmic term
+ * a_0 log(z_1 - z_0) of b_0 is left to the caller.
+ */
+template<class Ops>
+void fmeM2L(const FMEExpansionTables &t, double *receiver, const double *source, double dx, double dy)
+{
+	typedef typename Ops::Vector Vector;
+	const uint32_t p = t.numCoeff;
+	const uint32_t numVectors = fmeNumVectors<Ops>(t);
+	FMEKernelBuffer<Ops> buffer(2*t.stride);
+	double *powers = buffer.data();
+	double *c = powers + t.stride;
+	const double invLengthSquare = 1.0 / (dx*dx + dy*dy);
+	fmeComplexPowers<Ops>(powers, p, dx*invLengthSquare, -dy*invLengthSquare);
+	fmeZero<Ops>(powers + 2*p, numVectors*Ops::width - 2*p);
+
+	for (uint32_t v = 0; v < numVectors; ++v) {
+		const uint32_t i = v*Ops::width;
+		Ops::store(c + i, Ops::cmul(Ops::load(source + i), Ops::load(powers + i)));
+	}
+
+	for (uint32_t v = 0; v < numVectors; ++v) {
+		const uint32_t i = v*Ops::width;
+		Vector sum = Ops::zero();
+		for (uint32_t k = 0; k < p; ++k) {
+			sum = Ops::fmadd(Ops::load(t.m2l + k*t.stride + i), Ops::broadcast(c + 2*k), sum);
+		}
+		Ops::store(receiver + i, Ops::add(Ops::load(receiver + i), Ops::cmul(Ops::load(powers + i), sum)));
+	}
+}
+
+//! Shifts the local expansion \a source by (\a dx, \a dy) = z_0 - z_1 and adds it to \a receiver.
+template<class Ops>
+void fmeL2L(const FMEExpansionTables &t, double *receiver, const double *source, double dx, double dy)
+{
+	typedef typename Ops::Vector Vector;
+	const uint32_t p = t.numCoeff;
+	const uint32_t numVectors = fmeNumVectors<Ops>(t);
+	// d^(p-1), ..., d, 1, 0, ...; column k reads d^(k-l) at 2(p-1-k) + 2l
+	FMEKernelBuffer<Ops> buffer(2*p + t.stride);
+	double *powers = buffer.data();
+	double *ascending = powers + 2*p;
+	fmeComplexPowers<Ops>(ascending, p, dx, dy);
+	for (uint32_t k = 0; k < p; ++k) {
+		powers[2*(p-1-k)] = ascending[2*k];
+		powers[2*(p-1-k) + 1] = ascending[2*k + 1];
+	}
+	fmeZero<Ops>(powers + 2*p, numVectors*Ops::width);
+
+	for (uint32_t v = 0; v < numVectors; ++v) {
+		const uint32_t i = v*Ops::width;
+		// column k only contributes to l <= k
+		Vector b = Ops::load(receiver + i);
+		for (uint32_t k = i/2; k < p; ++k) {
+			Vector shifts = Ops::mul(Ops::load(t.l2l + k*t.stride + i), Ops::load(powers + 2*(p-1-k) + i));
+			b = Ops::add(b, Ops::cmul(source + 2*k, shifts));
+		}
+		Ops::store(receiver + i, b);
+	}
+}
+
+//! Evaluates the derivative of the local expansion \a coeff at offset (\a dx, \a dy) from its center and subtracts the conjugate from (\a fx, \a fy).
+template<class Ops>
+void fmeL2P(const FMEExpansionTables &t, const double *coeff, double dx, double dy, double &fx, double &fy)
+{
+	typedef typename Ops::Vector Vector;
+	const uint32_t p = t.numCoeff;
+	const uint32_t numVectors = fmeNumVectors<Ops>(t);
+	// 0, 1, d, ..., d^(p-2), 0, ...
+	FMEKernelBuffer<Ops> buffer(t.stride);
+	double *powers = buffer.data();
+	powers[0] = powers[1] = 0.0;
+	fmeComplexPowers<Ops>(powers + 2, p - 1, dx, dy);
+	fmeZero<Ops>(powers + 2*p, numVectors*Ops::width - 2*p);
+
+	Vector sum = Ops::zero();
+	for (uint32_t v = 0; v < numVectors; ++v) {
+		const uint32_t i = v*Ops::width;
+		Vector a = Ops::mul(Ops::load(coeff + i), Ops::load(t.l2p + i));
+		sum = Ops::add(sum, Ops::cmul(a, Ops::load(powers + i)));
+	}
+
+	double lanes[Ops::width];
+	Ops::store(lanes, sum);
+	for (int l = 0; l < Ops::width; l += 2) {
+		fx -= lanes[l];
+		fy += lanes[l + 1];
+	}
+}
+
+//! Adds the repulsive forces between the points \a i of one set and the up to Ops::width points \a j of another one.
+/**
+ * Only lanes \a begin(i) to \a end - 1 of the points \a j interact with point
+ * \a i. The forces on the points \a i are added to \a fxi, \a fyi, those on
+ * the points \a j are accumulated in registers and subtracted from \a fxj,
+ * \a fyj once at the end.
+ */
+template<class Ops, class Begin>
+inline void fmeDirectBlock(
+	const float *xi, const float *yi, const float *si, float *fxi, float *fyi, uint32_t ni,
+	const float *xj, const float *yj, const float *sj, float *fxj, float *fyj, int end, Begin begin)
+{
+	typedef typename Ops::Vector Vector;
+	const bool full = end == Ops::width;
+	const Vector x = full ? Ops::load(xj) : Ops::loadFirst(xj, end);
+	const Vector y = full ? Ops::load(yj) : Ops::loadFirst(yj, end);
+	const Vector s = full ? Ops::load(sj) : Ops::loadFirst(sj, end);
+	const Vector protection = Ops::set1(COMPUTE_FORCE_PROTECTION_FACTOR);
+	Vector sumX = Ops::zero(), sumY = Ops::zero();
+
+	for (uint32_t i = 0; i < ni; ++i) {
+		Vector dx = Ops::sub(Ops::set1(xi[i]), x);
+		Vector dy = Ops::sub(Ops::set1(yi[i]), y);
+#ifdef FME_KERNEL_USE_OLD
+		Vector sSum = Ops::add(Ops::set1(si[i]), s);
+#else
+		Vector sSum = Ops::mul(Ops::set1(si[i]), s);
+#endif
+		Vector f = Ops::div(sSum, Ops::max(Ops::mul(sSum, protection), Ops::add(Ops::mul(dx, dx), Ops::mul(dy, dy))));
+		const int first = begin(i);
+		if (first > 0 || !full) {
+			f = Ops::selectLanes(f, first, end);
+		}
+		Vector forceX = Ops::mul(dx, f), forceY = Ops::mul(dy, f);
+		sumX = Ops::add(sumX, forceX);
+		sumY = Ops::add(sumY, forceY);
+		fxi[i] += Ops::sum(forceX);
+		fyi[i] += Ops::sum(forceY);
+	}
+
+	if (full) {
+		Ops::store(fxj, Ops::sub(Ops::load(fxj), sumX));
+		Ops::store(fyj, Ops::sub(Ops::load(fyj), sumY));
+	} else {
+		Ops::storeFirst(fxj, Ops::sub(Ops::loadFirst(fxj, end), sumX), end);
+		Ops::storeFirst(fyj, Ops::sub(Ops::loadFirst(fyj, end), sumY), end);
+	}
+}
+
+//! Lets point \a i interact with all lanes of a block.
+template<class Ops>
+struct FMEAllLanes {
+	int operator()(uint32_t) const { return 0; }
+};
+
+//! Lets point \a i interact with the lanes of a block at positions greater than \a i.
+template<class Ops>
+struct FMELanesAfter {
+	explicit FMELanesAfter(uint32_t offset) : m_offset(offset) { }
+	int operator()(uint32_t i) const { return i < m_offset ? 0 : int(i - m_offset + 1); }
+	uint32_t m_offset;
+};
+
+//! Evaluates the repulsive forces between the \a n points \a x, \a y directly and adds them to \a fx, \a fy, see eval_direct().
+template<class Ops>
+void fmeDirect(const float *x, const float *y, const float *s, float *fx, float *fy, uint32_t n)
+{
+	for (uint32_t j = 0; j < n; j += Ops::width) {
+		const int end = n - j < uint32_t(Ops::width) ? int(n - j) : Ops::width;
+		// the points before the last one of the block interact with (parts of) it
+		fmeDirectBlock<Ops>(x, y, s, fx, fy, j + end - 1, x + j, y + j, s + j, fx + j, fy + j, end, FMELanesAfter<Ops>(j));
+	}
+}
+
+//! Evaluates the repulsive forces between two disjoint sets of points directly, see eval_direct().
+template<class Ops>
+void fmeDirect(
+	const float *x1, const float *y1, const float *s1, float *fx1, float *fy1, uint32_t n1,
+	const float *x2, const float *y2, const float *s2, float *fx2, float *fy2, uint32_t n2)
+{
+	for (uint32_t j = 0; j < n2; j += Ops::width) {
+		const int end = n2 - j < uint32_t(Ops::width) ? int(n2 - j) : Ops::width;
+		fmeDirectBlock<Ops>(x1, y1, s1, fx1, fy1, n1, x2 + j, y2 + j, s2 + j, fx2 + j, fy2 + j, end, FMEAllLanes<Ops>());
+	}
+}
+
+//! The expansion and direct evaluation kernels for one instruction set.
+struct FMEExpansionKernels {
+	void (*p2m)(const FMEExpansionTables &t, double *coeff, double dx, double dy, double q);
+	void (*m2m)(const FMEExpansionTables &t, double *receiver, const double *source, double dx, double dy);
+	void (*m2l)(const FMEExpansionTables &t, double *receiver, const double *source, double dx, double dy);
+	void (*l2l)(const FMEExpansionTables &t, double *receiver, const double *source, double dx, double dy);
+	void (*l2p)(const FMEExpansionTables &t, const double *coeff, double dx, double dy, double &fx, double &fy);
+	void (*direct)(const float *x, const float *y, const float *s, float *fx, float *fy, uint32_t n);
+	void (*directPair)(
+		const float *x1, const float *y1, const float *s1, float *fx1, float *fy1, uint32_t n1,
+		const float *x2, const float *y2, const float *s2, float *fx2, float *fy2, uint32_t n2);
+};
+
+//! Returns the kernels instantiated with the given vector operations.
+template<class DoubleOps, class FloatOps>
+FMEExpansionKernels fmeExpansionKernels()
+{
+	FMEExpansionKernels kernels;
+	kernels.p2m = &fmeP2M<DoubleOps>;
+	kernels.m2m = &fmeM2M<DoubleOps>;
+	kernels.m2l = &fmeM2L<DoubleOps>;
+	kernels.l2l = &fmeL2L<DoubleOps>;
+	kernels.l2p = &fmeL2P<DoubleOps>;
+	kernels.direct = &fmeDirect<FloatOps>;
+	kernels.directPair = &fmeDirect<FloatOps>;
+	return kernels;
+}
+
+//! Complex vector operations of the expansion kernels for a single complex number.
+/**
+ * A vector holds #width doubles, that is, the real and imaginary parts of
+ * #width / 2 complex numbers.
+ */
+struct FMEScalarDoubleOps {
+	struct Vector { double re, im; };
+	static const int width = 2;
+
+	static Vector make(double re, double im) { Vector a; a.re = re; a.im = im; return a; }
+	static Vector load(const double *p) { return make(p[0], p[1]); }
+	static void store(double *p, Vector a) { p[0] = a.re; p[1] = a.im; }
+	static Vector set1(double a) { return make(a, a); }
+	static Vector zero() { return make(0.0, 0.0); }
+	//! Returns the complex number at \a p in every position.
+	static Vector broadcast(const double *p) { return load(p); }
+	static Vector add(Vector a, Vector b) { return make(a.re + b.re, a.im + b.im); }
+	static Vector mul(Vector a, Vector b) { return make(a.re * b.re, a.im * b.im); }
+	static Vector fmadd(Vector a, Vector b, Vector c) { return make(a.re * b.re + c.re, a.im * b.im + c.im); }
+	//! Multiplies the complex numbers in \a a and \a b.
+	static Vector cmul(Vector a, Vector b) { return make(a.re * b.re - a.im * b.im, a.re * b.im + a.im * b.re); }
+	//! Multiplies the complex numbers in \a b by the one at \a a.
+	static Vector cmul(const double *a, Vector b) { return cmul(load(a), b); }
+};
+
+//! Vector operations of the direct evaluation kernels for plain scalars.
+struct FMEScalarFloatOps {
+	typedef float Vector;
+	static const int width = 1;
+
+	static Vector load(const float *p) { return *p; }
+	static void store(float *p, Vector a) { *p = a; }
+	static Vector set1(float a) { return a; }
+	static Vector zero() { return 0.0f; }
+	static Vector add(Vector a, Vector b) { return a + b; }
+	static Vector sub(Vector a, Vector b) { return a - b; }
+	static Vector mul(Vector a, Vector b) { return a * b; }
+	static Vector div(Vector a, Vector b) { return a / b; }
+	static Vector max(Vector a, Vector b) { return a > b ? a : b; }
+	//! Loads the first \a k lanes, the others are zero.
+	static Vector loadFirst(const float *p, int) { return *p; }
+	//! Stores the first \a k lanes.
+	static void storeFirst(float *p, Vector a, int) { *p = a; }
+	//! Keeps the lanes \a begin to \a end - 1, the others become zero.
+	static Vector selectLanes(Vector a, int, int) { return a; }
+	//! Returns the sum of all lanes.
+	static float sum(Vector a) { return a; }
+};
+
+//! All-ones lanes followed by all-zero lanes, for masking the last vector of a row.
+/**
+ * Loading a vector of width \a w at position 16 - \a k yields a mask whose
+ * first \a k lanes are set.
+ */
+static const int32_t fmeLaneMask[32] = {
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 };
+
+#ifdef OGDF_SSE2_EXTENSIONS
+
+//! Complex vector operations of the expansion kernels for SSE2 (one complex number).
+struct FMESSE2DoubleOps {
+	typedef __m128d Vector;
+	static const int width = 2;
+
+	static Vector load(const double *p) { return _mm_loadu_pd(p); }
+	static void store(double *p, Vector a) { _mm_storeu_pd(p, a); }
+	static Vector set1(double a) { return _mm_set1_pd(a); }
+	static Vector zero() { return _mm_setzero_pd(); }
+	static Vector broadcast(const double *p) { return _mm_loadu_pd(p); }
+	static Vector add(Vector a, Vector b) { return _mm_add_pd(a, b); }
+	static Vector mul(Vector a, Vector b) { return _mm_mul_pd(a, b); }
+	static Vector fmadd(Vector a, Vector b, Vector c) { return _mm_add_pd(_mm_mul_pd(a, b), c); }
+	static Vector cmul(Vector a, Vector b) {
+		// (a.re b.re, a.re b.im) + (-a.im b.im, a.im b.re)
+		Vector t = _mm_mul_pd(_mm_unpackhi_pd(a, a), _mm_shuffle_pd(b, b, 1));
+		return _mm_add_pd(_mm_mul_pd(_mm_unpacklo_pd(a, a), b), _mm_xor_pd(t, _mm_set_sd(-0.0)));
+	}
+	static Vector cmul(const double *a, Vector b) {
+		Vector t = _mm_mul_pd(_mm_set1_pd(a[1]), _mm_shuffle_pd(b, b, 1));
+		return _mm_add_pd(_mm_mul_pd(_mm_set1_pd(a[0]), b), _mm_xor_pd(t, _mm_set_sd(-0.0)));
+	}
+};
+
+//! Vector operations of the direct evaluation kernels for SSE2.
+struct FMESSE2FloatOps {
+	typedef __m128 Vector;
+	static const int width = 4;
+
+	static Vector firstLanes(int k) {
+		return _mm_castsi128_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(fmeLaneMask + 16 - k)));
+	}
+
+	static Vector load(const float *p) { return _mm_loadu_ps(p); }
+	static void store(float *p, Vector a) { _mm_storeu_ps(p, a); }
+	static Vector set1(float a) { return _mm_set1_ps(a); }
+	static Vector zero() { return _mm_setzero_ps(); }
+	static Vector add(Vector a, Vector b) { return _mm_add_ps(a, b); }
+	static Vector sub(Vector a, Vector b) { return _mm_sub_ps(a, b); }
+	static Vector mul(Vector a, Vector b) { return _mm_mul_ps(a, b); }
+	static Vector div(Vector a, Vector b) { return _mm_div_ps(a, b); }
+	static Vector max(Vector a, Vector b) { return _mm_max_ps(a, b); }
+	static Vector loadFirst(const float *p, int k) {
+		float lanes[width] = { 0.0f, 0.0f, 0.0f, 0.0f };
+		std::memcpy(lanes, p, k * sizeof(float));
+		return _mm_loadu_ps(lanes);
+	}
+	static void storeFirst(float *p, Vector a, int k) {
+		float lanes[width];
+		_mm_storeu_ps(lanes, a);
+		std::memcpy(p, lanes, k * sizeof(float));
+	}
+	static Vector selectLanes(Vector a, int begin, int end) {
+		return _mm_and_ps(_mm_andnot_ps(firstLanes(begin), firstLanes(end)), a);
+	}
+	static float sum(Vector a) {
+		Vector t = _mm_add_ps(a, _mm_movehl_ps(a, a));
+		return _mm_cvtss_f32(_mm_add_ss(t, _mm_shuffle_ps(t, t, 1)));
+	}
+};
+
+#endif
+
+#ifdef OGDF_AVX2_EXTENSIONS
+
+//! Returns the expansion kernels for AVX2 and FMA.
+/**
+ * @pre System::cpuSupports(#cpufAVX2) and System::cpuSupports(#cpufFMA)
+ */
+FMEExpansionKernels fmeExpansionKernelsAVX2();
+
+#endif
+
+#ifdef OGDF_AVX512_EXTENSIONS
+
+//! Returns the expansion kernels for AVX-512F.
+/**
+ * @pre System::cpuSupports(#cpufAVX512F)
+ */
+FMEExpansionKernels fmeExpansionKernelsAVX512();
+
+#endif
+
+} // end namespace ogdf
@@ -91,6 +91,18 @@ struct FMEGlobalOptions
 };
 
 
+//! accumulated wall clock times of the phases of the main iterations
+struct FMEPhaseTimes
+{
+	uint32_t numIterations;				//!< number of measured iterations
+	double build;						//!< seconds spent for constructing the quadtree
+	double expansion;					//!< seconds spent for the expansions and the repulsive forces
+	double force;						//!< seconds spent for the edge forces and moving the nodes
+
+	FMEPhaseTimes() : numIterations(0), build(0.0), expansion(0.0), force(0.0) { }
+};
+
+
 //! forward decl of local context struct
 struct FMELocalContext;
 
@@ -116,6 +128,7 @@ struct FMEGlobalContext
 	float min_y;							//!< global point, node min y coordinate for bounding box calculations
 	float max_y;							//!< global point, node max y coordinate for bounding box calculations
 	double currAvgEdgeLength;
+	FMEPhaseTimes phaseTimes;				//!< phase times measured by the main thread
 };
 
 
@@ -337,38 +350,31 @@ static inline l2p_functor l2p_function(FMELocalContext* pLocalContext)
 }
 
 
-//! Local-to-Point functor
+//! Point-to-Point functor (direct evaluation)
 struct p2p_functor
 {
-	const LinearQuadtree& tree;
+	LinearQuadtreeExpansion& expansions;
 	float* fx;
 	float* fy;
 
-	p2p_functor(const LinearQuadtree& t, float* x, float* y) : tree(t), fx(x), fy(y) { }
+	p2p_functor(LinearQuadtreeExpansion& e, float* x, float* y) : expansions(e), fx(x), fy(y) { }
 
 	inline void operator()(LinearQuadtree::NodeID nodeIndexA, LinearQuadtree::NodeID nodeIndexB)
 	{
-		uint32_t offsetA = tree.firstPoint(nodeIndexA);
-		uint32_t offsetB = tree.firstPoint(nodeIndexB);
-		uint32_t numPointsA = tree.numberOfPoints(nodeIndexA);
-		uint32_t numPointsB = tree.numberOfPoints(nodeIndexB);
-		eval_direct_fast(tree.pointX() + offsetA, tree.pointY() + offsetA, tree.pointSize() + offsetA, fx + offsetA, fy + offsetA, numPointsA,
-						 tree.pointX() + offsetB, tree.pointY() + offsetB, tree.pointSize() + offsetB, fx + offsetB, fy + offsetB, numPointsB);
+		expansions.P2P(nodeIndexA, nodeIndexB, fx, fy);
 	}
 
 	inline void operator()(LinearQuadtree::NodeID nodeIndex)
 	{
-		uint32_t offset = tree.firstPoint(nodeIndex);
-		uint32_t numPoints = tree.numberOfPoints(nodeIndex);
-		eval_direct_fast(tree.pointX() + offset, tree.pointY() + offset, tree.pointSize() + offset, fx + offset, fy + offset, numPoints);
+		expansions.P2P(nodeIndex, fx, fy);
 	}
 };
 
 
-//! creates Local-to-Point functor
+//! creates Point-to-Point functor
 static inline p2p_functor p2p_function(FMELocalContext* pLocalContext)
 {
-	return p2p_functor(*pLocalContext->pGlobalContext->pQuadtree, pLocalContext->forceX, pLocalContext->forceY);
+	return p2p_functor(*pLocalContext->pGlobalContext->pExpansion, pLocalContext->forceX, pLocalContext->forceY);
 }
 
 
@@ -649,9 +655,7 @@ public:
 	inline void operator()(uint32_t i)
 	{
 		uint32_t node = quadtree->directNode(i);
-		uint32_t offset = quadtree->firstPoint(node);
-		uint32_t numPoints = quadtree->numberOfPoints(node);
-		eval_direct_fast(quadtree->pointX() + offset, quadtree->pointY() + offset, quadtree->pointSize() + offset, forceArrayX + offset, forceArrayY + offset, numPoints);
+		quadtreeExp->P2P(node, forceArrayX, forceArrayY);
 	}
 
 	inline void operator()(uint32_t begin, uint32_t end)
@@ -693,12 +697,7 @@ public:
 	{
 		uint32_t nodeA = quadtree->directNodeA(i);
 		uint32_t nodeB = quadtree->directNodeB(i);
-		uint32_t offsetA = quadtree->firstPoint(nodeA);
-		uint32_t offsetB = quadtree->firstPoint(nodeB);
-		uint32_t numPointsA = quadtree->numberOfPoints(nodeA);
-		uint32_t numPointsB = quadtree->numberOfPoints(nodeB);
-		eval_direct_fast(quadtree->pointX() + offsetA, quadtree->pointY() + offsetA, quadtree->pointSize() + offsetA, forceArrayX + offsetA, forceArrayY + offsetA, numPointsA,
-						 quadtree->pointX() + offsetB, quadtree->pointY() + offsetB, quadtree->pointSize() + offsetB, forceArrayX + offsetB, forceArrayY + offsetB, numPointsB);
+		quadtreeExp->P2P(nodeA, nodeB, forceArrayX, forceArrayY);
 	}
 
 	inline void operator()(uint32_t begin, uint32_t end)
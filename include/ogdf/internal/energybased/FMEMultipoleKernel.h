@@ -36,6 +36,7 @@
 
 #include <ogdf/internal/energybased/FMEKernel.h>
 #include <ogdf/internal/energybased/FMEFunc.h>
+#include <vector>
 
 
 namespace ogdf {
@@ -152,8 +153,57 @@ public:
 	{
 		if (isMainThread())
 		{
-			std::sort(ptr, ptr + n, comparer);
+			sort_presorted(ptr, n, comparer);
+		}
+	}
+
+	//! sorts a sequence that is almost sorted already, e.g. the points of the last iteration
+	/**
+	 * Every element that breaks the order is moved together with its predecessor to a buffer,
+	 * the remaining elements stay sorted in place. The buffer is sorted and merged back.
+	 * If too many elements are misplaced, the sequence is sorted by sort_unsorted instead.
+	 */
+	template<typename T, typename C>
+	static void sort_presorted(T* ptr, uint32_t n, C comparer)
+	{
+		std::vector<T> misplaced;
+		uint32_t m = 0;
+		for (uint32_t i = 0; i < n; i++)
+		{
+			if (m > 0 && comparer(ptr[i], ptr[m-1]))
+			{
+				misplaced.push_back(ptr[--m]);
+				misplaced.push_back(ptr[i]);
+				if (misplaced.size() > n/8) {
+					// restore the sequence and sort it from scratch
+					std::copy(misplaced.begin(), misplaced.end(), ptr + m);
+					sort_unsorted(ptr, n, comparer);
+					return;
+				}
+			} else
+				ptr[m++] = ptr[i];
 		}
+		if (misplaced.empty())
+			return;
+		sort_unsorted(misplaced.data(), (uint32_t)misplaced.size(), comparer);
+		std::copy(misplaced.begin(), misplaced.end(), ptr + m);
+		std::inplace_merge(ptr, ptr + m, ptr + n, comparer);
+	}
+
+	//! sorts an arbitrary sequence
+	template<typename T, typename C>
+	static void sort_unsorted(T* ptr, uint32_t n, C comparer)
+	{
+		std::sort(ptr, ptr + n, comparer);
+	}
+
+	//! sorts an arbitrary sequence of points, in linear time if they are ordered by their morton numbers
+	static void sort_unsorted(LinearQuadtree::LQPoint* ptr, uint32_t n, bool (*comparer)(const LinearQuadtree::LQPoint&, const LinearQuadtree::LQPoint&))
+	{
+		if (comparer == LQPointComparer)
+			sortByMortonNr(ptr, n);
+		else
+			std::sort(ptr, ptr + n, comparer);
 	}
 
 	//! lazy parallel sorting for num_threads = power of two
@@ -173,7 +223,7 @@ public:
 		if (n <= 1) return;
 		if (numThreads == 1)
 		{
-			std::sort(ptr, ptr + n, comparer);
+			sort_presorted(ptr, n, comparer);
 		}
 		else
 		{
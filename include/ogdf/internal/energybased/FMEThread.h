@@ -34,7 +34,7 @@
 
 #pragma once
 
-#include <ogdf/basic/Thread.h>
+#include <ogdf/basic/TaskScheduler.h>
 #include <ogdf/basic/Barrier.h>
 
 #include <ogdf/internal/energybased/FastUtils.h>
@@ -131,9 +131,16 @@ private:
 };
 
 
+/*!
+ * The threads running an FME kernel.
+ *
+ * The threads are workers of the global TaskScheduler reserved by a gang,
+ * so the pool may get fewer threads than requested if the scheduler is busy.
+*/
 class FMEThreadPool
 {
 public:
+	//! creates a pool of at most \a numThreads threads (rounded down to a power of two)
 	FMEThreadPool(uint32_t numThreads);
 
 	~FMEThreadPool();
@@ -167,6 +174,8 @@ private:
 
 	void deallocate();
 
+	TaskScheduler::Gang m_gang;
+
 	uint32_t m_numThreads;
 
 	FMEThread** m_pThreads;
@@ -0,0 +1,201 @@
+/** \file
+ * \brief Kernels for the repulsive forces of SpringEmbedderFRExact
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.txt in the root directory of the OGDF installation for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ *
+ * \see  http://www.gnu.org/copyleft/gpl.html
+ ***************************************************************/
+
+#pragma once
+
+#include <ogdf/basic/basic.h>
+#include <ogdf/internal/basic/intrinsics.h>
+
+namespace ogdf {
+
+//! Input of the repulsion kernels of SpringEmbedderFRExact.
+/**
+ * The arrays #x, #y and #weight are padded by nodes of weight 0 up to a
+ * multiple of #padding, so the kernels work on full vectors only. A padding
+ * node, like the node itself, contributes nothing to a repulsive force.
+ */
+template<typename T>
+struct FRExactRepulsion {
+	static const int padding = 8; //!< Multiple of the vector width of every kernel.
+
+	const T *x;       //!< x-coordinates of the nodes.
+	const T *y;       //!< y-coordinates of the nodes.
+	const T *weight;  //!< Weights of the nodes.
+	int numPadded;    //!< Number of nodes including padding.
+	T minDistSquare;  //!< Lower bound for squared distances.
+	double cRep;      //!< Factor for repulsive forces.
+};
+
+//! Computes the repulsive forces of the \a R nodes starting at \a v.
+/**
+ * The rows are processed together so that every loaded vector of the other
+ * nodes is reused \a R times. The summation order of a single row does not
+ * depend on \a R, hence neither does the result.
+ */
+template<class Ops, int R>
+inline void frExactRepulsionTile(
+	const FRExactRepulsion<typename Ops::Scalar> &r,
+	int v,
+	double *dispX,
+	double *dispY)
+{
+	typedef typename Ops::Scalar Scalar;
+	typedef typename Ops::Vector Vector;
+
+	Vector xv[R], yv[R], sumX[R], sumY[R];
+	for (int i = 0; i < R; ++i) {
+		xv[i] = Ops::set1(r.x[v + i]);
+		yv[i] = Ops::set1(r.y[v + i]);
+		sumX[i] = sumY[i] = Ops::zero();
+	}
+	const Vector minDistSquare = Ops::set1(r.minDistSquare);
+
+	for (int u = 0; u < r.numPadded; u += Ops::width) {
+		const Vector xu = Ops::load(r.x + u);
+		const Vector yu = Ops::load(r.y + u);
+		const Vector wu = Ops::load(r.weight + u);
+		for (int i = 0; i < R; ++i) {
+			Vector deltaX = Ops::sub(xv[i], xu);
+			Vector deltaY = Ops::sub(yv[i], yu);
+			Vector distSquare = Ops::max(minDistSquare,
+				Ops::add(Ops::mul(deltaX, deltaX), Ops::mul(deltaY, deltaY)));
+			Vector t = Ops::div(wu, distSquare);
+			sumX[i] = Ops::add(sumX[i], Ops::mul(deltaX, t));
+			sumY[i] = Ops::add(sumY[i], Ops::mul(deltaY, t));
+		}
+	}
+
+	for (int i = 0; i < R; ++i) {
+		Scalar lanesX[Ops::width], lanesY[Ops::width];
+		Ops::store(lanesX, sumX[i]);
+		Ops::store(lanesY, sumY[i]);
+		double sx = 0.0, sy = 0.0;
+		for (int l = 0; l < Ops::width; ++l) {
+			sx += lanesX[l];
+			sy += lanesY[l];
+		}
+		dispX[v + i] = r.cRep * sx;
+		dispY[v + i] = r.cRep * sy;
+	}
+}
+
+//! Computes the repulsive forces of the nodes \a begin, ..., \a end - 1 on all nodes.
+template<class Ops>
+void frExactRepulsion(
+	const FRExactRepulsion<typename Ops::Scalar> &r,
+	int begin,
+	int end,
+	double *dispX,
+	double *dispY)
+{
+	int v = begin;
+	for (; v + 4 <= end; v += 4) {
+		frExactRepulsionTile<Ops, 4>(r, v, dispX, dispY);
+	}
+	for (; v < end; ++v) {
+		frExactRepulsionTile<Ops, 1>(r, v, dispX, dispY);
+	}
+}
+
+//! Vector operations of the repulsion kernels for plain scalars.
+template<typename T>
+struct FRExactScalarOps {
+	typedef T Scalar;
+	typedef T Vector;
+	static const int width = 1;
+
+	static Vector load(const Scalar *p) { return *p; }
+	static void store(Scalar *p, Vector a) { *p = a; }
+	static Vector set1(Scalar a) { return a; }
+	static Vector zero() { return 0; }
+	static Vector add(Vector a, Vector b) { return a + b; }
+	static Vector sub(Vector a, Vector b) { return a - b; }
+	static Vector mul(Vector a, Vector b) { return a * b; }
+	static Vector div(Vector a, Vector b) { return a / b; }
+	static Vector max(Vector a, Vector b) { return a > b ? a : b; }
+};
+
+#ifdef OGDF_SSE2_EXTENSIONS
+
+//! Vector operations of the repulsion kernels for SSE2 (double precision).
+struct FRExactSSE2DoubleOps {
+	typedef double Scalar;
+	typedef __m128d Vector;
+	static const int width = 2;
+
+	static Vector load(const Scalar *p) { return _mm_loadu_pd(p); }
+	static void store(Scalar *p, Vector a) { _mm_storeu_pd(p, a); }
+	static Vector set1(Scalar a) { return _mm_set1_pd(a); }
+	static Vector zero() { return _mm_setzero_pd(); }
+	static Vector add(Vector a, Vector b) { return _mm_add_pd(a, b); }
+	static Vector sub(Vector a, Vector b) { return _mm_sub_pd(a, b); }
+	static Vector mul(Vector a, Vector b) { return _mm_mul_pd(a, b); }
+	static Vector div(Vector a, Vector b) { return _mm_div_pd(a, b); }
+	static Vector max(Vector a, Vector b) { return _mm_max_pd(a, b); }
+};
+
+//! Vector operations of the repulsion kernels for SSE2 (single precision).
+struct FRExactSSE2FloatOps {
+	typedef float Scalar;
+	typedef __m128 Vector;
+	static const int width = 4;
+
+	static Vector load(const Scalar *p) { return _mm_loadu_ps(p); }
+	static void store(Scalar *p, Vector a) { _mm_storeu_ps(p, a); }
+	static Vector set1(Scalar a) { return _mm_set1_ps(a); }
+	static Vector zero() { return _mm_setzero_ps(); }
+	static Vector add(Vector a, Vector b) { return _mm_add_ps(a, b); }
+	static Vector sub(Vector a, Vector b) { return _mm_sub_ps(a, b); }
+	static Vector mul(Vector a, Vector b) { return _mm_mul_ps(a, b); }
+	static Vector div(Vector a, Vector b) { return _mm_div_ps(a, b); }
+	static Vector max(Vector a, Vector b) { return _mm_max_ps(a, b); }
+};
+
+#endif
+
+#ifdef OGDF_AVX_EXTENSIONS
+
+//! Computes the repulsive forces of the nodes \a begin, ..., \a end - 1 with AVX (double precision).
+/**
+ * @pre System::cpuSupports(#cpufAVX)
+ */
+void frExactRepulsionAVX(const FRExactRepulsion<double> &r, int begin, int end, double *dispX, double *dispY);
+
+//! Computes the repulsive forces of the nodes \a begin, ..., \a end - 1 with AVX (single precision).
+/**
+ * @pre System::cpuSupports(#cpufAVX)
+ */
+void frExactRepulsionAVX(const FRExactRepulsion<float> &r, int begin, int end, double *dispX, double *dispY);
+
+#endif
+
+} // end namespace ogdf
@@ -155,19 +155,21 @@ inline MNR_T mortonNumber(C_T ix, C_T iy)
 template<typename MNR_T, typename C_T>
 inline void mortonNumberInv(MNR_T mnr, C_T& x, C_T& y)
 {
-	// bit length of the coordinates
-	unsigned int BIT_LENGTH = static_cast<unsigned int>(sizeof(C_T)) << 3;
-	// set least significant bit
-	MNR_T mask = 0x1;
-	// set coords to zero
-	x = y = 0;
-	for (unsigned int i=0; i < BIT_LENGTH; i++)
-	{
-		x = (C_T)(x | (mnr & mask));
-		mnr = mnr >> 1;
-		y = (C_T)(y | (mnr & mask));
-		mask = mask << 1;
+	// bit length of the morton number
+	const unsigned int BIT_LENGTH = static_cast<unsigned int>(sizeof(MNR_T)) << 3;
+	// every second bit set
+	const MNR_T ones = ~((MNR_T)0x0);
+	MNR_T mx = mnr & (ones / 3);
+	MNR_T my = (mnr >> 1) & (ones / 3);
+
+	for (unsigned int i = 1; i < (BIT_LENGTH >> 1); i = i << 1) {
+		// decrease frequency, the mask keeps the lower 2*i bits of every 4*i bits
+		MNR_T mask = ones / ((((MNR_T)0x1) << (2*i)) + 1);
+		mx = (mx | (mx >> i)) & mask;
+		my = (my | (my >> i)) & mask;
 	}
+	x = (C_T)mx;
+	y = (C_T)my;
 }
 
 //! returns the index of the most signficant bit set. 0 = most signif, bitlength-1 = least signif
@@ -186,6 +188,22 @@ inline uint32_t mostSignificantBit(T n)
 	return BIT_LENGTH;
 }
 
+#ifdef __has_builtin
+#if __has_builtin(__builtin_clz)
+//! returns the index of the most signficant bit set using the count leading zeros instruction
+inline uint32_t mostSignificantBit(uint32_t n)
+{
+	return n ? static_cast<uint32_t>(__builtin_clz(n)) : 32;
+}
+
+//! returns the index of the most signficant bit set using the count leading zeros instruction
+inline uint32_t mostSignificantBit(uint64_t n)
+{
+	return n ? static_cast<uint32_t>(__builtin_clzll(n)) : 64;
+}
+#endif
+#endif
+
 //! returns the prev power of two
 inline uint32_t prevPowerOfTwo(uint32_t n)
 {
@@ -614,6 +614,14 @@ public:
 	WSPD* wspd() const{ return m_WSPD; };
 
 	void init(float min_x, float min_y, float max_x, float max_y);
+
+	//! keeps the grid as long as it covers the given box and is less than twice as large, otherwise re-initializes it with some slack
+	/**
+	 * A stable grid keeps the morton numbers of the points stable, so their order changes only a little
+	 * between two iterations. Returns true if the grid has been re-initialized.
+	 */
+	bool fitGrid(float min_x, float min_y, float max_x, float max_y);
+
 	inline float minX() const { return m_min_x; }
 	inline float minY() const { return m_min_y; }
 	inline float maxX() const { return m_max_x; }
@@ -781,6 +789,15 @@ private:
 	//! number of inner nodes in the chain
 	uint32_t m_numInnerNodes;
 
+	//! level of the smallest cell containing point i-1 and point i, 0 if they are in the same leaf (see LinearQuadtreeBuilder::update)
+	uint8_t* m_cellLevel;
+
+	//! number of positions up to i whose cell level differs from the last build
+	uint32_t* m_numChangedLevels;
+
+	//! true if the tree and m_cellLevel have been built by LinearQuadtreeBuilder::update
+	bool m_cellLevelsValid;
+
 };
 
 inline void swap(ogdf::LinearQuadtree::LQPoint& b, ogdf::LinearQuadtree::LQPoint& a)
@@ -795,4 +812,7 @@ inline bool LQPointComparer(const LinearQuadtree::LQPoint& a, const LinearQuadtr
 	return a.mortonNr < b.mortonNr;
 }
 
+//! sorts the points by their morton numbers with a stable radix sort in linear time
+void sortByMortonNr(LinearQuadtree::LQPoint* points, uint32_t n);
+
 } // end of namespace ogdf
@@ -36,6 +36,7 @@
 
 #include <ogdf/internal/energybased/FastUtils.h>
 #include <ogdf/internal/energybased/LinearQuadtree.h>
+#include <vector>
 
 namespace ogdf {
 
@@ -58,6 +59,14 @@ public:
 	//! prepares the node and leaf layer for the complete tree from 0 to n (excluding n)
 	void prepareTree();
 
+	//! prepares and links the complete tree like prepareTree() and build(), but keeps the subtrees of the last update()
+	/**
+	 * A subtree of the last update() is kept if the points in its range are still in the same cells
+	 * relative to each other and its range is still separated from the neighboring points on its level.
+	 * Only the leaves and inner nodes between the kept subtrees are prepared again.
+	 */
+	void update();
+
 	//! merges the node curr with curr's next node by appending the next nodes children to curr except the first one.
 	void mergeWithNext(LinearQuadtree::NodeID curr);
 
@@ -102,6 +111,9 @@ public:
 			tree.setNextNode(restoreChainLastNode, 0);
 	}
 
+	//! collects the roots of the maximal subtrees below curr that update() can keep
+	void collectUnchangedSubtrees(LinearQuadtree::NodeID curr, std::vector<LinearQuadtree::NodeID>& roots);
+
 	//! returns the level of the first common ancestor of a and b
 	inline uint32_t CAL(LinearQuadtree::PointID a, LinearQuadtree::PointID b)
 	{
@@ -35,6 +35,7 @@
 #pragma once
 
 #include <ogdf/internal/energybased/LinearQuadtree.h>
+#include <ogdf/internal/energybased/FMEExpansionKernel.h>
 
 namespace ogdf {
 
@@ -62,8 +63,14 @@ public:
 	//! evaluates the derivate of the local expansion at the point and adds the forces to fx fy
 	void L2P(uint32_t source, uint32_t point, float& fx, float& fy);
 
+	//! evaluates the forces between all points of the node directly and adds them to fx fy (indexed by point)
+	void P2P(uint32_t node, float* fx, float* fy);
+
+	//! evaluates the forces between the points of node a and node b directly and adds them to fx fy (indexed by point)
+	void P2P(uint32_t nodeA, uint32_t nodeB, float* fx, float* fy);
+
 	//! returns the size in bytes
-	uint32_t sizeInBytes() const { return m_numExp*m_numCoeff*(uint32_t)sizeof(double)*4; }
+	uint32_t sizeInBytes() const { return m_numExp*m_tables.stride*(uint32_t)sizeof(double)*2; }
 
 	//! returns the array with multipole coefficients
 	inline double* multiExp() const { return m_multiExp; }
@@ -74,6 +81,12 @@ public:
 	//! number of coefficients per expansions
 	inline uint32_t numCoeff() const { return m_numCoeff; }
 
+	//! number of doubles per expansion, the coefficients are followed by zeros
+	inline uint32_t stride() const { return m_tables.stride; }
+
+	//! the factors of the kernels
+	inline const FMEExpansionTables& tables() const { return m_tables; }
+
 	//! the quadtree
 	const LinearQuadtree& tree() { return m_tree; }
 private:
@@ -84,6 +97,12 @@ private:
 	//! releases the memory for the coeffs
 	void deallocate();
 
+	//! computes the factors of the kernels
+	void initTables();
+
+	//! returns the coefficients of the expansion with the given index in coeffs
+	inline double* coeff(double* coeffs, uint32_t index) const { return coeffs + index*m_tables.stride; }
+
 	//! the Quadtree reference
 	const LinearQuadtree& m_tree;
 public:
@@ -101,6 +120,16 @@ public:
 	uint32_t m_numCoeff;
 
 	BinCoeff<double> binCoef;
+
+private:
+	//! the factors of the kernels
+	FMEExpansionTables m_tables;
+
+	//! the memory of the factors
+	double* m_factors;
+
+	//! the kernels for the instruction set of the CPU
+	FMEExpansionKernels m_kernels;
 };
 
 
@@ -65,6 +65,41 @@ struct NodeMerge
 };
 
 
+//! A snapshot of a level graph in compressed sparse row format.
+/**
+ * Nodes and edges are numbered consecutively from 0. The adjacencies of node \a i
+ * are the entries \a m_adjStart[i], ..., \a m_adjStart[i+1]-1 of \a m_adjNode and
+ * \a m_adjEdge; every edge that is not a self-loop appears in the adjacencies of both
+ * its end nodes.
+ */
+struct CompactGraph
+{
+	std::vector<int> m_nodeIndex;    //!< The index of every node in the MultilevelGraph.
+	std::vector<double> m_radius;    //!< The radius of every node.
+	std::vector<int> m_mergeWeight;  //!< The number of original nodes represented by every node.
+
+	std::vector<int> m_adjStart;     //!< The first adjacency of every node, followed by the number of adjacencies.
+	std::vector<int> m_adjNode;      //!< The adjacent node of every adjacency.
+	std::vector<int> m_adjEdge;      //!< The edge of every adjacency.
+
+	std::vector<int> m_edgeIndex;    //!< The index of every edge in the MultilevelGraph.
+	std::vector<double> m_weight;    //!< The weight (desired length) of every edge.
+	std::vector<int> m_source;       //!< The source of every edge.
+	std::vector<int> m_target;       //!< The target of every edge.
+
+	int numberOfNodes() const { return (int)m_nodeIndex.size(); }
+	int numberOfEdges() const { return (int)m_edgeIndex.size(); }
+};
+
+
+//! A level of a MultilevelGraph that was built by contracting a CompactGraph as a whole.
+struct CompactLevel
+{
+	CompactGraph m_graph;      //!< The graph of this level.
+	std::vector<int> m_parent; //!< The index of the node representing every node of #m_graph on the next coarser level.
+};
+
+
 class OGDF_EXPORT MultilevelGraph
 {
 private:
@@ -72,6 +107,7 @@ private:
 	Graph * m_G;
 	GraphAttributes * m_GA; //<! Keeps layout info in replacement of information below (todo: remove them)
 	std::vector<NodeMerge *> m_changes;
+	std::vector<CompactLevel> m_compactLevels; //!< Levels that were contracted as a whole, finest first.
 	NodeArray<double> m_radius;
 	double m_avgRadius; //stores average node radius for scaling and random layout purposes
 
@@ -158,6 +194,29 @@ public:
 	void updateReverseIndizes();
 	//sets the merge weights back to initial values
 	void updateMergeWeights();
+
+	//! Stores the current level graph in \a CG.
+	void compactGraph(CompactGraph &CG) const;
+
+	//! Replaces the current graph by \a coarsest, the result of contracting the graphs of \a levels one after another.
+	/**
+	 * \a levels[0].m_graph has to describe the current graph. Every node of a coarser
+	 * graph has to carry the index of one of the nodes it represents, every edge the
+	 * index of one of the edges it represents. The levels are moved into the
+	 * MultilevelGraph and undone one by one by expandCompactLevel().
+	 * Compact levels cannot be mixed with node merges.
+	 */
+	void contract(std::vector<CompactLevel> &levels, const CompactGraph &coarsest);
+
+	//! Returns the number of compact levels that have not been expanded yet.
+	int numberOfCompactLevels() const { return (int)m_compactLevels.size(); }
+
+	//! Replaces the current graph by the graph of the last compact level.
+	/**
+	 * The reinserted nodes are appended to \a inserted, the nodes representing them
+	 * on the coarser level to \a representatives. Their positions are left to the caller.
+	 */
+	void expandCompactLevel(std::vector<node> &inserted, std::vector<node> &representatives);
 };
 
 } // namespace ogdf
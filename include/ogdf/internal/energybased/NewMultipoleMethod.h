@@ -37,6 +37,7 @@
 #include <ogdf/basic/Graph.h>
 #include <ogdf/basic/List.h>
 #include <ogdf/basic/Array2D.h>
+#include <ogdf/basic/ArrayBuffer.h>
 #include <ogdf/basic/geometry.h>
 #include <ogdf/internal/energybased/QuadTreeNM.h>
 #include <ogdf/internal/energybased/FruchtermanReingold.h>
@@ -71,6 +72,17 @@ public:
 	//! Import updated information of the drawing area.
 	void update_boxlength_and_cornercoordinate(double b_l,DPoint d_l_c);
 
+	//! Sets the number of threads to \a t (0 = all threads of the global TaskScheduler).
+	/**
+	 * For any value other than 1, the expansions and forces are calculated by
+	 * the parallel variants of the NMM steps. Their results do not depend on
+	 * the number of threads, but may differ slightly from the sequential ones.
+	 */
+	void number_of_threads(unsigned int t) { _number_of_threads = t; }
+
+	//! Returns the number of threads (0 = all threads of the global TaskScheduler).
+	unsigned int number_of_threads() const { return _number_of_threads; }
+
 private:
 	//! The minimum number of nodes for which the forces are
 	//! calculated using NMM (for lower values the exact
@@ -85,6 +97,7 @@ private:
 	int _find_small_cell;//!< 0 = iterative; 1= Aluru
 	int _particles_in_leaves;//!< max. number of particles for leaves of the quadtree
 	int _precision;  //!< precision for p-term multipole expansion
+	unsigned int _number_of_threads; //!< number of threads (1 = sequential, 0 = all)
 
 	double boxlength;//!< length of drawing box
 	DPoint down_left_corner;//!< down left corner of drawing box
@@ -394,12 +407,35 @@ private:
 	//!  *act_ptr has a father_node.
 	void add_shifted_expansion_to_father_expansion(QuadTreeNodeNM* act_ptr);
 
+	//! Parallel variant of form_multipole_expansions(): the centers are set in the
+	//! same order (they are waggled randomly), the ME Lists of the leaves are
+	//! calculated in parallel and shifted to the ancestors afterwards.
+	void form_multipole_expansions_in_parallel(NodeArray<NodeAttributes>& A,
+		QuadTreeNM& T,
+		ArrayBuffer<QuadTreeNodeNM*>& quad_tree_leaves);
+
+	//! The expansion Lists and centers of the treenodes of the subtree rooted at
+	//! act_ptr are initialized in preorder and the treenodes are appended to
+	//! postorder in postorder.
+	void init_expansions_of_subtree(QuadTreeNodeNM* act_ptr,
+		ArrayBuffer<QuadTreeNodeNM*>& postorder);
+
 	//! According to NMM T is traversed recursively top-down starting from act_node_ptr
 	//! == T.get_root_ptr() and thereby the lists D1, D2, M and LE are calculated for all
 	//! treenodes.
 	void calculate_local_expansions_and_WSPRLS(NodeArray<NodeAttributes>&A,
 		QuadTreeNodeNM* act_node_ptr);
 
+	//! Parallel variant of calculate_local_expansions_and_WSPRLS(): T is traversed
+	//! level by level and the treenodes of one level are handled in parallel.
+	void calculate_local_expansions_and_WSPRLS_in_parallel(NodeArray<NodeAttributes>&A,
+		QuadTreeNodeNM* root_ptr);
+
+	//! Calculates the lists D1, D2, M and LE of *act_node_ptr (without recursion);
+	//! precondition: the lists of its father are known.
+	void calculate_local_expansion_and_WSPRLS_of_node(NodeArray<NodeAttributes>&A,
+		QuadTreeNodeNM* act_node_ptr);
+
 	//! If the small cell of ptr_1 and ptr_2 are well separated true is returned (else
 	//! false).
 	bool well_separated(QuadTreeNodeNM* ptr_1, QuadTreeNodeNM* ptr_2);
@@ -428,18 +464,38 @@ private:
 		List<QuadTreeNodeNM*>& quad_tree_leaves,
 		NodeArray<DPoint>& F_local_exp);
 
+	//! The force contribution defined by leaf_ptr->get_local_exp() is calculated
+	//! and stored in F_local_exp for the nodes contained in *leaf_ptr.
+	void transform_local_exp_to_forces_of_leaf(NodeArray <NodeAttributes>&A,
+		const QuadTreeNodeNM* leaf_ptr,
+		NodeArray<DPoint>& F_local_exp);
+
 	//! For each leaf v in quad_tree_leaves the force contribution defined by all nodes
 	//! in v.get_M() is calculated and stored in F_multipole_exp.
 	void transform_multipole_exp_to_forces(NodeArray<NodeAttributes>& A,
 		List<QuadTreeNodeNM*>& quad_tree_leaves,
 		NodeArray<DPoint>& F_multipole_exp);
 
+	//! The force contribution defined by all nodes in leaf_ptr->get_M() is
+	//! calculated and added to F_multipole_exp for the nodes contained in *leaf_ptr.
+	void transform_multipole_exp_to_forces_of_leaf(NodeArray<NodeAttributes>& A,
+		const QuadTreeNodeNM* leaf_ptr,
+		NodeArray<DPoint>& F_multipole_exp);
+
 	//! For each leaf v in quad_tree_leaves the force contributions from all leaves in
 	//! v.get_D1() and v.get_D2() are calculated.
 	void calculate_neighbourcell_forces(NodeArray<NodeAttributes>& A,
 		List<QuadTreeNodeNM*>& quad_tree_leaves,
 		NodeArray<DPoint>& F_direct);
 
+	//! The force contributions from *leaf_ptr itself and all leaves in
+	//! leaf_ptr->get_D1() and leaf_ptr->get_D2() are calculated and stored in
+	//! F_direct for the nodes contained in *leaf_ptr only; this is the variant used
+	//! by parallel NMM (nodes at the same position are separated deterministically).
+	void calculate_neighbourcell_forces_of_leaf(NodeArray<NodeAttributes>& A,
+		const QuadTreeNodeNM* leaf_ptr,
+		NodeArray<DPoint>& F_direct);
+
 	//! Add repulsive force contributions for each node.
 	void add_rep_forces(const Graph& G,
 		NodeArray<DPoint>& F_direct,
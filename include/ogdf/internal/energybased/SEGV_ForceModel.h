@@ -35,14 +35,89 @@
 #pragma once
 
 #include <ogdf/energybased/SpringEmbedderGridVariant.h>
+#include <ogdf/basic/ArrayBuffer.h>
+#include <ogdf/internal/energybased/SEGV_RepulsionKernel.h>
 
 namespace ogdf {
 
+//! The grid cells of SpringEmbedderGridVariant.
+/**
+ * The cells (-1,-1), ..., (#high1(), #high2()) are ranked in Morton order
+ * (Z-order), and the nodes are kept sorted by the rank of their cell
+ * together with a copy of their positions. Hence nearby nodes are near in
+ * memory, and since every aligned 2x2 block of cells has consecutive ranks,
+ * the 3x3 neighbourhood of a cell consists of at most six contiguous ranges.
+ * These ranges only depend on the dimensions of the grid and are computed
+ * once by init().
+ */
+class SpringEmbedderGridVariant::Grid
+{
+public:
+	Grid() : m_high1(0), m_high2(0), m_kernel(nullptr), m_kernelCubic(nullptr) { }
+
+	//! Initializes the grid with cells (-1,-1), ..., (\a xA, \a yA) for \a n nodes.
+	void init(int xA, int yA, int n);
+
+	//! Sorts the nodes by the cells given by NodeInfo::m_gridX and NodeInfo::m_gridY.
+	void sort(const Array<NodeInfo> &vInfo);
+
+	//! Multiplies the copied positions of the sorted nodes \a begin, ..., \a end - 1 by \a s.
+	void scale(int begin, int end, double s) {
+		for (int k = begin; k < end; ++k) {
+			m_x[k] *= s;
+			m_y[k] *= s;
+		}
+	}
+
+	int high1() const { return m_high1; }
+	int high2() const { return m_high2; }
+
+	//! Returns the node at position \a k of the sorted order.
+	int sortedNode(int k) const { return m_node[k]; }
+
+	//! Returns the repulsive forces on \a vj by the nodes in the 3x3 cells around it.
+	/**
+	 * A node at distance \a d < \a boxLength contributes its difference
+	 * vector to \a vj divided by \a d^2 + \a eps, or by \a d^3 + \a eps if
+	 * \a cubic is set.
+	 */
+	DPoint repulsion(const NodeInfo &vj, double boxLength, double eps, bool cubic) const {
+		const int c = m_rank(vj.m_gridX, vj.m_gridY);
+		const int *ranges = &m_ranges[0];
+		const SEGVRepulsion r = { &m_x[0], &m_y[0], &m_cellStart[0], boxLength, eps };
+
+		DPoint force;
+		(cubic ? m_kernelCubic : m_kernel)(r, ranges + m_rangeStart[c], ranges + m_rangeStart[c+1],
+			vj.m_pos.m_x, vj.m_pos.m_y, force.m_x, force.m_y);
+		return force;
+	}
+
+private:
+	typedef void (*Kernel)(const SEGVRepulsion &r, const int *range, const int *rangeStop,
+		double px, double py, double &forceX, double &forceY);
+
+	int m_high1; //!< Largest x-index of a cell.
+	int m_high2; //!< Largest y-index of a cell.
+
+	Array2D<int> m_rank;       //!< The rank of each cell in Morton order.
+	Array<int> m_rangeStart;   //!< First neighbour range of each cell (by rank).
+	ArrayBuffer<int> m_ranges; //!< Neighbour ranges as pairs of cell ranks.
+
+	Array<int>    m_cellStart; //!< First sorted node of each cell (by rank).
+	Array<int>    m_node;      //!< The nodes sorted by cell.
+	Array<double> m_x;         //!< x-coordinates of the sorted nodes (padded).
+	Array<double> m_y;         //!< y-coordinates of the sorted nodes (padded).
+
+	Kernel m_kernel;      //!< Kernel for forces divided by \a d^2 + \a eps.
+	Kernel m_kernelCubic; //!< Kernel for forces divided by \a d^3 + \a eps.
+};
+
+
 class SpringEmbedderGridVariant::ForceModelBase
 {
 public:
-	ForceModelBase(const Array<NodeInfo> &vInfo, const Array<int> &adjLists, const Array2D<ListPure<int>> &gridCell, double idealEdgeLength)
-		: m_vInfo(vInfo), m_adjLists(adjLists), m_gridCell(gridCell), m_idealEdgeLength(idealEdgeLength) { }
+	ForceModelBase(const Array<NodeInfo> &vInfo, const Array<int> &adjLists, const Grid &grid, double idealEdgeLength)
+		: m_vInfo(vInfo), m_adjLists(adjLists), m_grid(grid), m_idealEdgeLength(idealEdgeLength) { }
 
 	virtual ~ForceModelBase() { }
 
@@ -51,9 +126,9 @@ public:
 	double eps() const { return 0.01*m_idealEdgeLength; }
 
 protected:
-	const Array<NodeInfo>        &m_vInfo;
-	const Array<int>             &m_adjLists;
-	const Array2D<ListPure<int>> &m_gridCell;
+	const Array<NodeInfo> &m_vInfo;
+	const Array<int>      &m_adjLists;
+	const Grid            &m_grid;
 
 	double m_idealEdgeLength;
 };
@@ -62,8 +137,8 @@ protected:
 class SpringEmbedderGridVariant::ForceModelFR : public ForceModelBase
 {
 public:
-	ForceModelFR(const Array<NodeInfo> &vInfo, const Array<int> &adjLists, const Array2D<ListPure<int>> &gridCell, double idealEdgeLength)
-		: ForceModelBase(vInfo, adjLists, gridCell, idealEdgeLength) { }
+	ForceModelFR(const Array<NodeInfo> &vInfo, const Array<int> &adjLists, const Grid &grid, double idealEdgeLength)
+		: ForceModelBase(vInfo, adjLists, grid, idealEdgeLength) { }
 
 	DPoint computeDisplacement(int j, double boxLength) const;
 };
@@ -71,8 +146,8 @@ public:
 class SpringEmbedderGridVariant::ForceModelFRModAttr : public ForceModelBase
 {
 public:
-	ForceModelFRModAttr(const Array<NodeInfo> &vInfo, const Array<int> &adjLists, const Array2D<ListPure<int>> &gridCell, double idealEdgeLength)
-		: ForceModelBase(vInfo, adjLists, gridCell, idealEdgeLength) { }
+	ForceModelFRModAttr(const Array<NodeInfo> &vInfo, const Array<int> &adjLists, const Grid &grid, double idealEdgeLength)
+		: ForceModelBase(vInfo, adjLists, grid, idealEdgeLength) { }
 
 	DPoint computeDisplacement(int j, double boxLength) const;
 };
@@ -80,8 +155,8 @@ public:
 class SpringEmbedderGridVariant::ForceModelFRModRep : public ForceModelBase
 {
 public:
-	ForceModelFRModRep(const Array<NodeInfo> &vInfo, const Array<int> &adjLists, const Array2D<ListPure<int>> &gridCell, double idealEdgeLength)
-		: ForceModelBase(vInfo, adjLists, gridCell, idealEdgeLength) { }
+	ForceModelFRModRep(const Array<NodeInfo> &vInfo, const Array<int> &adjLists, const Grid &grid, double idealEdgeLength)
+		: ForceModelBase(vInfo, adjLists, grid, idealEdgeLength) { }
 
 	DPoint computeDisplacement(int j, double boxLength) const;
 };
@@ -90,8 +165,8 @@ public:
 class SpringEmbedderGridVariant::ForceModelEades : public ForceModelBase
 {
 public:
-	ForceModelEades(const Array<NodeInfo> &vInfo, const Array<int> &adjLists, const Array2D<ListPure<int>> &gridCell, double idealEdgeLength)
-		: ForceModelBase(vInfo, adjLists, gridCell, idealEdgeLength) { }
+	ForceModelEades(const Array<NodeInfo> &vInfo, const Array<int> &adjLists, const Grid &grid, double idealEdgeLength)
+		: ForceModelBase(vInfo, adjLists, grid, idealEdgeLength) { }
 
 	DPoint computeDisplacement(int j, double boxLength) const;
 };
@@ -100,8 +175,8 @@ public:
 class SpringEmbedderGridVariant::ForceModelHachul : public ForceModelBase
 {
 public:
-	ForceModelHachul(const Array<NodeInfo> &vInfo, const Array<int> &adjLists, const Array2D<ListPure<int>> &gridCell, double idealEdgeLength)
-		: ForceModelBase(vInfo, adjLists, gridCell, idealEdgeLength) { }
+	ForceModelHachul(const Array<NodeInfo> &vInfo, const Array<int> &adjLists, const Grid &grid, double idealEdgeLength)
+		: ForceModelBase(vInfo, adjLists, grid, idealEdgeLength) { }
 
 	DPoint computeDisplacement(int j, double boxLength) const;
 };
@@ -110,8 +185,8 @@ public:
 class SpringEmbedderGridVariant::ForceModelGronemann : public ForceModelBase
 {
 public:
-	ForceModelGronemann(const Array<NodeInfo> &vInfo, const Array<int> &adjLists, const Array2D<ListPure<int>> &gridCell, double idealEdgeLength)
-		: ForceModelBase(vInfo, adjLists, gridCell, idealEdgeLength) { }
+	ForceModelGronemann(const Array<NodeInfo> &vInfo, const Array<int> &adjLists, const Grid &grid, double idealEdgeLength)
+		: ForceModelBase(vInfo, adjLists, grid, idealEdgeLength) { }
 
 	DPoint computeDisplacement(int j, double boxLength) const;
 };
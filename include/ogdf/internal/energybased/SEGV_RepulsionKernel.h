@@ -0,0 +1,187 @@
+/** \file
+ * \brief Kernels for the grid-based repulsive forces of SpringEmbedderGridVariant
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.txt in the root directory of the OGDF installation for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ *
+ * \see  http://www.gnu.org/copyleft/gpl.html
+ ***************************************************************/
+
+#pragma once
+
+#include <ogdf/basic/basic.h>
+#include <ogdf/internal/basic/intrinsics.h>
+#include <cmath>
+#include <cstdint>
+
+namespace ogdf {
+
+//! Input of the repulsion kernels of SpringEmbedderGridVariant.
+/**
+ * The nodes are sorted by grid cell; the nodes of the cell with rank \a c are
+ * #x[#cellStart[\a c]], ..., #x[#cellStart[\a c + 1] - 1]. The arrays #x and
+ * #y are followed by #padding further entries, so a kernel may load full
+ * vectors at the end of any range.
+ */
+struct SEGVRepulsion {
+	static const int padding = 4; //!< At least the vector width of the widest kernel minus one.
+
+	const double *x;         //!< x-coordinates of the nodes sorted by cell.
+	const double *y;         //!< y-coordinates of the nodes sorted by cell.
+	const int    *cellStart; //!< First sorted node of each cell (by rank).
+	double boxLength;        //!< Only nodes closer than this repel each other.
+	double eps;              //!< Added to the denominator of every force.
+};
+
+//! Sums up the repulsive forces of the nodes in the given cell ranges on point (\a px, \a py).
+/**
+ * The ranges are given as pairs of cell ranks [\a lo, \a hi), so that all
+ * nodes in cells \a lo, ..., \a hi - 1 are considered. A node at distance
+ * \a d < SEGVRepulsion::boxLength contributes its difference vector divided by
+ * \a d^2 + eps, or by \a d^3 + eps if \a cubic is set. The point itself
+ * contributes nothing since its difference vector is zero.
+ */
+template<class Ops, bool cubic>
+inline void segvRepulsion(
+	const SEGVRepulsion &r,
+	const int *range,
+	const int *rangeStop,
+	double px,
+	double py,
+	double &forceX,
+	double &forceY)
+{
+	typedef typename Ops::Vector Vector;
+	typedef typename Ops::Mask Mask;
+
+	const Vector pxv = Ops::set1(px);
+	const Vector pyv = Ops::set1(py);
+	const Vector boxLength = Ops::set1(r.boxLength);
+	const Vector eps = Ops::set1(r.eps);
+	const Vector one = Ops::set1(1.0);
+	Vector sumX = Ops::zero(), sumY = Ops::zero();
+
+	for (; range != rangeStop; range += 2) {
+		const int stop = r.cellStart[range[1]];
+		for (int u = r.cellStart[range[0]]; u < stop; u += Ops::width) {
+			Vector deltaX = Ops::sub(pxv, Ops::load(r.x + u));
+			Vector deltaY = Ops::sub(pyv, Ops::load(r.y + u));
+			Vector distSquare = Ops::add(Ops::mul(deltaX, deltaX), Ops::mul(deltaY, deltaY));
+			Vector dist = Ops::sqrt(distSquare);
+			Vector denom = cubic ? Ops::mul(distSquare, dist) : distSquare;
+			Vector t = Ops::div(one, Ops::add(denom, eps));
+
+			Mask inBox = Ops::less(dist, boxLength);
+			if (stop - u < Ops::width) {
+				inBox = Ops::both(inBox, Ops::firstLanes(stop - u));
+			}
+			sumX = Ops::add(sumX, Ops::select(inBox, Ops::mul(deltaX, t)));
+			sumY = Ops::add(sumY, Ops::select(inBox, Ops::mul(deltaY, t)));
+		}
+	}
+
+	double lanesX[Ops::width], lanesY[Ops::width];
+	Ops::store(lanesX, sumX);
+	Ops::store(lanesY, sumY);
+	forceX = forceY = 0.0;
+	for (int l = 0; l < Ops::width; ++l) {
+		forceX += lanesX[l];
+		forceY += lanesY[l];
+	}
+}
+
+//! All-ones lanes followed by all-zero lanes, used for masking the last vector of a range.
+/**
+ * Loading a vector of width \a w at position \a w - \a k yields a mask whose
+ * first \a k lanes are set.
+ */
+static const int64_t segvLaneMask[8] = { -1, -1, -1, -1, 0, 0, 0, 0 };
+
+//! Vector operations of the repulsion kernels for plain scalars.
+struct SEGVScalarOps {
+	typedef double Vector;
+	typedef bool Mask;
+	static const int width = 1;
+
+	static Vector load(const double *p) { return *p; }
+	static void store(double *p, Vector a) { *p = a; }
+	static Vector set1(double a) { return a; }
+	static Vector zero() { return 0.0; }
+	static Vector add(Vector a, Vector b) { return a + b; }
+	static Vector sub(Vector a, Vector b) { return a - b; }
+	static Vector mul(Vector a, Vector b) { return a * b; }
+	static Vector div(Vector a, Vector b) { return a / b; }
+	static Vector sqrt(Vector a) { return std::sqrt(a); }
+	static Mask less(Vector a, Vector b) { return a < b; }
+	static Mask both(Mask a, Mask b) { return a && b; }
+	static Mask firstLanes(int k) { return k > 0; }
+	static Vector select(Mask m, Vector a) { return m ? a : 0.0; }
+};
+
+#ifdef OGDF_SSE2_EXTENSIONS
+
+//! Vector operations of the repulsion kernels for SSE2.
+struct SEGVSSE2Ops {
+	typedef __m128d Vector;
+	typedef __m128d Mask;
+	static const int width = 2;
+
+	static Vector load(const double *p) { return _mm_loadu_pd(p); }
+	static void store(double *p, Vector a) { _mm_storeu_pd(p, a); }
+	static Vector set1(double a) { return _mm_set1_pd(a); }
+	static Vector zero() { return _mm_setzero_pd(); }
+	static Vector add(Vector a, Vector b) { return _mm_add_pd(a, b); }
+	static Vector sub(Vector a, Vector b) { return _mm_sub_pd(a, b); }
+	static Vector mul(Vector a, Vector b) { return _mm_mul_pd(a, b); }
+	static Vector div(Vector a, Vector b) { return _mm_div_pd(a, b); }
+	static Vector sqrt(Vector a) { return _mm_sqrt_pd(a); }
+	static Mask less(Vector a, Vector b) { return _mm_cmplt_pd(a, b); }
+	static Mask both(Mask a, Mask b) { return _mm_and_pd(a, b); }
+	static Mask firstLanes(int k) {
+		return _mm_castsi128_pd(_mm_loadu_si128(reinterpret_cast<const __m128i*>(segvLaneMask + 4 - k)));
+	}
+	static Vector select(Mask m, Vector a) { return _mm_and_pd(m, a); }
+};
+
+#endif
+
+#ifdef OGDF_AVX_EXTENSIONS
+
+//! Sums up the repulsive forces on (\a px, \a py) with AVX, see segvRepulsion().
+/**
+ * @pre System::cpuSupports(#cpufAVX)
+ */
+void segvRepulsionAVX(const SEGVRepulsion &r, const int *range, const int *rangeStop, double px, double py, double &forceX, double &forceY);
+
+//! Sums up the cubic repulsive forces on (\a px, \a py) with AVX, see segvRepulsion().
+/**
+ * @pre System::cpuSupports(#cpufAVX)
+ */
+void segvRepulsionCubicAVX(const SEGVRepulsion &r, const int *range, const int *rangeStop, double px, double py, double &forceX, double &forceY);
+
+#endif
+
+}
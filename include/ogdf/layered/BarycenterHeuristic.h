@@ -48,10 +48,10 @@ class OGDF_EXPORT BarycenterHeuristic : public LayerByLayerSweep
 {
 public:
 	//! Creates a new instance of the barycenter heuristic.
-	BarycenterHeuristic() { }
+	BarycenterHeuristic() : m_numberOfThreads(1) { }
 
 	//! Creates a new instance of the barycenter heuristic.
-	BarycenterHeuristic(const BarycenterHeuristic &crossMin) { }
+	BarycenterHeuristic(const BarycenterHeuristic &crossMin) : m_numberOfThreads(crossMin.m_numberOfThreads) { }
 
 	//! Returns a new instance of the barycenter heuristic with the same option settings.
 	virtual LayerByLayerSweep *clone() const override
@@ -68,8 +68,19 @@ public:
 	//! Does some clean-up after calls.
 	virtual void cleanup () override { m_weight.init(); }
 
+	//! Returns the number of threads sorting a level (0 = all available).
+	unsigned int numberOfThreads() const { return m_numberOfThreads; }
+
+	//! Sets the number of threads sorting a level (0 = all available).
+	/**
+	 * The weights of the nodes are computed and sorted in parallel; the
+	 * resulting order does not depend on the number of threads.
+	 */
+	void numberOfThreads(unsigned int n) { m_numberOfThreads = n; }
+
 private:
 	NodeArray<double> m_weight; //!< The  barycenter weight of the nodes.
+	unsigned int m_numberOfThreads; //!< The number of threads sorting a level.
 };
 
 
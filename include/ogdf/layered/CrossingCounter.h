@@ -0,0 +1,124 @@
+/** \file
+ * \brief Declaration of class CrossingCounter.
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.txt in the root directory of the OGDF installation for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ *
+ * \see  http://www.gnu.org/copyleft/gpl.html
+ ***************************************************************/
+
+#pragma once
+
+#include <ogdf/layered/CrossingMinInterfaces.h>
+#include <vector>
+
+namespace ogdf {
+
+//! Maintains the number of crossings between the levels of a hierarchy.
+/**
+ * The counter takes a snapshot of the levels and the edges between them in
+ * flat arrays, so counting needs no virtual calls and no allocations. The
+ * crossings are stored per pair of consecutive levels; after a heuristic
+ * permuted some levels, update() recounts only the pairs next to a changed level.
+ *
+ * The counter can also serve as the model of a heuristic itself: swapDelta()
+ * and moveDelta() return the change of crossings caused by swapping or moving
+ * nodes of a level, swap() and move() apply it to the counter (but not to the
+ * levels). The edges must not change while the counter is used.
+ *
+ * \see HierarchyLevelsBase::calculateCrossings()
+ */
+class OGDF_EXPORT CrossingCounter
+{
+public:
+	//! Creates a counter for the current order of \a levels.
+	explicit CrossingCounter(const HierarchyLevelsBase &levels);
+
+	//! Returns the number of levels.
+	int numberOfLevels() const { return (int)m_levelStart.size() - 1; }
+
+	//! Returns the number of nodes on level \a i.
+	int levelSize(int i) const { return m_levelStart[i+1] - m_levelStart[i]; }
+
+	//! Returns the total number of crossings.
+	int totalCrossings() const { return m_total; }
+
+	//! Returns the number of crossings between level \a i and \a i+1.
+	int crossings(int i) const { return m_crossings[i]; }
+
+	//! Takes over the order of the nodes in \a levels and returns the total number of crossings.
+	int update(const HierarchyLevelsBase &levels);
+
+	//! Returns the change of crossings if the nodes at positions \a p and \a p+1 on level \a i are swapped.
+	int swapDelta(int i, int p) const;
+
+	//! Swaps the nodes at positions \a p and \a p+1 on level \a i.
+	void swap(int i, int p);
+
+	//! Returns the change of crossings if the node at position \a from on level \a i is moved to position \a to.
+	/**
+	 * The nodes in between are shifted by one position.
+	 */
+	int moveDelta(int i, int from, int to) const;
+
+	//! Moves the node at position \a from on level \a i to position \a to.
+	void move(int i, int from, int to);
+
+	//! Returns the change of crossings if two neighbouring nodes change places.
+	/**
+	 * \a left and \a right are the sorted positions of the neighbours of the left
+	 * and the right node on the same adjacent level; this takes O(\a nLeft + \a nRight) time.
+	 */
+	static int swapDifference(const int *left, int nLeft, const int *right, int nRight);
+
+private:
+	std::vector<int> m_levelStart; //!< The first node of every level, followed by the number of nodes.
+	std::vector<int> m_order;      //!< The nodes of every level in their current order.
+	std::vector<int> m_pos;        //!< The position of every node on its level.
+	std::vector<int> m_id;         //!< The number of the node with every index (-1 if none).
+
+	std::vector<int> m_upperStart; //!< The first upper neighbour of every node.
+	std::vector<int> m_upper;      //!< The upper neighbours of all nodes.
+	std::vector<int> m_lowerStart; //!< The first lower neighbour of every node.
+	std::vector<int> m_lower;      //!< The lower neighbours of all nodes.
+
+	std::vector<int> m_crossings;  //!< The crossings between every level and the next one.
+	int m_total;                   //!< The total number of crossings.
+
+	std::vector<int> m_tree;       //!< Binary indexed tree used for counting.
+	mutable std::vector<int> m_sortedV, m_sortedW; //!< Buffers of neighbour positions for delta queries.
+
+	//! Counts the crossings between level \a i and \a i+1 from scratch.
+	int count(int i);
+
+	//! Returns the change of crossings above and below if node \a v and its right neighbour \a w are swapped.
+	void swapDeltas(int v, int w, int &upperDelta, int &lowerDelta) const;
+
+	//! Stores the sorted positions of the neighbours \a adj[\a start[v]], ..., \a adj[\a start[v+1]-1] in \a sorted.
+	void sortedPositions(const std::vector<int> &start, const std::vector<int> &adj, int v, std::vector<int> &sorted) const;
+};
+
+} // end namespace ogdf
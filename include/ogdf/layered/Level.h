@@ -107,11 +107,19 @@ public:
 	//! Exchanges nodes at position \a i and \a j.
 	void swap(int i, int j);
 
-	//! Sorts the nodes according to \a weight using quicksort.
-	void sort(NodeArray<double> &weight);
+	//! Sorts the nodes according to \a weight using a stable sort.
+	/**
+	 * If \a numThreads is not 1, the sort runs on \a numThreads threads
+	 * (0 = all available); the result is the same for any number of threads.
+	 */
+	void sort(NodeArray<double> &weight, unsigned int numThreads = 1);
 
 	//! Sorts the nodes according to \a weight using bucket sort.
-	void sort(NodeArray<int> &weight, int minBucket, int maxBucket);
+	/**
+	 * If \a numThreads is not 1, a parallel stable sort on \a numThreads threads
+	 * (0 = all available) is used instead, yielding the same order.
+	 */
+	void sort(NodeArray<int> &weight, int minBucket, int maxBucket, unsigned int numThreads = 1);
 
 	//! Sorts the nodes according to \a weight (without special placement for "isolated" nodes).
 	void sortByWeightOnly(NodeArray<double> &weight);
@@ -48,15 +48,15 @@ class OGDF_EXPORT MedianHeuristic : public LayerByLayerSweep
 {
 public:
 	//! Creates a new instance of the median heuristic.
-	MedianHeuristic() { }
+	MedianHeuristic() : m_numberOfThreads(1) { }
 
 	//! Creates a new instance of the median heuristic.
-	MedianHeuristic(const MedianHeuristic &crossMin) { }
+	MedianHeuristic(const MedianHeuristic &crossMin) : m_numberOfThreads(crossMin.m_numberOfThreads) { }
 
 	//! Returns a new instance of the median heuristic with the same option settings.
 	virtual LayerByLayerSweep *clone() const override
 	{
-		return new MedianHeuristic;
+		return new MedianHeuristic(*this);
 	}
 
 	//! Initializes crossing minimization for hierarchy \a H.
@@ -68,8 +68,19 @@ public:
 	//! Does some clean-up after calls.
 	virtual void cleanup () override { m_weight.init(); }
 
+	//! Returns the number of threads sorting a level (0 = all available).
+	unsigned int numberOfThreads() const { return m_numberOfThreads; }
+
+	//! Sets the number of threads sorting a level (0 = all available).
+	/**
+	 * The weights of the nodes are computed and sorted in parallel; the
+	 * resulting order does not depend on the number of threads.
+	 */
+	void numberOfThreads(unsigned int n) { m_numberOfThreads = n; }
+
 private:
 	NodeArray<int> m_weight; //!< The median weight of a node.
+	unsigned int m_numberOfThreads; //!< The number of threads sorting a level.
 };
 
 
@@ -35,7 +35,7 @@
 #pragma once
 
 #include <ogdf/module/LayerByLayerSweep.h>
-#include <ogdf/layered/CrossingsMatrix.h>
+#include <vector>
 
 
 namespace ogdf
@@ -44,6 +44,11 @@ namespace ogdf
 
 //! The sifting heuristic for 2-layer crossing minimization.
 /**
+ * Every node is moved through all positions of its level and put at the one with
+ * the fewest crossings. The change of crossings caused by swapping two neighbouring
+ * nodes is computed from the sorted positions of their adjacent nodes in
+ * O(deg), so no crossing matrix of quadratic size in the level width is needed.
+ *
  * @ingroup gd-layered-crossmin
  */
 class OGDF_EXPORT SiftingHeuristic : public LayerByLayerSweep
@@ -55,8 +60,6 @@ public:
 	//! Creates a new instance of the sifting heuristic with the same option settings as \a crossMin.
 	SiftingHeuristic(const SiftingHeuristic &crossMin);
 
-	~SiftingHeuristic();
-
 	//! Returns a new instance of the sifting heuristic with the same option settings.
 	virtual LayerByLayerSweep *clone() const override
 	{
@@ -67,7 +70,7 @@ public:
 	enum Strategy { left_to_right, desc_degree, random };
 
 	//! Initializes crossing minimization for hierarchy \a H.
-	virtual void init (const HierarchyLevels &levels) override;
+	virtual void init (const HierarchyLevels &levels) override { }
 
 	//! Calls the sifting heuristic for level \a L.
 	virtual void call (Level &L) override;
@@ -90,8 +93,13 @@ public:
 	}
 
 private:
-	CrossingsMatrix *m_crossingMatrix;
 	Strategy m_strategy;
+
+	std::vector<int> m_adjStart; //!< The first adjacent position of every node (by its position before sifting).
+	std::vector<int> m_adjPos;   //!< The sorted positions of the adjacent nodes of all nodes.
+
+	//! Returns the change of crossings if the nodes with indices \a u and \a v (left of \a v) change places.
+	int swapDelta(int u, int v) const;
 };
 
 
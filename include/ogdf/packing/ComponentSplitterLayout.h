@@ -40,6 +40,7 @@
 #include <ogdf/module/LayoutModule.h>
 #include <ogdf/basic/geometry.h>
 #include <ogdf/basic/GraphAttributes.h>
+#include <functional>
 #include <vector>
 
 
@@ -54,6 +55,12 @@ private:
 	double m_targetRatio;
 	int m_border;
 
+	std::function<LayoutModule*()> m_layoutFactory;	//!< Creates the layout modules of parallel runs.
+	unsigned int m_numberOfThreads;	//!< The maximal number of threads laying out components (0 = all).
+
+	//! Lays out the components in \a nodesInCC concurrently, largest component first.
+	void layoutComponentsInParallel(GraphAttributes &GA, const Array<List<node> > &nodesInCC);
+
 	//! Combines drawings of connected components to
 	//! a single drawing by rotating components and packing
 	//! the result (optimizes area of axis-parallel rectangle).
@@ -64,10 +71,35 @@ public:
 
 	void call(GraphAttributes &GA);
 
+	//! Sets the layout module called for one component after the other.
 	void setLayoutModule(LayoutModule *layout) {
 		m_secondaryLayout.set(layout);
 	}
 
+	//! Sets a function creating layout modules, which enables the parallel layout of the components.
+	/**
+	 * Layout modules are in general not thread-safe, so every thread laying out
+	 * components calls a module of its own created by \a factory. The modules
+	 * are deleted when the call finishes. If \a factory is set and
+	 * numberOfThreads() is not 1, the components are laid out concurrently by
+	 * the threads of the global TaskScheduler, largest component first, and the
+	 * module set by setLayoutModule() is not used.
+	 *
+	 * The drawing does not depend on the number of threads as long as the
+	 * layouts of the components do not depend on the order in which they are
+	 * computed (e.g., by drawing from ogdf::randomNumber()).
+	 * Pass an empty function to switch back to sequential layout.
+	 */
+	void setLayoutModuleFactory(std::function<LayoutModule*()> factory) {
+		m_layoutFactory = factory;
+	}
+
+	//! Returns the maximal number of threads laying out components (0 = all threads of the global TaskScheduler).
+	unsigned int numberOfThreads() const { return m_numberOfThreads; }
+
+	//! Sets the maximal number of threads laying out components (0 = all threads of the global TaskScheduler).
+	void setNumberOfThreads(unsigned int n) { m_numberOfThreads = n; }
+
 	void setPacker(CCLayoutPackModule *packer) {
 		m_packer.set(packer);
 	}
@@ -530,21 +530,11 @@ public:
 	//@{
 
 
-	//! Gives access to the node array of the widths of original nodes.
-	const NodeArray<double> &widthOrig() const {
-		return m_pGraphAttributes->width();
-	}
-
 	//! Returns the width of original node \a v.
 	double widthOrig(node v) const {
 		return m_pGraphAttributes->width(v);
 	}
 
-	//! Gives access to the node array of the heights of original nodes.
-	const NodeArray<double> &heightOrig() const {
-		return m_pGraphAttributes->height();
-	}
-
 	//! Returns the height of original node \a v.
 	double heightOrig(node v) const {
 		return m_pGraphAttributes->height(v);
@@ -205,8 +205,8 @@ public:
 		//when we always insert this node here, we can remove the associationclass
 		//class and information later on
 		node v = m_pG->newNode();
-		m_height[v] = ac->m_height;
-		m_width[v]  = ac->m_width;
+		m_geometry[v].m_height = ac->m_height;
+		m_geometry[v].m_width  = ac->m_width;
 		m_associationClassModel[ac->m_edge] = v;
 		ac->m_node = v;
 		//guarantee correct angle at edge to edge connection
@@ -233,8 +233,8 @@ public:
 	{
 		node dummy = m_pG->split(ac->m_edge)->source();
 
-		m_height[dummy] = 1; //just a dummy size
-		m_width[dummy]  = 1;
+		m_geometry[dummy].m_height = 1; //just a dummy size
+		m_geometry[dummy].m_width  = 1;
 		OGDF_ASSERT(ac->m_node)
 		m_pG->newEdge(ac->m_node, dummy);
 
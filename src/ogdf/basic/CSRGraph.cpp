@@ -0,0 +1,105 @@
+/** \file
+ * \brief Implementation of class CSRGraph.
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.txt in the root directory of the OGDF installation for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ *
+ * \see  http://www.gnu.org/copyleft/gpl.html
+ ***************************************************************/
+
+
+#include <ogdf/basic/CSRGraph.h>
+
+
+namespace ogdf {
+
+void CSRGraph::init(const Graph &G)
+{
+	m_pGraph = &G;
+	m_numNodes = G.numberOfNodes();
+	m_numEdges = G.numberOfEdges();
+
+	m_node.init(m_numNodes);
+	m_edge.init(m_numEdges);
+	m_nodeId.init(0, G.maxNodeIndex(), -1);
+	m_edgeId.init(0, G.maxEdgeIndex(), -1);
+
+	int i = 0;
+	for(node v : G.nodes) {
+		m_node[i] = v;
+		m_nodeId[v->index()] = i++;
+	}
+
+	m_source.init(m_numEdges);
+	m_target.init(m_numEdges);
+
+	int e = 0;
+	for(edge eG : G.edges) {
+		m_edge[e] = eG;
+		m_edgeId[eG->index()] = e;
+		m_source[e] = m_nodeId[eG->source()->index()];
+		m_target[e] = m_nodeId[eG->target()->index()];
+		++e;
+	}
+
+	m_adjStart.init(m_numNodes+1);
+	m_adjNode .init(2*m_numEdges);
+	m_adjEdge .init(2*m_numEdges);
+	m_outStart.init(m_numNodes+1);
+	m_outNode .init(m_numEdges);
+	m_outEdge .init(m_numEdges);
+
+	int a = 0, o = 0;
+	for(i = 0; i < m_numNodes; ++i) {
+		node v = m_node[i];
+		m_adjStart[i] = a;
+		m_outStart[i] = o;
+
+		for(adjEntry adj : v->adjEntries) {
+			edge eG = adj->theEdge();
+			int eId = m_edgeId[eG->index()];
+			int w = m_nodeId[adj->twinNode()->index()];
+
+			m_adjNode[a] = w;
+			m_adjEdge[a] = eId;
+			++a;
+
+			// a self-loop occurs twice in the adjacency list but is only outgoing once
+			if(adj == eG->adjSource()) {
+				m_outNode[o] = m_target[eId];
+				m_outEdge[o] = eId;
+				++o;
+			}
+		}
+	}
+	m_adjStart[m_numNodes] = a;
+	m_outStart[m_numNodes] = o;
+
+	OGDF_ASSERT(a == 2*m_numEdges);
+	OGDF_ASSERT(o == m_numEdges);
+}
+
+} // end namespace ogdf
@@ -39,6 +39,13 @@
 #include <ogdf/basic/GraphObserver.h>
 #include <ogdf/basic/Stack.h>
 
+#ifndef OGDF_MEMORY_POOL_NTS
+#include <atomic>
+#ifdef OGDF_NO_COMPILER_TLS
+#include <thread>
+#endif
+#endif
+
 using std::mutex;
 
 #ifndef OGDF_MEMORY_POOL_NTS
@@ -52,6 +59,23 @@ using std::lock_guard;
 
 namespace ogdf {
 
+int internal::registryShard()
+{
+#if defined(OGDF_MEMORY_POOL_NTS)
+	return 0;
+#elif defined(OGDF_NO_COMPILER_TLS)
+	return int(std::hash<std::thread::id>()(std::this_thread::get_id()) & 0x7fffffff);
+#else
+	static std::atomic<int> s_nextShard(0);
+	static OGDF_DECL_THREAD int s_shard = -1;
+
+	if (s_shard < 0)
+		s_shard = s_nextShard++ & 0x7fffffff;
+	return s_shard;
+#endif
+}
+
+
 Graph::Graph()
 {
 	m_nodeIdCount = m_edgeIdCount = 0;
@@ -613,6 +637,61 @@ edge Graph::newEdge(node v, node w)
 }
 
 
+void Graph::reserveNodes(int n)
+{
+	OGDF_ASSERT(n >= 0);
+
+	int maxId = m_nodeIdCount + n - 1;
+	if (maxId >= m_nodeArrayTableSize) {
+		m_nodeArrayTableSize = nextPower2(m_nodeArrayTableSize, maxId);
+		for(NodeArrayBase *nab : m_regNodeArrays)
+			nab->enlargeTable(m_nodeArrayTableSize);
+	}
+
+	if (OGDF_ALLOCATOR::checkSize(sizeof(NodeElement)))
+		OGDF_ALLOCATOR::reserve(sizeof(NodeElement), n);
+}
+
+
+void Graph::reserveEdges(int m)
+{
+	OGDF_ASSERT(m >= 0);
+
+	int maxId = m_edgeIdCount + m - 1;
+	if (maxId >= m_edgeArrayTableSize) {
+		m_edgeArrayTableSize = nextPower2(m_edgeArrayTableSize, maxId);
+
+		for(EdgeArrayBase *eab : m_regEdgeArrays)
+			eab->enlargeTable(m_edgeArrayTableSize);
+
+		for(AdjEntryArrayBase *aab : m_regAdjArrays)
+			aab->enlargeTable(m_edgeArrayTableSize << 1);
+	}
+
+	if (OGDF_ALLOCATOR::checkSize(sizeof(EdgeElement)))
+		OGDF_ALLOCATOR::reserve(sizeof(EdgeElement), m);
+	if (OGDF_ALLOCATOR::checkSize(sizeof(AdjElement)))
+		OGDF_ALLOCATOR::reserve(sizeof(AdjElement), 2*m);
+}
+
+
+void Graph::buildFromEdgeList(int n, const Array<std::pair<int,int>> &edgeList, Array<node> &newNodes)
+{
+	reserveNodes(n);
+	reserveEdges(edgeList.size());
+
+	newNodes.init(n);
+	for(int i = 0; i < n; ++i)
+		newNodes[i] = newNode();
+
+	for(const std::pair<int,int> &p : edgeList) {
+		OGDF_ASSERT(0 <= p.first && p.first < n);
+		OGDF_ASSERT(0 <= p.second && p.second < n);
+		newEdge(newNodes[p.first], newNodes[p.second]);
+	}
+}
+
+
 edge Graph::newEdge(adjEntry adjStart, adjEntry adjEnd, Direction dir)
 {
 	OGDF_ASSERT(adjStart != nullptr);
@@ -1048,33 +1127,24 @@ int Graph::genus() const
 }
 
 
-ListIterator<NodeArrayBase*> Graph::registerArray(
+Graph::NodeArrayHandle Graph::registerArray(
 	NodeArrayBase *pNodeArray) const
 {
-#ifndef OGDF_MEMORY_POOL_NTS
-	lock_guard<mutex> guard(m_mutexRegArrays);
-#endif
-	return m_regNodeArrays.pushBack(pNodeArray);
+	return m_regNodeArrays.add(pNodeArray);
 }
 
 
-ListIterator<EdgeArrayBase*> Graph::registerArray(
+Graph::EdgeArrayHandle Graph::registerArray(
 	EdgeArrayBase *pEdgeArray) const
 {
-#ifndef OGDF_MEMORY_POOL_NTS
-	lock_guard<mutex> guard(m_mutexRegArrays);
-#endif
-	return m_regEdgeArrays.pushBack(pEdgeArray);
+	return m_regEdgeArrays.add(pEdgeArray);
 }
 
 
-ListIterator<AdjEntryArrayBase*> Graph::registerArray(
+Graph::AdjEntryArrayHandle Graph::registerArray(
 	AdjEntryArrayBase *pAdjArray) const
 {
-#ifndef OGDF_MEMORY_POOL_NTS
-	lock_guard<mutex> guard(m_mutexRegArrays);
-#endif
-	return m_regAdjArrays.pushBack(pAdjArray);
+	return m_regAdjArrays.add(pAdjArray);
 }
 
 ListIterator<GraphObserver*> Graph::registerStructure(
@@ -1087,30 +1157,21 @@ ListIterator<GraphObserver*> Graph::registerStructure(
 }
 
 
-void Graph::unregisterArray(ListIterator<NodeArrayBase*> it) const
+void Graph::unregisterArray(const NodeArrayHandle &h) const
 {
-#ifndef OGDF_MEMORY_POOL_NTS
-	lock_guard<mutex> guard(m_mutexRegArrays);
-#endif
-	m_regNodeArrays.del(it);
+	m_regNodeArrays.remove(h);
 }
 
 
-void Graph::unregisterArray(ListIterator<EdgeArrayBase*> it) const
+void Graph::unregisterArray(const EdgeArrayHandle &h) const
 {
-#ifndef OGDF_MEMORY_POOL_NTS
-	lock_guard<mutex> guard(m_mutexRegArrays);
-#endif
-	m_regEdgeArrays.del(it);
+	m_regEdgeArrays.remove(h);
 }
 
 
-void Graph::unregisterArray(ListIterator<AdjEntryArrayBase*> it) const
+void Graph::unregisterArray(const AdjEntryArrayHandle &h) const
 {
-#ifndef OGDF_MEMORY_POOL_NTS
-	lock_guard<mutex> guard(m_mutexRegArrays);
-#endif
-	m_regAdjArrays.del(it);
+	m_regAdjArrays.remove(h);
 }
 
 void Graph::unregisterStructure(ListIterator<GraphObserver*> it) const
@@ -1122,28 +1183,19 @@ void Graph::unregisterStructure(ListIterator<GraphObserver*> it) const
 }
 
 
-void Graph::moveRegisterArray(ListIterator<NodeArrayBase*> it, NodeArrayBase *pNodeArray) const
+void Graph::moveRegisterArray(const NodeArrayHandle &h, NodeArrayBase *pNodeArray) const
 {
-#ifndef OGDF_MEMORY_POOL_NTS
-	lock_guard<mutex> guard(m_mutexRegArrays);
-#endif
-	*it = pNodeArray;
+	m_regNodeArrays.move(h, pNodeArray);
 }
 
-void Graph::moveRegisterArray(ListIterator<EdgeArrayBase*> it, EdgeArrayBase *pEdgeArray) const
+void Graph::moveRegisterArray(const EdgeArrayHandle &h, EdgeArrayBase *pEdgeArray) const
 {
-#ifndef OGDF_MEMORY_POOL_NTS
-	lock_guard<mutex> guard(m_mutexRegArrays);
-#endif
-	*it = pEdgeArray;
+	m_regEdgeArrays.move(h, pEdgeArray);
 }
 
-void Graph::moveRegisterArray(ListIterator<AdjEntryArrayBase*> it, AdjEntryArrayBase *pAdjArray) const
+void Graph::moveRegisterArray(const AdjEntryArrayHandle &h, AdjEntryArrayBase *pAdjArray) const
 {
-#ifndef OGDF_MEMORY_POOL_NTS
-	lock_guard<mutex> guard(m_mutexRegArrays);
-#endif
-	*it = pAdjArray;
+	m_regAdjArrays.move(h, pAdjArray);
 }
 
 
@@ -47,6 +47,9 @@ namespace ogdf {
 // graph topology + graphical attributes
 //---------------------------------------------------------
 
+const string GraphAttributes::s_emptyString;
+const DPolyline GraphAttributes::s_emptyPolyline;
+
 GraphAttributes::GraphAttributes() : m_pGraph(nullptr), m_directed(true), m_attributes(0) { }
 
 
@@ -69,10 +72,8 @@ void GraphAttributes::initAttributes(long attr)
 	OGDF_ASSERT(!(m_attributes & nodeLabelPosition) || (m_attributes & nodeLabel));
 
 	if (attr & nodeGraphics) {
-		m_x        .init( *m_pGraph, 0.0 );
-		m_y        .init( *m_pGraph, 0.0 );
-		m_width    .init( *m_pGraph, LayoutStandards::defaultNodeWidth () );
-		m_height   .init( *m_pGraph, LayoutStandards::defaultNodeHeight() );
+		m_geometry .init( *m_pGraph, NodeGeometry(0.0, 0.0,
+			LayoutStandards::defaultNodeWidth(), LayoutStandards::defaultNodeHeight()) );
 		m_nodeShape.init( *m_pGraph, LayoutStandards::defaultNodeShape () );
 	}
 	if (attr & threeD) {
@@ -82,14 +83,18 @@ void GraphAttributes::initAttributes(long attr)
 		}
 	}
 	if (attr & nodeStyle) {
-		m_nodeStroke.init( *m_pGraph, LayoutStandards::defaultNodeStroke() );
-		m_nodeFill  .init( *m_pGraph, LayoutStandards::defaultNodeFill  () );
+		// strokes and fills are allocated on first write access
+		m_nodeStroke.init();
+		m_nodeFill  .init();
+		m_nodeStrokeDefault = LayoutStandards::defaultNodeStroke();
+		m_nodeFillDefault   = LayoutStandards::defaultNodeFill();
 	}
 	if (attr & edgeGraphics) {
-		m_bends.init( *m_pGraph, DPolyline() );
+		m_bends.init();
 	}
 	if (attr & edgeStyle) {
-		m_edgeStroke.init( *m_pGraph, LayoutStandards::defaultEdgeStroke() );
+		m_edgeStroke.init();
+		m_edgeStrokeDefault = LayoutStandards::defaultEdgeStroke();
 	}
 	if (attr & nodeWeight) {
 		m_nodeIntWeight.init( *m_pGraph, 0 );
@@ -101,7 +106,7 @@ void GraphAttributes::initAttributes(long attr)
 		m_doubleWeight.init( *m_pGraph, 1.0 );
 	}
 	if (attr & nodeLabel) {
-		m_nodeLabel.init(*m_pGraph);
+		m_nodeLabel.init();
 	}
 	if (attr & nodeLabelPosition) {
 		m_nodeLabelPosX.init(*m_pGraph, 0.0);
@@ -111,7 +116,7 @@ void GraphAttributes::initAttributes(long attr)
 		}
 	}
 	if (attr & edgeLabel) {
-		m_edgeLabel.init(*m_pGraph);
+		m_edgeLabel.init();
 	}
 	if (attr & edgeType) {
 		m_eType.init( *m_pGraph, Graph::association ); //should be Graph::standard and explicitly set
@@ -126,7 +131,7 @@ void GraphAttributes::initAttributes(long attr)
 		m_edgeArrow.init( *m_pGraph, LayoutStandards::defaultEdgeArrow() );
 	}
 	if (attr & nodeTemplate) {
-		m_nodeTemplate.init(*m_pGraph);
+		m_nodeTemplate.init();
 	}
 	if (attr & edgeSubGraphs) {
 		m_subGraph.init( *m_pGraph, 0 );
@@ -139,10 +144,7 @@ void GraphAttributes::destroyAttributes(long attr)
 	m_attributes &= ~attr;
 
 	if (attr & nodeGraphics) {
-		m_x     .init();
-		m_y     .init();
-		m_width .init();
-		m_height.init();
+		m_geometry .init();
 		m_nodeShape.init();
 		if (attr & nodeStyle) {
 			m_nodeStroke.init();
@@ -205,19 +207,22 @@ void GraphAttributes::init(const Graph &G, long initAttr)
 void GraphAttributes::setAllWidth(double w)
 {
 	for(node v : m_pGraph->nodes)
-		m_width[v] = w;
+		m_geometry[v].m_width = w;
 }
 
 
 void GraphAttributes::setAllHeight(double h)
 {
 	for (node v : m_pGraph->nodes)
-		m_height[v] = h;
+		m_geometry[v].m_height = h;
 }
 
 
 void GraphAttributes::clearAllBends()
 {
+	if (m_bends.graphOf() == nullptr)
+		return;
+
 	for(edge e : m_pGraph->edges)
 		m_bends[e].clear();
 }
@@ -383,6 +388,9 @@ int GraphAttributes::hierarchyList(List<List<edge>* > &list) const
 
 void GraphAttributes::removeUnnecessaryBendsHV()
 {
+	if (m_bends.graphOf() == nullptr)
+		return;
+
 	for(edge e: m_pGraph->edges)
 	{
 		DPolyline &dpl = m_bends[e];
@@ -495,20 +503,20 @@ void GraphAttributes::scale(double sx, double sy, bool scaleNodes)
 {
 	if (m_attributes & nodeGraphics) {
 		for (node v : m_pGraph->nodes) {
-			m_x[v] *= sx;
-			m_y[v] *= sy;
+			m_geometry[v].m_x *= sx;
+			m_geometry[v].m_y *= sy;
 		}
 
 		if (scaleNodes) {
 			double asx = fabs(sx), asy = fabs(sy);
 			for (node v : m_pGraph->nodes) {
-				m_width [v] *= asx;
-				m_height[v] *= asy;
+				m_geometry[v].m_width *= asx;
+				m_geometry[v].m_height *= asy;
 			}
 		}
 	}
 
-	if (m_attributes & edgeGraphics) {
+	if (m_bends.graphOf() != nullptr) {
 		for (edge e : m_pGraph->edges) {
 			for (DPoint &p : m_bends[e]) {
 				p.m_x *= sx;
@@ -523,12 +531,12 @@ void GraphAttributes::translate(double dx, double dy)
 {
 	if (m_attributes & nodeGraphics) {
 		for (node v : m_pGraph->nodes) {
-			m_x[v] += dx;
-			m_y[v] += dy;
+			m_geometry[v].m_x += dx;
+			m_geometry[v].m_y += dy;
 		}
 	}
 
-	if (m_attributes & edgeGraphics) {
+	if (m_bends.graphOf() != nullptr) {
 		for (edge e : m_pGraph->edges) {
 			for (DPoint &p : m_bends[e]) {
 				p.m_x += dx;
@@ -562,10 +570,10 @@ void GraphAttributes::flipVertical(const DRect &box)
 	double dy = box.p1().m_y + box.p2().m_y;
 
 	for (node v : m_pGraph->nodes) {
-		m_y[v] = dy - m_y[v];
+		m_geometry[v].m_y = dy - m_geometry[v].m_y;
 	}
 
-	if (m_attributes & edgeGraphics) {
+	if (m_bends.graphOf() != nullptr) {
 		for (edge e : m_pGraph->edges) {
 			for (DPoint &p : m_bends[e]) {
 				p.m_y = dy - p.m_y;
@@ -583,10 +591,10 @@ void GraphAttributes::flipHorizontal(const DRect &box)
 	double dx = box.p1().m_x + box.p2().m_x;
 
 	for (node v : m_pGraph->nodes) {
-		m_x[v] = dx - m_x[v];
+		m_geometry[v].m_x = dx - m_geometry[v].m_x;
 	}
 
-	if (m_attributes & edgeGraphics) {
+	if (m_bends.graphOf() != nullptr) {
 		for (edge e : m_pGraph->edges) {
 			for (DPoint &p : m_bends[e]) {
 				p.m_x = dx - p.m_x;
@@ -600,20 +608,20 @@ void GraphAttributes::scaleAndTranslate(double sx, double sy, double dx, double
 {
 	if (m_attributes & nodeGraphics) {
 		for (node v : m_pGraph->nodes) {
-			m_x[v] = m_x[v] * sx + dx;
-			m_y[v] = m_y[v] * sy + dy;
+			m_geometry[v].m_x = m_geometry[v].m_x * sx + dx;
+			m_geometry[v].m_y = m_geometry[v].m_y * sy + dy;
 		}
 
 		if (scaleNodes) {
 			for (node v : m_pGraph->nodes) {
 				double asx = fabs(sx), asy = fabs(sy);
-				m_width[v]  *= asx;
-				m_height[v] *= asy;
+				m_geometry[v].m_width  *= asx;
+				m_geometry[v].m_height *= asy;
 			}
 		}
 	}
 
-	if (m_attributes & edgeGraphics) {
+	if (m_bends.graphOf() != nullptr) {
 		for (edge e : m_pGraph->edges) {
 			for (DPoint &p : m_bends[e]) {
 				p.m_x = p.m_x * sx + dx;
@@ -628,15 +636,16 @@ void GraphAttributes::rotateRight90()
 {
 	if (m_attributes & nodeGraphics) {
 		for (node v : m_pGraph->nodes) {
-			double x = m_x[v], y = m_y[v];
-			m_x[v] = -y;
-			m_y[v] = x;
+			NodeGeometry &g = m_geometry[v];
+			double x = g.m_x, y = g.m_y;
+			g.m_x = -y;
+			g.m_y = x;
 
-			swap(m_width[v], m_height[v]);
+			swap(g.m_width, g.m_height);
 		}
 	}
 
-	if (m_attributes & edgeGraphics) {
+	if (m_bends.graphOf() != nullptr) {
 		for (edge e : m_pGraph->edges) {
 			for (DPoint &p : m_bends[e]) {
 				double x = p.m_x, y = p.m_y;
@@ -652,15 +661,16 @@ void GraphAttributes::rotateLeft90()
 {
 	if (m_attributes & nodeGraphics) {
 		for (node v : m_pGraph->nodes) {
-			double x = m_x[v], y = m_y[v];
-			m_x[v] = y;
-			m_y[v] = -x;
+			NodeGeometry &g = m_geometry[v];
+			double x = g.m_x, y = g.m_y;
+			g.m_x = y;
+			g.m_y = -x;
 
-			swap(m_width[v], m_height[v]);
+			swap(g.m_width, g.m_height);
 		}
 	}
 
-	if (m_attributes & edgeGraphics) {
+	if (m_bends.graphOf() != nullptr) {
 		for (edge e : m_pGraph->edges) {
 			for (DPoint &p : m_bends[e]) {
 				double x = p.m_x, y = p.m_y;
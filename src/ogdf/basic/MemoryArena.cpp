@@ -0,0 +1,141 @@
+/** \file
+ * \brief Implementation of MemoryArena and ArenaScope
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.txt in the root directory of the OGDF installation for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ *
+ * \see  http://www.gnu.org/copyleft/gpl.html
+ ***************************************************************/
+
+
+#include <ogdf/basic/MemoryArena.h>
+#include <ogdf/basic/exceptions.h>
+#include <cstring>
+
+
+namespace ogdf {
+
+std::atomic<int> MemoryArena::s_numScopes(0);
+std::atomic<bool> ArenaScope::s_enabled(true);
+
+static OGDF_DECL_THREAD MemoryArena *s_installed = nullptr;
+
+
+MemoryArena *MemoryArena::installed()
+{
+	return s_installed;
+}
+
+
+MemoryArena *MemoryArena::exchangeCurrent(MemoryArena *arena)
+{
+	MemoryArena *previous = s_installed;
+	s_installed = arena;
+	return previous;
+}
+
+
+char *MemoryArena::allocateChunk(size_t nBytes, size_t alignment)
+{
+	// huge requests get a chunk of their own
+	size_t size = max(m_nextChunkSize, sizeof(Chunk) + nBytes + alignment);
+	if (m_nextChunkSize < eMaxChunkSize)
+		m_nextChunkSize *= 2;
+
+	Chunk *chunk = static_cast<Chunk*>(malloc(size));
+	if (chunk == nullptr) OGDF_THROW(InsufficientMemoryException);
+
+	chunk->m_next = m_chunks;
+	chunk->m_size = size;
+	m_chunks = chunk;
+
+	m_end = reinterpret_cast<char*>(chunk) + size;
+	return align(reinterpret_cast<char*>(chunk + 1), alignment);
+}
+
+
+void *MemoryArena::reallocate(void *p, size_t oldBytes, size_t newBytes, size_t alignment)
+{
+	if (p == nullptr)
+		return allocate(newBytes, alignment);
+
+	// grow or shrink the most recent allocation in place
+	if (p == m_last && static_cast<char*>(p) + newBytes <= m_end) {
+		m_ptr = m_last + newBytes;
+		if (newBytes > oldBytes)
+			m_bytesAllocated += newBytes - oldBytes;
+		return p;
+	}
+
+	void *q = allocate(newBytes, alignment);
+	memcpy(q, p, min(oldBytes, newBytes));
+	return q;
+}
+
+
+void MemoryArena::release()
+{
+	while (m_chunks != nullptr) {
+		Chunk *next = m_chunks->m_next;
+		free(m_chunks);
+		m_chunks = next;
+	}
+
+	m_ptr = m_end = m_last = nullptr;
+	m_nextChunkSize = eMinChunkSize;
+}
+
+
+size_t MemoryArena::memoryInChunks() const
+{
+	size_t bytes = 0;
+	for (const Chunk *chunk = m_chunks; chunk != nullptr; chunk = chunk->m_next)
+		bytes += chunk->m_size;
+	return bytes;
+}
+
+
+void ArenaScope::install()
+{
+	m_installed = enabled();
+	if (m_installed) {
+		++MemoryArena::s_numScopes;
+		m_previous = MemoryArena::exchangeCurrent(m_arena);
+	} else {
+		m_previous = nullptr;
+	}
+}
+
+
+ArenaScope::~ArenaScope()
+{
+	if (m_installed) {
+		MemoryArena::exchangeCurrent(m_previous);
+		--MemoryArena::s_numScopes;
+	}
+}
+
+}
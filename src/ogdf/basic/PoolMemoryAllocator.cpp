@@ -35,10 +35,38 @@
 
 
 #include <ogdf/basic/memory.h>
+#include <climits>
+#include <iomanip>
 
 
 namespace ogdf {
 
+namespace {
+
+#ifdef OGDF_MEMORY_POOL_NTS
+typedef size_t Counter;
+
+inline size_t loadCounter(const Counter &c) { return c; }
+inline void addToCounter(Counter &c, size_t n) { c += n; }
+
+#else
+typedef std::atomic<size_t> Counter;
+
+// Counters are only modified by their owning thread, hence no (expensive)
+// read-modify-write operation is needed; other threads only read them.
+inline size_t loadCounter(const Counter &c) {
+	return c.load(std::memory_order_relaxed);
+}
+
+inline void addToCounter(Counter &c, size_t n) {
+	c.store(c.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+}
+#endif
+
+enum { eUnregistered = 0, eRegistered, eRetired };
+
+}
+
 
 struct PoolMemoryAllocator::PoolElement
 {
@@ -52,17 +80,36 @@ struct PoolMemoryAllocator::BlockChain
 	BlockChain *m_next;
 };
 
+//! The cache of a thread (zero-initialized on creation).
+struct PoolMemoryAllocator::ThreadCache
+{
+	MemElemPtr m_free[eNumSizeClasses];   //!< The free lists of the thread.
+	int        m_count[eNumSizeClasses];  //!< The number of elements in each free list.
+	int        m_limit[eNumSizeClasses];  //!< The maximal number of elements kept in each free list.
+	Counter    m_allocs[eNumSizeClasses];   //!< The number of allocations of the thread.
+	Counter    m_deallocs[eNumSizeClasses]; //!< The number of deallocations of the thread.
+
+	ThreadCache *m_prev; //!< The predecessor in the list of registered caches.
+	ThreadCache *m_next; //!< The successor in the list of registered caches.
+	int m_state;         //!< One of eUnregistered, eRegistered, eRetired.
+};
+
 
-PoolMemoryAllocator::PoolElement PoolMemoryAllocator::s_pool[eTableSize];
+PoolMemoryAllocator::PoolElement PoolMemoryAllocator::s_pool[eNumSizeClasses];
 PoolMemoryAllocator::BlockChainPtr PoolMemoryAllocator::s_blocks;
 
+PoolMemoryAllocator::ThreadCache *PoolMemoryAllocator::s_threads;
+size_t PoolMemoryAllocator::s_retiredAllocs[eNumSizeClasses];
+size_t PoolMemoryAllocator::s_retiredDeallocs[eNumSizeClasses];
+size_t PoolMemoryAllocator::s_peakBytesInUse[eNumSizeClasses];
+
 #ifdef OGDF_DEBUG
 size_t PoolMemoryAllocator::s_nettoAlloc;
 #endif
 
 
 #ifdef OGDF_MEMORY_POOL_NTS
-PoolMemoryAllocator::MemElemPtr PoolMemoryAllocator::s_tp[eTableSize];
+PoolMemoryAllocator::ThreadCache PoolMemoryAllocator::s_tc;
 
 #elif defined(OGDF_NO_COMPILER_TLS)
 std::mutex PoolMemoryAllocator::s_mutex;
@@ -71,7 +118,45 @@ pthread_key_t PoolMemoryAllocator::s_tpKey;
 #else
 
 std::mutex PoolMemoryAllocator::s_mutex;
-OGDF_DECL_THREAD PoolMemoryAllocator::MemElemPtr PoolMemoryAllocator::s_tp[eTableSize];
+OGDF_DECL_THREAD PoolMemoryAllocator::ThreadCache PoolMemoryAllocator::s_tc;
+
+//! Returns the cache of a thread to the global pool when the thread exits.
+struct PoolMemoryAllocator::ThreadGuard
+{
+	~ThreadGuard() {
+		retireThread(s_tc);
+	}
+};
+#endif
+
+
+inline PoolMemoryAllocator::ThreadCache &PoolMemoryAllocator::threadCache()
+{
+#if !defined(OGDF_MEMORY_POOL_NTS) && defined(OGDF_NO_COMPILER_TLS)
+	ThreadCache *tc = static_cast<ThreadCache*>(pthread_getspecific(s_tpKey));
+	return OGDF_LIKELY(tc != nullptr) ? *tc : *createThreadCache();
+#else
+	return s_tc;
+#endif
+}
+
+
+#if !defined(OGDF_MEMORY_POOL_NTS) && defined(OGDF_NO_COMPILER_TLS)
+PoolMemoryAllocator::ThreadCache *PoolMemoryAllocator::createThreadCache()
+{
+	ThreadCache *tc = static_cast<ThreadCache*>(calloc(1,sizeof(ThreadCache)));
+	if (OGDF_UNLIKELY(tc == nullptr)) OGDF_THROW(InsufficientMemoryException);
+	pthread_setspecific(s_tpKey,tc);
+	return tc;
+}
+
+
+void PoolMemoryAllocator::destroyThreadCache(void *p)
+{
+	ThreadCache *tc = static_cast<ThreadCache*>(p);
+	retireThread(*tc);
+	free(tc);
+}
 #endif
 
 
@@ -79,7 +164,7 @@ void PoolMemoryAllocator::init()
 {
 #ifndef OGDF_MEMORY_POOL_NTS
 #ifdef OGDF_NO_COMPILER_TLS
-	pthread_key_create(&s_tpKey,nullptr);
+	pthread_key_create(&s_tpKey,&destroyThreadCache);
 #endif
 #endif
 
@@ -87,10 +172,9 @@ void PoolMemoryAllocator::init()
 }
 
 
-void PoolMemoryAllocator::initThread() {
-#if !defined(OGDF_MEMORY_POOL_NTS) && defined(OGDF_NO_COMPILER_TLS)
-		pthread_setspecific(s_tpKey,calloc(eTableSize,sizeof(MemElemPtr)));
-#endif
+void PoolMemoryAllocator::initThread()
+{
+	registerThread(threadCache());
 }
 
 
@@ -121,123 +205,287 @@ void PoolMemoryAllocator::cleanup()
 
 
 void *PoolMemoryAllocator::allocate(size_t nBytes) {
-#if !defined(OGDF_MEMORY_POOL_NTS) && defined(OGDF_NO_COMPILER_TLS)
-	MemElemPtr &pFreeBytes = *((MemElemPtr*)pthread_getspecific(s_tpKey)+nBytes);
-#else
-	MemElemPtr &pFreeBytes = s_tp[nBytes];
-#endif
-	if (OGDF_LIKELY(pFreeBytes != nullptr)) {
-		MemElemPtr p = pFreeBytes;
-		pFreeBytes = p->m_next;
+	ThreadCache &tc = threadCache();
+	int sc = sizeClass(nBytes);
+
+	addToCounter(tc.m_allocs[sc], 1);
+
+	MemElemPtr p = tc.m_free[sc];
+	if (OGDF_LIKELY(p != nullptr)) {
+		tc.m_free[sc] = p->m_next;
+		--tc.m_count[sc];
 		p->m_next = nullptr;
 		return p;
 	} else {
-		return fillPool(pFreeBytes,uint16_t(nBytes));
+		return fillPool(tc,sc);
 	}
 }
 
 
 void PoolMemoryAllocator::deallocate(size_t nBytes, void *p) {
-#if !defined(OGDF_MEMORY_POOL_NTS) && defined(OGDF_NO_COMPILER_TLS)
-	MemElemPtr &pFreeBytes = *((MemElemPtr*)pthread_getspecific(s_tpKey)+nBytes);
+	ThreadCache &tc = threadCache();
+	int sc = sizeClass(nBytes);
+
+	addToCounter(tc.m_deallocs[sc], 1);
+
+	MemElemPtr(p)->m_next = tc.m_free[sc];
+	tc.m_free[sc] = MemElemPtr(p);
+
+#ifdef OGDF_MEMORY_POOL_NTS
+	++tc.m_count[sc];
 #else
-	MemElemPtr &pFreeBytes = s_tp[nBytes];
+	if (OGDF_UNLIKELY(++tc.m_count[sc] > tc.m_limit[sc]))
+		trimCache(tc,sc);
 #endif
-	MemElemPtr(p)->m_next = pFreeBytes;
-	pFreeBytes = MemElemPtr(p);
 }
 
 
 void PoolMemoryAllocator::deallocateList(size_t nBytes, void *pHead, void *pTail) {
-#if !defined(OGDF_MEMORY_POOL_NTS) && defined(OGDF_NO_COMPILER_TLS)
-	MemElemPtr &pFreeBytes = *((MemElemPtr*)pthread_getspecific(s_tpKey)+nBytes);
-#else
-	MemElemPtr &pFreeBytes = s_tp[nBytes];
+	ThreadCache &tc = threadCache();
+	int sc = sizeClass(nBytes);
+
+	int n = 1;
+	for (MemElemPtr p = MemElemPtr(pHead); p != pTail; p = p->m_next)
+		++n;
+
+	addToCounter(tc.m_deallocs[sc], n);
+
+	MemElemPtr(pTail)->m_next = tc.m_free[sc];
+	tc.m_free[sc] = MemElemPtr(pHead);
+	tc.m_count[sc] += n;
+
+#ifndef OGDF_MEMORY_POOL_NTS
+	if (tc.m_count[sc] > tc.m_limit[sc])
+		trimCache(tc,sc);
 #endif
-	MemElemPtr(pTail)->m_next = pFreeBytes;
-	pFreeBytes = MemElemPtr(pHead);
 }
 
 
-
 void PoolMemoryAllocator::flushPool()
 {
 #ifndef OGDF_MEMORY_POOL_NTS
-	for(uint16_t nBytes = 1; nBytes < eTableSize; ++nBytes) {
-#ifdef OGDF_NO_COMPILER_TLS
-		MemElemPtr &pHead =  *((MemElemPtr*)pthread_getspecific(s_tpKey)+nBytes);
-#else
-		MemElemPtr &pHead = s_tp[nBytes];
-#endif
+	ThreadCache &tc = threadCache();
+
+	for(int sc = 0; sc < eNumSizeClasses; ++sc) {
+		MemElemPtr pHead = tc.m_free[sc];
 		if(pHead != nullptr) {
 			MemElemPtr pTail = pHead;
-			int n = 1;
-
-			while(pTail->m_next != nullptr) {
+			while(pTail->m_next != nullptr)
 				pTail = pTail->m_next;
-				++n;
-			}
-
-			MemElemPtr pOldHead = pHead;
-			pHead = nullptr;
 
 			enterCS();
 
-			PoolElement &pe = s_pool[nBytes];
-
+			PoolElement &pe = s_pool[sc];
 			pTail->m_next = pe.m_gp;
-			pe.m_gp = pOldHead;
-			pe.m_size += n;
+			pe.m_gp = pHead;
+			pe.m_size += tc.m_count[sc];
 
 			leaveCS();
+
+			tc.m_free[sc] = nullptr;
+			tc.m_count[sc] = 0;
 		}
 	}
 #endif
 }
 
 
-void *PoolMemoryAllocator::fillPool(MemElemPtr &pFreeBytes, uint16_t nBytes)
+void PoolMemoryAllocator::registerThread(ThreadCache &tc)
 {
-	int nWords;
-	int nSlices = slicesPerBlock(max(nBytes,(uint16_t)eMinBytes),nWords);
+	if (tc.m_state != eUnregistered)
+		return;
 
-#ifdef OGDF_MEMORY_POOL_NTS
-	pFreeBytes = allocateBlock();
+#if !defined(OGDF_MEMORY_POOL_NTS) && !defined(OGDF_NO_COMPILER_TLS)
+	// the guard is destructed (and retires the cache) when the thread exits
+	static thread_local ThreadGuard guard;
+	(void) guard;
+#endif
+
+	for (int sc = 0; sc < eNumSizeClasses; ++sc)
+		tc.m_limit[sc] = max(tc.m_limit[sc], eMaxCachedBytes / int(sliceSize(sc)));
+
+	enterCS();
+	tc.m_prev = nullptr;
+	tc.m_next = s_threads;
+	if (s_threads != nullptr)
+		s_threads->m_prev = &tc;
+	s_threads = &tc;
+	leaveCS();
+
+	tc.m_state = eRegistered;
+}
+
+
+void PoolMemoryAllocator::retireThread(ThreadCache &tc)
+{
+	if (tc.m_state != eRegistered)
+		return;
+
+	// find the tails of the free lists before entering the critical section
+	MemElemPtr pTail[eNumSizeClasses];
+	for (int sc = 0; sc < eNumSizeClasses; ++sc) {
+		MemElemPtr p = tc.m_free[sc];
+		if (p != nullptr) {
+			while (p->m_next != nullptr)
+				p = p->m_next;
+		}
+		pTail[sc] = p;
+	}
+
+	enterCS();
+
+	for (int sc = 0; sc < eNumSizeClasses; ++sc) {
+		if (pTail[sc] != nullptr) {
+			PoolElement &pe = s_pool[sc];
+			pTail[sc]->m_next = pe.m_gp;
+			pe.m_gp = tc.m_free[sc];
+			pe.m_size += tc.m_count[sc];
+		}
+		s_retiredAllocs[sc] += loadCounter(tc.m_allocs[sc]);
+		s_retiredDeallocs[sc] += loadCounter(tc.m_deallocs[sc]);
+	}
+
+	if (tc.m_prev != nullptr)
+		tc.m_prev->m_next = tc.m_next;
+	else
+		s_threads = tc.m_next;
+	if (tc.m_next != nullptr)
+		tc.m_next->m_prev = tc.m_prev;
+
+	leaveCS();
+
+	// memory released during the remaining shutdown of the thread is kept in its cache
+	for (int sc = 0; sc < eNumSizeClasses; ++sc) {
+		tc.m_free[sc] = nullptr;
+		tc.m_count[sc] = 0;
+		tc.m_limit[sc] = INT_MAX;
+	}
+	tc.m_state = eRetired;
+}
+
+
+void PoolMemoryAllocator::trimCache(ThreadCache &tc, int sc)
+{
+	registerThread(tc);
+	if (tc.m_count[sc] <= tc.m_limit[sc])
+		return;
+
+	// keep the recently released elements (likely to be in the CPU cache) and
+	// return the remaining ones to the global pool in a single batch
+	int limit = eMaxCachedBytes / int(sliceSize(sc));
+	int nKeep = limit / 2;
+	int n = tc.m_count[sc] - nKeep;
+
+	MemElemPtr p = tc.m_free[sc];
+	for (int i = 1; i < nKeep; ++i)
+		p = p->m_next;
+
+	MemElemPtr pHead = p->m_next, pTail = pHead;
+	p->m_next = nullptr;
+	while (pTail->m_next != nullptr)
+		pTail = pTail->m_next;
+
+	tc.m_count[sc] = nKeep;
+	tc.m_limit[sc] = limit;
+
+	enterCS();
+
+	PoolElement &pe = s_pool[sc];
+	pTail->m_next = pe.m_gp;
+	pe.m_gp = pHead;
+	pe.m_size += n;
+	unguardedUpdatePeak(sc);
+
+	leaveCS();
+}
+
+
+void PoolMemoryAllocator::reserve(size_t nBytes, int nElements)
+{
+	OGDF_ASSERT(checkSize(nBytes));
+
+	ThreadCache &tc = threadCache();
+	registerThread(tc);
+
+	int sc = sizeClass(nBytes);
+	nElements -= tc.m_count[sc];
+	if(nElements <= 0)
+		return;
+
+	int nWords = sc+1;
+	int nSlices = slicesPerBlock(sc);
+	int nBlocks = (nElements + nSlices - 1) / nSlices;
+
+	// allocate the blocks first and chain them in the order of allocation afterwards
+	MemElemPtr *blocks = new MemElemPtr[nBlocks];
+
+	enterCS();
+	for(int i = 0; i < nBlocks; ++i)
+		blocks[i] = allocateBlock();
 #ifdef OGDF_DEBUG
-	s_nettoAlloc += nWords * nSlices;
+	s_nettoAlloc += nWords * nSlices * nBlocks;
 #endif
-	makeSlices(pFreeBytes, nWords, nSlices);
+	leaveCS();
+
+	std::sort(blocks, blocks+nBlocks);
+
+	MemElemPtr pTail = tc.m_free[sc];
+	for(int i = nBlocks-1; i >= 0; --i) {
+		makeSlices(blocks[i], nWords, nSlices);
+		(blocks[i] + (nSlices-1)*nWords)->m_next = pTail;
+		pTail = blocks[i];
+	}
+	tc.m_free[sc] = pTail;
+	tc.m_count[sc] += nBlocks * nSlices;
+	tc.m_limit[sc] = max(tc.m_limit[sc], tc.m_count[sc]);
+
+	delete [] blocks;
+}
+
+
+void *PoolMemoryAllocator::fillPool(ThreadCache &tc, int sc)
+{
+	registerThread(tc);
+
+	int nWords = sc+1;
+	int nSlices = slicesPerBlock(sc);
+	int n = nSlices;
+	MemElemPtr pFree;
 
-#else
 	enterCS();
 
-	PoolElement &pe = s_pool[nBytes];
-	if(pe.m_size >= nSlices) {
-		MemElemPtr p = pFreeBytes = pe.m_gp;
-		for(int i = 1; i < nSlices; ++i)
+	PoolElement &pe = s_pool[sc];
+	if(pe.m_size > 0) {
+		n = min(pe.m_size, nSlices);
+
+		MemElemPtr p = pFree = pe.m_gp;
+		for(int i = 1; i < n; ++i)
 			p = p->m_next;
 
 		pe.m_gp = p->m_next;
-		pe.m_size -= nSlices;
+		pe.m_size -= n;
+		unguardedUpdatePeak(sc);
 
 		leaveCS();
 
 		p->m_next = nullptr;
 
 	} else {
-		pFreeBytes = allocateBlock();
+		pFree = allocateBlock();
 #ifdef OGDF_DEBUG
 		s_nettoAlloc += nWords * nSlices;
 #endif
+		unguardedUpdatePeak(sc);
+
 		leaveCS();
 
-		makeSlices(pFreeBytes, nWords, nSlices);
+		makeSlices(pFree, nWords, nSlices);
 	}
-#endif
 
-	MemElemPtr p = pFreeBytes;
-	pFreeBytes = p->m_next;
-	return p;
+	tc.m_free[sc] = pFree->m_next;
+	tc.m_count[sc] = n-1;
+	pFree->m_next = nullptr;
+	return pFree;
 }
 
 
@@ -280,11 +528,8 @@ size_t PoolMemoryAllocator::memoryAllocatedInBlocks()
 size_t PoolMemoryAllocator::unguardedMemGlobalFreelist()
 {
 	size_t bytesFree = 0;
-	for (int sz = 1; sz < eTableSize; ++sz)
-	{
-		const PoolElement &pe = s_pool[sz];
-		bytesFree += pe.m_size * sz;
-	}
+	for (int sc = 0; sc < eNumSizeClasses; ++sc)
+		bytesFree += s_pool[sc].m_size * sliceSize(sc);
 
 	return bytesFree;
 }
@@ -302,38 +547,100 @@ size_t PoolMemoryAllocator::memoryInGlobalFreeList()
 
 size_t PoolMemoryAllocator::memoryInThreadFreeList()
 {
+	const ThreadCache &tc = threadCache();
+
 	size_t bytesFree = 0;
-	for (int sz = 1; sz < eTableSize; ++sz)
-	{
-#if !defined(OGDF_MEMORY_POOL_NTS) && defined(OGDF_NO_COMPILER_TLS)
-		MemElemPtr p = ((MemElemPtr*)pthread_getspecific(s_tpKey))[sz];
-#else
-		MemElemPtr p = s_tp[sz];
-#endif
-		for(; p != nullptr; p = p->m_next)
-			bytesFree += sz;
-	}
+	for (int sc = 0; sc < eNumSizeClasses; ++sc)
+		bytesFree += tc.m_count[sc] * sliceSize(sc);
 
 	return bytesFree;
 }
 
 
+size_t PoolMemoryAllocator::unguardedBytesInUse(int sc)
+{
+	size_t allocs = s_retiredAllocs[sc];
+	size_t deallocs = s_retiredDeallocs[sc];
+	for (const ThreadCache *tc = s_threads; tc != nullptr; tc = tc->m_next) {
+		allocs += loadCounter(tc->m_allocs[sc]);
+		deallocs += loadCounter(tc->m_deallocs[sc]);
+	}
+
+	// counters of different threads are not read atomically as a whole
+	return (allocs > deallocs) ? (allocs - deallocs) * sliceSize(sc) : 0;
+}
+
+
+void PoolMemoryAllocator::unguardedUpdatePeak(int sc)
+{
+	size_t bytesInUse = unguardedBytesInUse(sc);
+	if (bytesInUse > s_peakBytesInUse[sc])
+		s_peakBytesInUse[sc] = bytesInUse;
+}
+
+
+PoolMemoryAllocator::SizeClassStatistics PoolMemoryAllocator::statistics(int sc)
+{
+	OGDF_ASSERT(0 <= sc && sc < eNumSizeClasses);
+
+	SizeClassStatistics stats;
+	stats.m_sliceSize = sliceSize(sc);
+
+	enterCS();
+
+	unguardedUpdatePeak(sc);
+
+	stats.m_allocations = s_retiredAllocs[sc];
+	for (const ThreadCache *tc = s_threads; tc != nullptr; tc = tc->m_next)
+		stats.m_allocations += loadCounter(tc->m_allocs[sc]);
+	stats.m_bytesInUse = unguardedBytesInUse(sc);
+	stats.m_peakBytesInUse = s_peakBytesInUse[sc];
+	stats.m_bytesInGlobalFreeList = s_pool[sc].m_size * sliceSize(sc);
+
+	leaveCS();
+
+	return stats;
+}
+
+
+void PoolMemoryAllocator::writeStatistics(std::ostream &os)
+{
+	os << std::setw(6) << "size"
+	   << std::setw(14) << "allocations"
+	   << std::setw(14) << "in use"
+	   << std::setw(14) << "peak"
+	   << std::setw(14) << "global free" << "\n";
+
+	for (int sc = 0; sc < eNumSizeClasses; ++sc) {
+		SizeClassStatistics stats = statistics(sc);
+		if (stats.m_allocations == 0 && stats.m_bytesInGlobalFreeList == 0)
+			continue;
+
+		os << std::setw(6) << stats.m_sliceSize
+		   << std::setw(14) << stats.m_allocations
+		   << std::setw(14) << stats.m_bytesInUse
+		   << std::setw(14) << stats.m_peakBytesInUse
+		   << std::setw(14) << stats.m_bytesInGlobalFreeList << "\n";
+	}
+}
+
+
 void PoolMemoryAllocator::defrag()
 {
 	enterCS();
 
 	int maxSize = 0;
-	for(int sz = 1; sz < eTableSize; ++sz) {
-		int size = s_pool[sz].m_size;
+	for(int sc = 0; sc < eNumSizeClasses; ++sc) {
+		int size = s_pool[sc].m_size;
 		maxSize = max(maxSize, size);
 	}
 
 	if(maxSize > 1) {
 		MemElemPtr *a = new MemElemPtr[maxSize];
 
-		for(int sz = 1; sz < eTableSize; ++sz)
+		for(int sc = 0; sc < eNumSizeClasses; ++sc)
 		{
-			PoolElement &pe = s_pool[sz];
+			PoolElement &pe = s_pool[sc];
 			int n = pe.m_size;
 			if(n > 1)
 			{
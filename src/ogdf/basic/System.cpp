@@ -103,6 +103,22 @@ static void __cpuid(int CPUInfo[4], int infoType)
 #endif
 
 
+// Returns the state components enabled by the operating system (XCR0);
+// must only be called if the CPU supports XSAVE and the OS uses it (OSXSAVE).
+static inline uint64_t xcr0()
+{
+#ifdef _MSC_VER
+	return _xgetbv(0);
+#elif defined(__i386__) || defined(__x86_64__)
+	uint32_t a, d;
+	__asm__ __volatile__ ("xgetbv" : "=a" (a), "=d" (d) : "c" (0));
+	return ((uint64_t)d << 32) | a;
+#else
+	return 0;
+#endif
+}
+
+
 namespace ogdf {
 
 unsigned int System::s_cpuFeatures;
@@ -148,6 +164,30 @@ void System::init()
 		if(featureInfoECX & (1 <<  6)) s_cpuFeatures |= cpufmSMX;
 		if(featureInfoECX & (1 <<  7)) s_cpuFeatures |= cpufmEST;
 		if(featureInfoECX & (1 <<  3)) s_cpuFeatures |= cpufmMONITOR;
+
+		// AVX needs the OS to save the YMM registers (XMM and YMM state enabled in XCR0)
+		if((featureInfoECX & (1 << 28)) && (featureInfoECX & (1 << 27)) && (xcr0() & 6) == 6)
+			s_cpuFeatures |= cpufmAVX;
+
+		if((s_cpuFeatures & cpufmAVX) && (featureInfoECX & (1 << 12))) s_cpuFeatures |= cpufmFMA;
+	}
+
+	// the structured extended features (leaf 7, sub-leaf 0) build on AVX
+	if(nIds >= 7 && (s_cpuFeatures & cpufmAVX))
+	{
+#ifdef _MSC_VER
+		__cpuidex(CPUInfo, 7, 0);
+#else
+		CPUInfo[2] = 0; // sub-leaf
+		__cpuid(CPUInfo, 7);
+#endif
+		int extFeatureInfoEBX = CPUInfo[1];
+
+		if(extFeatureInfoEBX & (1 << 5)) s_cpuFeatures |= cpufmAVX2;
+
+		// AVX-512 needs the OS to save the opmask and ZMM registers as well
+		if((extFeatureInfoEBX & (1 << 16)) && (xcr0() & 0xe6) == 0xe6)
+			s_cpuFeatures |= cpufmAVX512F;
 	}
 
 	__cpuid(CPUInfo, 0x80000000);
@@ -0,0 +1,471 @@
+/** \file
+ * \brief Implementation of class TaskScheduler.
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.txt in the root directory of the OGDF installation for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ *
+ * \see  http://www.gnu.org/copyleft/gpl.html
+ ***************************************************************/
+
+#include <ogdf/basic/TaskScheduler.h>
+#include <ogdf/basic/Thread.h>
+#include <deque>
+
+
+namespace ogdf {
+
+struct TaskScheduler::Task {
+	std::function<void()> m_work;
+	TaskGroup *m_group;
+};
+
+
+struct TaskScheduler::TaskQueue {
+	std::mutex m_mutex;
+	std::deque<Task*> m_tasks;
+};
+
+
+struct TaskScheduler::Worker {
+	std::function<void()> m_main;	//!< The main loop of the worker.
+	Thread m_thread;
+	std::condition_variable m_wakeUp;
+
+	// the following members are protected by TaskScheduler::m_idleMutex
+	bool m_idle = false;			//!< Whether the worker sleeps in the idle list.
+	bool m_reserved = false;		//!< Whether the worker belongs to a gang.
+	GangJob *m_job = nullptr;		//!< The gang job the worker shall run.
+	unsigned int m_jobIndex = 0;	//!< The index of the worker within its gang.
+};
+
+
+struct TaskScheduler::GangJob {
+	const std::function<void(unsigned int)> *m_work;
+	std::mutex m_mutex;
+	std::condition_variable m_finished;
+	unsigned int m_running;			//!< The number of reserved workers still running the job.
+	std::exception_ptr m_exception;	//!< The first exception thrown by the job.
+
+	void setException(std::exception_ptr e) {
+		std::lock_guard<std::mutex> guard(m_mutex);
+		if (!m_exception) {
+			m_exception = e;
+		}
+	}
+};
+
+
+// the scheduler and the queue of the calling thread if it is a worker
+static OGDF_DECL_THREAD TaskScheduler *s_currentScheduler = nullptr;
+static OGDF_DECL_THREAD unsigned int s_currentQueue = 0;
+
+
+TaskScheduler::TaskScheduler(unsigned int numWorkers)
+	: m_numWorkers(numWorkers), m_queues(numWorkers + 1), m_workers(numWorkers),
+	  m_numQueued(0), m_numIdle(0), m_numBusy(0), m_numReserved(0), m_shutdown(false)
+{
+	for (TaskQueue *&q : m_queues) {
+		q = new TaskQueue;
+	}
+	for (unsigned int i = 0; i < m_numWorkers; ++i) {
+		Worker *w = m_workers[i] = new Worker;
+		w->m_main = [this, i] { workerMain(i); };
+		w->m_thread = Thread(w->m_main);
+	}
+}
+
+
+TaskScheduler::~TaskScheduler()
+{
+	{
+		std::lock_guard<std::mutex> guard(m_idleMutex);
+		OGDF_ASSERT(m_numReserved == 0);
+		m_shutdown = true;
+		for (Worker *w : m_workers) {
+			w->m_wakeUp.notify_one();
+		}
+	}
+
+	for (Worker *w : m_workers) {
+		w->m_thread.join();
+		delete w;
+	}
+	for (TaskQueue *q : m_queues) {
+		OGDF_ASSERT(q->m_tasks.empty());
+		delete q;
+	}
+}
+
+
+TaskScheduler &TaskScheduler::global()
+{
+#ifdef OGDF_MEMORY_POOL_NTS
+	static TaskScheduler scheduler(0);
+#else
+	static TaskScheduler scheduler(max(1u, Thread::hardware_concurrency()) - 1);
+#endif
+	return scheduler;
+}
+
+
+unsigned int TaskScheduler::currentQueue() const
+{
+	return s_currentScheduler == this ? s_currentQueue : m_numWorkers;
+}
+
+
+void TaskScheduler::workerMain(unsigned int i)
+{
+	s_currentScheduler = this;
+	s_currentQueue = i;
+	Worker &w = *m_workers[i];
+
+	std::unique_lock<std::mutex> lock(m_idleMutex);
+	for (;;) {
+		if (w.m_job != nullptr) {
+			GangJob *job = w.m_job;
+			w.m_job = nullptr;
+			lock.unlock();
+			runGangMember(*job, w.m_jobIndex);
+			lock.lock();
+
+		} else if (m_shutdown && !w.m_reserved) {
+			break;
+
+		} else if (w.m_reserved || w.m_idle) {
+			w.m_wakeUp.wait(lock);
+
+		} else {
+			lock.unlock();
+			while (Task *task = findTask(i)) {
+				++m_numBusy;
+				execute(task);
+				--m_numBusy;
+			}
+			OGDF_ALLOCATOR::flushPool();
+			lock.lock();
+
+			// register as idle before looking at the queues a last time, so
+			// that spawn() either sees this worker or we see the new task
+			m_idle.push(i);
+			w.m_idle = true;
+			++m_numIdle;
+			if (m_numQueued > 0) {
+				for (int k = 0; k < m_idle.size(); ++k) {
+					if (m_idle[k] == i) {
+						m_idle[k] = m_idle.top();
+						m_idle.pop();
+						break;
+					}
+				}
+				w.m_idle = false;
+				--m_numIdle;
+			}
+		}
+	}
+}
+
+
+void TaskScheduler::spawn(Task *task)
+{
+	TaskQueue &q = *m_queues[currentQueue()];
+	{
+		std::lock_guard<std::mutex> guard(q.m_mutex);
+		q.m_tasks.push_back(task);
+	}
+	++m_numQueued;
+
+	if (m_numIdle > 0) {
+		std::lock_guard<std::mutex> guard(m_idleMutex);
+		if (!m_idle.empty()) {
+			Worker &w = *m_workers[m_idle.popRet()];
+			w.m_idle = false;
+			--m_numIdle;
+			w.m_wakeUp.notify_one();
+		}
+	}
+}
+
+
+TaskScheduler::Task *TaskScheduler::popFront(unsigned int queue)
+{
+	TaskQueue &q = *m_queues[queue];
+	std::lock_guard<std::mutex> guard(q.m_mutex);
+	if (q.m_tasks.empty()) {
+		return nullptr;
+	}
+	Task *task = q.m_tasks.front();
+	q.m_tasks.pop_front();
+	--m_numQueued;
+	return task;
+}
+
+
+TaskScheduler::Task *TaskScheduler::popBack(unsigned int queue)
+{
+	TaskQueue &q = *m_queues[queue];
+	std::lock_guard<std::mutex> guard(q.m_mutex);
+	if (q.m_tasks.empty()) {
+		return nullptr;
+	}
+	Task *task = q.m_tasks.back();
+	q.m_tasks.pop_back();
+	--m_numQueued;
+	return task;
+}
+
+
+TaskScheduler::Task *TaskScheduler::findTask(unsigned int queue)
+{
+	if (m_numQueued == 0) {
+		return nullptr;
+	}
+
+	// workers take their newest task, the shared queue of the other threads is processed in order
+	Task *task = queue < m_numWorkers ? popBack(queue) : popFront(queue);
+
+	// steal the oldest task of another queue
+	for (unsigned int k = 1; task == nullptr && k <= m_numWorkers; ++k) {
+		task = popFront((queue + k) % (m_numWorkers + 1));
+	}
+	return task;
+}
+
+
+void TaskScheduler::execute(Task *task)
+{
+	TaskGroup *group = task->m_group;
+	try {
+		task->m_work();
+	} catch (...) {
+		std::lock_guard<std::mutex> guard(group->m_exceptionMutex);
+		if (!group->m_exception) {
+			group->m_exception = std::current_exception();
+		}
+	}
+	delete task;
+
+	// the group may be destroyed as soon as the counter drops to zero
+	--group->m_pending;
+}
+
+
+void TaskScheduler::helpUntilDone(TaskGroup &group)
+{
+	const unsigned int queue = currentQueue();
+	while (group.m_pending > 0) {
+		if (Task *task = findTask(queue)) {
+			execute(task);
+		} else {
+			std::this_thread::yield();
+		}
+	}
+}
+
+
+void TaskScheduler::parallelFor(int begin, int end, int grainSize,
+	const std::function<void(int, int)> &body, unsigned int maxThreads)
+{
+	if (begin >= end) {
+		return;
+	}
+	grainSize = max(1, grainSize);
+	const int numRanges = (end - begin - 1) / grainSize + 1;
+
+	unsigned int numThreads = maxThreads == 0 ? concurrency() : min(maxThreads, concurrency());
+	numThreads = min(numThreads, (unsigned int) numRanges);
+	if (numThreads <= 1) {
+		body(begin, end);
+		return;
+	}
+
+	// every participating thread takes ranges until none are left; tasks
+	// started after that (e.g., executed late by this thread) return at once
+	std::atomic<int> nextRange(0);
+	std::function<void()> work = [&] {
+		int r;
+		while ((r = nextRange++) < numRanges) {
+			const int b = begin + r * grainSize;
+			body(b, end - b > grainSize ? b + grainSize : end);
+		}
+	};
+
+	TaskGroup group(*this);
+	for (unsigned int t = 1; t < numThreads; ++t) {
+		group.run(work);
+	}
+	try {
+		work();
+	} catch (...) {
+		nextRange = numRanges;
+		helpUntilDone(group);
+		throw;
+	}
+	group.wait();
+}
+
+
+void TaskScheduler::reserve(unsigned int numWorkers, ArrayBuffer<unsigned int> &members)
+{
+	std::unique_lock<std::mutex> lock(m_idleMutex);
+
+	// workers that are neither idle nor reserved nor executing a task are
+	// about to fall asleep (or have just been started), so wait a moment for them
+	for (int attempt = 0; ; ++attempt) {
+		while (members.size() < (int) numWorkers && !m_idle.empty()) {
+			unsigned int i = m_idle.popRet();
+			Worker &w = *m_workers[i];
+			w.m_idle = false;
+			w.m_reserved = true;
+			--m_numIdle;
+			++m_numReserved;
+			members.push(i);
+		}
+
+		int numWaking = (int) m_numWorkers - (int) m_numReserved - m_idle.size() - m_numBusy;
+		if (members.size() == (int) numWorkers || numWaking <= 0 || attempt == 1000) {
+			break;
+		}
+		lock.unlock();
+		std::this_thread::yield();
+		lock.lock();
+	}
+}
+
+
+void TaskScheduler::release(unsigned int i)
+{
+	std::lock_guard<std::mutex> guard(m_idleMutex);
+	Worker &w = *m_workers[i];
+	w.m_reserved = false;
+	--m_numReserved;
+	w.m_wakeUp.notify_one();
+}
+
+
+void TaskScheduler::startGangJob(const ArrayBuffer<unsigned int> &members, GangJob &job)
+{
+	std::lock_guard<std::mutex> guard(m_idleMutex);
+	for (int k = 0; k < members.size(); ++k) {
+		Worker &w = *m_workers[members[k]];
+		w.m_job = &job;
+		w.m_jobIndex = k + 1;
+		w.m_wakeUp.notify_one();
+	}
+}
+
+
+void TaskScheduler::runGangMember(GangJob &job, unsigned int index)
+{
+	try {
+		(*job.m_work)(index);
+	} catch (...) {
+		job.setException(std::current_exception());
+	}
+
+	// notify while holding the lock, since the job is destroyed when run() returns
+	std::lock_guard<std::mutex> guard(job.m_mutex);
+	if (--job.m_running == 0) {
+		job.m_finished.notify_one();
+	}
+}
+
+
+TaskScheduler::TaskGroup::~TaskGroup()
+{
+	m_scheduler.helpUntilDone(*this);
+}
+
+
+void TaskScheduler::TaskGroup::run(std::function<void()> work)
+{
+	++m_pending;
+	m_scheduler.spawn(new Task{std::move(work), this});
+}
+
+
+void TaskScheduler::TaskGroup::wait()
+{
+	m_scheduler.helpUntilDone(*this);
+	if (m_exception) {
+		std::exception_ptr e = m_exception;
+		m_exception = nullptr;
+		std::rethrow_exception(e);
+	}
+}
+
+
+TaskScheduler::Gang::Gang(unsigned int maxThreads, TaskScheduler &scheduler) : m_scheduler(scheduler)
+{
+	if (maxThreads == 0) {
+		maxThreads = scheduler.concurrency();
+	}
+	m_scheduler.reserve(maxThreads - 1, m_members);
+}
+
+
+TaskScheduler::Gang::~Gang()
+{
+	shrink(1);
+}
+
+
+void TaskScheduler::Gang::shrink(unsigned int numThreads)
+{
+	while (size() > max(1u, numThreads)) {
+		m_scheduler.release(m_members.popRet());
+	}
+}
+
+
+void TaskScheduler::Gang::run(const std::function<void(unsigned int)> &work)
+{
+	if (m_members.empty()) {
+		work(0);
+		return;
+	}
+
+	GangJob job;
+	job.m_work = &work;
+	job.m_running = m_members.size();
+	m_scheduler.startGangJob(m_members, job);
+
+	try {
+		work(0);
+	} catch (...) {
+		job.setException(std::current_exception());
+	}
+
+	{
+		std::unique_lock<std::mutex> lock(job.m_mutex);
+		job.m_finished.wait(lock, [&job] { return job.m_running == 0; });
+	}
+	if (job.m_exception) {
+		std::rethrow_exception(job.m_exception);
+	}
+}
+
+} // end namespace ogdf
@@ -92,21 +92,18 @@ void randomGraph(Graph &G, int n, int m)
 	G.clear();
 	if (n == 0) return;
 
-	Array<node> v(n);
-
-	int i;
-	for(i = 0; i < n; i++)
-		v[i] = G.newNode();
-
 	minstd_rand rng(randomSeed());
 	uniform_int_distribution<> dist(0,n-1);
 
-	for(i = 0; i < m; i++) {
+	Array<std::pair<int,int>> edgeList(m);
+	for(int i = 0; i < m; i++) {
 		int v1 = dist(rng);
 		int v2 = dist(rng);
 
-		G.newEdge(v[v1],v[v2]);
+		edgeList[i] = std::pair<int,int>(v1,v2);
 	}
+
+	G.buildFromEdgeList(n, edgeList);
 }
 
 
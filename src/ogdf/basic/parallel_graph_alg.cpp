@@ -0,0 +1,581 @@
+/** \file
+ * \brief Implementation of parallel connectivity tests and topological sorting for CSRGraph.
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.txt in the root directory of the OGDF installation for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ *
+ * \see  http://www.gnu.org/copyleft/gpl.html
+ ***************************************************************/
+
+
+#include <ogdf/basic/simple_graph_alg.h>
+#include <ogdf/basic/ConcurrentDisjointSets.h>
+#include <ogdf/basic/ArrayBuffer.h>
+#include <ogdf/basic/Barrier.h>
+#include <ogdf/basic/Thread.h>
+#include <functional>
+
+
+namespace ogdf {
+
+// Levels of a traversal with fewer nodes than this are processed by a single
+// thread, which avoids synchronizing the threads after each of many small
+// levels (e.g., on long paths).
+static const int minParallelLevelSize = 1024;
+
+
+// Returns the number of threads to be used for a graph with n nodes.
+static unsigned int numberOfThreads(unsigned int numThreads, int n)
+{
+#ifdef OGDF_MEMORY_POOL_NTS
+	return 1;
+#else
+	if (numThreads == 0) {
+		numThreads = max(1u, Thread::hardware_concurrency());
+	}
+	return max(1u, min(numThreads, (unsigned int)max(n, 1)));
+#endif
+}
+
+
+//! A group of threads that cooperate on the same algorithm.
+class ThreadTeam {
+	unsigned int m_numThreads;	//!< The number of threads.
+	Barrier m_barrier;			//!< Synchronizes the threads.
+	Array<int> m_sum;			//!< Partial sums for prefixSum().
+
+public:
+	explicit ThreadTeam(unsigned int numThreads)
+		: m_numThreads(numThreads), m_barrier(numThreads), m_sum(numThreads + 1) { }
+
+	//! Returns the number of threads.
+	unsigned int size() const { return m_numThreads; }
+
+	//! Runs work(id) on every thread id = 0, ..., size()-1; the calling thread is thread 0.
+	void run(const std::function<void(unsigned int)> &work) {
+		Array<std::function<void()>> task(1, m_numThreads - 1);
+		Array<Thread> thread(1, m_numThreads - 1);
+		for (unsigned int id = 1; id < m_numThreads; ++id) {
+			task[id] = [&work, id] { work(id); };
+			thread[id] = Thread(task[id]);
+		}
+		work(0);
+		for (Thread &t : thread) {
+			t.join();
+		}
+	}
+
+	//! Waits until all threads have reached this point.
+	void sync() { m_barrier.threadSync(); }
+
+	//! Assigns the part [\a begin, \a end) of [0, \a n) that is processed by thread \a id.
+	void range(unsigned int id, int n, int &begin, int &end) const {
+		begin = int((long long)n * id / m_numThreads);
+		end   = int((long long)n * (id+1) / m_numThreads);
+	}
+
+	//! Returns the sum of the \a count values of the threads before \a id and assigns the sum of all values to \a total.
+	/**
+	 * Must be called by all threads.
+	 */
+	int prefixSum(unsigned int id, int count, int &total) {
+		m_sum[id+1] = count;
+		sync();
+		if (id == 0) {
+			m_sum[0] = 0;
+			for (unsigned int i = 0; i < m_numThreads; ++i) {
+				m_sum[i+1] += m_sum[i];
+			}
+		}
+		sync();
+		int prefix = m_sum[id];
+		total = m_sum[m_numThreads];
+		sync();
+		return prefix;
+	}
+};
+
+
+//! Level-synchronous traversal as used by breadth-first search and Kahn's algorithm.
+/**
+ * The nodes are stored in \a order level by level. Each thread pushes the nodes
+ * of the first level to found(id) before calling run().
+ */
+class LevelTraversal {
+	ThreadTeam &m_team;
+	Array<int> &m_order;				//!< The visited nodes in the order of their levels.
+	ArrayBuffer<int> m_levels;			//!< The start of each level in m_order, followed by the end.
+	Array<ArrayBuffer<int>> m_found;	//!< The nodes found by each thread for the next level.
+	int m_sequentialBegin;				//!< The next level after a sequentially processed run of levels...
+	int m_sequentialEnd;				//!< ... consisting of m_order[m_sequentialBegin .. m_sequentialEnd).
+
+public:
+	LevelTraversal(ThreadTeam &team, Array<int> &order)
+		: m_team(team), m_order(order), m_found(team.size()), m_sequentialBegin(0), m_sequentialEnd(0) { }
+
+	//! Returns the nodes found by thread \a id.
+	ArrayBuffer<int> &found(unsigned int id) { return m_found[id]; }
+
+	//! Returns the start of each level in the order, followed by the end of the last level.
+	const ArrayBuffer<int> &levels() const { return m_levels; }
+
+	//! Visits all nodes reachable from the first level and returns their number.
+	/**
+	 * Must be called by all threads. \a expand(v, found) is called exactly once for
+	 * each visited node v and pushes the nodes of the next level discovered from v
+	 * to \a found; each node must be pushed at most once by all threads together.
+	 */
+	template<class Expand>
+	int run(unsigned int id, Expand expand) {
+		ArrayBuffer<int> &found = m_found[id];
+		int levelBegin = 0, levelEnd = 0;
+
+		for (;;) {
+			// append the nodes found by all threads as the next level
+			int total;
+			int pos = levelEnd + m_team.prefixSum(id, found.size(), total);
+			for (int v : found) {
+				m_order[pos++] = v;
+			}
+			found.clear();
+			levelBegin = levelEnd;
+			levelEnd += total;
+			if (id == 0 && total > 0) {
+				m_levels.push(levelBegin);
+			}
+			m_team.sync();
+
+			if (levelEnd - levelBegin < minParallelLevelSize) {
+				// process small levels on the first thread only
+				if (id == 0) {
+					int head = levelBegin, tail = levelEnd;
+					while (head < tail) {
+						expand(m_order[head++], found);
+						for (int w : found) {
+							m_order[tail++] = w;
+						}
+						found.clear();
+
+						if (head == levelEnd) {
+							levelBegin = levelEnd;
+							levelEnd = tail;
+							if (levelEnd > levelBegin) {
+								m_levels.push(levelBegin);
+							}
+							if (levelEnd - levelBegin >= minParallelLevelSize) {
+								break;
+							}
+						}
+					}
+					m_sequentialBegin = levelBegin;
+					m_sequentialEnd = levelEnd;
+				}
+				m_team.sync();
+				levelBegin = m_sequentialBegin;
+				levelEnd = m_sequentialEnd;
+			}
+
+			if (levelBegin == levelEnd) {
+				break;
+			}
+
+			int begin, end;
+			m_team.range(id, levelEnd - levelBegin, begin, end);
+			for (int i = levelBegin + begin; i < levelBegin + end; ++i) {
+				expand(m_order[i], found);
+			}
+		}
+
+		if (id == 0) {
+			m_levels.push(levelEnd);
+		}
+		m_team.sync();
+		return levelEnd;
+	}
+
+	//! Calls \a f(v) for all visited nodes v level by level, starting with the last level if \a bottomUp is set.
+	/**
+	 * Must be called by all threads. Returns after all nodes have been processed.
+	 */
+	template<class Function>
+	void forEachLevel(unsigned int id, bool bottomUp, Function f) {
+		const int numLevels = m_levels.size() - 1;
+		auto levelSize = [&](int i) {
+			int l = bottomUp ? numLevels-1-i : i;
+			return m_levels[l+1] - m_levels[l];
+		};
+
+		for (int i = 0; i < numLevels; ) {
+			if (levelSize(i) < minParallelLevelSize) {
+				int j = i;
+				while (j < numLevels && levelSize(j) < minParallelLevelSize) {
+					++j;
+				}
+				if (id == 0) {
+					for (; i < j; ++i) {
+						int l = bottomUp ? numLevels-1-i : i;
+						for (int k = m_levels[l]; k < m_levels[l+1]; ++k) {
+							f(m_order[k]);
+						}
+					}
+				}
+				i = j;
+
+			} else {
+				int l = bottomUp ? numLevels-1-i : i;
+				int begin, end;
+				m_team.range(id, m_levels[l+1] - m_levels[l], begin, end);
+				for (int k = m_levels[l] + begin; k < m_levels[l] + end; ++k) {
+					f(m_order[k]);
+				}
+				++i;
+			}
+			m_team.sync();
+		}
+	}
+};
+
+
+// Numbers the sets of uf that contain an element v with isElement(v) consecutively
+// in the order of their representatives and stores the number of each such
+// representative r in number[r]. Returns the number of these sets.
+template<class IsElement>
+static int numberSets(ThreadTeam &team, unsigned int id, ConcurrentDisjointSets &uf, Array<int> &number, IsElement isElement)
+{
+	int begin, end;
+	team.range(id, uf.size(), begin, end);
+
+	int count = 0;
+	for (int v = begin; v < end; ++v) {
+		if (isElement(v) && uf.find(v) == v) {
+			++count;
+		}
+	}
+
+	int total;
+	int next = team.prefixSum(id, count, total);
+	for (int v = begin; v < end; ++v) {
+		if (isElement(v) && uf.find(v) == v) {
+			number[v] = next++;
+		}
+	}
+	team.sync();
+
+	return total;
+}
+
+
+int connectedComponents(const CSRGraph &G, NodeArray<int> &component, unsigned int numThreads)
+{
+	const int n = G.numberOfNodes();
+	numThreads = numberOfThreads(numThreads, n);
+	if (numThreads == 1) {
+		return connectedComponents(G, component);
+	}
+
+	const int m = G.numberOfEdges();
+	ThreadTeam team(numThreads);
+	ConcurrentDisjointSets uf(n);
+	Array<int> number(n);
+	int nComponent = 0;
+
+	team.run([&](unsigned int id) {
+		int begin, end;
+		team.range(id, m, begin, end);
+		for (int e = begin; e < end; ++e) {
+			uf.quickUnion(G.source(e), G.target(e));
+		}
+		team.sync();
+
+		// representatives are the smallest nodes of their components, so numbering
+		// them in increasing order yields the numbers of the sequential algorithm
+		int total = numberSets(team, id, uf, number, [](int) { return true; });
+		if (id == 0) {
+			nComponent = total;
+		}
+
+		team.range(id, n, begin, end);
+		for (int v = begin; v < end; ++v) {
+			component[G.original(v)] = number[uf.find(v)];
+		}
+	});
+
+	return nComponent;
+}
+
+
+int biconnectedComponents(const CSRGraph &G, EdgeArray<int> &component, unsigned int numThreads)
+{
+	const int n = G.numberOfNodes();
+	numThreads = numberOfThreads(numThreads, n);
+	if (numThreads == 1) {
+		return biconnectedComponents(G, component);
+	}
+
+	// This is the algorithm of Tarjan and Vishkin based on a breadth-first
+	// spanning forest. Tree edges are represented by their lower end nodes.
+
+	const int m = G.numberOfEdges();
+	const int *adjStart = G.adjStart();
+	const int *adjNode  = G.adjNodes();
+	const int *adjEdge  = G.adjEdges();
+
+	ThreadTeam team(numThreads);
+	ConcurrentDisjointSets connected(n), blocks(n);
+	Array<std::atomic<int>> parent(n);
+	Array<int> parentEdge(n), order(n), nd(n), pre(n), low(n), high(n), number(n);
+	LevelTraversal bfs(team, order);
+	int nComponent = 0, nIsolated = 0;
+
+	auto isRoot = [&](int v) {
+		return parentEdge[v] == -1;
+	};
+	auto isTreeEdge = [&](int v, int w, int e) {
+		return parentEdge[w] == e || parentEdge[v] == e;
+	};
+	auto isChild = [&](int v, int w, int e) {
+		return parentEdge[w] == e && parent[w].load(std::memory_order_relaxed) == v;
+	};
+	auto isAncestor = [&](int v, int w) {
+		return pre[v] <= pre[w] && pre[w] < pre[v] + nd[v];
+	};
+
+	team.run([&](unsigned int id) {
+		int begin, end;
+
+		// the smallest node of each connected component becomes the root of a BFS tree
+		team.range(id, m, begin, end);
+		for (int e = begin; e < end; ++e) {
+			connected.quickUnion(G.source(e), G.target(e));
+		}
+		team.range(id, n, begin, end);
+		for (int v = begin; v < end; ++v) {
+			parent[v].store(-1, std::memory_order_relaxed);
+			parentEdge[v] = -1;
+		}
+		team.sync();
+
+		for (int v = begin; v < end; ++v) {
+			if (connected.find(v) == v) {
+				parent[v].store(v, std::memory_order_relaxed);
+				bfs.found(id).push(v);
+			}
+		}
+		bfs.run(id, [&](int v, ArrayBuffer<int> &found) {
+			for (int a = adjStart[v]; a < adjStart[v+1]; ++a) {
+				int w = adjNode[a];
+				int unvisited = -1;
+				if (parent[w].compare_exchange_strong(unvisited, v, std::memory_order_relaxed)) {
+					parentEdge[w] = adjEdge[a];
+					found.push(w);
+				}
+			}
+		});
+
+		// number of descendants
+		bfs.forEachLevel(id, true, [&](int v) {
+			nd[v] = 1;
+			for (int a = adjStart[v]; a < adjStart[v+1]; ++a) {
+				if (isChild(v, adjNode[a], adjEdge[a])) {
+					nd[v] += nd[adjNode[a]];
+				}
+			}
+		});
+
+		// preorder numbers; the roots form the first level
+		int count = 0;
+		const int numRoots = bfs.levels()[1];
+		team.range(id, numRoots, begin, end);
+		for (int i = begin; i < end; ++i) {
+			count += nd[order[i]];
+		}
+		int total;
+		int next = team.prefixSum(id, count, total);
+		for (int i = begin; i < end; ++i) {
+			pre[order[i]] = next;
+			next += nd[order[i]];
+		}
+		team.sync();
+
+		bfs.forEachLevel(id, false, [&](int v) {
+			int next = pre[v] + 1;
+			for (int a = adjStart[v]; a < adjStart[v+1]; ++a) {
+				int w = adjNode[a];
+				if (isChild(v, w, adjEdge[a])) {
+					pre[w] = next;
+					next += nd[w];
+				}
+			}
+		});
+
+		// smallest and largest preorder number reachable from the subtree via a non-tree edge
+		bfs.forEachLevel(id, true, [&](int v) {
+			int l = pre[v], h = pre[v];
+			for (int a = adjStart[v]; a < adjStart[v+1]; ++a) {
+				int w = adjNode[a], e = adjEdge[a];
+				if (isChild(v, w, e)) {
+					l = min(l, low[w]);
+					h = max(h, high[w]);
+				} else if (!isTreeEdge(v, w, e)) {
+					l = min(l, pre[w]);
+					h = max(h, pre[w]);
+				}
+			}
+			low[v] = l;
+			high[v] = h;
+		});
+
+		// connect tree edges that lie on a common cycle
+		team.range(id, n, begin, end);
+		for (int v = begin; v < end; ++v) {
+			if (isRoot(v)) continue;
+			int u = parent[v].load(std::memory_order_relaxed);
+			if (!isRoot(u) && (low[v] < pre[u] || high[v] >= pre[u] + nd[u])) {
+				blocks.quickUnion(v, u);
+			}
+		}
+		team.range(id, m, begin, end);
+		for (int e = begin; e < end; ++e) {
+			int v = G.source(e), w = G.target(e);
+			if (v == w || isTreeEdge(v, w, e)) continue;
+			if (pre[v] < pre[w]) {
+				std::swap(v, w);
+			}
+			if (!isAncestor(w, v)) {
+				blocks.quickUnion(v, w);
+			}
+		}
+		team.sync();
+
+		int numBlocks = numberSets(team, id, blocks, number, [&](int v) { return !isRoot(v); });
+
+		// isolated nodes are roots without children
+		count = 0;
+		team.range(id, n, begin, end);
+		for (int v = begin; v < end; ++v) {
+			if (isRoot(v) && nd[v] == 1) {
+				++count;
+			}
+		}
+		team.prefixSum(id, count, total);
+		if (id == 0) {
+			nComponent = numBlocks;
+			nIsolated = total;
+		}
+
+		// a non-tree edge belongs to the block of the tree edge above its lower end
+		team.range(id, m, begin, end);
+		for (int e = begin; e < end; ++e) {
+			int v = G.source(e), w = G.target(e);
+			if (v == w) continue;
+			if (pre[v] < pre[w]) {
+				std::swap(v, w);
+			}
+			component[G.originalEdge(e)] = number[blocks.find(v)];
+		}
+	});
+
+	return nComponent + nIsolated;
+}
+
+
+// Computes a topological order of the nodes of G in order (or a prefix of it if
+// G contains cycles) with Kahn's algorithm, level by level in parallel, and
+// returns the number of ordered nodes.
+static int parallelTopologicalOrder(const CSRGraph &G, ThreadTeam &team, Array<int> &order, NodeArray<int> *num)
+{
+	const int n = G.numberOfNodes();
+	const int *outStart = G.outStart();
+	const int *outNode  = G.outNodes();
+
+	Array<std::atomic<int>> indeg(n);
+	LevelTraversal kahn(team, order);
+	int count = 0;
+
+	team.run([&](unsigned int id) {
+		int begin, end;
+		team.range(id, n, begin, end);
+		for (int v = begin; v < end; ++v) {
+			int d = G.indeg(v);
+			indeg[v].store(d, std::memory_order_relaxed);
+			if (d == 0) {
+				kahn.found(id).push(v);
+			}
+		}
+
+		int numOrdered = kahn.run(id, [&](int v, ArrayBuffer<int> &found) {
+			for (int a = outStart[v]; a < outStart[v+1]; ++a) {
+				int u = outNode[a];
+				if (indeg[u].fetch_sub(1, std::memory_order_relaxed) == 1) {
+					found.push(u);
+				}
+			}
+		});
+		if (id == 0) {
+			count = numOrdered;
+		}
+
+		if (num != nullptr) {
+			team.range(id, numOrdered, begin, end);
+			for (int i = begin; i < end; ++i) {
+				(*num)[G.original(order[i])] = i;
+			}
+		}
+	});
+
+	return count;
+}
+
+
+bool isAcyclic(const CSRGraph &G, unsigned int numThreads)
+{
+	const int n = G.numberOfNodes();
+	numThreads = numberOfThreads(numThreads, n);
+	if (numThreads == 1) {
+		return isAcyclic(G);
+	}
+
+	ThreadTeam team(numThreads);
+	Array<int> order(n);
+	return parallelTopologicalOrder(G, team, order, nullptr) == n;
+}
+
+
+void topologicalNumbering(const CSRGraph &G, NodeArray<int> &num, unsigned int numThreads)
+{
+	const int n = G.numberOfNodes();
+	numThreads = numberOfThreads(numThreads, n);
+	if (numThreads == 1) {
+		topologicalNumbering(G, num);
+		return;
+	}
+
+	ThreadTeam team(numThreads);
+	Array<int> order(n);
+	parallelTopologicalOrder(G, team, order, &num);
+}
+
+} // end namespace ogdf
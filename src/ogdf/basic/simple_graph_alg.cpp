@@ -226,6 +226,36 @@ bool isConnected(const Graph &G)
 }
 
 
+bool isConnected(const CSRGraph &G)
+{
+	const int n = G.numberOfNodes();
+	if (n == 0) return true;
+
+	Array<bool> visited(0, n-1, false);
+	Array<int> S(n);
+	const int *adjStart = G.adjStart();
+	const int *adjNode  = G.adjNodes();
+
+	int top = 0, count = 0;
+	S[top++] = 0;
+	visited[0] = true;
+	while(top > 0) {
+		int v = S[--top];
+		++count;
+
+		for(int a = adjStart[v]; a < adjStart[v+1]; ++a) {
+			int w = adjNode[a];
+			if(!visited[w]) {
+				visited[w] = true;
+				S[top++] = w;
+			}
+		}
+	}
+
+	return (count == n);
+}
+
+
 void makeConnected(Graph &G, List<edge> &added)
 {
 	added.clear();
@@ -300,6 +330,45 @@ int connectedComponents(const Graph &G, NodeArray<int> &component)
 	return nComponent;
 }
 
+
+
+int connectedComponents(const CSRGraph &G, NodeArray<int> &component)
+{
+	const int n = G.numberOfNodes();
+	int nComponent = 0;
+
+	Array<int> comp(0, n-1, -1);
+	Array<int> S(n);
+	const int *adjStart = G.adjStart();
+	const int *adjNode  = G.adjNodes();
+
+	for(int v = 0; v < n; ++v) {
+		if (comp[v] != -1) continue;
+
+		int top = 0;
+		S[top++] = v;
+		comp[v] = nComponent;
+
+		while(top > 0) {
+			int w = S[--top];
+			for(int a = adjStart[w]; a < adjStart[w+1]; ++a) {
+				int x = adjNode[a];
+				if (comp[x] == -1) {
+					comp[x] = nComponent;
+					S[top++] = x;
+				}
+			}
+		}
+
+		++nComponent;
+	}
+
+	for(int v = 0; v < n; ++v)
+		component[G.original(v)] = comp[v];
+
+	return nComponent;
+}
+
 //return the isolated nodes too, is used in incremental layout
 int connectedIsolatedComponents(const Graph &G, List<node> &isolated,
 								NodeArray<int> &component)
@@ -385,6 +454,60 @@ bool isBiconnected(const Graph &G, node &cutVertex)
 }
 
 
+
+bool isBiconnected(const CSRGraph &G, node &cutVertex)
+{
+	cutVertex = nullptr;
+	const int n = G.numberOfNodes();
+	if (n == 0) return true;
+
+	// explicit DFS stack replacing the recursion of dfsIsBicon()
+	struct Frame { int v, father, firstSon, pos; };
+
+	Array<int> number(0, n-1, 0), lowpt(n);
+	Array<Frame> S(n);
+	const int *adjStart = G.adjStart();
+	const int *adjNode  = G.adjNodes();
+	int numCount = 0, top = 0;
+
+	lowpt[0] = number[0] = ++numCount;
+	S[top++] = { 0, -1, -1, adjStart[0] };
+
+	while (top > 0) {
+		Frame &f = S[top-1];
+		int v = f.v;
+
+		if (f.pos < adjStart[v+1]) {
+			int w = adjNode[f.pos++];
+			if (v == w) continue; // ignore self-loops
+
+			if (number[w] == 0) {
+				if (f.firstSon == -1) f.firstSon = w;
+				lowpt[w] = number[w] = ++numCount;
+				S[top++] = { w, v, -1, adjStart[w] };
+			} else if (number[w] < lowpt[v]) {
+				lowpt[v] = number[w];
+			}
+
+		} else {
+			int father = f.father;
+			--top;
+			if (father == -1) continue;
+
+			const Frame &pf = S[top-1];
+			// is father cut vertex ?
+			if (lowpt[v] >= number[father] && (v != pf.firstSon || pf.father != -1)) {
+				cutVertex = G.original(father);
+				return false;
+			}
+			if (lowpt[v] < lowpt[father]) lowpt[father] = lowpt[v];
+		}
+	}
+
+	return numCount == n;
+}
+
+
 static void dfsMakeBicon (Graph &G,
 	node v, node father,
 	NodeArray<int> &number,
@@ -518,6 +641,84 @@ int biconnectedComponents(const Graph &G, EdgeArray<int> &component)
 }
 
 
+
+int biconnectedComponents(const CSRGraph &G, EdgeArray<int> &component)
+{
+	const int n = G.numberOfNodes();
+	if (n == 0) return 0;
+
+	// explicit DFS stack replacing the recursion of dfsBiconComp()
+	struct Frame { int v, father, pos; };
+
+	Array<int> number(0, n-1, 0), lowpt(n);
+	Array<int> called(n);
+	Array<Frame> S(n);
+	const int *adjStart = G.adjStart();
+	const int *adjNode  = G.adjNodes();
+	const int *adjEdge  = G.adjEdges();
+	int nNumber = 0, nComponent = 0, nIsolated = 0, nCalled = 0;
+
+	for(int r = 0; r < n; ++r) {
+		if (number[r] != 0) continue;
+
+		bool isolated = true;
+		for(int a = adjStart[r]; a < adjStart[r+1]; ++a) {
+			if (adjNode[a] != r) {
+				isolated = false; break;
+			}
+		}
+		if (isolated) {
+			++nIsolated;
+			continue;
+		}
+
+		int top = 0;
+		lowpt[r] = number[r] = ++nNumber;
+		called[nCalled++] = r;
+		S[top++] = { r, -1, adjStart[r] };
+
+		while (top > 0) {
+			Frame &f = S[top-1];
+			int v = f.v;
+
+			if (f.pos < adjStart[v+1]) {
+				int w = adjNode[f.pos++];
+				if (v == w) continue; // ignore self-loops
+
+				if (number[w] == 0) {
+					lowpt[w] = number[w] = ++nNumber;
+					called[nCalled++] = w;
+					S[top++] = { w, v, adjStart[w] };
+				} else if (number[w] < lowpt[v]) {
+					lowpt[v] = number[w];
+				}
+
+			} else {
+				int father = f.father;
+				--top;
+				if (father == -1) continue;
+
+				if (lowpt[v] == number[father]) {
+					int w;
+					do {
+						w = called[--nCalled];
+						for(int a = adjStart[w]; a < adjStart[w+1]; ++a) {
+							if (number[w] > number[adjNode[a]])
+								component[G.originalEdge(adjEdge[a])] = nComponent;
+						}
+					} while (w != v);
+
+					++nComponent;
+				}
+				if (lowpt[v] < lowpt[father]) lowpt[father] = lowpt[v];
+			}
+		}
+	}
+
+	return nComponent + nIsolated;
+}
+
+
 //---------------------------------------------------------
 // isTriconnected()
 // testing triconnectivity
@@ -703,6 +904,32 @@ bool isAcyclicUndirected(const Graph &G, List<edge> &backedges)
 }
 
 
+bool isAcyclic(const CSRGraph &G)
+{
+	const int n = G.numberOfNodes();
+	Array<int> indeg(n), S(n);
+	const int *outStart = G.outStart();
+	const int *outNode  = G.outNodes();
+	int top = 0, count = 0;
+
+	for(int v = 0; v < n; ++v)
+		if((indeg[v] = G.indeg(v)) == 0)
+			S[top++] = v;
+
+	while(top > 0) {
+		int v = S[--top];
+		++count;
+
+		for(int a = outStart[v]; a < outStart[v+1]; ++a) {
+			if(--indeg[outNode[a]] == 0)
+				S[top++] = outNode[a];
+		}
+	}
+
+	return count == n;
+}
+
+
 void makeAcyclic(Graph &G)
 {
 	List<edge> backedges;
@@ -820,6 +1047,35 @@ void topologicalNumbering(const Graph &G, NodeArray<int> &num)
 	}
 }
 
+
+
+void topologicalNumbering(const CSRGraph &G, NodeArray<int> &num)
+{
+	const int n = G.numberOfNodes();
+	Array<int> indeg(n), S(n);
+	const int *outStart = G.outStart();
+	const int *outNode  = G.outNodes();
+	int top = 0;
+
+	for(int v = 0; v < n; ++v)
+		if((indeg[v] = G.indeg(v)) == 0)
+			S[top++] = v;
+
+	int count = 0;
+	while(top > 0) {
+		int v = S[--top];
+		num[G.original(v)] = count++;
+
+		for(int a = outStart[v]; a < outStart[v+1]; ++a) {
+			int u = outNode[a];
+			if(u != v) {
+				if(--indeg[u] == 0)
+					S[top++] = u;
+			}
+		}
+	}
+}
+
 /**
  * Computes the strongly connected componets using tarjans algorithm.
  *
@@ -96,10 +96,10 @@ void ClusterGraphAttributes::updateClusterPositions(double boundaryDist)
 		//Initialize with first element
 		if (nit.valid())
 		{
-			x(c) = m_x[*nit] - m_width[*nit]/2;
-			y(c) = m_y[*nit] - m_height[*nit]/2;
-			width(c) = m_x[*nit] + m_width[*nit]/2;
-			height(c) = m_y[*nit] + m_height[*nit]/2;
+			x(c) = m_geometry[*nit].m_x - m_geometry[*nit].m_width/2;
+			y(c) = m_geometry[*nit].m_y - m_geometry[*nit].m_height/2;
+			width(c) = m_geometry[*nit].m_x + m_geometry[*nit].m_width/2;
+			height(c) = m_geometry[*nit].m_y + m_geometry[*nit].m_height/2;
 			++nit;
 		}
 		else
@@ -123,14 +123,14 @@ void ClusterGraphAttributes::updateClusterPositions(double boundaryDist)
 		//run through elements and update
 		while (nit.valid())
 		{
-			if (x(c) > m_x[*nit] - m_width[*nit]/2)
-				x(c) = m_x[*nit] - m_width[*nit]/2;
-			if (y(c) > m_y[*nit] - m_height[*nit]/2)
-				y(c) = m_y[*nit] - m_height[*nit]/2;
-			if (width(c) < m_x[*nit] + m_width[*nit]/2)
-				width(c) = m_x[*nit] + m_width[*nit]/2;
-			if (height(c) < m_y[*nit] + m_height[*nit]/2)
-				height(c) = m_y[*nit] + m_height[*nit]/2;
+			if (x(c) > m_geometry[*nit].m_x - m_geometry[*nit].m_width/2)
+				x(c) = m_geometry[*nit].m_x - m_geometry[*nit].m_width/2;
+			if (y(c) > m_geometry[*nit].m_y - m_geometry[*nit].m_height/2)
+				y(c) = m_geometry[*nit].m_y - m_geometry[*nit].m_height/2;
+			if (width(c) < m_geometry[*nit].m_x + m_geometry[*nit].m_width/2)
+				width(c) = m_geometry[*nit].m_x + m_geometry[*nit].m_width/2;
+			if (height(c) < m_geometry[*nit].m_y + m_geometry[*nit].m_height/2)
+				height(c) = m_geometry[*nit].m_y + m_geometry[*nit].m_height/2;
 			++nit;
 		}
 		while (cit.valid())
@@ -0,0 +1,108 @@
+/** \file
+ * \brief Expansion and direct evaluation kernels of the fast multipole embedder for AVX2 and FMA
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.txt in the root directory of the OGDF installation for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ *
+ * \see  http://www.gnu.org/copyleft/gpl.html
+ ***************************************************************/
+
+#include <ogdf/internal/energybased/FMEExpansionKernel.h>
+
+#ifdef OGDF_AVX2_EXTENSIONS
+
+#include <immintrin.h>
+
+namespace ogdf {
+
+// This file is compiled with AVX2 and FMA enabled. Everything instantiated
+// here has internal linkage, so no such code leaks into inline functions
+// shared with other translation units.
+namespace {
+
+// two complex numbers
+struct AVX2DoubleOps {
+	typedef __m256d Vector;
+	static const int width = 4;
+
+	static Vector load(const double *p) { return _mm256_loadu_pd(p); }
+	static void store(double *p, Vector a) { _mm256_storeu_pd(p, a); }
+	static Vector set1(double a) { return _mm256_set1_pd(a); }
+	static Vector zero() { return _mm256_setzero_pd(); }
+	static Vector broadcast(const double *p) { return _mm256_broadcast_pd(reinterpret_cast<const __m128d*>(p)); }
+	static Vector add(Vector a, Vector b) { return _mm256_add_pd(a, b); }
+	static Vector mul(Vector a, Vector b) { return _mm256_mul_pd(a, b); }
+	static Vector fmadd(Vector a, Vector b, Vector c) { return _mm256_fmadd_pd(a, b, c); }
+	static Vector cmul(Vector a, Vector b) {
+		// (a.re b.re, a.re b.im) -+ (a.im b.im, a.im b.re)
+		Vector t = _mm256_mul_pd(_mm256_permute_pd(a, 0xf), _mm256_permute_pd(b, 0x5));
+		return _mm256_fmaddsub_pd(_mm256_movedup_pd(a), b, t);
+	}
+	static Vector cmul(const double *a, Vector b) {
+		Vector t = _mm256_mul_pd(_mm256_broadcast_sd(a + 1), _mm256_permute_pd(b, 0x5));
+		return _mm256_fmaddsub_pd(_mm256_broadcast_sd(a), b, t);
+	}
+};
+
+struct AVX2FloatOps {
+	typedef __m256 Vector;
+	static const int width = 8;
+
+	static __m256i firstLanes(int k) {
+		return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(fmeLaneMask + 16 - k));
+	}
+
+	static Vector load(const float *p) { return _mm256_loadu_ps(p); }
+	static void store(float *p, Vector a) { _mm256_storeu_ps(p, a); }
+	static Vector set1(float a) { return _mm256_set1_ps(a); }
+	static Vector zero() { return _mm256_setzero_ps(); }
+	static Vector add(Vector a, Vector b) { return _mm256_add_ps(a, b); }
+	static Vector sub(Vector a, Vector b) { return _mm256_sub_ps(a, b); }
+	static Vector mul(Vector a, Vector b) { return _mm256_mul_ps(a, b); }
+	static Vector div(Vector a, Vector b) { return _mm256_div_ps(a, b); }
+	static Vector max(Vector a, Vector b) { return _mm256_max_ps(a, b); }
+	static Vector loadFirst(const float *p, int k) { return _mm256_maskload_ps(p, firstLanes(k)); }
+	static void storeFirst(float *p, Vector a, int k) { _mm256_maskstore_ps(p, firstLanes(k), a); }
+	static Vector selectLanes(Vector a, int begin, int end) {
+		return _mm256_and_ps(_mm256_castsi256_ps(_mm256_andnot_si256(firstLanes(begin), firstLanes(end))), a);
+	}
+	static float sum(Vector a) {
+		__m128 t = _mm_add_ps(_mm256_castps256_ps128(a), _mm256_extractf128_ps(a, 1));
+		t = _mm_add_ps(t, _mm_movehl_ps(t, t));
+		return _mm_cvtss_f32(_mm_add_ss(t, _mm_shuffle_ps(t, t, 1)));
+	}
+};
+
+}
+
+FMEExpansionKernels fmeExpansionKernelsAVX2()
+{
+	return fmeExpansionKernels<AVX2DoubleOps, AVX2FloatOps>();
+}
+
+} // end namespace ogdf
+
+#endif
@@ -0,0 +1,102 @@
+/** \file
+ * \brief Expansion and direct evaluation kernels of the fast multipole embedder for AVX-512F
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.txt in the root directory of the OGDF installation for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ *
+ * \see  http://www.gnu.org/copyleft/gpl.html
+ ***************************************************************/
+
+#include <ogdf/internal/energybased/FMEExpansionKernel.h>
+
+#ifdef OGDF_AVX512_EXTENSIONS
+
+#include <immintrin.h>
+
+namespace ogdf {
+
+// This file is compiled with AVX-512F enabled, see FMEExpansionKernelAVX2.cpp.
+namespace {
+
+// four complex numbers
+struct AVX512DoubleOps {
+	typedef __m512d Vector;
+	static const int width = 8;
+
+	static Vector load(const double *p) { return _mm512_loadu_pd(p); }
+	static void store(double *p, Vector a) { _mm512_storeu_pd(p, a); }
+	static Vector set1(double a) { return _mm512_set1_pd(a); }
+	static Vector zero() { return _mm512_setzero_pd(); }
+	static Vector broadcast(const double *p) {
+		return _mm512_castps_pd(_mm512_broadcast_f32x4(_mm_castpd_ps(_mm_loadu_pd(p))));
+	}
+	static Vector add(Vector a, Vector b) { return _mm512_add_pd(a, b); }
+	static Vector mul(Vector a, Vector b) { return _mm512_mul_pd(a, b); }
+	static Vector fmadd(Vector a, Vector b, Vector c) { return _mm512_fmadd_pd(a, b, c); }
+	static Vector cmul(Vector a, Vector b) {
+		// (a.re b.re, a.re b.im) -+ (a.im b.im, a.im b.re)
+		Vector t = _mm512_mul_pd(_mm512_permute_pd(a, 0xff), _mm512_permute_pd(b, 0x55));
+		return _mm512_fmaddsub_pd(_mm512_movedup_pd(a), b, t);
+	}
+	static Vector cmul(const double *a, Vector b) {
+		Vector t = _mm512_mul_pd(_mm512_set1_pd(a[1]), _mm512_permute_pd(b, 0x55));
+		return _mm512_fmaddsub_pd(_mm512_set1_pd(a[0]), b, t);
+	}
+};
+
+struct AVX512FloatOps {
+	typedef __m512 Vector;
+	static const int width = 16;
+
+	static __mmask16 firstLanes(int k) { return (__mmask16)((1u << k) - 1); }
+
+	static Vector load(const float *p) { return _mm512_loadu_ps(p); }
+	static void store(float *p, Vector a) { _mm512_storeu_ps(p, a); }
+	static Vector set1(float a) { return _mm512_set1_ps(a); }
+	static Vector zero() { return _mm512_setzero_ps(); }
+	static Vector add(Vector a, Vector b) { return _mm512_add_ps(a, b); }
+	static Vector sub(Vector a, Vector b) { return _mm512_sub_ps(a, b); }
+	static Vector mul(Vector a, Vector b) { return _mm512_mul_ps(a, b); }
+	static Vector div(Vector a, Vector b) { return _mm512_div_ps(a, b); }
+	static Vector max(Vector a, Vector b) { return _mm512_max_ps(a, b); }
+	static Vector loadFirst(const float *p, int k) { return _mm512_maskz_loadu_ps(firstLanes(k), p); }
+	static void storeFirst(float *p, Vector a, int k) { _mm512_mask_storeu_ps(p, firstLanes(k), a); }
+	static Vector selectLanes(Vector a, int begin, int end) {
+		return _mm512_maskz_mov_ps(firstLanes(end) & ~firstLanes(begin), a);
+	}
+	static float sum(Vector a) { return _mm512_reduce_add_ps(a); }
+};
+
+}
+
+FMEExpansionKernels fmeExpansionKernelsAVX512()
+{
+	return fmeExpansionKernels<AVX512DoubleOps, AVX512FloatOps>();
+}
+
+} // end namespace ogdf
+
+#endif
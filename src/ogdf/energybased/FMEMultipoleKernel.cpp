@@ -38,6 +38,7 @@
 #include <ogdf/internal/energybased/LinearQuadtreeBuilder.h>
 #include <ogdf/internal/energybased/LinearQuadtreeExpansion.h>
 #include <ogdf/internal/energybased/WSPD.h>
+#include <chrono>
 
 
 namespace ogdf {
@@ -69,9 +70,9 @@ void FMEMultipoleKernel::quadtreeConstruction(ArrayPartition& pointPartition)
 			globalContext->max_x = max(globalContext->max_x, globalContext->pLocalContext[j]->max_x);
 			globalContext->max_y = max(globalContext->max_y, globalContext->pLocalContext[j]->max_y);
 		}
-		tree.init(globalContext->min_x, globalContext->min_y, globalContext->max_x, globalContext->max_y);
+		// keep the grid of the last iteration if possible, so the points are almost sorted already
+		tree.fitGrid(globalContext->min_x, globalContext->min_y, globalContext->max_x, globalContext->max_y);
 		globalContext->coolDown *= 0.999f;
-		tree.clear();
 	}
 	// wait because the morton number computation needs the bounding box
 	sync();
@@ -97,10 +98,8 @@ void FMEMultipoleKernel::quadtreeConstruction(ArrayPartition& pointPartition)
 	if (isSingleThreaded())
 	{
 		LinearQuadtreeBuilder builder(tree);
-		// prepare the tree
-		builder.prepareTree();
-		// and link it
-		builder.build();
+		// prepare and link the tree, keeping the parts that did not change since the last iteration
+		builder.update();
 		LQPartitioner partitioner( localContext );
 		partitioner.partition();
 	} else // the more difficult part
@@ -539,20 +538,33 @@ void FMEMultipoleKernel::operator()(FMEGlobalContext* globalContext)
 	}
 	sync();
 
+	// the main thread measures the time of the phases
+	typedef std::chrono::steady_clock Clock;
+	FMEPhaseTimes& phaseTimes = globalContext->phaseTimes;
+	Clock::time_point phaseBegin;
+	auto endPhase = [&](double& phaseTime) {
+		Clock::time_point phaseEnd = Clock::now();
+		phaseTime += std::chrono::duration<double>(phaseEnd - phaseBegin).count();
+		phaseBegin = phaseEnd;
+	};
+
 	for (uint32_t currNumIteration = 0; ((currNumIteration < maxNumIterations) && !globalContext->earlyExit); currNumIteration++)
 	{
+		if (isMainThread()) phaseBegin = Clock::now();
 		// reset the coefficients
-		for_loop_array_set(threadNr(), numThreads(), treeExp.m_multiExp, treeExp.m_numExp*(treeExp.m_numCoeff << 1), 0.0);
-		for_loop_array_set(threadNr(), numThreads(), treeExp.m_localExp, treeExp.m_numExp*(treeExp.m_numCoeff << 1), 0.0);
+		for_loop_array_set(threadNr(), numThreads(), treeExp.m_multiExp, treeExp.m_numExp*treeExp.stride(), 0.0);
+		for_loop_array_set(threadNr(), numThreads(), treeExp.m_localExp, treeExp.m_numExp*treeExp.stride(), 0.0);
 
 		localContext->maxForceSq = 0.0;
 		localContext->avgForce = 0.0;
 
+		if (isMainThread()) endPhase(phaseTimes.expansion);
 		// construct the quadtree
 		quadtreeConstruction(nodePointPartition);
 		// wait for all threads to finish
 		sync();
 
+		if (isMainThread()) endPhase(phaseTimes.build);
 		if (isSingleThreaded()) // if is single threaded run the simple approximation
 			multipoleApproxSingleThreaded(nodePointPartition);
 		else // otherwise use the partitioning
@@ -560,6 +572,8 @@ void FMEMultipoleKernel::operator()(FMEGlobalContext* globalContext)
 		// now wait until all forces are summed up in the global array and mapped to graph node order
 		sync();
 
+		if (isMainThread()) endPhase(phaseTimes.expansion);
+
 		// run the edge forces
 		for_loop(edgePartition,							// iterate over all edges and sum up the forces in the threads array
 			edge_force_function< EDGE_FORCE_DIV_DEGREE >(localContext)	// divide the forces by degree of the node to avoid oscilation
@@ -579,6 +593,9 @@ void FMEMultipoleKernel::operator()(FMEGlobalContext* globalContext)
 		// check the max force square for all threads
 		if (isMainThread())
 		{
+			endPhase(phaseTimes.force);
+			phaseTimes.numIterations++;
+
 			double maxForceSq = 0.0;
 			for (uint32_t j=0; j < numThreads(); j++)
 				maxForceSq = max(globalContext->pLocalContext[j]->maxForceSq, maxForceSq);
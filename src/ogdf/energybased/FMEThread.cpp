@@ -86,8 +86,11 @@ void FMEThread::sync()
 
 
 
-FMEThreadPool::FMEThreadPool(uint32_t numThreads) : m_numThreads(numThreads)
+FMEThreadPool::FMEThreadPool(uint32_t numThreads) : m_gang(numThreads)
 {
+	// the kernels need a power of two threads
+	m_numThreads = prevPowerOfTwo(m_gang.size());
+	m_gang.shrink(m_numThreads);
 	allocate();
 }
 
@@ -99,21 +102,9 @@ FMEThreadPool::~FMEThreadPool()
 //! runs one iteration. This call blocks the main thread
 void FMEThreadPool::runThreads()
 {
-	uint32_t nThreads = numThreads();
-
-	Array<Thread> threads(1, nThreads);
-
-	for (uint32_t i=1; i < nThreads; i++)
-	{
-		threads[i] = Thread(*thread(i));
-	}
-
-	thread(0)->operator()();
-
-	for (uint32_t i=1; i < nThreads; i++)
-	{
-		threads[i].join();
-	}
+	m_gang.run([this](unsigned int i) {
+		thread(i)->operator()();
+	});
 }
 
 
@@ -41,6 +41,7 @@
 #include <ogdf/internal/energybased/Rectangle.h>
 #include <ogdf/basic/simple_graph_alg.h>
 #include <ogdf/basic/basic.h>
+#include <ogdf/basic/TaskScheduler.h>
 
 namespace ogdf {
 
@@ -283,6 +284,7 @@ void FMMMLayout::initialize_all_options()
 	edgeLengthMeasurement(elmBoundingCircle);
 	allowedPositions(apInteger);
 	maxIntPosExponent(40);
+	numberOfThreads(1);
 
 	//setting options for the divide et impera step
 	pageRatio(1.0);
@@ -1174,9 +1176,9 @@ void FMMMLayout::create_initial_placement(Graph& G, NodeArray<NodeAttributes>& A
 	{ //(random)
 		init_boxlength_and_cornercoordinate(G, A);
 		if (initialPlacementForces() == ipfRandomTime)//(RANDOM based on actual CPU-time)
-			srand((unsigned int) time(nullptr));
+			setSeed((int) time(nullptr));
 		else if (initialPlacementForces() == ipfRandomRandIterNr)//(RANDOM based on seed)
-			srand(randSeed());
+			setSeed(randSeed());
 
 		for (node v : G.nodes)
 		{
@@ -1206,9 +1208,12 @@ void FMMMLayout::make_initialisations_for_rep_calc_classes(Graph& G)
 	else if (repulsiveForcesCalculation() == rfcGridApproximation)
 		FR.make_initialisations(boxlength, down_left_corner, frGridQuotient());
 	else //(repulsiveForcesCalculation() == rfcNMM
+	{
 		NM.make_initialisations(G, boxlength, down_left_corner,
 		nmParticlesInLeaves(), nmPrecision(),
 		nmTreeConstruction(), nmSmallCell());
+		NM.number_of_threads(numberOfThreads());
+	}
 }
 
 
@@ -1225,24 +1230,59 @@ void FMMMLayout::calculate_attractive_forces(
 	//initialisation
 	init_F(G,F_attr);
 
-	//calculation
-	for(edge e : G.edges)
-	{
+	//the force f_u on the source u of an edge e (-f_u acts on its target)
+	auto calculate_force_on_source = [&](edge e, DPoint &force) {
 		node u = e->source();
 		node v = e->target();
 		DPoint vector_v_minus_u  = A[v].get_position() - A[u].get_position();
 		double norm_v_minus_u = vector_v_minus_u.norm();
 		if(vector_v_minus_u == nullpoint)
-			f_u = nullpoint;
-		else if(!N.f_near_machine_precision(norm_v_minus_u,f_u))
+			force = nullpoint;
+		else if(!N.f_near_machine_precision(norm_v_minus_u,force))
 		{
 			double scalar = f_attr_scalar(norm_v_minus_u,E[e].get_length())/norm_v_minus_u;
-			f_u.m_x = scalar * vector_v_minus_u.m_x;
-			f_u.m_y = scalar * vector_v_minus_u.m_y;
+			force.m_x = scalar * vector_v_minus_u.m_x;
+			force.m_y = scalar * vector_v_minus_u.m_y;
 		}
+	};
 
-		F_attr[v] = F_attr[v] - f_u;
-		F_attr[u] = F_attr[u] + f_u;
+	//calculation
+	if(numberOfThreads() == 1)
+	{
+		for(edge e : G.edges)
+		{
+			calculate_force_on_source(e,f_u);
+			F_attr[e->target()] = F_attr[e->target()] - f_u;
+			F_attr[e->source()] = F_attr[e->source()] + f_u;
+		}
+	}
+	else
+	{
+		//every node sums up the forces of its incident edges, so each edge
+		//is evaluated twice, but F_attr is written for one node per task only
+		Array<node> nodes(G.numberOfNodes());
+		int k = 0;
+		for(node v : G.nodes)
+			nodes[k++] = v;
+
+		const int NODES_PER_TASK = 256;
+		TaskScheduler::global().parallelFor(0, nodes.size(), NODES_PER_TASK,
+			[&](int begin, int end) {
+				DPoint f_e;
+				for (int i = begin; i < end; ++i) {
+					node w = nodes[i];
+					for(adjEntry adj : w->adjEntries) {
+						edge e = adj->theEdge();
+						if(e->isSelfLoop())
+							continue;
+						calculate_force_on_source(e,f_e);
+						if(e->source() == w)
+							F_attr[w] = F_attr[w] + f_e;
+						else
+							F_attr[w] = F_attr[w] - f_e;
+					}
+				}
+			}, numberOfThreads());
 	}
 }
 
@@ -0,0 +1,92 @@
+/** \file
+ * \brief AVX variants of the repulsion kernels of SpringEmbedderFRExact
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.txt in the root directory of the OGDF installation for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ *
+ * \see  http://www.gnu.org/copyleft/gpl.html
+ ***************************************************************/
+
+#include <ogdf/internal/energybased/FRExactKernel.h>
+
+#ifdef OGDF_AVX_EXTENSIONS
+
+#include <immintrin.h>
+
+namespace ogdf {
+
+// This file is compiled with AVX enabled. Everything instantiated here has
+// internal linkage, so no AVX code leaks into inline functions shared with
+// other translation units.
+namespace {
+
+struct AVXDoubleOps {
+	typedef double Scalar;
+	typedef __m256d Vector;
+	static const int width = 4;
+
+	static Vector load(const Scalar *p) { return _mm256_loadu_pd(p); }
+	static void store(Scalar *p, Vector a) { _mm256_storeu_pd(p, a); }
+	static Vector set1(Scalar a) { return _mm256_set1_pd(a); }
+	static Vector zero() { return _mm256_setzero_pd(); }
+	static Vector add(Vector a, Vector b) { return _mm256_add_pd(a, b); }
+	static Vector sub(Vector a, Vector b) { return _mm256_sub_pd(a, b); }
+	static Vector mul(Vector a, Vector b) { return _mm256_mul_pd(a, b); }
+	static Vector div(Vector a, Vector b) { return _mm256_div_pd(a, b); }
+	static Vector max(Vector a, Vector b) { return _mm256_max_pd(a, b); }
+};
+
+struct AVXFloatOps {
+	typedef float Scalar;
+	typedef __m256 Vector;
+	static const int width = 8;
+
+	static Vector load(const Scalar *p) { return _mm256_loadu_ps(p); }
+	static void store(Scalar *p, Vector a) { _mm256_storeu_ps(p, a); }
+	static Vector set1(Scalar a) { return _mm256_set1_ps(a); }
+	static Vector zero() { return _mm256_setzero_ps(); }
+	static Vector add(Vector a, Vector b) { return _mm256_add_ps(a, b); }
+	static Vector sub(Vector a, Vector b) { return _mm256_sub_ps(a, b); }
+	static Vector mul(Vector a, Vector b) { return _mm256_mul_ps(a, b); }
+	static Vector div(Vector a, Vector b) { return _mm256_div_ps(a, b); }
+	static Vector max(Vector a, Vector b) { return _mm256_max_ps(a, b); }
+};
+
+}
+
+void frExactRepulsionAVX(const FRExactRepulsion<double> &r, int begin, int end, double *dispX, double *dispY)
+{
+	frExactRepulsion<AVXDoubleOps>(r, begin, end, dispX, dispY);
+}
+
+void frExactRepulsionAVX(const FRExactRepulsion<float> &r, int begin, int end, double *dispX, double *dispY)
+{
+	frExactRepulsion<AVXFloatOps>(r, begin, end, dispX, dispY);
+}
+
+} // end namespace ogdf
+
+#endif
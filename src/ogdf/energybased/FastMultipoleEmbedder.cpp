@@ -126,6 +126,7 @@ void FastMultipoleEmbedder::call(GraphAttributes &GA, const EdgeArray<float>& ed
 
 void FastMultipoleEmbedder::run(uint32_t numIterations)
 {
+	m_phaseTimes = FMEPhaseTimes();
 	if (m_pGraph->numNodes() == 0) return;
 	if (m_pGraph->numNodes() == 1)
 	{
@@ -163,6 +164,7 @@ void FastMultipoleEmbedder::runMultipole()
 {
 	FMEGlobalContext* pGlobalContext = FMEMultipoleKernel::allocateContext(m_pGraph, m_pOptions, m_threadPool->numThreads());
 	m_threadPool->runKernel<FMEMultipoleKernel>(pGlobalContext);
+	m_phaseTimes = pGlobalContext->phaseTimes;
 	FMEMultipoleKernel::deallocateContext(pGlobalContext);
 }
 
@@ -195,6 +197,7 @@ void FastMultipoleEmbedder::allocate(uint32_t numNodes, uint32_t numEdges)
 		m_numberOfThreads = prevPowerOfTwo(min<uint32_t>(m_numberOfThreads, availableThreads));
 	}
 	m_threadPool = new FMEThreadPool(m_numberOfThreads);
+	m_numberOfThreads = m_threadPool->numThreads();
 }
 
 
@@ -34,6 +34,7 @@
 
 #include <ogdf/internal/energybased/LinearQuadtree.h>
 #include <ogdf/internal/energybased/WSPD.h>
+#include <vector>
 
 namespace ogdf {
 
@@ -51,6 +52,22 @@ void LinearQuadtree::init(float min_x, float min_y, float max_x, float max_y)
 }
 
 
+bool LinearQuadtree::fitGrid(float min_x, float min_y, float max_x, float max_y)
+{
+	double sideLength = (double)max(max_x - min_x, max_y - min_y);
+	if (min_x >= m_min_x && min_y >= m_min_y
+	 && max_x <= m_min_x + m_sideLengthPoints && max_y <= m_min_y + m_sideLengthPoints
+	 && sideLength * 2.0 > m_sideLengthPoints)
+	{
+		clear();
+		return false;
+	}
+	float slack = (float)(sideLength / 8.0);
+	init(min_x - slack, min_y - slack, max_x + slack, max_y + slack);
+	return true;
+}
+
+
 void LinearQuadtree::clear()
 {
 	m_numWSP = 0;
@@ -62,6 +79,8 @@ void LinearQuadtree::clear()
 
 LinearQuadtree::LinearQuadtree(uint32_t n, float* origXPos, float* origYPos, float* origSize) : m_origXPos(origXPos), m_origYPos(origYPos), m_origSize(origSize)
 {
+	m_min_x = m_min_y = m_max_x = m_max_y = 0.0f;
+	m_sideLengthPoints = -1.0;
 	allocate(n);
 	m_numPoints = n;
 	m_maxNumNodes = 2*n;
@@ -94,6 +113,9 @@ void LinearQuadtree::allocate(uint32_t n)
 	m_notWspd = static_cast<LQWSPair*>(MALLOC_16(m_maxNumNodes*sizeof(LQWSPair) * 27));
 	m_directNodes = static_cast<NodeID*>(MALLOC_16(m_maxNumNodes*sizeof(NodeID)));
 	m_WSPD = new WSPD(m_maxNumNodes);
+	m_cellLevel = static_cast<uint8_t*>(MALLOC_16(m_numPoints*sizeof(uint8_t)));
+	m_numChangedLevels = static_cast<uint32_t*>(MALLOC_16(m_numPoints*sizeof(uint32_t)));
+	m_cellLevelsValid = false;
 }
 
 
@@ -110,6 +132,8 @@ void LinearQuadtree::deallocate()
 	FREE_16(m_notWspd);
 	FREE_16(m_directNodes);
 	delete m_WSPD;
+	FREE_16(m_cellLevel);
+	FREE_16(m_numChangedLevels);
 }
 
 
@@ -119,6 +143,7 @@ uint64_t LinearQuadtree::sizeInBytes() const
 		m_maxNumNodes*sizeof(LQNode) +
 		m_maxNumNodes*sizeof(LQWSPair)*27 +
 		m_maxNumNodes*sizeof(NodeID) +
+		m_numPoints*(sizeof(uint8_t) + sizeof(uint32_t)) +
 		m_WSPD->sizeInBytes();
 }
 
@@ -158,4 +183,50 @@ void LinearQuadtree::addDirect(NodeID s)
 	m_numDirectNodes++;
 }
 
+
+void sortByMortonNr(LinearQuadtree::LQPoint* points, uint32_t n)
+{
+	// the bits that differ between the morton numbers, only these need to be sorted
+	MortonNR anyBits = 0;
+	MortonNR allBits = ~((MortonNR)0);
+	for (uint32_t i = 0; i < n; i++)
+	{
+		anyBits |= points[i].mortonNr;
+		allBits &= points[i].mortonNr;
+	}
+	const MortonNR varyingBits = anyBits ^ allBits;
+
+	const uint32_t DIGIT_BITS = 11;
+	const MortonNR DIGIT_MASK = (((MortonNR)0x1) << DIGIT_BITS) - 1;
+	std::vector<uint32_t> offset(((size_t)DIGIT_MASK) + 1);
+	std::vector<LinearQuadtree::LQPoint> buffer;
+	LinearQuadtree::LQPoint* src = points;
+	LinearQuadtree::LQPoint* dst = nullptr;
+
+	for (uint32_t shift = 0; shift < 64 && (varyingBits >> shift); shift += DIGIT_BITS)
+	{
+		if (!((varyingBits >> shift) & DIGIT_MASK))
+			continue;
+		if (!dst) {
+			buffer.resize(n);
+			dst = buffer.data();
+		}
+		std::fill(offset.begin(), offset.end(), 0);
+		for (uint32_t i = 0; i < n; i++)
+			offset[(src[i].mortonNr >> shift) & DIGIT_MASK]++;
+		uint32_t sum = 0;
+		for (uint32_t &o : offset)
+		{
+			uint32_t count = o;
+			o = sum;
+			sum += count;
+		}
+		for (uint32_t i = 0; i < n; i++)
+			dst[offset[(src[i].mortonNr >> shift) & DIGIT_MASK]++] = src[i];
+		std::swap(src, dst);
+	}
+	if (src != points)
+		std::copy(src, src + n, points);
+}
+
 } // end of namespace ogdf
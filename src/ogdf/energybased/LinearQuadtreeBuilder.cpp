@@ -53,6 +53,7 @@ void LinearQuadtreeBuilder::prepareNodeAndLeaf(LinearQuadtree::PointID leafPos,
 void LinearQuadtreeBuilder::prepareTree(LinearQuadtree::PointID begin,  LinearQuadtree::PointID end)
 {
 	LinearQuadtree::PointID i = begin;
+	tree.m_cellLevelsValid = false;
 	firstLeaf = begin;
 	firstInner = firstLeaf+n;
 	numLeaves = 0;
@@ -76,6 +77,92 @@ void LinearQuadtreeBuilder::prepareTree()
 }
 
 
+void LinearQuadtreeBuilder::update()
+{
+	// the tree of the last update() can only be reused if it was not built otherwise in between
+	bool reuse = tree.m_cellLevelsValid && tree.m_numLeaves > 1;
+	tree.m_cellLevelsValid = false;
+
+	// compute the level of the smallest cell containing a point and its predecessor
+	// and count the positions where this level changed since the last update
+	uint32_t numChanged = 0;
+	uint32_t numLeavesTotal = 0;
+	LinearQuadtree::PointID leafPos = 0;
+	for (LinearQuadtree::PointID i = 0; i < n; i++)
+	{
+		uint8_t level = 0;
+		if (i == 0 || tree.mortonNr(i) != tree.mortonNr(i-1))
+		{
+			if (i > 0)
+				level = (uint8_t)CAL(i-1, i);
+			leafPos = i;
+			numLeavesTotal++;
+		}
+		tree.setPointLeaf(i, leafPos);
+		if (level != tree.m_cellLevel[i])
+			numChanged++;
+		tree.m_cellLevel[i] = level;
+		tree.m_numChangedLevels[i] = numChanged;
+	}
+
+	std::vector<LinearQuadtree::NodeID> unchanged;
+	if (reuse)
+		collectUnchangedSubtrees(tree.root(), unchanged);
+
+	// prepare the leaves and nodes between the unchanged subtrees and chain everything together
+	firstLeaf = 0;
+	numLeaves = 0;
+	numInnerNodes = 0;
+	LinearQuadtree::NodeID chainEnd = 0;
+	std::vector<LinearQuadtree::NodeID>::const_iterator nextUnchanged = unchanged.begin();
+	LinearQuadtree::PointID i = 0;
+	while (i < n)
+	{
+		if (nextUnchanged != unchanged.end() && tree.firstPoint(*nextUnchanged) == i)
+		{
+			LinearQuadtree::NodeID subtree = *nextUnchanged++;
+			if (chainEnd) tree.setNextNode(chainEnd, subtree); else firstInner = subtree;
+			chainEnd = subtree;
+			// the node of the last leaf of the subtree links it to the rest
+			i = tree.pointLeaf(i + tree.numberOfPoints(subtree) - 1);
+		}
+		LinearQuadtree::PointID next = i + 1;
+		while ((next < n) && (tree.m_cellLevel[next] == 0))
+			next++;
+		prepareNodeAndLeaf(i, next);
+		if (chainEnd) tree.setNextNode(chainEnd, i + n); else firstInner = i + n;
+		chainEnd = i + n;
+		i = next;
+	}
+	numLeaves = numLeavesTotal;
+
+	build();
+	tree.m_cellLevelsValid = true;
+}
+
+
+void LinearQuadtreeBuilder::collectUnchangedSubtrees(LinearQuadtree::NodeID curr, std::vector<LinearQuadtree::NodeID>& roots)
+{
+	if (tree.isLeaf(curr))
+		return;
+
+	LinearQuadtree::PointID begin = tree.firstPoint(curr);
+	LinearQuadtree::PointID end = begin + tree.numberOfPoints(curr);
+	uint32_t level = tree.level(curr);
+	// no changes inside and still separated from the neighbors on this level
+	if ((tree.m_numChangedLevels[end-1] == tree.m_numChangedLevels[begin])
+	 && ((begin == 0) || (tree.m_cellLevel[begin] > level))
+	 && ((end == n) || (tree.m_cellLevel[end] > level)))
+	{
+		roots.push_back(curr);
+	} else
+	{
+		for (uint32_t i = 0; i < tree.numberOfChilds(curr); i++)
+			collectUnchangedSubtrees(tree.child(curr, i), roots);
+	}
+}
+
+
 void LinearQuadtreeBuilder::mergeWithNext(LinearQuadtree::NodeID curr)
 {
 	LinearQuadtree::NodeID next = tree.nextNode(curr);
@@ -120,7 +207,7 @@ void LinearQuadtreeBuilder::buildHierarchy()
 {
 	tree.clear();
 	restoreChainLastNode = 0;
-	tree.m_root = buildHierarchy(n, 128);
+	tree.m_root = buildHierarchy(firstInner, 128);
 }
 
 
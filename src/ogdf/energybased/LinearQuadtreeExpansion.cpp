@@ -33,18 +33,37 @@
  ***************************************************************/
 
 #include <ogdf/internal/energybased/LinearQuadtreeExpansion.h>
-#include <ogdf/internal/energybased/ComplexDouble.h>
 #include <ogdf/internal/energybased/WSPD.h>
-#include <complex>
-
-using namespace ogdf::sse;
+#include <ogdf/basic/System.h>
 
 namespace ogdf {
 
 LinearQuadtreeExpansion::LinearQuadtreeExpansion(uint32_t precision, const LinearQuadtree& tree) : m_tree(tree), m_numCoeff(precision), binCoef(2*m_numCoeff)
 {
 	m_numExp = m_tree.maxNumberOfNodes();
+	m_tables.numCoeff = m_numCoeff;
+	m_tables.stride = ((2*m_numCoeff + FMEExpansionTables::padding - 1) / FMEExpansionTables::padding) * FMEExpansionTables::padding;
 	allocate();
+	initTables();
+
+	// use the widest vector extension supported by the CPU
+#ifdef OGDF_AVX512_EXTENSIONS
+	if (System::cpuSupports(cpufAVX512F)) {
+		m_kernels = fmeExpansionKernelsAVX512();
+		return;
+	}
+#endif
+#ifdef OGDF_AVX2_EXTENSIONS
+	if (System::cpuSupports(cpufAVX2) && System::cpuSupports(cpufFMA)) {
+		m_kernels = fmeExpansionKernelsAVX2();
+		return;
+	}
+#endif
+#ifdef OGDF_SSE2_EXTENSIONS
+	m_kernels = fmeExpansionKernels<FMESSE2DoubleOps, FMESSE2FloatOps>();
+#else
+	m_kernels = fmeExpansionKernels<FMEScalarDoubleOps, FMEScalarFloatOps>();
+#endif
 }
 
 
@@ -56,8 +75,9 @@ LinearQuadtreeExpansion::~LinearQuadtreeExpansion(void)
 
 void LinearQuadtreeExpansion::allocate()
 {
-	m_multiExp = (double*)MALLOC_16(m_numCoeff*sizeof(double)*2*m_numExp);
-	m_localExp = (double*)MALLOC_16(m_numCoeff*sizeof(double)*2*m_numExp);
+	m_multiExp = (double*)MALLOC_16(m_tables.stride*sizeof(double)*m_numExp);
+	m_localExp = (double*)MALLOC_16(m_tables.stride*sizeof(double)*m_numExp);
+	m_factors = (double*)MALLOC_16((2 + 3*m_numCoeff)*m_tables.stride*sizeof(double));
 }
 
 
@@ -65,187 +85,155 @@ void LinearQuadtreeExpansion::deallocate()
 {
 	FREE_16(m_multiExp);
 	FREE_16(m_localExp);
+	FREE_16(m_factors);
+}
+
+
+void LinearQuadtreeExpansion::initTables()
+{
+	const uint32_t p = m_numCoeff;
+	const uint32_t stride = m_tables.stride;
+	for (uint32_t i = 0; i < (2 + 3*p)*stride; i++)
+		m_factors[i] = 0.0;
+
+	double* p2m = m_factors;
+	double* l2p = p2m + stride;
+	double* m2m = l2p + stride;
+	double* m2l = m2m + p*stride;
+	double* l2l = m2l + p*stride;
+
+	// sets the factor of column k and row l in both the real and the imaginary part
+	auto set = [stride](double* table, uint32_t k, uint32_t l, double value) {
+		table[k*stride + 2*l] = table[k*stride + 2*l + 1] = value;
+	};
+
+	set(p2m, 0, 0, 1.0);
+	for (uint32_t l = 1; l < p; l++)
+	{
+		set(p2m, 0, l, -1/(double)l);
+		set(l2p, 0, l, (double)l);
+	}
+
+	for (uint32_t k = 0; k < p; k++)
+	{
+		for (uint32_t l = 0; l < p; l++)
+		{
+			// b_l = a_0 d^l (-1/l) + sum_{k=1..l} a_k d^(l-k) binom(l-1, k-1), b_0 = a_0
+			if (k == 0)
+				set(m2m, k, l, l == 0 ? 1.0 : -1/(double)l);
+			else if (k <= l)
+				set(m2m, k, l, binCoef.value(l-1, k-1));
+
+			// b_l = sum_{k=l..p-1} a_k d^(k-l) binom(k, l)
+			if (l <= k)
+				set(l2l, k, l, binCoef.value(k, l));
+
+			// b_l = (-u)^l (-a_0/l + sum_{k>0} a_k u^k binom(l+k-1, k-1)), b_0 = sum_{k>0} a_k (-u)^k
+			const double sign = (l % 2) ? -1.0 : 1.0;
+			if (k > 0)
+				set(m2l, k, l, sign*(l == 0 ? ((k % 2) ? -1.0 : 1.0) : binCoef.value(l+k-1, k-1)));
+			else if (l > 0)
+				set(m2l, k, l, -sign/(double)l);
+		}
+	}
+
+	m_tables.p2m = p2m;
+	m_tables.l2p = l2p;
+	m_tables.m2m = m2m;
+	m_tables.m2l = m2l;
+	m_tables.l2l = l2l;
 }
 
 
 void LinearQuadtreeExpansion::P2M(uint32_t point, uint32_t receiver)
 {
-	double* receiv_coeff = m_multiExp + receiver*(m_numCoeff<<1);
 	const double q = (double)m_tree.pointSize(point);
 	const double x = (double)m_tree.pointX(point);
 	const double y = (double)m_tree.pointY(point);
 	const double centerX = (double)m_tree.nodeX(receiver);
 	const double centerY = (double)m_tree.nodeY(receiver);
-	// a0 += q_i
-	receiv_coeff[0] += q;
-	// a_1..m
-	ComplexDouble ak;
-	// p - z0
-	ComplexDouble delta(ComplexDouble(x, y) - ComplexDouble(centerX, centerY));
-	// (p - z0)^k
-	ComplexDouble delta_k(delta);
-	for (uint32_t k=1; k<m_numCoeff; k++)
-	{
-		ak.load(receiv_coeff+(k<<1));
-		ak -= delta_k*(q/(double)k);
-		ak.store(receiv_coeff+(k<<1));
-		delta_k *= delta;
-	}
+	// a0 += q_i, a_k -= q_i (p - z0)^k / k
+	m_kernels.p2m(m_tables, coeff(m_multiExp, receiver), x - centerX, y - centerY, q);
 }
 
 
 void LinearQuadtreeExpansion::L2P(uint32_t source, uint32_t point, float& fx, float& fy)
 {
-	const double* source_coeff = m_localExp + source*(m_numCoeff << 1);
 	const double x = (double)m_tree.pointX(point);
 	const double y = (double)m_tree.pointY(point);
 	const double centerX = (double)m_tree.nodeX(source);
 	const double centerY = (double)m_tree.nodeY(source);
-	ComplexDouble ak;
-	ComplexDouble res;
-	ComplexDouble delta(ComplexDouble(x,y) - ComplexDouble(centerX, centerY));
-	ComplexDouble delta_k(1);
-	for (uint32_t k=1; k<m_numCoeff; k++)
-	{
-		ak.load(source_coeff+(k<<1));
-		res += ak*delta_k*(double)k;
-		delta_k *= delta;
-	}
-	res = res.conj();
-	double resTemp[2];
-	res.store_unaligned(resTemp);
+	double resX = 0.0;
+	double resY = 0.0;
+	// the conjugate of the derivative sum_k k a_k (p - z0)^(k-1)
+	m_kernels.l2p(m_tables, coeff(m_localExp, source), x - centerX, y - centerY, resX, resY);
 
-	fx -= ((float)resTemp[0]);
-	fy -= ((float)resTemp[1]);
+	fx += ((float)resX);
+	fy += ((float)resY);
 }
 
 
 void LinearQuadtreeExpansion::M2M(uint32_t source, uint32_t receiver)
 {
-	double* receiv_coeff = m_multiExp + receiver*(m_numCoeff<<1);
-	double* source_coeff = m_multiExp + source*(m_numCoeff<<1);
-
 	const double center_x_source   = (double)m_tree.nodeX(source);
 	const double center_y_source   = (double)m_tree.nodeY(source);
 	const double center_x_receiver = (double)m_tree.nodeX(receiver);
 	const double center_y_receiver = (double)m_tree.nodeY(receiver);
 
-	ComplexDouble delta(ComplexDouble(center_x_source, center_y_source) - ComplexDouble(center_x_receiver, center_y_receiver));
-
-	ComplexDouble a(source_coeff);
-	ComplexDouble b(receiv_coeff);
-	b += a;
-	b.store(receiv_coeff);
-	for (uint32_t l=1;l<m_numCoeff;l++)
-	{
-		b.load(receiv_coeff+(l<<1));
-		ComplexDouble delta_k(1.0,0.0);
-		for (uint32_t k=0;k<l;k++)
-		{
-			a.load(source_coeff+((l-k)<<1));
-			b += a*delta_k*binCoef.value(l-1, k);
-			delta_k *= delta;
-		}
-		a.load(source_coeff);
-		b -= a*delta_k*(1/(double)l);
-		b.store(receiv_coeff+(l<<1));
-	}
+	m_kernels.m2m(m_tables, coeff(m_multiExp, receiver), coeff(m_multiExp, source),
+		center_x_source - center_x_receiver, center_y_source - center_y_receiver);
 }
 
 
 void LinearQuadtreeExpansion::L2L(uint32_t source, uint32_t receiver)
 {
-	double* receiv_coeff = m_localExp + receiver*(m_numCoeff<<1);
-	double* source_coeff = m_localExp + source*(m_numCoeff<<1);
-
 	const double center_x_source   = (double)m_tree.nodeX(source);
 	const double center_y_source   = (double)m_tree.nodeY(source);
 	const double center_x_receiver = (double)m_tree.nodeX(receiver);
 	const double center_y_receiver = (double)m_tree.nodeY(receiver);
 
-	ComplexDouble center_receiver(center_x_receiver, center_y_receiver);
-	ComplexDouble center_source(center_x_source, center_y_source);
-	ComplexDouble delta(center_source - center_receiver);
-
-	for (uint32_t l=0;l<m_numCoeff;l++)
-	{
-		ComplexDouble b(receiv_coeff+(l<<1));
-		ComplexDouble delta_k(1.0,0.0);
-		for (uint32_t k=l;k<m_numCoeff;k++)
-		{
-			ComplexDouble a(source_coeff+(k<<1));
-			b += a*delta_k*binCoef.value(k, l);
-			delta_k *= delta;
-		}
-		b.store(receiv_coeff+(l<<1));
-	}
+	m_kernels.l2l(m_tables, coeff(m_localExp, receiver), coeff(m_localExp, source),
+		center_x_source - center_x_receiver, center_y_source - center_y_receiver);
 }
 
 
 void LinearQuadtreeExpansion::M2L(uint32_t source, uint32_t receiver)
 {
-	double* receiv_coeff = m_localExp + receiver*(m_numCoeff<<1);
-	double* source_coeff = m_multiExp + source*(m_numCoeff<<1);
+	double* receiv_coeff = coeff(m_localExp, receiver);
+	const double* source_coeff = coeff(m_multiExp, source);
 
 	const float center_x_source   = (float)m_tree.nodeX(source);
 	const float center_y_source   = (float)m_tree.nodeY(source);
 	const float center_x_receiver = (float)m_tree.nodeX(receiver);
 	const float center_y_receiver = (float)m_tree.nodeY(receiver);
 
-	ComplexDouble center_receiver(center_x_receiver, center_y_receiver);
-	ComplexDouble center_source(center_x_source, center_y_source);
-	ComplexDouble delta0(center_source - center_receiver);
-
-	ComplexDouble delta1 = -delta0;
-	ComplexDouble delta1_l(delta1);
-	ComplexDouble a;
-	ComplexDouble a0(source_coeff);
-	ComplexDouble b;
-	ComplexDouble sum;
-	for (uint32_t l=1;l<m_numCoeff;l++)
-	{
-		b.load(receiv_coeff+(l<<1));
-		sum = a0*(-1/(double)l);
-		ComplexDouble delta0_k(delta0);
-		for (uint32_t k=1;k<m_numCoeff;k++)
-		{
-			a.load(source_coeff+(k<<1));
-			sum += (a*binCoef.value(l+k-1, k-1)) / delta0_k;
-			delta0_k *= delta0;
-		}
+	const double deltaX = (double)center_x_source - (double)center_x_receiver;
+	const double deltaY = (double)center_y_source - (double)center_y_receiver;
+	m_kernels.m2l(m_tables, receiv_coeff, source_coeff, deltaX, deltaY);
 
-		b += sum/delta1_l;
-		b.store(receiv_coeff+(l<<1));
-		delta1_l *= delta1;
-	}
+	// b0 += a0*log(z1 - z0)
+	double r = sqrt(deltaX*deltaX + deltaY*deltaY);
+	double phi = atan((center_x_receiver - center_x_source)/(center_y_receiver - center_y_source));
+	receiv_coeff[0] += source_coeff[0]*log(r) - source_coeff[1]*phi;
+	receiv_coeff[1] += source_coeff[0]*phi + source_coeff[1]*log(r);
+}
 
-	// b0
-	b.load(receiv_coeff);
-	//std::complex<double> sdelta(m_center[(receiver<<1)] - m_center[(source<<1)],  m_center[(receiver<<1)+1] - m_center[(source<<1) +1]);//, m_x[receiver] - m_x[source], m_y[receiver] - m_y[source]);
-	/*std::complex<double> sdelta(center_x_receiver - center_x_source,
-								center_y_receiver - center_y_source);//, m_x[receiver] - m_x[source], m_y[receiver] - m_y[source]);
 
-	if ((sdelta.real() <=0) && (sdelta.imag() == 0)) //no cont. compl. log fct exists !!!
-		sdelta = log(sdelta + 0.00000001);
-	else
-		sdelta = log(sdelta);
+void LinearQuadtreeExpansion::P2P(uint32_t node, float* fx, float* fy)
+{
+	const uint32_t offset = m_tree.firstPoint(node);
+	m_kernels.direct(m_tree.pointX() + offset, m_tree.pointY() + offset, m_tree.pointSize() + offset,
+		fx + offset, fy + offset, m_tree.numberOfPoints(node));
+}
 
-	*/
-	double r = delta1.length();//= sqrt(sdelta.real()*sdelta.real()+sdelta.imag()*sdelta.imag());
-	double phi = atan((center_x_receiver - center_x_source)/(center_y_receiver - center_y_source));
-	// sum = a0*log(z1 - z0)
-	b += a0*ComplexDouble(log(r), phi);
-	// (z1 - z0)^1
-	//b += a0*ComplexDouble(sdelta.real(), sdelta.imag());
-	delta1_l = delta1;
-	for (uint32_t k=1;k<m_numCoeff;k++)
-	{
-		a.load(source_coeff+(k<<1));
-		b += a/delta1_l;
-		//(z1 - z0)^k
-		delta1_l *= delta1;
-	}
-	b.store(receiv_coeff);
+
+void LinearQuadtreeExpansion::P2P(uint32_t nodeA, uint32_t nodeB, float* fx, float* fy)
+{
+	const uint32_t offsetA = m_tree.firstPoint(nodeA);
+	const uint32_t offsetB = m_tree.firstPoint(nodeB);
+	m_kernels.directPair(
+		m_tree.pointX() + offsetA, m_tree.pointY() + offsetA, m_tree.pointSize() + offsetA, fx + offsetA, fy + offsetA, m_tree.numberOfPoints(nodeA),
+		m_tree.pointX() + offsetB, m_tree.pointY() + offsetB, m_tree.pointSize() + offsetB, fx + offsetB, fy + offsetB, m_tree.numberOfPoints(nodeB));
 }
 
 } // end of namespace ogdf
@@ -223,7 +223,7 @@ int MultilevelGraph::getLevel()
 {
 	if (m_changes.size() == 0)
 	{
-		return 0;
+		return (int)m_compactLevels.size();
 	}
 	else
 	{
@@ -764,6 +764,152 @@ void MultilevelGraph::updateReverseIndizes()
 }
 
 
+void MultilevelGraph::compactGraph(CompactGraph &CG) const
+{
+	const int n = m_G->numberOfNodes();
+	const int m = m_G->numberOfEdges();
+	NodeArray<int> pos(*m_G);
+
+	CG.m_nodeIndex.resize(n);
+	CG.m_radius.resize(n);
+	CG.m_mergeWeight.resize(n);
+	int i = 0;
+	for(node v : m_G->nodes) {
+		pos[v] = i;
+		CG.m_nodeIndex[i] = v->index();
+		CG.m_radius[i] = m_radius[v];
+		CG.m_mergeWeight[i] = m_reverseNodeMergeWeight[v->index()];
+		i++;
+	}
+
+	CG.m_edgeIndex.resize(m);
+	CG.m_weight.resize(m);
+	CG.m_source.resize(m);
+	CG.m_target.resize(m);
+	CG.m_adjStart.assign(n+1, 0);
+	int k = 0;
+	for(edge e : m_G->edges) {
+		int s = pos[e->source()];
+		int t = pos[e->target()];
+		CG.m_edgeIndex[k] = e->index();
+		CG.m_weight[k] = m_weight[e];
+		CG.m_source[k] = s;
+		CG.m_target[k] = t;
+		if (s != t) {
+			CG.m_adjStart[s+1]++;
+			CG.m_adjStart[t+1]++;
+		}
+		k++;
+	}
+
+	for (i = 0; i < n; i++) {
+		CG.m_adjStart[i+1] += CG.m_adjStart[i];
+	}
+	CG.m_adjNode.resize(CG.m_adjStart[n]);
+	CG.m_adjEdge.resize(CG.m_adjStart[n]);
+	std::vector<int> next(CG.m_adjStart.begin(), CG.m_adjStart.end() - 1);
+	for (k = 0; k < m; k++) {
+		int s = CG.m_source[k];
+		int t = CG.m_target[k];
+		if (s != t) {
+			CG.m_adjNode[next[s]] = t;
+			CG.m_adjEdge[next[s]++] = k;
+			CG.m_adjNode[next[t]] = s;
+			CG.m_adjEdge[next[t]++] = k;
+		}
+	}
+}
+
+
+void MultilevelGraph::contract(std::vector<CompactLevel> &levels, const CompactGraph &coarsest)
+{
+	OGDF_ASSERT(m_changes.empty());
+	OGDF_ASSERT(!levels.empty());
+	OGDF_ASSERT(levels.front().m_graph.numberOfNodes() == m_G->numberOfNodes());
+
+	std::vector<bool> isKept(m_reverseNodeIndex.size(), false);
+	for (int index : coarsest.m_nodeIndex) {
+		isKept[index] = true;
+	}
+
+	edge eNext;
+	for (edge e = m_G->firstEdge(); e != nullptr; e = eNext) {
+		eNext = e->succ();
+		m_reverseEdgeIndex[e->index()] = nullptr;
+		m_G->delEdge(e);
+	}
+
+	node vNext;
+	for (node v = m_G->firstNode(); v != nullptr; v = vNext) {
+		vNext = v->succ();
+		if (!isKept[v->index()]) {
+			m_reverseNodeIndex[v->index()] = nullptr;
+			m_G->delNode(v);
+		}
+	}
+
+	for (int i = 0; i < coarsest.numberOfNodes(); i++) {
+		int index = coarsest.m_nodeIndex[i];
+		m_radius[index] = coarsest.m_radius[i];
+		m_reverseNodeMergeWeight[index] = coarsest.m_mergeWeight[i];
+	}
+
+	for (int k = 0; k < coarsest.numberOfEdges(); k++) {
+		int index = coarsest.m_edgeIndex[k];
+		edge e = m_G->newEdge(
+		  m_reverseNodeIndex[coarsest.m_nodeIndex[coarsest.m_source[k]]],
+		  m_reverseNodeIndex[coarsest.m_nodeIndex[coarsest.m_target[k]]],
+		  index);
+		m_reverseEdgeIndex[index] = e;
+		m_weight[e] = coarsest.m_weight[k];
+	}
+
+	for (CompactLevel &level : levels) {
+		m_compactLevels.push_back(std::move(level));
+	}
+	levels.clear();
+}
+
+
+void MultilevelGraph::expandCompactLevel(std::vector<node> &inserted, std::vector<node> &representatives)
+{
+	OGDF_ASSERT(!m_compactLevels.empty());
+	const CompactLevel &level = m_compactLevels.back();
+	const CompactGraph &CG = level.m_graph;
+
+	edge eNext;
+	for (edge e = m_G->firstEdge(); e != nullptr; e = eNext) {
+		eNext = e->succ();
+		m_reverseEdgeIndex[e->index()] = nullptr;
+		m_G->delEdge(e);
+	}
+
+	for (int i = 0; i < CG.numberOfNodes(); i++) {
+		int index = CG.m_nodeIndex[i];
+		if (m_reverseNodeIndex[index] == nullptr) {
+			node v = m_G->newNode(index);
+			m_reverseNodeIndex[index] = v;
+			inserted.push_back(v);
+			representatives.push_back(m_reverseNodeIndex[level.m_parent[i]]);
+		}
+		m_radius[index] = CG.m_radius[i];
+		m_reverseNodeMergeWeight[index] = CG.m_mergeWeight[i];
+	}
+
+	for (int k = 0; k < CG.numberOfEdges(); k++) {
+		int index = CG.m_edgeIndex[k];
+		edge e = m_G->newEdge(
+		  m_reverseNodeIndex[CG.m_nodeIndex[CG.m_source[k]]],
+		  m_reverseNodeIndex[CG.m_nodeIndex[CG.m_target[k]]],
+		  index);
+		m_reverseEdgeIndex[index] = e;
+		m_weight[e] = CG.m_weight[k];
+	}
+
+	m_compactLevels.pop_back();
+}
+
+
 void MultilevelGraph::writeGML(ostream &os)
 {
 	GraphAttributes GA(*m_G);
@@ -36,6 +36,7 @@
 #include <ogdf/internal/energybased/NewMultipoleMethod.h>
 #include <ogdf/energybased/FMMMLayout.h>
 #include <ogdf/basic/Math.h>
+#include <ogdf/basic/TaskScheduler.h>
 #include <ogdf/internal/energybased/numexcept.h>
 
 
@@ -56,6 +57,7 @@ using std::complex;
 NewMultipoleMethod::NewMultipoleMethod()
   : MIN_NODE_NUMBER(175)
   , using_NMM(true)
+  , _number_of_threads(1)
   , max_power_of_2_index(30)
 {
 	//setting predefined parameters
@@ -87,24 +89,45 @@ void NewMultipoleMethod::calculate_repulsive_forces_by_NMM(
 	NodeArray<DPoint> F_direct(G);
 	NodeArray<DPoint> F_local_exp(G);
 	NodeArray<DPoint> F_multipole_exp(G);
-	List<QuadTreeNodeNM*> quad_tree_leaves;
 
 	//initializations
 
 	for(node v : G.nodes)
 		F_direct[v]=F_local_exp[v]=F_multipole_exp[v]=nullpoint;
 
-	quad_tree_leaves.clear();
 	if(tree_construction_way() == FMMMLayout::rtcPathByPath)
 		build_up_red_quad_tree_path_by_path(G,A,T);
 	else //tree_construction_way == FMMMLayout::rtcSubtreeBySubtree
 		build_up_red_quad_tree_subtree_by_subtree(G,A,T);
 
-	form_multipole_expansions(A,T,quad_tree_leaves);
-	calculate_local_expansions_and_WSPRLS(A,T.get_root_ptr());
-	transform_local_exp_to_forces(A,quad_tree_leaves,F_local_exp);
-	transform_multipole_exp_to_forces(A,quad_tree_leaves,F_multipole_exp);
-	calculate_neighbourcell_forces(A,quad_tree_leaves,F_direct);
+	if(number_of_threads() == 1)
+	{
+		List<QuadTreeNodeNM*> quad_tree_leaves;
+		form_multipole_expansions(A,T,quad_tree_leaves);
+		calculate_local_expansions_and_WSPRLS(A,T.get_root_ptr());
+		transform_local_exp_to_forces(A,quad_tree_leaves,F_local_exp);
+		transform_multipole_exp_to_forces(A,quad_tree_leaves,F_multipole_exp);
+		calculate_neighbourcell_forces(A,quad_tree_leaves,F_direct);
+	}
+	else
+	{
+		//the tree is built sequentially; every leaf writes only the forces of the
+		//nodes it contains, so the leaves are processed in parallel
+		ArrayBuffer<QuadTreeNodeNM*> quad_tree_leaves;
+		form_multipole_expansions_in_parallel(A,T,quad_tree_leaves);
+		calculate_local_expansions_and_WSPRLS_in_parallel(A,T.get_root_ptr());
+
+		const int LEAVES_PER_TASK = 16;
+		TaskScheduler::global().parallelFor(0, quad_tree_leaves.size(), LEAVES_PER_TASK,
+			[&](int begin, int end) {
+				for (int i = begin; i < end; ++i) {
+					const QuadTreeNodeNM *leaf_ptr = quad_tree_leaves[i];
+					transform_local_exp_to_forces_of_leaf(A,leaf_ptr,F_local_exp);
+					transform_multipole_exp_to_forces_of_leaf(A,leaf_ptr,F_multipole_exp);
+					calculate_neighbourcell_forces_of_leaf(A,leaf_ptr,F_direct);
+				}
+			}, number_of_threads());
+	}
 	add_rep_forces(G,F_direct,F_multipole_exp,F_local_exp,F_rep);
 
 	delete_red_quad_tree_and_count_treenodes(T);
@@ -2035,6 +2058,54 @@ void NewMultipoleMethod::form_multipole_expansion_of_subtree(
 }
 
 
+void NewMultipoleMethod::form_multipole_expansions_in_parallel(
+	NodeArray<NodeAttributes>& A,
+	QuadTreeNM& T,
+	ArrayBuffer<QuadTreeNodeNM*>& quad_tree_leaves)
+{
+	//the centers are waggled by random numbers, so they are set sequentially in
+	//the same order as by form_multipole_expansions()
+	ArrayBuffer<QuadTreeNodeNM*> postorder;
+	init_expansions_of_subtree(T.get_root_ptr(),postorder);
+
+	for (QuadTreeNodeNM *act_ptr : postorder)
+		if (act_ptr->is_leaf())
+			quad_tree_leaves.push(act_ptr);
+
+	const int LEAVES_PER_TASK = 16;
+	TaskScheduler::global().parallelFor(0, quad_tree_leaves.size(), LEAVES_PER_TASK,
+		[&](int begin, int end) {
+			for (int i = begin; i < end; ++i)
+				form_multipole_expansion_of_leaf_node(A,quad_tree_leaves[i]);
+		}, number_of_threads());
+
+	//in postorder every expansion is complete before it is shifted to its father
+	for (QuadTreeNodeNM *act_ptr : postorder)
+		if (!act_ptr->is_root())
+			add_shifted_expansion_to_father_expansion(act_ptr);
+}
+
+
+void NewMultipoleMethod::init_expansions_of_subtree(
+	QuadTreeNodeNM* act_ptr,
+	ArrayBuffer<QuadTreeNodeNM*>& postorder)
+{
+	init_expansion_Lists(act_ptr);
+	set_center(act_ptr);
+
+	if(act_ptr->child_lt_exists())
+		init_expansions_of_subtree(act_ptr->get_child_lt_ptr(),postorder);
+	if(act_ptr->child_rt_exists())
+		init_expansions_of_subtree(act_ptr->get_child_rt_ptr(),postorder);
+	if(act_ptr->child_lb_exists())
+		init_expansions_of_subtree(act_ptr->get_child_lb_ptr(),postorder);
+	if(act_ptr->child_rb_exists())
+		init_expansions_of_subtree(act_ptr->get_child_rb_ptr(),postorder);
+
+	postorder.push(act_ptr);
+}
+
+
 inline void NewMultipoleMethod::init_expansion_Lists(QuadTreeNodeNM* act_ptr)
 {
 	int i;
@@ -2134,6 +2205,61 @@ void NewMultipoleMethod::add_shifted_expansion_to_father_expansion(QuadTreeNodeN
 void NewMultipoleMethod::calculate_local_expansions_and_WSPRLS(
 	NodeArray<NodeAttributes>&A,
 	QuadTreeNodeNM* act_node_ptr)
+{
+	calculate_local_expansion_and_WSPRLS_of_node(A,act_node_ptr);
+
+	//recursive calls if act_node is not a leaf
+	if(!act_node_ptr->is_leaf())
+	{
+		if(act_node_ptr->child_lt_exists())
+			calculate_local_expansions_and_WSPRLS(A,act_node_ptr->get_child_lt_ptr());
+		if(act_node_ptr->child_rt_exists())
+			calculate_local_expansions_and_WSPRLS(A,act_node_ptr->get_child_rt_ptr());
+		if(act_node_ptr->child_lb_exists())
+			calculate_local_expansions_and_WSPRLS(A,act_node_ptr->get_child_lb_ptr());
+		if(act_node_ptr->child_rb_exists())
+			calculate_local_expansions_and_WSPRLS(A,act_node_ptr->get_child_rb_ptr());
+	}
+}
+
+
+void NewMultipoleMethod::calculate_local_expansions_and_WSPRLS_in_parallel(
+	NodeArray<NodeAttributes>&A,
+	QuadTreeNodeNM* root_ptr)
+{
+	//a treenode only needs the lists and the local expansion of its father
+	ArrayBuffer<QuadTreeNodeNM*> act_level, next_level;
+	act_level.push(root_ptr);
+
+	while(!act_level.empty())
+	{
+		const int TREENODES_PER_TASK = 8;
+		TaskScheduler::global().parallelFor(0, act_level.size(), TREENODES_PER_TASK,
+			[&](int begin, int end) {
+				for (int i = begin; i < end; ++i)
+					calculate_local_expansion_and_WSPRLS_of_node(A,act_level[i]);
+			}, number_of_threads());
+
+		next_level.clear();
+		for (QuadTreeNodeNM *act_node_ptr : act_level)
+		{
+			if(act_node_ptr->child_lt_exists())
+				next_level.push(act_node_ptr->get_child_lt_ptr());
+			if(act_node_ptr->child_rt_exists())
+				next_level.push(act_node_ptr->get_child_rt_ptr());
+			if(act_node_ptr->child_lb_exists())
+				next_level.push(act_node_ptr->get_child_lb_ptr());
+			if(act_node_ptr->child_rb_exists())
+				next_level.push(act_node_ptr->get_child_rb_ptr());
+		}
+		std::swap(act_level, next_level);
+	}
+}
+
+
+void NewMultipoleMethod::calculate_local_expansion_and_WSPRLS_of_node(
+	NodeArray<NodeAttributes>&A,
+	QuadTreeNodeNM* act_node_ptr)
 {
 	List<QuadTreeNodeNM*> I,L,L2,E,D1,D2,M;
 	QuadTreeNodeNM *selected_node_ptr;
@@ -2213,23 +2339,11 @@ void NewMultipoleMethod::calculate_local_expansions_and_WSPRLS(
 	for (QuadTreeNodeNM *ptr : L2)
 		add_local_expansion_of_leaf(A,ptr,act_node_ptr);
 
-	//Step 4: recursive calls if act_node is not a leaf
-	if(!act_node_ptr->is_leaf())
-	{
-		if(act_node_ptr->child_lt_exists())
-			calculate_local_expansions_and_WSPRLS(A,act_node_ptr->get_child_lt_ptr());
-		if(act_node_ptr->child_rt_exists())
-			calculate_local_expansions_and_WSPRLS(A,act_node_ptr->get_child_rt_ptr());
-		if(act_node_ptr->child_lb_exists())
-			calculate_local_expansions_and_WSPRLS(A,act_node_ptr->get_child_lb_ptr());
-		if(act_node_ptr->child_rb_exists())
-			calculate_local_expansions_and_WSPRLS(A,act_node_ptr->get_child_rb_ptr());
-	}
-
-	//Step 5: WSPRLS(Well Separateness Preserving Refinement of leaf surroundings)
+	//Step 4: WSPRLS(Well Separateness Preserving Refinement of leaf surroundings)
 	//if act_node is a leaf than calculate the list D1,D2 and M from I and D1
-	else // *act_node_ptr is a leaf
-	{//else
+	//(the recursive calls for interior nodes are made by the caller)
+	if(act_node_ptr->is_leaf())
+	{//if
 		act_node_ptr->get_D1(D1);
 		act_node_ptr->get_D2(D2);
 
@@ -2264,7 +2378,7 @@ void NewMultipoleMethod::calculate_local_expansions_and_WSPRLS(
 		act_node_ptr->set_D1(D1);
 		act_node_ptr->set_D2(D2);
 		act_node_ptr->set_M(M);
-	}//else
+	}//if
 }
 
 
@@ -2505,6 +2619,16 @@ void NewMultipoleMethod::transform_local_exp_to_forces(
 	NodeArray <NodeAttributes>&A,
 	List<QuadTreeNodeNM*>& quad_tree_leaves,
 	NodeArray<DPoint>& F_local_exp)
+{
+	for(const QuadTreeNodeNM *leaf_ptr : quad_tree_leaves)
+		transform_local_exp_to_forces_of_leaf(A,leaf_ptr,F_local_exp);
+}
+
+
+void NewMultipoleMethod::transform_local_exp_to_forces_of_leaf(
+	NodeArray <NodeAttributes>&A,
+	const QuadTreeNodeNM* leaf_ptr,
+	NodeArray<DPoint>& F_local_exp)
 {
 	complex<double> sum;
 	complex<double> complex_null (0,0);
@@ -2516,27 +2640,24 @@ void NewMultipoleMethod::transform_local_exp_to_forces(
 	//and evaluate it for each node in contained_nodes()
 	//and transform the complex number back to the real-world, to obtain the force
 
-	for(const QuadTreeNodeNM *leaf_ptr : quad_tree_leaves)
-	{
-		List<node> contained_nodes;
-		leaf_ptr->get_contained_nodes(contained_nodes);
-		z_0 = leaf_ptr->get_Sm_center();
+	List<node> contained_nodes;
+	leaf_ptr->get_contained_nodes(contained_nodes);
+	z_0 = leaf_ptr->get_Sm_center();
 
-		for(node v : contained_nodes)
+	for(node v : contained_nodes)
+	{
+		complex<double> z_v (A[v].get_x(),A[v].get_y());
+		sum = complex_null;
+		z_v_minus_z_0_over_k_minus_1 = 1;
+		for(int k=1; k<=precision(); k++)
 		{
-			complex<double> z_v (A[v].get_x(),A[v].get_y());
-			sum = complex_null;
-			z_v_minus_z_0_over_k_minus_1 = 1;
-			for(int k=1; k<=precision(); k++)
-			{
-				sum += double(k) * leaf_ptr->get_local_exp()[k] *
-					z_v_minus_z_0_over_k_minus_1;
-				z_v_minus_z_0_over_k_minus_1 *= z_v - z_0;
-			}
-			force_vector.m_x = sum.real();
-			force_vector.m_y = (-1) * sum.imag();
-			F_local_exp[v] = force_vector;
+			sum += double(k) * leaf_ptr->get_local_exp()[k] *
+				z_v_minus_z_0_over_k_minus_1;
+			z_v_minus_z_0_over_k_minus_1 *= z_v - z_0;
 		}
+		force_vector.m_x = sum.real();
+		force_vector.m_y = (-1) * sum.imag();
+		F_local_exp[v] = force_vector;
 	}
 }
 
@@ -2545,46 +2666,53 @@ void NewMultipoleMethod::transform_multipole_exp_to_forces(
 	NodeArray<NodeAttributes>& A,
 	List<QuadTreeNodeNM*>& quad_tree_leaves,
 	NodeArray<DPoint>& F_multipole_exp)
+{
+	for(const QuadTreeNodeNM *act_leaf_ptr : quad_tree_leaves)
+		transform_multipole_exp_to_forces_of_leaf(A,act_leaf_ptr,F_multipole_exp);
+}
+
+
+void NewMultipoleMethod::transform_multipole_exp_to_forces_of_leaf(
+	NodeArray<NodeAttributes>& A,
+	const QuadTreeNodeNM* act_leaf_ptr,
+	NodeArray<DPoint>& F_multipole_exp)
 {
 	complex<double> sum;
 	complex<double> z_0;
 	complex<double> z_v_minus_z_0_over_minus_k_minus_1;
 	DPoint force_vector;
 
-	//for each leaf u in the M-List of an actual leaf v do:
+	//for each leaf u in the M-List of the actual leaf v do:
 	//calculate derivative of the multipole expansion function at u
 	//and evaluate it for each node in v.get_contained_nodes()
 	//and transform the complex number back to the real-world, to obtain the force
 
-	for(QuadTreeNodeNM *act_leaf_ptr : quad_tree_leaves)
-	{
-		List<node> act_contained_nodes;
-		act_leaf_ptr->get_contained_nodes(act_contained_nodes);
+	List<node> act_contained_nodes;
+	act_leaf_ptr->get_contained_nodes(act_contained_nodes);
 
-		List<QuadTreeNodeNM*> M;
-		act_leaf_ptr->get_M(M);
+	List<QuadTreeNodeNM*> M;
+	act_leaf_ptr->get_M(M);
 
-		for(const QuadTreeNodeNM *M_node_ptr : M)
+	for(const QuadTreeNodeNM *M_node_ptr : M)
+	{
+		z_0 = M_node_ptr->get_Sm_center();
+		for(node v : act_contained_nodes)
 		{
-			z_0 = M_node_ptr->get_Sm_center();
-			for(node v : act_contained_nodes)
+			complex<double> z_v (A[v].get_x(),A[v].get_y());
+			z_v_minus_z_0_over_minus_k_minus_1 = 1.0/(z_v-z_0);
+			sum = M_node_ptr->get_multipole_exp()[0]*
+				z_v_minus_z_0_over_minus_k_minus_1;
+
+			for(int k=1; k<=precision(); k++)
 			{
-				complex<double> z_v (A[v].get_x(),A[v].get_y());
-				z_v_minus_z_0_over_minus_k_minus_1 = 1.0/(z_v-z_0);
-				sum = M_node_ptr->get_multipole_exp()[0]*
+				z_v_minus_z_0_over_minus_k_minus_1 /= z_v - z_0;
+				sum -= double(k) * M_node_ptr->get_multipole_exp()[k] *
 					z_v_minus_z_0_over_minus_k_minus_1;
-
-				for(int k=1; k<=precision(); k++)
-				{
-					z_v_minus_z_0_over_minus_k_minus_1 /= z_v - z_0;
-					sum -= double(k) * M_node_ptr->get_multipole_exp()[k] *
-						z_v_minus_z_0_over_minus_k_minus_1;
-				}
-				force_vector.m_x = sum.real();
-				force_vector.m_y = (-1) * sum.imag();
-				F_multipole_exp[v] =  F_multipole_exp[v] + force_vector;
-
 			}
+			force_vector.m_x = sum.real();
+			force_vector.m_y = (-1) * sum.imag();
+			F_multipole_exp[v] =  F_multipole_exp[v] + force_vector;
+
 		}
 	}
 }
@@ -2744,6 +2872,87 @@ void NewMultipoleMethod::calculate_neighbourcell_forces(
 }
 
 
+//! Returns a short vector whose direction depends only on the (unordered) pair of
+//! indices \a i and \a j; it replaces the random distinct position of a node at
+//! the same position as another one in parallel NMM.
+static DPoint separating_vector(int i, int j)
+{
+	unsigned int hash = (unsigned int)min(i,j) * 0x9E3779B1u ^ (unsigned int)max(i,j) * 0x85EBCA6Bu;
+	hash ^= hash >> 15;
+	double angle = hash * (2 * Math::pi / 4294967296.0);
+	const double length = 0.005; //inside the radius used by numexcept
+	return DPoint(length * cos(angle), length * sin(angle));
+}
+
+
+void NewMultipoleMethod::calculate_neighbourcell_forces_of_leaf(
+	NodeArray<NodeAttributes>& A,
+	const QuadTreeNodeNM* act_leaf,
+	NodeArray<DPoint>& F_direct)
+{
+	List<node> act_contained_nodes,other_contained_nodes;
+	List<QuadTreeNodeNM*> other_leaves;
+	DPoint vector_v_minus_u;
+	double norm_v_minus_u,scalar;
+
+	act_leaf->get_contained_nodes(act_contained_nodes);
+
+	if(act_contained_nodes.size() <= particles_in_leaves())
+	{//if (usual case)
+		//unlike calculate_neighbourcell_forces() every pair is handled for both
+		//nodes, so F_direct is only written for the nodes of act_leaf
+		auto add_force_of_u_on_v = [&](node u, node v) {
+			const DPoint& pos_u = A[u].get_position();
+			const DPoint& pos_v = A[v].get_position();
+			if (pos_u == pos_v)
+			{//(Exception handling if two nodes have the same position)
+				vector_v_minus_u = separating_vector(u->index(),v->index());
+				if (v->index() < u->index())
+					vector_v_minus_u = DPoint(0,0) - vector_v_minus_u;
+			}
+			else
+				vector_v_minus_u = pos_v - pos_u;
+			norm_v_minus_u = vector_v_minus_u.norm();
+			scalar = f_rep_scalar(norm_v_minus_u)/norm_v_minus_u;
+			F_direct[v].m_x += scalar * vector_v_minus_u.m_x;
+			F_direct[v].m_y += scalar * vector_v_minus_u.m_y;
+		};
+
+		//Step 1: calculate forces inside act_contained_nodes
+		for(node v : act_contained_nodes)
+			for(node u : act_contained_nodes)
+				if(u != v)
+					add_force_of_u_on_v(u,v);
+
+		//Step 2: calculate forces of the nodes of the leaves in act_leaf->get_D1()
+		//and act_leaf->get_D2()
+		act_leaf->get_D1(other_leaves);
+		List<QuadTreeNodeNM*> non_neighboured_leaves;
+		act_leaf->get_D2(non_neighboured_leaves);
+		other_leaves.conc(non_neighboured_leaves);
+
+		for(const QuadTreeNodeNM *other_leaf : other_leaves)
+		{
+			other_leaf->get_contained_nodes(other_contained_nodes);
+			for(node v : act_contained_nodes)
+				for(node u : other_contained_nodes)
+					add_force_of_u_on_v(u,v);
+		}
+	}//if(usual case)
+	else //special case (more then particles_in_leaves() particles at the same position)
+	{//else
+		for(node v : act_contained_nodes)
+		{
+			vector_v_minus_u = separating_vector(v->index(),v->index());
+			norm_v_minus_u = vector_v_minus_u.norm();
+			scalar = f_rep_scalar(norm_v_minus_u)/norm_v_minus_u;
+			F_direct[v].m_x += scalar * vector_v_minus_u.m_x;
+			F_direct[v].m_y += scalar * vector_v_minus_u.m_y;
+		}
+	}//else
+}
+
+
 inline void NewMultipoleMethod::add_rep_forces(
 	const Graph& G,
 	NodeArray<DPoint>& F_direct,
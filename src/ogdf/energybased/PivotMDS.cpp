@@ -33,6 +33,11 @@
  ***************************************************************/
 
 #include <ogdf/energybased/PivotMDS.h>
+#include <ogdf/basic/CSRGraph.h>
+#include <ogdf/basic/TaskScheduler.h>
+#include <ogdf/basic/Thread.h>
+#include <ogdf/internal/basic/intrinsics.h>
+#include <functional>
 
 
 namespace ogdf {
@@ -41,6 +46,137 @@ const double PivotMDS::EPSILON = 1 - 1e-10;
 const double PivotMDS::FACTOR = -0.5;
 
 
+// Returns the number of threads to be used if \a numThreads are requested (0 = one per core).
+static unsigned int effectiveNumberOfThreads(unsigned int numThreads)
+{
+#ifdef OGDF_MEMORY_POOL_NTS
+	return 1;
+#else
+	return numThreads == 0 ? max(1u, Thread::hardware_concurrency()) : numThreads;
+#endif
+}
+
+
+// Calls work(begin, end) for chunks [begin, end) of chunkSize items covering
+// 0, ..., numItems - 1 on up to numThreads threads (0 = one per core).
+static void parallelChunks(int numItems, int chunkSize, unsigned int numThreads,
+	const std::function<void(int, int)> &work)
+{
+	TaskScheduler::global().parallelFor(0, numItems, chunkSize, [&](int begin, int end) {
+		// split ranges of a sequential run into chunks as well
+		for (int first = begin; first < end; first += chunkSize) {
+			work(first, min(first + chunkSize, end));
+		}
+	}, effectiveNumberOfThreads(numThreads));
+}
+
+
+// Sums of the products of two rows with four rows of the pivot matrix, split
+// into two lanes for the even and the odd nodes.
+struct PivotMDSTileSums {
+	double sum[2][4][2];
+};
+
+
+#ifdef OGDF_SSE2_EXTENSIONS
+static inline __m128d loadTwo(const double *p) { return _mm_loadu_pd(p); }
+static inline __m128d loadTwo(const float *p) {
+	return _mm_cvtps_pd(_mm_castsi128_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p))));
+}
+#endif
+
+
+// Adds the products of the rows x[0..1] with the rows y[0..3] over the
+// nodes begin, ..., end - 1 (begin is even) to \a tile.
+template<typename T>
+static inline void addProducts(const T *const x[2], const T *const y[4], int begin, int end, PivotMDSTileSums &tile)
+{
+	int k = begin;
+#ifdef OGDF_SSE2_EXTENSIONS
+	__m128d sum[2][4];
+	for (int a = 0; a < 2; a++) {
+		for (int b = 0; b < 4; b++) {
+			sum[a][b] = _mm_loadu_pd(tile.sum[a][b]);
+		}
+	}
+	for (; k + 1 < end; k += 2) {
+		const __m128d x0 = loadTwo(x[0] + k);
+		const __m128d x1 = loadTwo(x[1] + k);
+		for (int b = 0; b < 4; b++) {
+			const __m128d yb = loadTwo(y[b] + k);
+			sum[0][b] = _mm_add_pd(sum[0][b], _mm_mul_pd(x0, yb));
+			sum[1][b] = _mm_add_pd(sum[1][b], _mm_mul_pd(x1, yb));
+		}
+	}
+	for (int a = 0; a < 2; a++) {
+		for (int b = 0; b < 4; b++) {
+			_mm_storeu_pd(tile.sum[a][b], sum[a][b]);
+		}
+	}
+#endif
+	for (; k < end; k++) {
+		for (int a = 0; a < 2; a++) {
+			for (int b = 0; b < 4; b++) {
+				tile.sum[a][b][k & 1] += double(x[a][k]) * double(y[b][k]);
+			}
+		}
+	}
+}
+
+
+// Computes the eigenvalues (the diagonal of A afterwards) and the eigenvectors
+// (the columns of V) of the small symmetric matrix A by cyclic Jacobi rotations.
+static void jacobiEigenValues(Array2D<double>& A, Array2D<double>& V)
+{
+	const int s = A.size1();
+	V.init(0, s - 1, 0, s - 1, 0.0);
+	for (int i = 0; i < s; i++) {
+		V(i, i) = 1;
+	}
+
+	for (int sweep = 0; sweep < 100; sweep++) {
+		double diagonal = 0, offDiagonal = 0;
+		for (int p = 0; p < s; p++) {
+			diagonal += A(p, p) * A(p, p);
+			for (int q = p + 1; q < s; q++) {
+				offDiagonal += A(p, q) * A(p, q);
+			}
+		}
+		if (offDiagonal <= 1e-30 * diagonal) {
+			return;
+		}
+
+		for (int p = 0; p < s; p++) {
+			for (int q = p + 1; q < s; q++) {
+				if (A(p, q) == 0) {
+					continue;
+				}
+				// rotation that eliminates A(p,q)
+				double theta = (A(q, q) - A(p, p)) / (2 * A(p, q));
+				double t = (theta >= 0 ? 1 : -1) / (fabs(theta) + sqrt(theta * theta + 1));
+				double c = 1 / sqrt(t * t + 1);
+				double sn = t * c;
+				for (int r = 0; r < s; r++) {
+					double arp = A(r, p), arq = A(r, q);
+					A(r, p) = c * arp - sn * arq;
+					A(r, q) = sn * arp + c * arq;
+				}
+				for (int r = 0; r < s; r++) {
+					double apr = A(p, r), aqr = A(q, r);
+					A(p, r) = c * apr - sn * aqr;
+					A(q, r) = sn * apr + c * aqr;
+				}
+				for (int r = 0; r < s; r++) {
+					double vrp = V(r, p), vrq = V(r, q);
+					V(r, p) = c * vrp - sn * vrq;
+					V(r, q) = sn * vrp + c * vrq;
+				}
+			}
+		}
+	}
+}
+
+
 void PivotMDS::call(GraphAttributes& GA)
 {
 	if (!isConnected(GA.constGraph())) {
@@ -56,36 +192,40 @@ void PivotMDS::call(GraphAttributes& GA)
 }
 
 
-void PivotMDS::centerPivotmatrix(Array<Array<double> >& pivotMatrix)
+template<typename T>
+void PivotMDS::centerPivotmatrix(Array2D<T>& pivotMatrix)
 {
-	int numberOfPivots = pivotMatrix.size();
+	int numberOfPivots = pivotMatrix.size1();
 	// this is ensured since the graph size is at least 2!
-	int nodeCount = pivotMatrix[0].size();
+	int nodeCount = pivotMatrix.size2();
 
+	// the matrix is traversed row by row (pivot by pivot), since the
+	// entries of a row are contiguous
 	double normalizationFactor = 0;
-	double rowColNormalizer;
 	Array<double> colNormalization(numberOfPivots);
+	Array<double> rowNormalization(0, nodeCount - 1, 0.0);
 
 	for (int i = 0; i < numberOfPivots; i++) {
-		rowColNormalizer = 0;
+		const T *row = &pivotMatrix(i, 0);
+		double rowColNormalizer = 0;
 		for (int j = 0; j < nodeCount; j++) {
-			rowColNormalizer += pivotMatrix[i][j] * pivotMatrix[i][j];
+			double square = double(row[j]) * row[j];
+			rowColNormalizer += square;
+			rowNormalization[j] += square;
 		}
 		normalizationFactor += rowColNormalizer;
 		colNormalization[i] = rowColNormalizer / nodeCount;
 	}
-	normalizationFactor = normalizationFactor / (nodeCount * numberOfPivots);
-	for (int i = 0; i < nodeCount; i++) {
-		rowColNormalizer = 0;
-		for (int j = 0; j < numberOfPivots; j++) {
-			double square = pivotMatrix[j][i] * pivotMatrix[j][i];
-			pivotMatrix[j][i] = square + normalizationFactor
-					- colNormalization[j];
-			rowColNormalizer += square;
-		}
-		rowColNormalizer /= numberOfPivots;
-		for (int j = 0; j < numberOfPivots; j++) {
-			pivotMatrix[j][i] = FACTOR * (pivotMatrix[j][i] - rowColNormalizer);
+	normalizationFactor = normalizationFactor / (nodeCount * double(numberOfPivots));
+	for (int j = 0; j < nodeCount; j++) {
+		rowNormalization[j] /= numberOfPivots;
+	}
+	for (int i = 0; i < numberOfPivots; i++) {
+		T *row = &pivotMatrix(i, 0);
+		for (int j = 0; j < nodeCount; j++) {
+			double square = double(row[j]) * row[j];
+			row[j] = T(FACTOR * (square + normalizationFactor
+					- colNormalization[i] - rowNormalization[j]));
 		}
 	}
 }
@@ -117,25 +257,15 @@ void PivotMDS::pivotMDSLayout(GraphAttributes& GA)
 		doPathLayout(GA, head);
 	}
 	else {
-		Array<Array<double> > pivDistMatrix;
-		// compute the pivot matrix
-		getPivotDistanceMatrix(GA, pivDistMatrix);
-		// center the pivot matrix
-		centerPivotmatrix(pivDistMatrix);
 		// init the coordinate matrix
 		Array<Array<double> > coord(DIMENSION_COUNT);
 		for (int i = 0; i < coord.size(); i++) {
 			coord[i].init(n);
 		}
-		// init the eigen values array
-		Array<double> eVals(DIMENSION_COUNT);
-		singularValueDecomposition(pivDistMatrix, coord, eVals);
-		// compute the correct aspect ratio
-		for (int i = 0; i < coord.size(); i++) {
-			eVals[i] = sqrt(eVals[i]);
-			for (int j = 0; j < n; j++) {
-				coord[i][j] *= eVals[i];
-			}
+		if (m_singlePrecision) {
+			pivotMDSCoordinates<float>(GA, coord);
+		} else {
+			pivotMDSCoordinates<double>(GA, coord);
 		}
 		// set the new positions to the graph
 		int i = 0;
@@ -152,6 +282,29 @@ void PivotMDS::pivotMDSLayout(GraphAttributes& GA)
 }
 
 
+template<typename T>
+void PivotMDS::pivotMDSCoordinates(const GraphAttributes& GA, Array<Array<double> >& coord)
+{
+	const int n = GA.constGraph().numberOfNodes();
+
+	Array2D<T> pivDistMatrix;
+	// compute the pivot matrix
+	getPivotDistanceMatrix(GA, pivDistMatrix);
+	// center the pivot matrix
+	centerPivotmatrix(pivDistMatrix);
+	// init the eigen values array
+	Array<double> eVals(DIMENSION_COUNT);
+	singularValueDecomposition(pivDistMatrix, coord, eVals);
+	// compute the correct aspect ratio
+	for (int i = 0; i < coord.size(); i++) {
+		eVals[i] = sqrt(eVals[i]);
+		for (int j = 0; j < n; j++) {
+			coord[i][j] *= eVals[i];
+		}
+	}
+}
+
+
 void PivotMDS::doPathLayout(GraphAttributes& GA, const node& v)
 {
 	double xPos = 0;
@@ -182,84 +335,123 @@ void PivotMDS::doPathLayout(GraphAttributes& GA, const node& v)
 
 
 void PivotMDS::eigenValueDecomposition(
-	Array<Array<double> >& K,
+	const Array2D<double>& K,
 	Array<Array<double> >& eVecs,
 	Array<double>& eValues)
 {
-	randomize(eVecs);
-	const int p = K.size();
-	double r = 0;
-	for (int i = 0; i < DIMENSION_COUNT; i++) {
-		eValues[i] = normalize(eVecs[i]);
+	// subspace iteration with Rayleigh-Ritz steps: the images of a random
+	// block of vectors are orthonormalized and rotated into approximate
+	// eigenvectors until those of the largest eigenvalues converge
+	const int p = K.size1();
+	const int s = min(p, DIMENSION_COUNT + OVERSAMPLING);
+	Array<Array<double> > X(s), KX(s), Y(s), KY(s);
+	for (int i = 0; i < s; i++) {
+		X[i].init(p);
+		KX[i].init(p);
+		Y[i].init(p);
+		KY[i].init(p);
 	}
-	while (r < EPSILON) {
-        if (std::isnan(r) || isinf(r)) {
-			// Throw arithmetic exception (Shouldn't occur
-			// for DIMEMSION_COUNT = 2
-			OGDF_THROW(AlgorithmFailureException);
-			return;
-		}
-		// remember prev values
-		Array<Array<double> > tmpOld(DIMENSION_COUNT);
-		for (int i = 0; i < DIMENSION_COUNT; i++) {
-			tmpOld[i].init(p);
-			for (int j = 0; j < p; j++) {
-				tmpOld[i][j] = eVecs[i][j];
-				eVecs[i][j] = 0;
-			}
-		}
-		// multiply matrices
-		for (int i = 0; i < DIMENSION_COUNT; i++) {
+	randomize(X);
+
+	auto multiply = [&](const Array<Array<double> >& from, Array<Array<double> >& to) {
+		for (int i = 0; i < s; i++) {
 			for (int j = 0; j < p; j++) {
+				const double *row = &K(j, 0);
+				double sum = 0;
 				for (int k = 0; k < p; k++) {
-					eVecs[i][k] += K[j][k] * tmpOld[i][j];
+					sum += row[k] * from[i][k];
 				}
+				to[i][j] = sum;
 			}
 		}
-		// orthogonalize
-		for (int i = 0; i < DIMENSION_COUNT; i++) {
+	};
+	multiply(X, KX);
+
+	Array2D<double> H(0, s - 1, 0, s - 1), W;
+	Array<int> order(s);
+	bool converged = false;
+	while (!converged) {
+		// orthonormalize the images
+		for (int i = 0; i < s; i++) {
+			Y[i] = KX[i];
 			for (int j = 0; j < i; j++) {
-				double fac = prod(eVecs[j], eVecs[i])
-						/ prod(eVecs[j], eVecs[j]);
+				double fac = prod(Y[j], Y[i]);
 				for (int k = 0; k < p; k++) {
-					eVecs[i][k] -= fac * eVecs[j][k];
+					Y[i][k] -= fac * Y[j][k];
 				}
 			}
+			normalize(Y[i]);
 		}
-		// normalize
-		for (int i = 0; i < DIMENSION_COUNT; i++) {
-			eValues[i] = normalize(eVecs[i]);
+		multiply(Y, KY);
+
+		// Rayleigh-Ritz: the eigenvectors of Y^T K Y rotate Y into
+		// approximate eigenvectors of K
+		for (int i = 0; i < s; i++) {
+			for (int j = 0; j <= i; j++) {
+				H(i, j) = H(j, i) = (prod(Y[i], KY[j]) + prod(Y[j], KY[i])) / 2;
+			}
 		}
-		r = 1;
+		jacobiEigenValues(H, W);
+		for (int i = 0; i < s; i++) {
+			order[i] = i;
+		}
+		std::sort(order.begin(), order.end(), [&](int a, int b) { return H(a, a) > H(b, b); });
+		for (int i = 0; i < s; i++) {
+			X[i].fill(0);
+			KX[i].fill(0);
+			for (int j = 0; j < s; j++) {
+				double w = W(j, order[i]);
+				for (int k = 0; k < p; k++) {
+					X[i][k] += w * Y[j][k];
+					KX[i][k] += w * KY[j][k];
+				}
+			}
+		}
+
+		// converged if the residuals K x - theta x are small
+		const double theta0 = H(order[0], order[0]);
+		converged = true;
 		for (int i = 0; i < DIMENSION_COUNT; i++) {
-			// get absolute value (abs only defined for int)
-			double tmp = prod(eVecs[i], tmpOld[i]);
-			if (tmp < 0) {
-				tmp *= -1;
+			const double theta = H(order[i], order[i]);
+			if (std::isnan(theta) || isinf(theta)) {
+				// Throw arithmetic exception (Shouldn't occur
+				// for DIMEMSION_COUNT = 2
+				OGDF_THROW(AlgorithmFailureException);
+				return;
+			}
+			double residual = 0;
+			for (int k = 0; k < p; k++) {
+				double r = KX[i][k] - theta * X[i][k];
+				residual += r * r;
+			}
+			if (residual > (1 - EPSILON) * theta0 * theta0) {
+				converged = false;
 			}
-			r = min(r, tmp);
 		}
 	}
+
+	for (int i = 0; i < DIMENSION_COUNT; i++) {
+		eVecs[i] = X[i];
+		eValues[i] = sqrt(prod(KX[i], KX[i]));
+	}
 }
 
 
+template<typename T>
 void PivotMDS::getPivotDistanceMatrix(
 	const GraphAttributes& GA,
-	Array<Array<double> >& pivDistMatrix)
+	Array2D<T>& pivDistMatrix)
 {
 	const Graph& G = GA.constGraph();
 	const int n = G.numberOfNodes();
+	const CSRGraph C(G);
 
 	// lower the number of pivots if necessary
 	int numberOfPivots = min(n, m_numberOfPivots);
 	// number of pivots times n matrix used to store the graph distances
-	pivDistMatrix.init(numberOfPivots);
-	for (int i = 0; i < numberOfPivots; i++) {
-		pivDistMatrix[i].init(n);
-	}
+	pivDistMatrix.init(0, numberOfPivots - 1, 0, n - 1);
 	// edges costs array
 	EdgeArray<double> edgeCosts;
-	bool hasEdgeCosts = false;
 	// already checked whether this attribute exists or not (see call method)
 	if (m_hasEdgeCostsAttribute) {
 		edgeCosts.init(G);
@@ -267,44 +459,77 @@ void PivotMDS::getPivotDistanceMatrix(
 		{
 			edgeCosts[e] = GA.doubleWeight(e);
 		}
-		hasEdgeCosts = true;
 	}
 	// used for min-max strategy
-	NodeArray<double> minDistances(G, std::numeric_limits<double>::infinity());
-	NodeArray<double> shortestPathSingleSource(G);
-	// the current pivot node
-	node pivNode = G.firstNode();
-	for (int i = 0; i < numberOfPivots; i++) {
-		// get the shortest path from the currently processed pivot node to
-		// all other nodes in the graph
-		shortestPathSingleSource.fill(std::numeric_limits<double>::infinity());
-		if (hasEdgeCosts) {
-			dijkstra_SPSS(pivNode, G, shortestPathSingleSource, edgeCosts);
+	Array<double> minDistances(0, n - 1, std::numeric_limits<double>::infinity());
+	Array<double> estimate(n), lowerBound(n);
+	const int pivotsPerRound = min((int) effectiveNumberOfThreads(m_numberOfThreads), MAX_PIVOTS_PER_ROUND);
+	Array<int> pivots(pivotsPerRound);
+
+	// the pivots are chosen in rounds; the first pivot is the first node
+	int first = 0, previous = 0;
+	while (first < numberOfPivots) {
+		int count = 0;
+		if (first == 0) {
+			pivots[count++] = 0;
 		} else {
-			bfs_SPSS(pivNode, G, shortestPathSingleSource, m_edgeCosts);
-		}
-		copySPSS(pivDistMatrix[i], shortestPathSingleSource);
-		// update the pivot and the minDistances array ... to ensure the
-		// correctness set minDistance of the pivot node to zero
-		minDistances[pivNode] = 0;
-		for(node v : G.nodes)
-		{
-			minDistances[v] = min(minDistances[v], shortestPathSingleSource[v]);
-			if (minDistances[v] > minDistances[pivNode]) {
-				pivNode = v;
+			// max-min strategy, where the distance from a pivot of this round
+			// is estimated by the triangle inequality for the pivots of the
+			// previous round: d(v,w) >= |d(p,v) - d(p,w)|
+			for (int v = 0; v < n; v++) {
+				estimate[v] = minDistances[v];
+			}
+			while (count < pivotsPerRound && first + count < numberOfPivots) {
+				int pivNode = 0;
+				for (int v = 1; v < n; v++) {
+					if (estimate[v] > estimate[pivNode]) {
+						pivNode = v;
+					}
+				}
+				if (count > 0 && !(estimate[pivNode] > 0)) {
+					break;
+				}
+				pivots[count++] = pivNode;
+				if (count == pivotsPerRound) {
+					break;
+				}
+				lowerBound.fill(0);
+				for (int q = previous; q < first; q++) {
+					const T *row = &pivDistMatrix(q, 0);
+					const double d = row[pivNode];
+					for (int v = 0; v < n; v++) {
+						lowerBound[v] = max(lowerBound[v], fabs(row[v] - d));
+					}
+				}
+				for (int v = 0; v < n; v++) {
+					estimate[v] = min(estimate[v], lowerBound[v]);
+				}
 			}
 		}
-	}
-}
 
+		// get the shortest paths from the pivots of this round to all
+		// other nodes in the graph
+		Array<int> sources(count);
+		for (int i = 0; i < count; i++) {
+			sources[i] = pivots[i];
+		}
+		if (m_hasEdgeCostsAttribute) {
+			dijkstra_SPMS(C, sources, &pivDistMatrix(first, 0), edgeCosts, m_numberOfThreads);
+		} else {
+			bfs_SPMS(C, sources, &pivDistMatrix(first, 0), T(m_edgeCosts), m_numberOfThreads);
+		}
 
-void PivotMDS::copySPSS(Array<double>& copyTo, NodeArray<double>& copyFrom)
-{
-	const Graph &G = *copyFrom.graphOf();
-
-	int i = 0;
-	for (node v : G.nodes) {
-		copyTo[i++] = copyFrom[v];
+		// update the minDistances array ... to ensure the
+		// correctness set minDistance of the pivot node to zero
+		for (int i = first; i < first + count; i++) {
+			const T *row = &pivDistMatrix(i, 0);
+			for (int v = 0; v < n; v++) {
+				minDistances[v] = min(minDistances[v], double(row[v]));
+			}
+			minDistances[pivots[i - first]] = 0;
+		}
+		previous = first;
+		first += count;
 	}
 }
 
@@ -380,33 +605,80 @@ void PivotMDS::randomize(Array<Array<double> >& matrix)
 }
 
 
-void PivotMDS::selfProduct(const Array<Array<double> >& d, Array<Array<double> >& result)
+template<typename T>
+void PivotMDS::selfProduct(const Array2D<T>& d, Array2D<double>& result)
 {
-	double sum;
-	for (int i = 0; i < d.size(); i++) {
-		for (int j = 0; j <= i; j++) {
-			sum = 0;
-			for (int k = 0; k < d[0].size(); k++) {
-				sum += d[i][k] * d[j][k];
+	const int l = d.size1();
+	const int n = d.size2();
+	result.init(0, l - 1, 0, l - 1);
+
+	// The lower triangle is divided into tiles of 2x4 entries, whose sums stay
+	// in registers while a block of nodes is processed. The blocks are the outer
+	// loop, so their part of the matrix is reused from the cache by a group of
+	// rows of tiles. Each entry is summed by a single thread in the order of
+	// the nodes, so the result does not depend on the number of threads.
+	const int blockSize = 512;
+	const int rowsPerGroup = 16;
+	const int numTileCols = (l + 3) / 4;
+
+	// rows beyond the matrix are mapped to its last row; their sums are discarded
+	auto rowOf = [&](int i) { return &d(min(i, l - 1), 0); };
+
+	parallelChunks(l, rowsPerGroup, m_numberOfThreads, [&](int firstRow, int endRow) {
+		const int numTileRows = (endRow - firstRow + 1) / 2;
+		Array<PivotMDSTileSums> tiles(numTileRows * numTileCols);
+		for (PivotMDSTileSums &tile : tiles) {
+			for (int a = 0; a < 2; a++) {
+				for (int b = 0; b < 4; b++) {
+					tile.sum[a][b][0] = tile.sum[a][b][1] = 0;
+				}
 			}
-			result[i][j] = sum;
-			result[j][i] = sum;
+		}
+
+		for (int begin = 0; begin < n; begin += blockSize) {
+			const int end = min(begin + blockSize, n);
+			for (int r = 0; r < numTileRows; r++) {
+				const int i0 = firstRow + 2 * r;
+				const T *x[2] = { rowOf(i0), rowOf(i0 + 1) };
+				for (int c = 0; 4 * c <= i0 + 1; c++) {
+					const int j0 = 4 * c;
+					const T *y[4] = { rowOf(j0), rowOf(j0 + 1), rowOf(j0 + 2), rowOf(j0 + 3) };
+					addProducts(x, y, begin, end, tiles[r * numTileCols + c]);
+				}
+			}
+		}
+
+		for (int r = 0; r < numTileRows; r++) {
+			const int i0 = firstRow + 2 * r;
+			for (int c = 0; 4 * c <= i0 + 1; c++) {
+				const PivotMDSTileSums &tile = tiles[r * numTileCols + c];
+				for (int a = 0; a < 2 && i0 + a < endRow; a++) {
+					for (int b = 0; b < 4 && 4 * c + b < l; b++) {
+						result(i0 + a, 4 * c + b) = tile.sum[a][b][0] + tile.sum[a][b][1];
+					}
+				}
+			}
+		}
+	});
+
+	// the tiles may reach beyond the diagonal; the lower triangle is complete
+	for (int i = 0; i < l; i++) {
+		for (int j = 0; j < i; j++) {
+			result(j, i) = result(i, j);
 		}
 	}
 }
 
 
+template<typename T>
 void PivotMDS::singularValueDecomposition(
-	Array<Array<double> >& pivDistMatrix,
+	const Array2D<T>& pivDistMatrix,
 	Array<Array<double> >& eVecs,
 	Array<double>& eVals)
 {
-	const int l = pivDistMatrix.size();
-	const int n = pivDistMatrix[0].size();
-	Array<Array<double> > K(l);
-	for (int i = 0; i < l; i++) {
-		K[i].init(l);
-	}
+	const int l = pivDistMatrix.size1();
+	const int n = pivDistMatrix.size2();
+	Array2D<double> K;
 	// calc C^TC
 	selfProduct(pivDistMatrix, K);
 
@@ -420,13 +692,20 @@ void PivotMDS::singularValueDecomposition(
 	// C^Tx
 	for (int i = 0; i < DIMENSION_COUNT; i++) {
 		eVals[i] = sqrt(eVals[i]);
-		for (int j = 0; j < n; j++) { // node j
-			eVecs[i][j] = 0;
-			for (int k = 0; k < l; k++) { // pivot k
-				eVecs[i][j] += pivDistMatrix[k][j] * tmp[i][k];
+		eVecs[i].fill(0);
+	}
+	parallelChunks(n, 4096, m_numberOfThreads, [&](int begin, int end) {
+		for (int k = 0; k < l; k++) { // pivot k
+			const T *row = &pivDistMatrix(k, 0);
+			for (int i = 0; i < DIMENSION_COUNT; i++) {
+				const double factor = tmp[i][k];
+				double *eVec = &eVecs[i][0];
+				for (int j = begin; j < end; j++) { // node j
+					eVec[j] += row[j] * factor;
+				}
 			}
 		}
-	}
+	});
 	for (int i = 0; i < DIMENSION_COUNT; i++) {
 		normalize(eVecs[i]);
 	}
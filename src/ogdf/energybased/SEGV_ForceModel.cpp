@@ -47,26 +47,9 @@ namespace ogdf {
 		const double cEps = eps();
 
 		const NodeInfo &vj = m_vInfo[j];
-		int grid_x = vj.m_gridX;
-		int grid_y = vj.m_gridY;
 
 		// repulsive forces on node j: F_rep(d) = iel^2 / d
-		DPoint force(0,0);
-		for(int gi = -1; gi <= 1; gi++) {
-			for(int gj = -1; gj <= 1; gj++) {
-				for(int u : m_gridCell(grid_x+gi,grid_y+gj)) {
-
-					if(u == j) continue;
-					DPoint dist = vj.m_pos - m_vInfo[u].m_pos;
-					double d = dist.norm();
-
-					if(d < boxLength) {
-						dist /= d * d + cEps;
-						force += dist;
-					}
-				}
-			}
-		}
+		DPoint force = m_grid.repulsion(vj, boxLength, cEps, false);
 
 		force *= m_idealEdgeLength * m_idealEdgeLength;
 		DPoint disp(force);
@@ -100,26 +83,9 @@ namespace ogdf {
 		const double cEps = eps();
 
 		const NodeInfo &vj = m_vInfo[j];
-		int grid_x = vj.m_gridX;
-		int grid_y = vj.m_gridY;
 
 		// repulsive forces on node j: F_rep(d) = iel^3 / d
-		DPoint force(0,0);
-		for(int gi = -1; gi <= 1; gi++) {
-			for(int gj = -1; gj <= 1; gj++) {
-				for(int u : m_gridCell(grid_x+gi,grid_y+gj)) {
-
-					if(u == j) continue;
-					DPoint dist = vj.m_pos - m_vInfo[u].m_pos;
-					double d = dist.norm();
-
-					if(d < boxLength) {
-						dist /= d * d + cEps;
-						force += dist;
-					}
-				}
-			}
-		}
+		DPoint force = m_grid.repulsion(vj, boxLength, cEps, false);
 
 		force *= m_idealEdgeLength * m_idealEdgeLength * m_idealEdgeLength;
 		DPoint disp(force);
@@ -153,26 +119,9 @@ namespace ogdf {
 		const double cEps = eps();
 
 		const NodeInfo &vj = m_vInfo[j];
-		int grid_x = vj.m_gridX;
-		int grid_y = vj.m_gridY;
 
 		// repulsive forces on node j: F_rep(d) = iel^2 / d^2
-		DPoint force(0,0);
-		for(int gi = -1; gi <= 1; gi++) {
-			for(int gj = -1; gj <= 1; gj++) {
-				for(int u : m_gridCell(grid_x+gi,grid_y+gj)) {
-
-					if(u == j) continue;
-					DPoint dist = vj.m_pos - m_vInfo[u].m_pos;
-					double d = dist.norm();
-
-					if(d < boxLength) {
-						dist /= d * d * d + cEps;
-						force += dist;
-					}
-				}
-			}
-		}
+		DPoint force = m_grid.repulsion(vj, boxLength, cEps, true);
 
 		force *= m_idealEdgeLength * m_idealEdgeLength;
 		DPoint disp(force);
@@ -206,26 +155,9 @@ namespace ogdf {
 		const double cIELEps = m_idealEdgeLength + cEps;
 
 		const NodeInfo &vj = m_vInfo[j];
-		int grid_x = vj.m_gridX;
-		int grid_y = vj.m_gridY;
 
 		// repulsive forces on node j: F_rep(d) = iel^2 / d
-		DPoint force(0,0);
-		for(int gi = -1; gi <= 1; gi++) {
-			for(int gj = -1; gj <= 1; gj++) {
-				for(int u : m_gridCell(grid_x+gi,grid_y+gj)) {
-
-					if(u == j) continue;
-					DPoint dist = vj.m_pos - m_vInfo[u].m_pos;
-					double d = dist.norm();
-
-					if(d < boxLength) {
-						dist /= d * d + cEps;
-						force += dist;
-					}
-				}
-			}
-		}
+		DPoint force = m_grid.repulsion(vj, boxLength, cEps, false);
 
 		force *= m_idealEdgeLength * m_idealEdgeLength;
 		DPoint disp(force);
@@ -266,26 +198,9 @@ namespace ogdf {
 		const double cIELEps = m_idealEdgeLength + cEps;
 
 		const NodeInfo &vj = m_vInfo[j];
-		int grid_x = vj.m_gridX;
-		int grid_y = vj.m_gridY;
 
 		// repulsive forces on node j: F_rep(d) = iel^2 / d
-		DPoint force(0,0);
-		for(int gi = -1; gi <= 1; gi++) {
-			for(int gj = -1; gj <= 1; gj++) {
-				for(int u : m_gridCell(grid_x+gi,grid_y+gj)) {
-
-					if(u == j) continue;
-					DPoint dist = vj.m_pos - m_vInfo[u].m_pos;
-					double d = dist.norm();
-
-					if(d < boxLength) {
-						dist /= d * d + cEps;
-						force += dist;
-					}
-				}
-			}
-		}
+		DPoint force = m_grid.repulsion(vj, boxLength, cEps, false);
 
 		force *= m_idealEdgeLength * m_idealEdgeLength;
 		DPoint disp(force);
@@ -324,26 +239,9 @@ namespace ogdf {
 		const double cIELEps = m_idealEdgeLength + cEps;
 
 		const NodeInfo &vj = m_vInfo[j];
-		int grid_x = vj.m_gridX;
-		int grid_y = vj.m_gridY;
 
 		// repulsive forces on node j: F_rep(d) = iel^2 / d
-		DPoint force(0,0);
-		for(int gi = -1; gi <= 1; gi++) {
-			for(int gj = -1; gj <= 1; gj++) {
-				for(int u : m_gridCell(grid_x+gi,grid_y+gj)) {
-
-					if(u == j) continue;
-					DPoint dist = vj.m_pos - m_vInfo[u].m_pos;
-					double d = dist.norm();
-
-					if(d < boxLength) {
-						dist /= d * d + cEps;
-						force += dist;
-					}
-				}
-			}
-		}
+		DPoint force = m_grid.repulsion(vj, boxLength, cEps, false);
 
 		force *= m_idealEdgeLength * m_idealEdgeLength;
 		DPoint disp(force);
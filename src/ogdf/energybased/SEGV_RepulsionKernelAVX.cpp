@@ -0,0 +1,80 @@
+/** \file
+ * \brief AVX kernels for the grid-based repulsive forces of SpringEmbedderGridVariant
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.txt in the root directory of the OGDF installation for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ *
+ * \see  http://www.gnu.org/copyleft/gpl.html
+ ***************************************************************/
+
+#include <ogdf/internal/energybased/SEGV_RepulsionKernel.h>
+
+#ifdef OGDF_AVX_EXTENSIONS
+
+#include <immintrin.h>
+
+namespace ogdf {
+
+// This file is compiled with AVX enabled, see FRExactKernelAVX.cpp.
+namespace {
+
+struct AVXOps {
+	typedef __m256d Vector;
+	typedef __m256d Mask;
+	static const int width = 4;
+
+	static Vector load(const double *p) { return _mm256_loadu_pd(p); }
+	static void store(double *p, Vector a) { _mm256_storeu_pd(p, a); }
+	static Vector set1(double a) { return _mm256_set1_pd(a); }
+	static Vector zero() { return _mm256_setzero_pd(); }
+	static Vector add(Vector a, Vector b) { return _mm256_add_pd(a, b); }
+	static Vector sub(Vector a, Vector b) { return _mm256_sub_pd(a, b); }
+	static Vector mul(Vector a, Vector b) { return _mm256_mul_pd(a, b); }
+	static Vector div(Vector a, Vector b) { return _mm256_div_pd(a, b); }
+	static Vector sqrt(Vector a) { return _mm256_sqrt_pd(a); }
+	static Mask less(Vector a, Vector b) { return _mm256_cmp_pd(a, b, _CMP_LT_OQ); }
+	static Mask both(Mask a, Mask b) { return _mm256_and_pd(a, b); }
+	static Mask firstLanes(int k) {
+		return _mm256_castsi256_pd(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(segvLaneMask + 4 - k)));
+	}
+	static Vector select(Mask m, Vector a) { return _mm256_and_pd(m, a); }
+};
+
+}
+
+void segvRepulsionAVX(const SEGVRepulsion &r, const int *range, const int *rangeStop, double px, double py, double &forceX, double &forceY)
+{
+	segvRepulsion<AVXOps, false>(r, range, rangeStop, px, py, forceX, forceY);
+}
+
+void segvRepulsionCubicAVX(const SEGVRepulsion &r, const int *range, const int *rangeStop, double px, double py, double &forceX, double &forceY)
+{
+	segvRepulsion<AVXOps, true>(r, range, rangeStop, px, py, forceX, forceY);
+}
+
+} // end namespace ogdf
+
+#endif
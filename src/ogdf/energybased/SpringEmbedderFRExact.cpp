@@ -37,17 +37,113 @@
 #include <ogdf/packing/TileToRowsCCPacker.h>
 #include <ogdf/basic/GraphCopyAttributes.h>
 #include <ogdf/basic/simple_graph_alg.h>
+#include <ogdf/basic/TaskScheduler.h>
+#include <ogdf/basic/Thread.h>
+#include <ogdf/internal/energybased/FRExactKernel.h>
 
-#ifdef _OPENMP
-#include <omp.h>
+#include <functional>
+
+
+namespace ogdf {
+
+//! Repulsion kernel for processors without AVX.
+static void frExactRepulsionDefault(const FRExactRepulsion<double> &r, int begin, int end, double *dispX, double *dispY)
+{
+#ifdef OGDF_SSE2_EXTENSIONS
+	frExactRepulsion<FRExactSSE2DoubleOps>(r, begin, end, dispX, dispY);
+#else
+	frExactRepulsion<FRExactScalarOps<double> >(r, begin, end, dispX, dispY);
 #endif
+}
+
 
-#ifdef OGDF_SSE3_EXTENSIONS
-#include <ogdf/internal/basic/intrinsics.h>
+//! Repulsion kernel for processors without AVX (single precision).
+static void frExactRepulsionDefault(const FRExactRepulsion<float> &r, int begin, int end, double *dispX, double *dispY)
+{
+#ifdef OGDF_SSE2_EXTENSIONS
+	frExactRepulsion<FRExactSSE2FloatOps>(r, begin, end, dispX, dispY);
+#else
+	frExactRepulsion<FRExactScalarOps<float> >(r, begin, end, dispX, dispY);
 #endif
+}
 
 
-namespace ogdf {
+//! Computes the repulsive forces of SpringEmbedderFRExact in precision \a T.
+/**
+ * The nodes are split into small ranges handed out to the threads of the
+ * global TaskScheduler, and every range is processed by the widest kernel
+ * the processor supports.
+ */
+template<typename T>
+class FRExactRepulsionComputer {
+	//! Minimum number of nodes per thread; below that, synchronization dominates.
+	static const int minNodesPerThread = 512;
+	//! Number of nodes handed out at once to a thread (a multiple of the tile size).
+	static const int rowsPerTask = 128;
+
+	typedef void (*Kernel)(const FRExactRepulsion<T> &, int, int, double *, double *);
+
+	int m_n;
+	Array<T> m_x, m_y, m_weight; //!< Padded copies of coordinates and weights.
+	FRExactRepulsion<T> m_input;
+	Kernel m_kernel;
+	unsigned int m_numThreads;
+
+public:
+	FRExactRepulsionComputer(int n, const double *weight, double minDistSquare, double cRep, unsigned int numThreads)
+		: m_n(n), m_numThreads(1)
+	{
+		const int numPadded = (n + FRExactRepulsion<T>::padding - 1)
+		                      / FRExactRepulsion<T>::padding * FRExactRepulsion<T>::padding;
+		m_x.init(numPadded);
+		m_y.init(numPadded);
+		m_weight.init(numPadded);
+		for (int v = 0; v < numPadded; ++v) {
+			m_x[v] = m_y[v] = 0;
+			m_weight[v] = v < n ? T(weight[v]) : 0;
+		}
+
+		m_input.x = &m_x[0];
+		m_input.y = &m_y[0];
+		m_input.weight = &m_weight[0];
+		m_input.numPadded = numPadded;
+		m_input.minDistSquare = T(minDistSquare);
+		m_input.cRep = cRep;
+
+		m_kernel = &frExactRepulsionDefault;
+#ifdef OGDF_AVX_EXTENSIONS
+		if (System::cpuSupports(cpufAVX)) {
+			m_kernel = &frExactRepulsionAVX;
+		}
+#endif
+
+#ifndef OGDF_MEMORY_POOL_NTS
+		if (numThreads == 0) {
+			numThreads = max(1u, Thread::hardware_concurrency());
+		}
+		m_numThreads = max(1u, min(numThreads, (unsigned int)(n / minNodesPerThread)));
+#endif
+	}
+
+	//! Stores the repulsive forces on the nodes at positions (\a x, \a y) in (\a dispX, \a dispY).
+	void operator()(const double *x, const double *y, double *dispX, double *dispY)
+	{
+		for (int v = 0; v < m_n; ++v) {
+			m_x[v] = T(x[v]);
+			m_y[v] = T(y[v]);
+		}
+
+		if (m_numThreads == 1) {
+			m_kernel(m_input, 0, m_n, dispX, dispY);
+			return;
+		}
+
+		TaskScheduler::global().parallelFor(0, m_n, rowsPerTask, [&](int begin, int end) {
+			m_kernel(m_input, begin, end, dispX, dispY);
+		}, m_numThreads);
+	}
+};
+
 
 SpringEmbedderFRExact::ArrayGraph::ArrayGraph(GraphAttributes &ga) : m_ga(&ga), m_mapNode(ga.constGraph())
 {
@@ -155,6 +251,8 @@ SpringEmbedderFRExact::SpringEmbedderFRExact()
 	m_useNodeWeight = false;
 	m_checkConvergence = true;
 	m_convTolerance = 0.01; //fraction of ideal edge length below which convergence is achieved
+	m_numberOfThreads = 0;
+	m_singlePrecision = false;
 }
 
 
@@ -182,12 +280,10 @@ void SpringEmbedderFRExact::call(GraphAttributes &AG)
 		{
 			initialize(component);
 
-#ifdef OGDF_SSE3_EXTENSIONS
-			if(System::cpuSupports(cpufSSE3))
-				mainStep_sse3(component);
+			if(m_singlePrecision)
+				mainStep<float>(component);
 			else
-#endif
-				mainStep(component);
+				mainStep<double>(component);
 		}
 
 		double minX, maxX, minY, maxY;
@@ -301,6 +397,7 @@ void SpringEmbedderFRExact::cool(double &tx, double &ty, int &cF)
 }
 
 
+template<typename T>
 void SpringEmbedderFRExact::mainStep(ArrayGraph &C)
 {
 	const int    n       = C.numberOfNodes();
@@ -314,6 +411,8 @@ void SpringEmbedderFRExact::mainStep(ArrayGraph &C)
 	double *disp_x = (double*) System::alignedMemoryAlloc16(n*sizeof(double)); //new double[n];
 	double *disp_y = (double*) System::alignedMemoryAlloc16(n*sizeof(double)); //new double[n];
 
+	FRExactRepulsionComputer<T> repulsion(n, C.m_nodeWeight, minDistSquare, c_rep, m_numberOfThreads);
+
 	double tx = m_txNull;
 	double ty = m_tyNull;
 	int cF = 1;
@@ -328,28 +427,7 @@ void SpringEmbedderFRExact::mainStep(ArrayGraph &C)
 		if (m_checkConvergence) converged = true;
 		// repulsive forces
 
-		#pragma omp parallel for
-		for(int v = 0; v < n; ++v)
-		{
-			disp_x[v] = disp_y[v] = 0;
-
-			for(int u = 0; u < n; ++u)
-			{
-				if(u == v) continue;
-
-				double delta_x = C.m_x[v] - C.m_x[u];
-				double delta_y = C.m_y[v] - C.m_y[u];
-
-				double distSquare = max(minDistSquare, delta_x*delta_x + delta_y*delta_y);
-
-				double t = C.m_nodeWeight[u] / distSquare;
-				disp_x[v] += delta_x * t;
-				disp_y[v] += delta_y * t;
-			}
-
-			disp_x[v] *= c_rep;
-			disp_y[v] *= c_rep;
-		}
+		repulsion(C.m_x, C.m_y, disp_x, disp_y);
 
 		// attractive forces
 
@@ -372,7 +450,6 @@ void SpringEmbedderFRExact::mainStep(ArrayGraph &C)
 
 		// limit the maximum displacement to the temperature (m_tx,m_ty)
 
-		#pragma omp parallel for
 		for(int v = 0; v < n; ++v)
 		{
 			double dist = max(minDist, sqrt(disp_x[v]*disp_x[v] + disp_y[v]*disp_y[v]));
@@ -397,189 +474,4 @@ void SpringEmbedderFRExact::mainStep(ArrayGraph &C)
 }//mainstep
 
 
-void SpringEmbedderFRExact::mainStep_sse3(ArrayGraph &C)
-{
-//#if (defined(OGDF_ARCH_X86) || defined(OGDF_ARCH_X64)) && !(defined(__GNUC__) && !defined(__SSE3__))
-#ifdef OGDF_SSE3_EXTENSIONS
-
-	const int n            = C.numberOfNodes();
-
-#ifdef _OPENMP
-	const int work = 256;
-	const int nThreadsRep  = min(omp_get_max_threads(), 1 + n*n/work);
-	const int nThreadsPrev = min(omp_get_max_threads(), 1 + n  /work);
-#endif
-
-	const double k       = m_idealEdgeLength;
-	const double kSquare = k*k;
-	const double c_rep   = 0.052 * kSquare; // 0.2 = factor for repulsive forces as suggested by Warshal
-
-	const double minDist       = 10e-6;//100*DBL_EPSILON;
-	const double minDistSquare = minDist*minDist;
-
-	double *disp_x = (double*) System::alignedMemoryAlloc16(n*sizeof(double));
-	double *disp_y = (double*) System::alignedMemoryAlloc16(n*sizeof(double));
-
-	__m128d mm_kSquare       = _mm_set1_pd(kSquare);
-	__m128d mm_minDist       = _mm_set1_pd(minDist);
-	__m128d mm_minDistSquare = _mm_set1_pd(minDistSquare);
-	__m128d mm_c_rep         = _mm_set1_pd(c_rep);
-
-	#pragma omp parallel num_threads(nThreadsRep)
-	{
-		double tx = m_txNull;
-		double ty = m_tyNull;
-		int cF = 1;
-
-		for(int i = 1; i <= m_iterations; i++)
-		{
-			// repulsive forces
-
-			#pragma omp for
-			for(int v = 0; v < n; ++v)
-			{
-				__m128d mm_disp_xv = _mm_setzero_pd();
-				__m128d mm_disp_yv = _mm_setzero_pd();
-
-				__m128d mm_xv = _mm_set1_pd(C.m_x[v]);
-				__m128d mm_yv = _mm_set1_pd(C.m_y[v]);
-
-				int u;
-				for(u = 0; u+1 < v; u += 2)
-				{
-					__m128d mm_delta_x = _mm_sub_pd(mm_xv, _mm_load_pd(&C.m_x[u]));
-					__m128d mm_delta_y = _mm_sub_pd(mm_yv, _mm_load_pd(&C.m_y[u]));
-
-					__m128d mm_distSquare = _mm_max_pd(mm_minDistSquare,
-						_mm_add_pd(_mm_mul_pd(mm_delta_x,mm_delta_x),_mm_mul_pd(mm_delta_y,mm_delta_y))
-					);
-
-					__m128d mm_t = _mm_div_pd(_mm_load_pd(&C.m_nodeWeight[u]), mm_distSquare);
-					mm_disp_xv = _mm_add_pd(mm_disp_xv, _mm_mul_pd(mm_delta_x, mm_t));
-					mm_disp_yv = _mm_add_pd(mm_disp_yv, _mm_mul_pd(mm_delta_y, mm_t));
-					//mm_disp_xv = _mm_add_pd(mm_disp_xv, _mm_mul_pd(mm_delta_x, _mm_div_pd(mm_kSquare,mm_distSquare)));
-					//mm_disp_yv = _mm_add_pd(mm_disp_yv, _mm_mul_pd(mm_delta_y, _mm_div_pd(mm_kSquare,mm_distSquare)));
-				}
-				int uStart = u+2;
-				if(u == v) ++u;
-				if(u < n) {
-					__m128d mm_delta_x = _mm_sub_sd(mm_xv, _mm_load_sd(&C.m_x[u]));
-					__m128d mm_delta_y = _mm_sub_sd(mm_yv, _mm_load_sd(&C.m_y[u]));
-
-					__m128d mm_distSquare = _mm_max_sd(mm_minDistSquare,
-						_mm_add_sd(_mm_mul_sd(mm_delta_x,mm_delta_x),_mm_mul_sd(mm_delta_y,mm_delta_y))
-					);
-
-					__m128d mm_t = _mm_div_sd(_mm_load_sd(&C.m_nodeWeight[u]), mm_distSquare);
-					mm_disp_xv = _mm_add_sd(mm_disp_xv, _mm_mul_sd(mm_delta_x, mm_t));
-					mm_disp_yv = _mm_add_sd(mm_disp_yv, _mm_mul_sd(mm_delta_y, mm_t));
-					//mm_disp_xv = _mm_add_sd(mm_disp_xv, _mm_mul_sd(mm_delta_x, _mm_div_sd(mm_kSquare,mm_distSquare)));
-					//mm_disp_yv = _mm_add_sd(mm_disp_yv, _mm_mul_sd(mm_delta_y, _mm_div_sd(mm_kSquare,mm_distSquare)));
-				}
-
-				for(u = uStart; u < n; u += 2)
-				{
-					__m128d mm_delta_x = _mm_sub_pd(mm_xv, _mm_load_pd(&C.m_x[u]));
-					__m128d mm_delta_y = _mm_sub_pd(mm_yv, _mm_load_pd(&C.m_y[u]));
-
-					__m128d mm_distSquare = _mm_max_pd(mm_minDistSquare,
-						_mm_add_pd(_mm_mul_pd(mm_delta_x,mm_delta_x),_mm_mul_pd(mm_delta_y,mm_delta_y))
-					);
-
-					__m128d mm_t = _mm_div_pd(_mm_load_pd(&C.m_nodeWeight[u]), mm_distSquare);
-					mm_disp_xv = _mm_add_pd(mm_disp_xv, _mm_mul_pd(mm_delta_x, mm_t));
-					mm_disp_yv = _mm_add_pd(mm_disp_yv, _mm_mul_pd(mm_delta_y, mm_t));
-					//mm_disp_xv = _mm_add_pd(mm_disp_xv, _mm_mul_pd(mm_delta_x, _mm_div_pd(mm_kSquare,mm_distSquare)));
-					//mm_disp_yv = _mm_add_pd(mm_disp_yv, _mm_mul_pd(mm_delta_y, _mm_div_pd(mm_kSquare,mm_distSquare)));
-				}
-				if(u < n) {
-					__m128d mm_delta_x = _mm_sub_sd(mm_xv, _mm_load_sd(&C.m_x[u]));
-					__m128d mm_delta_y = _mm_sub_sd(mm_yv, _mm_load_sd(&C.m_y[u]));
-
-					__m128d mm_distSquare = _mm_max_sd(mm_minDistSquare,
-						_mm_add_sd(_mm_mul_sd(mm_delta_x,mm_delta_x),_mm_mul_sd(mm_delta_y,mm_delta_y))
-					);
-
-					__m128d mm_t = _mm_div_sd(_mm_load_sd(&C.m_nodeWeight[u]), mm_distSquare);
-					mm_disp_xv = _mm_add_sd(mm_disp_xv, _mm_mul_sd(mm_delta_x, mm_t));
-					mm_disp_yv = _mm_add_sd(mm_disp_yv, _mm_mul_sd(mm_delta_y, mm_t));
-					//mm_disp_xv = _mm_add_sd(mm_disp_xv, _mm_mul_sd(mm_delta_x, _mm_div_sd(mm_kSquare,mm_distSquare)));
-					//mm_disp_yv = _mm_add_sd(mm_disp_yv, _mm_mul_sd(mm_delta_y, _mm_div_sd(mm_kSquare,mm_distSquare)));
-				}
-
-				mm_disp_xv = _mm_hadd_pd(mm_disp_xv,mm_disp_xv);
-				mm_disp_yv = _mm_hadd_pd(mm_disp_yv,mm_disp_yv);
-
-				_mm_store_sd(&disp_x[v], _mm_mul_sd(mm_disp_xv, mm_c_rep));
-				_mm_store_sd(&disp_y[v], _mm_mul_sd(mm_disp_yv, mm_c_rep));
-			}
-
-			// attractive forces
-
-			#pragma omp single
-			for(int e = 0; e < C.numberOfEdges(); ++e)
-			{
-				int v = C.m_src[e];
-				int u = C.m_tgt[e];
-
-				double delta_x = C.m_x[v] - C.m_x[u];
-				double delta_y = C.m_y[v] - C.m_y[u];
-
-				double dist = max(minDist, sqrt(delta_x*delta_x + delta_y*delta_y));
-
-				disp_x[v] -= delta_x * dist / k;
-				disp_y[v] -= delta_y * dist / k;
-
-				disp_x[u] += delta_x * dist / k;
-				disp_y[u] += delta_y * dist / k;
-			}
-
-			// limit the maximum displacement to the temperature (m_tx,m_ty)
-
-			__m128d mm_tx = _mm_set1_pd(tx);
-			__m128d mm_ty = _mm_set1_pd(ty);
-
-			#pragma omp for nowait
-			for(int v = 0; v < n-1; v += 2)
-			{
-				__m128d mm_disp_xv = _mm_load_pd(&disp_x[v]);
-				__m128d mm_disp_yv = _mm_load_pd(&disp_y[v]);
-
-				__m128d mm_dist = _mm_max_pd(mm_minDist, _mm_sqrt_pd(
-					_mm_add_pd(_mm_mul_pd(mm_disp_xv,mm_disp_xv),_mm_mul_pd(mm_disp_yv,mm_disp_yv))
-				));
-
-				_mm_store_pd(&C.m_x[v], _mm_add_pd(_mm_load_pd(&C.m_x[v]),
-					_mm_mul_pd(_mm_div_pd(mm_disp_xv, mm_dist), _mm_min_pd(mm_dist,mm_tx))
-				));
-				_mm_store_pd(&C.m_y[v], _mm_add_pd(_mm_load_pd(&C.m_y[v]),
-					_mm_mul_pd(_mm_div_pd(mm_disp_yv, mm_dist), _mm_min_pd(mm_dist,mm_ty))
-				));
-			}
-			#pragma omp single nowait
-			{
-				if(n % 2) {
-					int v = n-1;
-					double dist = max(minDist, sqrt(disp_x[v]*disp_x[v] + disp_y[v]*disp_y[v]));
-
-					C.m_x[v] += disp_x[v] / dist * min(dist,tx);
-					C.m_y[v] += disp_y[v] / dist * min(dist,ty);
-				}
-			}
-
-			cool(tx,ty,cF);
-
-			#pragma omp barrier
-		}
-	}
-
-	System::alignedMemoryFree(disp_x);
-	System::alignedMemoryFree(disp_y);
-
-#else
-	mainStep(C);
-#endif
-}
-
-
 } // end namespace ogdf
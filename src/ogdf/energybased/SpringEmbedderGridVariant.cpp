@@ -33,14 +33,18 @@
  ***************************************************************/
 
 #include <ogdf/internal/energybased/SEGV_ForceModel.h>
+#include <ogdf/internal/energybased/FastUtils.h>
 
 #include <ogdf/packing/TileToRowsCCPacker.h>
 #include <ogdf/basic/GraphCopyAttributes.h>
 #include <ogdf/basic/simple_graph_alg.h>
 #include <ogdf/basic/Barrier.h>
-#include <ogdf/basic/Thread.h>
+#include <ogdf/basic/TaskScheduler.h>
 #include <ogdf/fileformats/GraphIO.h>
 #include <ogdf/basic/Math.h>
+#include <ogdf/basic/System.h>
+#include <algorithm>
+#include <atomic>
 #include <random>
 
 
@@ -98,6 +102,113 @@ SpringEmbedderGridVariant::SpringEmbedderGridVariant()
 }
 
 
+//! Repulsion kernel for processors without AVX.
+template<bool cubic>
+static void segvRepulsionDefault(const SEGVRepulsion &r, const int *range, const int *rangeStop, double px, double py, double &forceX, double &forceY)
+{
+#ifdef OGDF_SSE2_EXTENSIONS
+	segvRepulsion<SEGVSSE2Ops, cubic>(r, range, rangeStop, px, py, forceX, forceY);
+#else
+	segvRepulsion<SEGVScalarOps, cubic>(r, range, rangeStop, px, py, forceX, forceY);
+#endif
+}
+
+
+void SpringEmbedderGridVariant::Grid::init(int xA, int yA, int n)
+{
+	m_high1 = xA;
+	m_high2 = yA;
+
+	m_kernel = &segvRepulsionDefault<false>;
+	m_kernelCubic = &segvRepulsionDefault<true>;
+#ifdef OGDF_AVX_EXTENSIONS
+	if (System::cpuSupports(cpufAVX)) {
+		m_kernel = &segvRepulsionAVX;
+		m_kernelCubic = &segvRepulsionCubicAVX;
+	}
+#endif
+
+	// rank the cells in Morton order (cell coordinates are shifted to be non-negative)
+	const int numCells = (xA+2) * (yA+2);
+	std::vector<std::pair<uint64_t, int>> order;
+	order.reserve(numCells);
+	for (int x = -1; x <= xA; ++x) {
+		for (int y = -1; y <= yA; ++y) {
+			order.push_back(std::make_pair(mortonNumber<uint64_t, uint32_t>(x+1, y+1), (x+1) * (yA+2) + (y+1)));
+		}
+	}
+	std::sort(order.begin(), order.end());
+
+	m_rank.init(-1, xA, -1, yA);
+	for (int c = 0; c < numCells; ++c) {
+		const int cell = order[c].second;
+		m_rank(cell / (yA+2) - 1, cell % (yA+2) - 1) = c;
+	}
+
+	// merge the neighbourhood of each cell that may contain nodes into ranges of consecutive ranks
+	m_rangeStart.init(numCells+1);
+	m_ranges.clear();
+	for (int c = 0; c < numCells; ++c) {
+		m_rangeStart[c] = m_ranges.size();
+
+		const int x = order[c].second / (yA+2) - 1;
+		const int y = order[c].second % (yA+2) - 1;
+		if (x < 0 || x >= xA || y < 0 || y >= yA) {
+			continue;
+		}
+
+		int neighbours[9], k = 0;
+		for (int dx = -1; dx <= 1; ++dx) {
+			for (int dy = -1; dy <= 1; ++dy) {
+				neighbours[k++] = m_rank(x+dx, y+dy);
+			}
+		}
+		std::sort(neighbours, neighbours+9);
+
+		for (int i = 0; i < 9; ) {
+			int stop = i+1;
+			while (stop < 9 && neighbours[stop] == neighbours[stop-1] + 1) {
+				++stop;
+			}
+			m_ranges.push(neighbours[i]);
+			m_ranges.push(neighbours[stop-1] + 1);
+			i = stop;
+		}
+	}
+	m_rangeStart[numCells] = m_ranges.size();
+
+	m_cellStart.init(numCells+1);
+	m_node.init(n);
+	m_x.init(0, n + SEGVRepulsion::padding - 1, 0.0);
+	m_y.init(0, n + SEGVRepulsion::padding - 1, 0.0);
+}
+
+
+void SpringEmbedderGridVariant::Grid::sort(const Array<NodeInfo> &vInfo)
+{
+	const int n = m_node.size();
+	const int numCells = m_cellStart.high();
+
+	// counting sort, afterwards m_cellStart[c] is the end of cell c
+	m_cellStart.fill(0);
+	for (int j = 0; j < n; ++j) {
+		++m_cellStart[m_rank(vInfo[j].m_gridX, vInfo[j].m_gridY)];
+	}
+	for (int c = 1; c <= numCells; ++c) {
+		m_cellStart[c] += m_cellStart[c-1];
+	}
+
+	// fill the cells from the back, which turns the ends into starts and keeps the nodes of a cell in order
+	for (int j = n-1; j >= 0; --j) {
+		const NodeInfo &vj = vInfo[j];
+		const int k = --m_cellStart[m_rank(vj.m_gridX, vj.m_gridY)];
+		m_node[k] = j;
+		m_x[k] = vj.m_pos.m_x;
+		m_y[k] = vj.m_pos.m_y;
+	}
+}
+
+
 class SpringEmbedderGridVariant::Master {
 
 	const SpringEmbedderGridVariant &m_spring;
@@ -109,7 +220,7 @@ class SpringEmbedderGridVariant::Master {
 	Array<NodeInfo>        m_vInfo;
 	Array<DPoint>          m_disp;
 	Array<int>             m_adjLists;
-	Array2D<ListPure<int>> m_gridCell;
+	Grid                   m_grid;
 
 	ForceModelBase *m_forceModel;
 	ForceModelBase *m_forceModelImprove;
@@ -117,6 +228,8 @@ class SpringEmbedderGridVariant::Master {
 	Array<Worker*>  m_worker;
 	Barrier        *m_barrier;
 
+	std::atomic<int> m_nextChunk; //!< First sorted node of the next chunk of the force computation.
+
 	double m_idealEdgeLength;
 
 	double m_tNull;
@@ -136,6 +249,9 @@ class SpringEmbedderGridVariant::Master {
 	double m_scaleFactor;
 
 public:
+	//! Number of nodes a worker takes at once in the force computation.
+	static const int chunkSize = 64;
+
 	Master(const SpringEmbedderGridVariant &spring, const GraphCopy &gc, GraphAttributes &ga, DPoint &boundingBox);
 	~Master() {
 		delete m_barrier;
@@ -167,7 +283,7 @@ public:
 	Array<NodeInfo> &vInfo() { return m_vInfo; }
 	Array<DPoint> &disp() { return m_disp; }
 	Array<int> &adjLists() { return m_adjLists; }
-	Array2D<ListPure<int>> &gridCell() { return m_gridCell; }
+	Grid &grid() { return m_grid; }
 
 	const ForceModelBase &forceModel() const { return *m_forceModel; }
 	const ForceModelBase &forceModelImprove() const { return *m_forceModelImprove; }
@@ -177,6 +293,16 @@ public:
 			m_barrier->threadSync();
 	}
 
+	//! Returns the first sorted node of the next chunk of the force computation.
+	/**
+	 * The chunks are handed out dynamically, so workers that get nodes in
+	 * sparse regions of the drawing simply take more chunks.
+	 */
+	int nextChunk() { return m_nextChunk.fetch_add(chunkSize); }
+
+	//! Starts handing out chunks from the beginning (called between two barriers).
+	void resetChunks() { m_nextChunk = 0; }
+
 	void computeGrid(double wsum, double hsum, double xmin, double xmax, double ymin, double ymax);
 	void updateGridAndMoveNodes();
 	void scaleLayout(double sumLengths);
@@ -225,6 +351,7 @@ public:
 
 private:
 	double sumUpLengths(Array<NodeInfo> &vInfo, const Array<int> &adjLists);
+	void computeDisplacements(const ForceModelBase &forceModel, double f, minstd_rand &rng);
 	void scaling(Array<NodeInfo> &vInfo, const Array<int> &adjLists);
 	void finalScaling(Array<NodeInfo> &vInfo, const Array<int> &adjLists);
 };
@@ -233,13 +360,15 @@ private:
 
 SpringEmbedderGridVariant::Master::Master(const SpringEmbedderGridVariant &spring, const GraphCopy &gc, GraphAttributes &ga, DPoint &boundingBox) :
 	m_spring(spring), m_gc(gc), m_ga(ga), m_boundingBox(boundingBox),
-	m_index(gc), m_vInfo(gc.numberOfNodes()), m_disp(gc.numberOfNodes()), m_adjLists(2*gc.numberOfEdges()), m_forceModel(nullptr), m_forceModelImprove(nullptr),
+	m_index(gc), m_vInfo(gc.numberOfNodes()), m_disp(gc.numberOfNodes()), m_adjLists(2*gc.numberOfEdges()), m_forceModel(nullptr), m_forceModelImprove(nullptr), m_nextChunk(0),
 	m_avgDisplacement(numeric_limits<double>::max()), m_maxDisplacement(numeric_limits<double>::max())
 {
 	const unsigned int minNodesPerThread = 64;
 	const unsigned int n = gc.numberOfNodes();
 
-	unsigned int nThreads = max( 1u, min(spring.m_maxThreads, (n/4) / (minNodesPerThread/4)) );
+	// the workers synchronize by a barrier, so they must run concurrently
+	TaskScheduler::Gang gang(max( 1u, min(spring.m_maxThreads, (n/4) / (minNodesPerThread/4)) ));
+	unsigned int nThreads = gang.size();
 	m_worker.init(nThreads);
 
 	if(nThreads == 1) {
@@ -278,21 +407,17 @@ SpringEmbedderGridVariant::Master::Master(const SpringEmbedderGridVariant &sprin
 
 		m_barrier = new Barrier(nThreads);
 
-		Array<Thread> thread(nThreads-1);
-
-		for(unsigned int i = 1; i < nThreads; ++i) {
+		for(unsigned int i = 0; i < nThreads; ++i) {
 			m_worker[i] =
 				new Worker(i, *this, startIndex[i], startIndex[i+1], startNode[i], startNode[i+1], eStartIndex[i]);
-			thread [i-1] = Thread(*m_worker[i]);
 		}
 
-		m_worker[0] = new Worker(0, *this, startIndex[0], startIndex[1], startNode[0], startNode[1], eStartIndex[0]);
-		(*m_worker[0])();
+		gang.run([this](unsigned int i) {
+			(*m_worker[i])();
+		});
 
-		for(unsigned int i = 1; i < nThreads; ++i) {
-			thread[i-1].join();
+		for(unsigned int i = 1; i < nThreads; ++i)
 			delete m_worker[i];
-		}
 	}
 
 	delete m_worker[0];
@@ -390,60 +515,61 @@ void SpringEmbedderGridVariant::Master::computeGrid(double wsum, double hsum, do
 	OGDF_ASSERT(width >= 0);
 	OGDF_ASSERT(height >= 0);
 
-	initUnfoldPhase();
-
 	double k = sqrt(width*height / n);
 	m_k2 = max(1e-3, 2*k);
 
 	if(scaling != Scaling::useIdealEdgeLength)
 		m_idealEdgeLength = k;
 
+	// the initial force limit depends on the ideal edge length
+	initUnfoldPhase();
+
 	switch(m_spring.m_forceModel) {
 	case SpringForceModel::FruchtermanReingold:
-		m_forceModel = new ForceModelFR(m_vInfo, m_adjLists, m_gridCell, m_idealEdgeLength);
+		m_forceModel = new ForceModelFR(m_vInfo, m_adjLists, m_grid, m_idealEdgeLength);
 		break;
 	case SpringForceModel::FruchtermanReingoldModAttr:
-		m_forceModel = new ForceModelFRModAttr(m_vInfo, m_adjLists, m_gridCell, m_idealEdgeLength);
+		m_forceModel = new ForceModelFRModAttr(m_vInfo, m_adjLists, m_grid, m_idealEdgeLength);
 		break;
 	case SpringForceModel::FruchtermanReingoldModRep:
-		m_forceModel = new ForceModelFRModRep(m_vInfo, m_adjLists, m_gridCell, m_idealEdgeLength);
+		m_forceModel = new ForceModelFRModRep(m_vInfo, m_adjLists, m_grid, m_idealEdgeLength);
 		break;
 	case SpringForceModel::Eades:
-		m_forceModel = new ForceModelEades(m_vInfo, m_adjLists, m_gridCell, m_idealEdgeLength);
+		m_forceModel = new ForceModelEades(m_vInfo, m_adjLists, m_grid, m_idealEdgeLength);
 		break;
 	case SpringForceModel::Hachul:
-		m_forceModel = new ForceModelHachul(m_vInfo, m_adjLists, m_gridCell, m_idealEdgeLength);
+		m_forceModel = new ForceModelHachul(m_vInfo, m_adjLists, m_grid, m_idealEdgeLength);
 		break;
 	case SpringForceModel::Gronemann:
-		m_forceModel = new ForceModelGronemann(m_vInfo, m_adjLists, m_gridCell, m_idealEdgeLength);
+		m_forceModel = new ForceModelGronemann(m_vInfo, m_adjLists, m_grid, m_idealEdgeLength);
 		break;
 	}
 
 	switch(m_spring.m_forceModelImprove) {
 	case SpringForceModel::FruchtermanReingold:
-		m_forceModelImprove = new ForceModelFR(m_vInfo, m_adjLists, m_gridCell, m_idealEdgeLength);
+		m_forceModelImprove = new ForceModelFR(m_vInfo, m_adjLists, m_grid, m_idealEdgeLength);
 		break;
 	case SpringForceModel::FruchtermanReingoldModAttr:
-		m_forceModelImprove = new ForceModelFRModAttr(m_vInfo, m_adjLists, m_gridCell, m_idealEdgeLength);
+		m_forceModelImprove = new ForceModelFRModAttr(m_vInfo, m_adjLists, m_grid, m_idealEdgeLength);
 		break;
 	case SpringForceModel::FruchtermanReingoldModRep:
-		m_forceModelImprove = new ForceModelFRModRep(m_vInfo, m_adjLists, m_gridCell, m_idealEdgeLength);
+		m_forceModelImprove = new ForceModelFRModRep(m_vInfo, m_adjLists, m_grid, m_idealEdgeLength);
 		break;
 	case SpringForceModel::Eades:
-		m_forceModelImprove = new ForceModelEades(m_vInfo, m_adjLists, m_gridCell, m_idealEdgeLength);
+		m_forceModelImprove = new ForceModelEades(m_vInfo, m_adjLists, m_grid, m_idealEdgeLength);
 		break;
 	case SpringForceModel::Hachul:
-		m_forceModelImprove = new ForceModelHachul(m_vInfo, m_adjLists, m_gridCell, m_idealEdgeLength);
+		m_forceModelImprove = new ForceModelHachul(m_vInfo, m_adjLists, m_grid, m_idealEdgeLength);
 		break;
 	case SpringForceModel::Gronemann:
-		m_forceModelImprove = new ForceModelGronemann(m_vInfo, m_adjLists, m_gridCell, m_idealEdgeLength);
+		m_forceModelImprove = new ForceModelGronemann(m_vInfo, m_adjLists, m_grid, m_idealEdgeLength);
 		break;
 	}
 
 	// build  grid cells
 	int xA = int(width / m_k2 + 2);
 	int yA = int(height / m_k2 + 2);
-	m_gridCell.init(-1,xA,-1,yA);
+	m_grid.init(xA, yA, n);
 
 	for(int j = 0; j < n; ++j)
 	{
@@ -456,9 +582,9 @@ void SpringEmbedderGridVariant::Master::computeGrid(double wsum, double hsum, do
 		OGDF_ASSERT(vj.m_gridX > -1);
 		OGDF_ASSERT(vj.m_gridY < yA);
 		OGDF_ASSERT(vj.m_gridY > -1);
-
-		m_vInfo[j].m_lit = m_gridCell(vj.m_gridX,vj.m_gridY).pushFront(j);
 	}
+
+	m_grid.sort(m_vInfo);
 }
 
 
@@ -484,8 +610,8 @@ void SpringEmbedderGridVariant::Master::updateGridAndMoveNodes()
 
 	m_avgDisplacement = sumForces / numberOfNodes();
 
-	const int xA = m_gridCell.high1();
-	const int yA = m_gridCell.high2();
+	const int xA = m_grid.high1();
+	const int yA = m_grid.high2();
 
 	// prevent drawing area from getting too small
 	double hMargin = 0.5 * max(0.0, m_idealEdgeLength * xA - (xmax-xmin));
@@ -507,21 +633,17 @@ void SpringEmbedderGridVariant::Master::updateGridAndMoveNodes()
 		vj.m_pos += m_disp[j];
 
 		// new cell
-		int grid_x = int((vj.m_pos.m_x - m_xleft ) / m_k2);
-		int grid_y = int((vj.m_pos.m_y - m_ysmall) / m_k2);
-
-		OGDF_ASSERT(grid_x >= 0);
-		OGDF_ASSERT(grid_x < m_gridCell.high1());
-		OGDF_ASSERT(grid_y >= 0);
-		OGDF_ASSERT(grid_y < m_gridCell.high2());
-
-		// move to different cell?
-		if( (grid_x != vj.m_gridX) || (grid_y != vj.m_gridY) ) {
-			m_gridCell(vj.m_gridX,vj.m_gridY).moveToFront(vj.m_lit, m_gridCell(grid_x,grid_y));
-			vj.m_gridX = grid_x;
-			vj.m_gridY = grid_y;
-		}
+		vj.m_gridX = int((vj.m_pos.m_x - m_xleft ) / m_k2);
+		vj.m_gridY = int((vj.m_pos.m_y - m_ysmall) / m_k2);
+
+		OGDF_ASSERT(vj.m_gridX >= 0);
+		OGDF_ASSERT(vj.m_gridX < xA);
+		OGDF_ASSERT(vj.m_gridY >= 0);
+		OGDF_ASSERT(vj.m_gridY < yA);
 	}
+
+	m_grid.sort(m_vInfo);
+	resetChunks();
 }
 
 
@@ -567,6 +689,8 @@ void SpringEmbedderGridVariant::Master::initUnfoldPhase()
 	// convergence
 	m_avgDisplacement = numeric_limits<double>::max();
 	m_maxDisplacement = numeric_limits<double>::max();
+
+	resetChunks();
 }
 
 
@@ -580,6 +704,8 @@ void SpringEmbedderGridVariant::Master::initImprovementPhase()
 	// convergence
 	m_avgDisplacement = numeric_limits<double>::max();
 	m_maxDisplacement = numeric_limits<double>::max();
+
+	resetChunks();
 }
 
 
@@ -597,7 +723,7 @@ void SpringEmbedderGridVariant::Master::scaleLayout(double sumLengths)
 	m_ysmall *= m_scaleFactor;
 	m_ybig   *= m_scaleFactor;
 
-	m_k2 = max( (m_xright-m_xleft) / (m_gridCell.high1()-1), (m_ybig-m_ysmall) / (m_gridCell.high2()-1) );
+	m_k2 = max( (m_xright-m_xleft) / (m_grid.high1()-1), (m_ybig-m_ysmall) / (m_grid.high2()-1) );
 }
 
 
@@ -698,6 +824,67 @@ double SpringEmbedderGridVariant::Worker::sumUpLengths(Array<NodeInfo> &vInfo, c
 }
 
 
+void SpringEmbedderGridVariant::Worker::computeDisplacements(const ForceModelBase &forceModel, double f, minstd_rand &rng)
+{
+	const Grid      &grid  = m_master.grid();
+	Array<NodeInfo> &vInfo = m_master.vInfo();
+	Array<DPoint>   &disp  = m_master.disp();
+
+	const int n = m_master.numberOfNodes();
+	const bool noise = m_master.noise();
+	const double boxLength = m_master.boxLength();
+	const double t = m_master.maxForceLength();
+
+	uniform_real_distribution<> rand(0.75,1.25);
+
+	double xmin = numeric_limits<double>::max(), xmax = -numeric_limits<double>::max();
+	double ymin = numeric_limits<double>::max(), ymax = -numeric_limits<double>::max();
+
+	double sumForces = 0.0;
+	double maxForce  = 0.0;
+
+	// take chunks of nodes in the order of their cells until all are done
+	for(int k = m_master.nextChunk(); k < n; k = m_master.nextChunk()) {
+		const int stop = min(k + Master::chunkSize, n);
+		for(; k < stop; ++k) {
+			const int j = grid.sortedNode(k);
+			NodeInfo &vj = vInfo[j];
+
+			DPoint dp = forceModel.computeDisplacement(j, boxLength);
+
+			// noise
+			if(noise) {
+				dp.m_x *= rand(rng);
+				dp.m_y *= rand(rng);
+			}
+
+			double length = dp.norm();
+			sumForces += length;
+			updateMax(maxForce, length);
+
+			double s = (length <= t) ? f : f * t / length;
+			dp *= s;
+
+			DPoint newPos = vj.m_pos + dp;
+
+			// update new bounding box
+			updateMin(xmin, newPos.m_x);
+			updateMax(xmax, newPos.m_x);
+			updateMin(ymin, newPos.m_y);
+			updateMax(ymax, newPos.m_y);
+
+			// store displacement
+			disp[j] = dp;
+		}
+	}
+
+	m_xmin = xmin; m_xmax = xmax;
+	m_ymin = ymin; m_ymax = ymax;
+	m_sumForces = sumForces;
+	m_maxForce  = maxForce;
+}
+
+
 void SpringEmbedderGridVariant::Worker::scaling(Array<NodeInfo> &vInfo, const Array<int> &adjLists)
 {
 	m_sumLengths = sumUpLengths(vInfo, adjLists);
@@ -712,6 +899,7 @@ void SpringEmbedderGridVariant::Worker::scaling(Array<NodeInfo> &vInfo, const Ar
 	double s = m_master.scaleFactor();
 	for(int j = m_vStartIndex; j < m_vStopIndex; ++j)
 		vInfo[j].m_pos *= s;
+	m_master.grid().scale(m_vStartIndex, m_vStopIndex, s);
 
 	if(m_id == 0)
 		m_master.initImprovementPhase();
@@ -740,7 +928,7 @@ void SpringEmbedderGridVariant::Worker::finalScaling(Array<NodeInfo> &vInfo, con
 	double ymin = numeric_limits<double>::max(), ymax = -numeric_limits<double>::max();
 
 	node v = m_vStart;
-	for(int j = m_vStartIndex; j < m_vStopIndex; ++j) {
+	for(int j = m_vStartIndex; j < m_vStopIndex; v = v->succ(), ++j) {
 		node vOrig = gc.original(v);
 		NodeInfo &vj = vInfo[j];
 
@@ -824,14 +1012,10 @@ void SpringEmbedderGridVariant::Worker::operator()()
 	// Main step
 	//---------------------------------
 
-	const bool noise = m_master.noise();
 	Array<DPoint> &disp = m_master.disp();
 
 	// random number generator for adding noise
 	minstd_rand rng(randomSeed());
-	uniform_real_distribution<> rand(0.75,1.25);
-
-	//Array2D<ListPure<int>> &gridCell = m_master.gridCell();
 
 	// --- Unfold Phase ---
 
@@ -840,52 +1024,7 @@ void SpringEmbedderGridVariant::Worker::operator()()
 	const int numIter = m_master.numberOfIterations();
 	for(int iter = 1; m_master.hasConverged() == false && iter <= numIter; ++iter)
 	{
-		double boxLength = m_master.boxLength();
-
-		xmin = numeric_limits<double>::max(); xmax = -numeric_limits<double>::max();
-		ymin = numeric_limits<double>::max(); ymax = -numeric_limits<double>::max();
-
-		double sumForces = 0.0;
-		double maxForce  = 0.0;
-
-		double t = m_master.maxForceLength();
-		double f = m_master.coolingFactor() * forceScaleFactor;
-
-		for(int j = m_vStartIndex; j < m_vStopIndex; ++j) {
-			NodeInfo &vj = vInfo[j];
-
-			DPoint dp = forceModel.computeDisplacement(j, boxLength);
-
-			// noise
-			if(noise) {
-				dp.m_x *= rand(rng);
-				dp.m_y *= rand(rng);
-			}
-
-			double length = dp.norm();
-			sumForces += length;
-			updateMax(maxForce, length);
-
-			//double s = (length <= t) ? forceScaleFactor : forceScaleFactor * t / length;
-			double s = (length <= t) ? f : f * t / length;
-			dp *= s;
-
-			DPoint newPos = vj.m_pos + dp;
-
-			// update new bounding box
-			updateMin(xmin, newPos.m_x);
-			updateMax(xmax, newPos.m_x);
-			updateMin(ymin, newPos.m_y);
-			updateMax(ymax, newPos.m_y);
-
-			// store displacement
-			disp[j] = dp;
-		}
-
-		m_xmin = xmin; m_xmax = xmax;
-		m_ymin = ymin; m_ymax = ymax;
-		m_sumForces = sumForces;
-		m_maxForce  = maxForce;
+		computeDisplacements(forceModel, m_master.coolingFactor() * forceScaleFactor, rng);
 
 		m_master.syncThreads();
 
@@ -910,52 +1049,7 @@ void SpringEmbedderGridVariant::Worker::operator()()
 
 		for(int iter = 1; !m_master.hasConverged() && iter <= numIterImp; ++iter)
 		{
-			double boxLength = m_master.boxLength();
-
-			xmin = numeric_limits<double>::max(); xmax = -numeric_limits<double>::max();
-			ymin = numeric_limits<double>::max(); ymax = -numeric_limits<double>::max();
-
-			double sumForces = 0.0;
-			double maxForce  = 0.0;
-
-			double t = m_master.maxForceLength();
-			double f = m_master.coolingFactor() * forceScaleFactor;
-
-			for(int j = m_vStartIndex; j < m_vStopIndex; ++j) {
-				NodeInfo &vj = vInfo[j];
-
-				DPoint dp = forceModelImprove.computeDisplacement(j, boxLength);
-
-				// noise
-				if(noise) {
-					dp.m_x *= rand(rng);
-					dp.m_y *= rand(rng);
-				}
-
-				double length = dp.norm();
-				sumForces += length;
-				updateMax(maxForce, length);
-
-				//double s = (length <= t) ? forceScaleFactor : forceScaleFactor * t / length;
-				double s = (length <= t) ? f : f * t / length;
-				dp *= s;
-
-				DPoint newPos = vj.m_pos + dp;
-
-				// update new bounding box
-				updateMin(xmin, newPos.m_x);
-				updateMax(xmax, newPos.m_x);
-				updateMin(ymin, newPos.m_y);
-				updateMax(ymax, newPos.m_y);
-
-				// store displacement
-				disp[j] = dp;
-			}
-
-			m_xmin = xmin; m_xmax = xmax;
-			m_ymin = ymin; m_ymax = ymax;
-			m_sumForces = sumForces;
-			m_maxForce  = maxForce;
+			computeDisplacements(forceModelImprove, m_master.coolingFactor() * forceScaleFactor, rng);
 
 			m_master.syncThreads();
 
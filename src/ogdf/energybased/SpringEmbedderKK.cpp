@@ -33,7 +33,11 @@
  ***************************************************************/
 
 #include <ogdf/energybased/SpringEmbedderKK.h>
-#include <ogdf/basic/SList.h>
+#include <ogdf/basic/CSRGraph.h>
+#include <ogdf/graphalg/ShortestPathAlgorithms.h>
+#include <ogdf/basic/TaskScheduler.h>
+#include <ogdf/basic/Thread.h>
+#include <ogdf/internal/basic/intrinsics.h>
 
 #ifdef OGDF_DEBUG
 #include <ogdf/basic/simple_graph_alg.h>
@@ -45,12 +49,375 @@ const double SpringEmbedderKK::minVal = DBL_MIN;
 const double SpringEmbedderKK::desMinLength = 0.0001;
 const int SpringEmbedderKK::maxVal = numeric_limits<int>::max();
 
+
+//! The state of the main loop of SpringEmbedderKK on flat arrays.
+/**
+ * Nodes are identified by their ids in the (symmetric) matrices of spring lengths
+ * and strengths, so the contribution of node \a m to the partial derivatives of all
+ * other nodes is computed from row \a m. Sums over all nodes are accumulated in two
+ * lanes, one for the even and one for the odd ids; hence the SSE2 kernels and the
+ * scalar ones give identical results.
+ *
+ * The partial derivatives of all nodes are updated by a gang of workers of the
+ * global TaskScheduler. Every node is handled independently and ties in the
+ * search for the node with maximum delta are broken by the smallest id, so the
+ * layout does not depend on the number of threads.
+ */
+class KamadaKawaiIteration {
+	//! Minimum number of nodes per thread; below that, synchronization dominates.
+	static const int minNodesPerThread = 256;
+
+	const NodeMatrix<double> &m_length;		//!< The original spring lengths l_ij.
+	const NodeMatrix<double> &m_strength;	//!< The spring strengths k_ij.
+	const int m_n;							//!< The number of nodes.
+	Array<double> m_x, m_y;					//!< The positions of the nodes.
+	Array<double> m_derX, m_derY;			//!< The partial derivatives of the nodes.
+
+	TaskScheduler::Gang m_gang;	//!< The threads running the parallel steps.
+	unsigned int m_numThreads;	//!< The number of threads including the calling one.
+
+	// the current parallel step
+	enum class Step { Initialize, Update } m_step;
+	int m_moved;				//!< The node moved by the last local iterations.
+	double m_oldX, m_oldY;		//!< The position of #m_moved before these iterations.
+	Array<int> m_bestOf;		//!< The node with maximum delta per thread.
+	Array<double> m_deltaOf;	//!< The maximum delta per thread.
+
+public:
+	KamadaKawaiIteration(const GraphAttributes &GA,
+		const NodeMatrix<double> &oLength,
+		const NodeMatrix<double> &sstrength,
+		unsigned int numThreads)
+	  : m_length(oLength), m_strength(sstrength), m_n(oLength.size()),
+		m_x(m_n), m_y(m_n), m_derX(m_n), m_derY(m_n),
+		m_gang(numberOfThreads(numThreads, m_n)), m_numThreads(m_gang.size()),
+		m_bestOf(m_numThreads), m_deltaOf(m_numThreads)
+	{
+		for (int i = 0; i < m_n; ++i) {
+			node v = oLength.original(i);
+			m_x[i] = GA.x(v);
+			m_y[i] = GA.y(v);
+		}
+	}
+
+	//! Returns the x-coordinate of node \a i.
+	double x(int i) const { return m_x[i]; }
+	//! Returns the y-coordinate of node \a i.
+	double y(int i) const { return m_y[i]; }
+	//! Returns dE/dx_i.
+	double derivativeX(int i) const { return m_derX[i]; }
+	//! Returns dE/dy_i.
+	double derivativeY(int i) const { return m_derY[i]; }
+
+	//! Moves node \a i by (\a dx, \a dy).
+	void move(int i, double dx, double dy) {
+		m_x[i] += dx;
+		m_y[i] += dy;
+	}
+
+	//! Copies the positions of the nodes to \a GA and their partial derivatives to \a partialDer.
+	void copyTo(GraphAttributes &GA, NodeArray<SpringEmbedderKK::dpair> &partialDer) const {
+		for (int i = 0; i < m_n; ++i) {
+			node v = m_length.original(i);
+			GA.x(v) = m_x[i];
+			GA.y(v) = m_y[i];
+			partialDer[v] = SpringEmbedderKK::dpair(m_derX[i], m_derY[i]);
+		}
+	}
+
+	//! Computes the partial derivatives of all nodes and the node \a best with maximum delta.
+	void computeDerivatives(int &best, double &delta) {
+		m_step = Step::Initialize;
+		best = 0;
+		delta = 0.0;
+		runParallel(best, delta);
+	}
+
+	//! Recomputes the partial derivatives of node \a m and returns its delta.
+	double computeDerivative(int m) {
+		sumDerivative(m, m_derX[m], m_derY[m]);
+		return sqrt(m_derX[m] * m_derX[m] + m_derY[m] * m_derY[m]);
+	}
+
+	//! Updates the partial derivatives of all nodes after \a m has been moved from
+	//! (\a oldX, \a oldY) and updates the node \a best with maximum \a delta.
+	void updateDerivatives(int m, double oldX, double oldY, int &best, double &delta) {
+		m_step = Step::Update;
+		m_moved = m;
+		m_oldX = oldX;
+		m_oldY = oldY;
+		runParallel(best, delta);
+	}
+
+	//! Computes the elements of the Jacobian of node \a m (dE_dy_dx equals \a dxy).
+	void jacobian(int m, double &dxx, double &dxy, double &dyy) const;
+
+private:
+	//! Returns the number of threads to be used for \a n nodes.
+	static unsigned int numberOfThreads(unsigned int numThreads, int n) {
+#ifdef OGDF_MEMORY_POOL_NTS
+		return 1;
+#else
+		if (numThreads == 0) {
+			numThreads = max(1u, Thread::hardware_concurrency());
+		}
+		return max(1u, min(numThreads, (unsigned int)(n / minNodesPerThread)));
+#endif
+	}
+
+	//! Runs the current step on all threads and updates \a best and \a delta
+	//! by the results of the threads in order.
+	void runParallel(int &best, double &delta) {
+		m_gang.run([this](unsigned int t) { runStep(t); });
+		for (unsigned int t = 0; t < m_numThreads; ++t) {
+			if (m_deltaOf[t] > delta) {
+				best = m_bestOf[t];
+				delta = m_deltaOf[t];
+			}
+		}
+	}
+
+	//! Runs the current step for the nodes of thread \a t.
+	void runStep(unsigned int t) {
+		const int begin = int(t * (long long)m_n / m_numThreads);
+		const int end = int((t + 1) * (long long)m_n / m_numThreads);
+		m_bestOf[t] = -1;
+		m_deltaOf[t] = -1.0;
+		if (m_step == Step::Initialize) {
+			for (int i = begin; i < end; ++i) {
+				sumDerivative(i, m_derX[i], m_derY[i]);
+				checkDelta(t, i);
+			}
+		} else {
+			update(t, begin, end);
+		}
+	}
+
+	//! Updates the node with maximum delta of thread \a t by node \a i.
+	void checkDelta(unsigned int t, int i) {
+		double delta = sqrt(m_derX[i] * m_derX[i] + m_derY[i] * m_derY[i]);
+		if (delta > m_deltaOf[t]) {
+			m_bestOf[t] = i;
+			m_deltaOf[t] = delta;
+		}
+	}
+
+	//! Returns the contribution of node \a u to the partial derivatives of node \a m
+	//! at (\a xm, \a ym); \a k and \a l are the strength and length of their spring.
+	static void contribution(double xm, double ym, double xu, double yu, double k, double l,
+		double &dx, double &dy) {
+		double x_diff = xm - xu;
+		double y_diff = ym - yu;
+		double distance = sqrt(x_diff * x_diff + y_diff * y_diff);
+		dx = k * (x_diff - l * x_diff / distance);
+		dy = k * (y_diff - l * y_diff / distance);
+	}
+
+	//! Computes the partial derivatives of node \a m by summing up over all nodes.
+	void sumDerivative(int m, double &dx, double &dy) const;
+
+	//! Updates the partial derivatives of the nodes in [\a begin, \a end) of thread \a t
+	//! after #m_moved has been moved.
+	void update(unsigned int t, int begin, int end);
+};
+
+
+void KamadaKawaiIteration::sumDerivative(int m, double &dx, double &dy) const
+{
+	const double *k = m_strength.row(m);
+	const double *l = m_length.row(m);
+	const double xm = m_x[m], ym = m_y[m];
+	double sumX[2] = {0.0, 0.0}, sumY[2] = {0.0, 0.0};
+	int u = 0;
+
+#ifdef OGDF_SSE2_EXTENSIONS
+	__m128d mm_sumX = _mm_setzero_pd();
+	__m128d mm_sumY = _mm_setzero_pd();
+	const __m128d mm_xm = _mm_set1_pd(xm);
+	const __m128d mm_ym = _mm_set1_pd(ym);
+	// clears the lane of m in the pair containing it
+	const __m128d mm_mask = (m & 1) ? _mm_castsi128_pd(_mm_set_epi32(0, 0, -1, -1))
+	                                : _mm_castsi128_pd(_mm_set_epi32(-1, -1, 0, 0));
+
+	for (; u + 1 < m_n; u += 2) {
+		__m128d mm_x_diff = _mm_sub_pd(mm_xm, _mm_loadu_pd(&m_x[u]));
+		__m128d mm_y_diff = _mm_sub_pd(mm_ym, _mm_loadu_pd(&m_y[u]));
+		__m128d mm_distance = _mm_sqrt_pd(_mm_add_pd(
+			_mm_mul_pd(mm_x_diff, mm_x_diff), _mm_mul_pd(mm_y_diff, mm_y_diff)));
+		__m128d mm_k = _mm_loadu_pd(&k[u]);
+		__m128d mm_l = _mm_loadu_pd(&l[u]);
+		__m128d mm_dx = _mm_mul_pd(mm_k, _mm_sub_pd(mm_x_diff,
+			_mm_div_pd(_mm_mul_pd(mm_l, mm_x_diff), mm_distance)));
+		__m128d mm_dy = _mm_mul_pd(mm_k, _mm_sub_pd(mm_y_diff,
+			_mm_div_pd(_mm_mul_pd(mm_l, mm_y_diff), mm_distance)));
+		if ((u >> 1) == (m >> 1)) {
+			mm_dx = _mm_and_pd(mm_dx, mm_mask);
+			mm_dy = _mm_and_pd(mm_dy, mm_mask);
+		}
+		mm_sumX = _mm_add_pd(mm_sumX, mm_dx);
+		mm_sumY = _mm_add_pd(mm_sumY, mm_dy);
+	}
+	_mm_storeu_pd(sumX, mm_sumX);
+	_mm_storeu_pd(sumY, mm_sumY);
+#endif
+
+	for (; u < m_n; ++u) {
+		double cx = 0.0, cy = 0.0;
+		if (u != m) {
+			contribution(xm, ym, m_x[u], m_y[u], k[u], l[u], cx, cy);
+		}
+		sumX[u & 1] += cx;
+		sumY[u & 1] += cy;
+	}
+
+	dx = sumX[0] + sumX[1];
+	dy = sumY[0] + sumY[1];
+}
+
+
+void KamadaKawaiIteration::jacobian(int m, double &dxx, double &dxy, double &dyy) const
+{
+	const double *k = m_strength.row(m);
+	const double *l = m_length.row(m);
+	const double xm = m_x[m], ym = m_y[m];
+	double sumXX[2] = {0.0, 0.0}, sumXY[2] = {0.0, 0.0}, sumYY[2] = {0.0, 0.0};
+	int u = 0;
+
+#ifdef OGDF_SSE2_EXTENSIONS
+	__m128d mm_sumXX = _mm_setzero_pd();
+	__m128d mm_sumXY = _mm_setzero_pd();
+	__m128d mm_sumYY = _mm_setzero_pd();
+	const __m128d mm_one = _mm_set1_pd(1.0);
+	const __m128d mm_xm = _mm_set1_pd(xm);
+	const __m128d mm_ym = _mm_set1_pd(ym);
+	const __m128d mm_mask = (m & 1) ? _mm_castsi128_pd(_mm_set_epi32(0, 0, -1, -1))
+	                                : _mm_castsi128_pd(_mm_set_epi32(-1, -1, 0, 0));
+
+	for (; u + 1 < m_n; u += 2) {
+		__m128d mm_x_diff = _mm_sub_pd(mm_xm, _mm_loadu_pd(&m_x[u]));
+		__m128d mm_y_diff = _mm_sub_pd(mm_ym, _mm_loadu_pd(&m_y[u]));
+		__m128d mm_dist = _mm_sqrt_pd(_mm_add_pd(
+			_mm_mul_pd(mm_x_diff, mm_x_diff), _mm_mul_pd(mm_y_diff, mm_y_diff)));
+		__m128d mm_dist3 = _mm_mul_pd(_mm_mul_pd(mm_dist, mm_dist), mm_dist);
+		__m128d mm_k = _mm_loadu_pd(&k[u]);
+		__m128d mm_l = _mm_loadu_pd(&l[u]);
+		__m128d mm_xx = _mm_mul_pd(mm_k, _mm_sub_pd(mm_one,
+			_mm_div_pd(_mm_mul_pd(_mm_mul_pd(mm_l, mm_y_diff), mm_y_diff), mm_dist3)));
+		__m128d mm_xy = _mm_div_pd(_mm_mul_pd(_mm_mul_pd(_mm_mul_pd(mm_k, mm_l), mm_x_diff), mm_y_diff), mm_dist3);
+		__m128d mm_yy = _mm_mul_pd(mm_k, _mm_sub_pd(mm_one,
+			_mm_div_pd(_mm_mul_pd(_mm_mul_pd(mm_l, mm_x_diff), mm_x_diff), mm_dist3)));
+		if ((u >> 1) == (m >> 1)) {
+			mm_xx = _mm_and_pd(mm_xx, mm_mask);
+			mm_xy = _mm_and_pd(mm_xy, mm_mask);
+			mm_yy = _mm_and_pd(mm_yy, mm_mask);
+		}
+		mm_sumXX = _mm_add_pd(mm_sumXX, mm_xx);
+		mm_sumXY = _mm_add_pd(mm_sumXY, mm_xy);
+		mm_sumYY = _mm_add_pd(mm_sumYY, mm_yy);
+	}
+	_mm_storeu_pd(sumXX, mm_sumXX);
+	_mm_storeu_pd(sumXY, mm_sumXY);
+	_mm_storeu_pd(sumYY, mm_sumYY);
+#endif
+
+	for (; u < m_n; ++u) {
+		double cxx = 0.0, cxy = 0.0, cyy = 0.0;
+		if (u != m) {
+			double x_diff = xm - m_x[u];
+			double y_diff = ym - m_y[u];
+			double dist = sqrt(x_diff * x_diff + y_diff * y_diff);
+			double dist3 = dist * dist * dist;
+			OGDF_ASSERT(dist3 != 0.0);
+			cxx = k[u] * (1 - (l[u] * y_diff * y_diff)/dist3);
+			cxy = k[u] * l[u] * x_diff * y_diff / dist3;
+			cyy = k[u] * (1 - (l[u] * x_diff * x_diff)/dist3);
+		}
+		sumXX[u & 1] += cxx;
+		sumXY[u & 1] += cxy;
+		sumYY[u & 1] += cyy;
+	}
+
+	dxx = sumXX[0] + sumXX[1];
+	dxy = sumXY[0] + sumXY[1];
+	dyy = sumYY[0] + sumYY[1];
+}
+
+
+void KamadaKawaiIteration::update(unsigned int t, int begin, int end)
+{
+	const int m = m_moved;
+	const double *k = m_strength.row(m);
+	const double *l = m_length.row(m);
+	const double xm = m_x[m], ym = m_y[m];
+	int v = begin;
+
+#ifdef OGDF_SSE2_EXTENSIONS
+	const __m128d mm_xm = _mm_set1_pd(xm);
+	const __m128d mm_ym = _mm_set1_pd(ym);
+	const __m128d mm_oldX = _mm_set1_pd(m_oldX);
+	const __m128d mm_oldY = _mm_set1_pd(m_oldY);
+
+	for (; v + 1 < end; v += 2) {
+		__m128d mm_xv = _mm_loadu_pd(&m_x[v]);
+		__m128d mm_yv = _mm_loadu_pd(&m_y[v]);
+		__m128d mm_k = _mm_loadu_pd(&k[v]);
+		__m128d mm_l = _mm_loadu_pd(&l[v]);
+
+		// contribution of m at its new position
+		__m128d mm_x_diff = _mm_sub_pd(mm_xv, mm_xm);
+		__m128d mm_y_diff = _mm_sub_pd(mm_yv, mm_ym);
+		__m128d mm_distance = _mm_sqrt_pd(_mm_add_pd(
+			_mm_mul_pd(mm_x_diff, mm_x_diff), _mm_mul_pd(mm_y_diff, mm_y_diff)));
+		__m128d mm_newX = _mm_mul_pd(mm_k, _mm_sub_pd(mm_x_diff,
+			_mm_div_pd(_mm_mul_pd(mm_l, mm_x_diff), mm_distance)));
+		__m128d mm_newY = _mm_mul_pd(mm_k, _mm_sub_pd(mm_y_diff,
+			_mm_div_pd(_mm_mul_pd(mm_l, mm_y_diff), mm_distance)));
+
+		// contribution of m at its old position
+		mm_x_diff = _mm_sub_pd(mm_xv, mm_oldX);
+		mm_y_diff = _mm_sub_pd(mm_yv, mm_oldY);
+		mm_distance = _mm_sqrt_pd(_mm_add_pd(
+			_mm_mul_pd(mm_x_diff, mm_x_diff), _mm_mul_pd(mm_y_diff, mm_y_diff)));
+		__m128d mm_oldPX = _mm_mul_pd(mm_k, _mm_sub_pd(mm_x_diff,
+			_mm_div_pd(_mm_mul_pd(mm_l, mm_x_diff), mm_distance)));
+		__m128d mm_oldPY = _mm_mul_pd(mm_k, _mm_sub_pd(mm_y_diff,
+			_mm_div_pd(_mm_mul_pd(mm_l, mm_y_diff), mm_distance)));
+
+		__m128d mm_diffX = _mm_sub_pd(mm_newX, mm_oldPX);
+		__m128d mm_diffY = _mm_sub_pd(mm_newY, mm_oldPY);
+		if (v == m || v + 1 == m) {
+			// m does not contribute to itself
+			const __m128d mm_mask = (v == m) ? _mm_castsi128_pd(_mm_set_epi32(-1, -1, 0, 0))
+			                                 : _mm_castsi128_pd(_mm_set_epi32(0, 0, -1, -1));
+			mm_diffX = _mm_and_pd(mm_diffX, mm_mask);
+			mm_diffY = _mm_and_pd(mm_diffY, mm_mask);
+		}
+		_mm_storeu_pd(&m_derX[v], _mm_add_pd(_mm_loadu_pd(&m_derX[v]), mm_diffX));
+		_mm_storeu_pd(&m_derY[v], _mm_add_pd(_mm_loadu_pd(&m_derY[v]), mm_diffY));
+		checkDelta(t, v);
+		checkDelta(t, v + 1);
+	}
+#endif
+
+	for (; v < end; ++v) {
+		double newX = 0.0, newY = 0.0, oldX = 0.0, oldY = 0.0;
+		if (v != m) {
+			contribution(m_x[v], m_y[v], xm, ym, k[v], l[v], newX, newY);
+			contribution(m_x[v], m_y[v], m_oldX, m_oldY, k[v], l[v], oldX, oldY);
+		}
+		m_derX[v] += newX - oldX;
+		m_derY[v] += newY - oldY;
+		checkDelta(t, v);
+	}
+}
+
+
 void SpringEmbedderKK::initialize(
 	GraphAttributes& GA,
 	NodeArray<dpair>& partialDer,
 	const EdgeArray<double>& eLength,
-	NodeArray< NodeArray<double> >& oLength,
-	NodeArray< NodeArray<double> >& sstrength,
+	NodeMatrix<double>& oLength,
+	NodeMatrix<double>& sstrength,
 	double & maxDist,
 	bool simpleBFS)
 {
@@ -63,17 +430,12 @@ void SpringEmbedderKK::initialize(
 	if (!m_useLayout)
 		shufflePositions(GA);
 
-	//the shortest path lengths
-	for(node v : G.nodes)
-		oLength[v].init(G, numeric_limits<double>::max());
-
 	//-------------------------------------
 	//computes shortest path distances d_ij
 	//-------------------------------------
 	if (simpleBFS)
 	{
-		//we use simply BFS n times
-		//TODO experimentally compare speed, also with bintree dijkstra
+		//we use simply BFS n times, the sources are distributed among the threads
 //#ifdef OGDF_DEBUG
 //		double timeUsed;
 //		usedTime(timeUsed);
@@ -89,9 +451,8 @@ void SpringEmbedderKK::initialize(
 	{
 		EdgeArray<double> adaptedLength(G);
 		adaptLengths(G, GA, eLength, adaptedLength);
-		//we use simply the BFM n times or Floyd instead, leading to cubic runtime
-		//TODO experimentally compare speed, also with bintree dijkstra
-		maxDist = allpairssp(G, adaptedLength, oLength, numeric_limits<double>::max());
+		//we use Dijkstra n times, the sources are distributed among the threads
+		maxDist = allpairssp(G, adaptedLength, oLength);
 	}
 	//------------------------------------
 	//computes original spring length l_ij
@@ -144,26 +505,25 @@ void SpringEmbedderKK::initialize(
 	// Having L we can compute the original lengths l_ij
 	// Computes spring strengths k_ij
 	//--------------------------------------------------
-	double dij;
-	for(node v : G.nodes)
+	const int n = oLength.size();
+	sstrength.init(G);
+	for (int i = 0; i < n; ++i)
 	{
-		sstrength[v].init(G);
-		for(node w : G.nodes)
+		double *lengths = oLength.row(i);
+		double *strengths = sstrength.row(i);
+		for (int j = 0; j < n; ++j)
 		{
-			dij = oLength[v][w];
-			if (dij == numeric_limits<double>::max())
+			double dij = lengths[j];
+			if (std::isinf(dij))
 			{
-				sstrength[v][w] = minVal;
+				strengths[j] = minVal;
 			}
 			else
 			{
-				oLength[v][w] = L * dij;
-				if (v==w) sstrength[v][w] = 1.0;
+				lengths[j] = L * dij;
+				if (i == j) strengths[j] = 1.0;
 				else
-				sstrength[v][w] = m_K / (dij * dij);
-
-
-
+				strengths[j] = m_K / (dij * dij);
 			}
 		}
 	}
@@ -172,34 +532,20 @@ void SpringEmbedderKK::initialize(
 
 void SpringEmbedderKK::mainStep(GraphAttributes& GA,
 								NodeArray<dpair>& partialDer,
-								NodeArray< NodeArray<double> >& oLength,
-								NodeArray< NodeArray<double> >& sstrength,
+								NodeMatrix<double>& oLength,
+								NodeMatrix<double>& sstrength,
 								const double maxDist)
 {
 	const Graph &G = GA.constGraph();
 
-#ifdef OGDF_DEBUG
-	NodeArray<int> nodeCounts(G, 0);
-	int nodeCount = 0; //number of moved nodes
-#endif
-	// Now we compute delta_m, we search for the node with max value
-	double delta_m = 0.0;
-	node best_m = G.firstNode();
+	// the iteration works on the ids of the matrices
+	KamadaKawaiIteration state(GA, oLength, sstrength, m_numberOfThreads);
 
-	// Compute the partial derivatives first
-	for(node v : G.nodes)
-	{
-		dpair parder = computeParDers(v, GA, sstrength, oLength);
-		partialDer[v] = parder;
-		//delta_m is sqrt of squares of partial derivatives
-		double delta_v = sqrt(parder.x1()*parder.x1() + parder.x2()*parder.x2());
-
-		if (delta_v > delta_m)
-		{
-			best_m = v;
-			delta_m = delta_v;
-		}
-	}
+	// Compute the partial derivatives first and search for the
+	// node best_m with max value delta_m
+	int best_m;
+	double delta_m;
+	state.computeDerivatives(best_m, delta_m);
 
 	int globalItCount, localItCount;
 	if (m_computeMaxIt)
@@ -216,48 +562,21 @@ void SpringEmbedderKK::mainStep(GraphAttributes& GA,
 
 	while (globalItCount-- > 0 && !finished(delta_m))
 	{
-#ifdef OGDF_DEBUG
-//		cout <<"G: "<<globalItCount <<"\n";
-//		cout <<"New iteration on "<<best_m->index()<<"\n";
-		nodeCount++;
-		nodeCounts[best_m]++;
-#endif
 		// The contribution best_m makes to the partial derivatives of
-		// each vertex.
-		NodeArray<dpair> p_partials(G);
-		for(node v : G.nodes)
-		{
-			p_partials[v] = computeParDer(v, best_m, GA, sstrength, oLength);
-		}
+		// each vertex is removed afterwards using its old position.
+		const double oldX = state.x(best_m);
+		const double oldY = state.y(best_m);
 
 		localItCount = 0;
 		do {
-#ifdef OGDF_DEBUG
-//			cout <<"  New local iteration\n";
-//			cout <<"   L: "<<localItCount <<"\n";
-#endif
 			// Compute the 4 elements of the Jacobian
-			double dE_dx_dx = 0.0, dE_dx_dy = 0.0, dE_dy_dx = 0.0, dE_dy_dy = 0.0;
-			for(node v : G.nodes)
-			{
-				if (v != best_m) {
-					double x_diff = GA.x(best_m) - GA.x(v);
-					double y_diff = GA.y(best_m) - GA.y(v);
-					double dist = sqrt(x_diff * x_diff + y_diff * y_diff);
-					double dist3 = dist * dist * dist;
-					OGDF_ASSERT(dist3 != 0.0);
-					double k_mi = sstrength[best_m][v];
-					double l_mi = oLength[best_m][v];
-					dE_dx_dx += k_mi * (1 - (l_mi * y_diff * y_diff)/dist3);
-					dE_dx_dy += k_mi * l_mi * x_diff * y_diff / dist3;
-					dE_dy_dx += k_mi * l_mi * x_diff * y_diff / dist3;
-					dE_dy_dy += k_mi * (1 - (l_mi * x_diff * x_diff)/dist3);
-				}
-			}
+			double dE_dx_dx, dE_dx_dy, dE_dy_dy;
+			state.jacobian(best_m, dE_dx_dx, dE_dx_dy, dE_dy_dy);
+			double dE_dy_dx = dE_dx_dy;
 
 			// Solve for delta_x and delta_y
-			double dE_dx = partialDer[best_m].x1();
-			double dE_dy = partialDer[best_m].x2();
+			double dE_dx = state.derivativeX(best_m);
+			double dE_dy = state.derivativeY(best_m);
 
 			double delta_x =
 				(dE_dx_dy * dE_dy - dE_dy_dy * dE_dx)
@@ -267,51 +586,18 @@ void SpringEmbedderKK::mainStep(GraphAttributes& GA,
 				(dE_dx_dx * dE_dy - dE_dy_dx * dE_dx)
 				/ (dE_dy_dx * dE_dx_dy - dE_dx_dx * dE_dy_dy);
 
-
 			// Move p by (delta_x, delta_y)
-#ifdef OGDF_DEBUG
-			// cout <<"   x"<< delta_x<<"\n";
-			// cout <<"   y" <<delta_y<<"\n";
-#endif
-			GA.x(best_m) += delta_x;
-			GA.y(best_m) += delta_y;
+			state.move(best_m, delta_x, delta_y);
 
 			// Recompute partial derivatives and delta_p
-			dpair deriv = computeParDers(best_m, GA, sstrength, oLength);
-			partialDer[best_m] = deriv;
-
-			delta_m =
-				sqrt(deriv.x1()*deriv.x1() + deriv.x2()*deriv.x2());
+			delta_m = state.computeDerivative(best_m);
 		} while (localItCount-- > 0 && !finishedNode(delta_m));
 
 		// Select new best_m by updating each partial derivative and delta
-		node old_p = best_m;
-		for(node v : G.nodes)
-		{
-			dpair old_deriv_p = p_partials[v];
-			dpair old_p_partial =
-				computeParDer(v, old_p, GA, sstrength, oLength);
-			dpair deriv = partialDer[v];
-
-			deriv.x1() += old_p_partial.x1() - old_deriv_p.x1();
-			deriv.x2() += old_p_partial.x2() - old_deriv_p.x2();
-
-			partialDer[v] = deriv;
-			double delta = sqrt(deriv.x1()*deriv.x1() + deriv.x2()*deriv.x2());
-
-			if (delta > delta_m) {
-				best_m = v;
-				delta_m = delta;
-			}
-		}
+		state.updateDerivatives(best_m, oldX, oldY, best_m, delta_m);
 	}//while
-#ifdef OGDF_DEBUG
-//  cout << "NodeCount: "<<nodeCount<<"\n";
-//  for(node v : G.nodes)
-//  {
-//   	cout<<"Counts "<<v->index()<<": "<<nodeCounts[v]<<"\n";
-//  }
-#endif
+
+	state.copyTo(GA, partialDer);
 }//mainStep
 
 
@@ -320,8 +606,8 @@ void SpringEmbedderKK::doCall(GraphAttributes& GA, const EdgeArray<double>& eLen
 	const Graph& G = GA.constGraph();
 	NodeArray<dpair> partialDer(G); //stores the partial derivative per node
 	double maxDist; //maximum distance between nodes
-	NodeArray< NodeArray<double> > oLength(G);//first distance, then original length
-	NodeArray< NodeArray<double> > sstrength(G);//the spring strength
+	NodeMatrix<double> oLength;//first distance, then original length
+	NodeMatrix<double> sstrength;//the spring strength
 
 	//only for debugging
 	OGDF_ASSERT(isConnected(G));
@@ -392,8 +678,8 @@ SpringEmbedderKK::dpair SpringEmbedderKK::computeParDer(
 	node m,
 	node u,
 	GraphAttributes& GA,
-	NodeArray< NodeArray<double> >& ss,
-	NodeArray< NodeArray<double> >& dist)
+	NodeMatrix<double>& ss,
+	NodeMatrix<double>& dist)
 {
 	dpair result(0.0, 0.0);
 	if (m != u)
@@ -401,8 +687,8 @@ SpringEmbedderKK::dpair SpringEmbedderKK::computeParDer(
 		double x_diff = GA.x(m) - GA.x(u);
 		double y_diff = GA.y(m) - GA.y(u);
 		double distance = sqrt(x_diff * x_diff + y_diff * y_diff);
-		result.x1() = (ss[m][u]) * (x_diff - (dist[m][u])*x_diff/distance);
-		result.x2() = (ss[m][u]) * (y_diff - (dist[m][u])*y_diff/distance);
+		result.x1() = (ss(m, u)) * (x_diff - (dist(m, u))*x_diff/distance);
+		result.x2() = (ss(m, u)) * (y_diff - (dist(m, u))*y_diff/distance);
 	}
 
 	return result;
@@ -412,8 +698,8 @@ SpringEmbedderKK::dpair SpringEmbedderKK::computeParDer(
 //compute partial derivative for v
 SpringEmbedderKK::dpair SpringEmbedderKK::computeParDers(node v,
 	GraphAttributes& GA,
-	NodeArray< NodeArray<double> >& ss,
-	NodeArray< NodeArray<double> >& dist)
+	NodeMatrix<double>& ss,
+	NodeMatrix<double>& dist)
 {
 	dpair result(0.0, 0.0);
 	for(node u : GA.constGraph().nodes)
@@ -427,135 +713,51 @@ SpringEmbedderKK::dpair SpringEmbedderKK::computeParDers(node v,
 }
 
 
-/**
- * Initialise the original estimates from nodes and edges.
- */
-
-//we could speed this up by not using nested NodeArrays and
-//by not doing the fully symmetrical computation on undirected graphs
-//All Pairs Shortest Path Floyd, initializes the whole matrix
-//returns maximum distance. Does not detect negative cycles (lead to neg. values on diagonal)
-//threshold is the value for the distance of non-adjacent nodes, distance has to be
-//initialized with
-double SpringEmbedderKK::allpairssp(const Graph& G, const EdgeArray<double>& eLengths, NodeArray< NodeArray<double> >& distance,
-	const double threshold)
+//all pairs shortest paths with Dijkstra started at each node,
+//initializes the whole matrix and returns the maximum finite distance
+double SpringEmbedderKK::allpairssp(const Graph& G, const EdgeArray<double>& eLengths, NodeMatrix<double>& distance)
 {
-	double maxDist = -threshold;
+	dijkstra_SPAP(CSRGraph(G), distance, eLengths, m_numberOfThreads);
 
-	for(node v : G.nodes)
+	// the sums along a path in both directions may differ in the last bit,
+	// but the main loop relies on a symmetric matrix
+	const int n = distance.size();
+	for (int i = 0; i < n; ++i)
 	{
-		distance[v][v] = 0.0;
-	}
-
-	//TODO: Experimentally compare this against
-	// all nodes and incident edges (memory access) on huge graphs
-	for(edge e : G.edges)
-	{
-		distance[e->source()][e->target()] = eLengths[e];
-		distance[e->target()][e->source()] = eLengths[e];
-	}
-
-///**
-// * And run the main loop of the algorithm.
-// */
-	for(node v : G.nodes)
-	{
-		for(node u : G.nodes)
+		for (int j = i + 1; j < n; ++j)
 		{
-			for(node w : G.nodes)
-			{
-				if ((distance[u][v] < threshold) && (distance[v][w] < threshold))
-				{
-					distance[u][w] = min( distance[u][w], distance[u][v] + distance[v][w] );
-					//distance[w][u] = distance[u][w]; //is done anyway afterwards
-				}
-				if (distance[u][w] < threshold)
-					maxDist = max(maxDist,distance[u][w]);
-			}
+			distance(i, j) = distance(j, i) = min(distance(i, j), distance(j, i));
 		}
 	}
-	//debug output
-//#ifdef OGDF_DEBUG
-//	for(node v : G.nodes)
-//	{
-//		if (distance[v][v] < 0.0) cerr << "\n###Error in shortest path computation###\n\n";
-//	}
-//	cout << "Maxdist: "<<maxDist<<"\n";
-//	for(node u : G.nodes)
-//	{
-//	for(node w : G.nodes)
-//	{
-////		cout << "Distance " << u->index() << " -> "<<w->index()<<" "<<distance[u][w]<<"\n";
-//	}
-//	}
-//#endif
-	return maxDist;
+	return maxFiniteDistance(distance);
 }//allpairssp
 
 
 //the same without weights, i.e. all pairs shortest paths with BFS
 //Runs in time |V|²
 //for compatibility, distances are double
-double SpringEmbedderKK::allpairsspBFS(const Graph& G, NodeArray< NodeArray<double> >& distance)
+double SpringEmbedderKK::allpairsspBFS(const Graph& G, NodeMatrix<double>& distance)
 {
-	double maxDist = 0;
-
-	for(node v : G.nodes)
-	{
-		distance[v][v] = 0.0;
-	}
+	bfs_SPAP(CSRGraph(G), distance, 1.0, m_numberOfThreads);
+	return maxFiniteDistance(distance);
+}//allpairsspBFS
 
-	node v = G.firstNode();
 
-	//start in each node once
-	while (v != nullptr)
+double SpringEmbedderKK::maxFiniteDistance(const NodeMatrix<double>& distance)
+{
+	double maxDist = 0;
+	const int n = distance.size();
+	for (int i = 0; i < n; ++i)
 	{
-		//do a bfs
-		NodeArray<bool> mark(G, true);
-		SListPure<node> bfs;
-		bfs.pushBack(v);
-		mark[v] = false;
-
-		while (!bfs.empty())
+		const double *dist = distance.row(i);
+		for (int j = 0; j < n; ++j)
 		{
-			node w = bfs.popFrontRet();
-			double d = distance[v][w]+1.0f;
-
-
-			for(adjEntry adj : w->adjEntries) {
-				node u = adj->twinNode();
-				if (mark[u])
-				{
-					mark[u] = false;
-					bfs.pushBack(u);
-					distance[v][u] = d;
-					maxDist = max(maxDist,d);
-				}
-			}
-		}//while
-
-		v = v->succ();
-	}//while
-	//check for negative cycles
-	for(node v : G.nodes)
-	{
-		if (distance[v][v] < 0.0)
-			cerr << "\n###Error in shortest path computation###\n\n";
+			if (!std::isinf(dist[j]))
+				maxDist = max(maxDist, dist[j]);
+		}
 	}
-
-//debug output
-//#ifdef OGDF_DEBUG
-//	cout << "Maxdist: "<<maxDist<<"\n";
-//	for(node u : G.nodes)
-//	{
-//	for(node w : G.nodes)
-//	{
-////		cout << "Distance " << u->index() << " -> "<<w->index()<<" "<<distance[u][w]<<"\n";
-//	}
-//	}
-//#endif
 	return maxDist;
-}//allpairsspBFS
+}
 
 
 void SpringEmbedderKK::scale(GraphAttributes& GA)
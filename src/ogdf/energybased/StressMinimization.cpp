@@ -34,6 +34,9 @@
  ***************************************************************/
 
 #include <ogdf/energybased/StressMinimization.h>
+#include <ogdf/basic/CSRGraph.h>
+#include <ogdf/basic/ArrayBuffer.h>
+#include <algorithm>
 
 
 namespace ogdf {
@@ -43,6 +46,319 @@ const double StressMinimization::EPSILON = 10e-4;
 const int StressMinimization::DEFAULT_NUMBER_OF_PIVOTS = 50;
 
 
+//! The terms of the sparse stress model, see StressMinimization::useSparseStress().
+/**
+ * Nodes are identified by their ids in a CSRGraph. The exact terms of node \a i
+ * are stored in [m_termStart[i], m_termStart[i+1]), the terms of node \a i and
+ * the pivots in row \a i of m_pivotDist and m_pivotWeight. Distances and weights
+ * are stored as floats, which halves the memory needed by the model.
+ */
+class SparseStressModel {
+	int m_numberOfPivots;			//!< The number of pivots k.
+	Array<int> m_pivot;				//!< The pivots.
+	Array<float> m_pivotDist;		//!< The n x k matrix of distances between the nodes and the pivots.
+	Array<float> m_pivotWeight;		//!< The n x k matrix of weights of the pivot terms (0 if omitted).
+	Array<int> m_termStart;			//!< The start of the exact terms of each node, followed by the end.
+	ArrayBuffer<int> m_termNode;	//!< The other node of each exact term.
+	ArrayBuffer<float> m_termDist;	//!< The graph distance of each exact term.
+
+public:
+	/**
+	 * Builds the model of \a G.
+	 *
+	 * @param G is the graph.
+	 * @param edgeCosts are the costs of the edges of the original graph, or nullptr for uniform costs.
+	 * @param uniformCosts are the costs of every edge if \a edgeCosts is nullptr.
+	 * @param numberOfPivots is the number of pivots.
+	 * @param depth is the number of hops up to which pairs of nodes get an exact term.
+	 * @param unreachableDistance replaces the distance of nodes in different components.
+	 */
+	SparseStressModel(const CSRGraph &G, const EdgeArray<double> *edgeCosts, double uniformCosts,
+		int numberOfPivots, int depth, double unreachableDistance);
+
+	//! Performs one round of localized stress majorization on the coordinates \a x, \a y and \a z (if not nullptr).
+	void majorize(Array<double> &x, Array<double> &y, Array<double> *z, bool fixX, bool fixY, bool fixZ) const;
+
+	//! Returns the sparse stress of the coordinates \a x, \a y and \a z (if not nullptr).
+	double stress(const Array<double> &x, const Array<double> &y, const Array<double> *z) const;
+
+private:
+	//! Selects the pivots by the max-min strategy and computes their distances to all nodes.
+	void computePivotDistances(const CSRGraph &G, const EdgeArray<double> *edgeCosts, double uniformCosts);
+
+	//! Calls visit(j, d_ij, w_ij) for every term of node \a i.
+	template<typename Visit>
+	void forEachTerm(int i, Visit visit) const {
+		for (int t = m_termStart[i]; t < m_termStart[i+1]; ++t) {
+			double d = m_termDist[t];
+			visit(m_termNode[t], d, 1 / (d*d));
+		}
+		const int row = i * m_numberOfPivots;
+		for (int q = 0; q < m_numberOfPivots; ++q) {
+			double w = m_pivotWeight[row + q];
+			if (w > 0) {
+				visit(m_pivot[q], double(m_pivotDist[row + q]), w);
+			}
+		}
+	}
+};
+
+
+SparseStressModel::SparseStressModel(
+	const CSRGraph &G,
+	const EdgeArray<double> *edgeCosts,
+	double uniformCosts,
+	int numberOfPivots,
+	int depth,
+	double unreachableDistance)
+{
+	const int n = G.numberOfNodes();
+	const int m = G.numberOfEdges();
+	m_numberOfPivots = min(numberOfPivots, n);
+	const int k = m_numberOfPivots;
+	computePivotDistances(G, edgeCosts, uniformCosts);
+
+	// every node is represented by its closest pivot; a pivot term of node i
+	// stands for the nodes of the pivot's region that are at most half as far
+	// from the pivot as i
+	Array<int> regionStart(0, k, 0);
+	Array<int> region(n);
+	for (int i = 0; i < n; ++i) {
+		const float *row = &m_pivotDist[i*k];
+		region[i] = int(std::min_element(row, row + k) - row);
+		++regionStart[region[i] + 1];
+	}
+	for (int q = 0; q < k; ++q) {
+		regionStart[q+1] += regionStart[q];
+	}
+	Array<float> regionDist(max(n, 1));
+	Array<int> fill(regionStart);
+	for (int i = 0; i < n; ++i) {
+		regionDist[fill[region[i]]++] = m_pivotDist[i*k + region[i]];
+	}
+	for (int q = 0; q < k; ++q) {
+		std::sort(&regionDist[0] + regionStart[q], &regionDist[0] + regionStart[q+1]);
+	}
+
+	Array<double> cost(max(m, 1));
+	for (int e = 0; e < m; ++e) {
+		cost[e] = edgeCosts ? (*edgeCosts)[G.originalEdge(e)] : uniformCosts;
+	}
+	Array<int> pivotIndex(0, max(n, 1) - 1, -1);
+	for (int q = 0; q < k; ++q) {
+		pivotIndex[m_pivot[q]] = q;
+	}
+
+	const int *adjStart = G.adjStart();
+	const int *adjNode  = G.adjNodes();
+	const int *adjEdge  = G.adjEdges();
+	const double infinity = std::numeric_limits<double>::infinity();
+
+	Array<double> dist(0, max(n, 1) - 1, infinity);
+	Array<int> queued(0, max(n, 1) - 1, 0);
+	Array<int> coveredBy(0, max(k, 1) - 1, -1);
+	ArrayBuffer<int> touched, frontier[2];
+	int stamp = 0;
+
+	m_termStart.init(n + 1);
+	m_pivotWeight.init(n * k);
+	for (int i = 0; i < n; ++i) {
+		m_termStart[i] = m_termNode.size();
+
+		// distances along paths with at most depth edges (Bellman-Ford restricted
+		// to depth rounds); for uniform edge costs this is a BFS
+		dist[i] = 0;
+		touched.push(i);
+		frontier[0].clear();
+		frontier[0].push(i);
+		for (int r = 0; r < depth && !frontier[r % 2].empty(); ++r) {
+			const ArrayBuffer<int> &cur = frontier[r % 2];
+			ArrayBuffer<int> &next = frontier[(r+1) % 2];
+			next.clear();
+			++stamp;
+			for (int u : cur) {
+				for (int a = adjStart[u]; a < adjStart[u+1]; ++a) {
+					int w = adjNode[a];
+					double d = dist[u] + cost[adjEdge[a]];
+					if (d < dist[w]) {
+						if (isinf(dist[w])) {
+							touched.push(w);
+						}
+						dist[w] = d;
+						if (queued[w] != stamp) {
+							queued[w] = stamp;
+							next.push(w);
+						}
+					}
+				}
+			}
+		}
+
+		for (int w : touched) {
+			if (w != i && dist[w] > 0) {
+				m_termNode.push(w);
+				m_termDist.push(float(dist[w]));
+				if (pivotIndex[w] >= 0) {
+					coveredBy[pivotIndex[w]] = i;
+				}
+			}
+			dist[w] = infinity;
+		}
+		touched.clear();
+
+		for (int q = 0; q < k; ++q) {
+			float &d = m_pivotDist[i*k + q];
+			float &w = m_pivotWeight[i*k + q];
+			if (m_pivot[q] == i || coveredBy[q] == i || d <= 0) {
+				w = 0;
+			} else if (isinf(d)) {
+				d = float(unreachableDistance);
+				w = float(1 / (unreachableDistance * unreachableDistance));
+			} else {
+				const float *begin = &regionDist[0] + regionStart[q];
+				const float *end = &regionDist[0] + regionStart[q+1];
+				int s = int(std::upper_bound(begin, end, d / 2) - begin);
+				w = float(max(s, 1) / (double(d) * d));
+			}
+		}
+	}
+	m_termStart[n] = m_termNode.size();
+}
+
+
+void SparseStressModel::computePivotDistances(
+	const CSRGraph &G,
+	const EdgeArray<double> *edgeCosts,
+	double uniformCosts)
+{
+	const int n = G.numberOfNodes();
+	const int k = m_numberOfPivots;
+	const double infinity = std::numeric_limits<double>::infinity();
+	m_pivot.init(k);
+	m_pivotDist.init(n * k);
+
+	// the distances of a batch of pivots are collected pivot by pivot and then
+	// written to the rows of m_pivotDist, which avoids a cache miss per entry
+	const int batchSize = 16;
+	Array<float> batch(batchSize * n);
+	Array<int> queue(n);
+	const int *adjStart = G.adjStart();
+	const int *adjNode  = G.adjNodes();
+	NodeArray<double> shortestPathSingleSource;
+	if (edgeCosts) {
+		shortestPathSingleSource.init(G.constGraph());
+	}
+
+	// max-min strategy as in PivotMDS: the next pivot is the node farthest
+	// from all previous pivots
+	Array<double> minDistances(0, n - 1, infinity);
+	int pivot = 0;
+	for (int q = 0; q < k; ++q) {
+		m_pivot[q] = pivot;
+		float *dist = &batch[(q % batchSize) * n];
+		if (edgeCosts) {
+			shortestPathSingleSource.fill(infinity);
+			dijkstra_SPSS(G.original(pivot), G, shortestPathSingleSource, *edgeCosts);
+			for (int i = 0; i < n; ++i) {
+				double d = shortestPathSingleSource[G.original(i)];
+				dist[i] = (d == std::numeric_limits<double>::max()) ? float(infinity) : float(d);
+			}
+		} else {
+			std::fill(dist, dist + n, float(infinity));
+			int head = 0, tail = 0;
+			queue[tail++] = pivot;
+			dist[pivot] = 0;
+			while (head < tail) {
+				int u = queue[head++];
+				for (int a = adjStart[u]; a < adjStart[u+1]; ++a) {
+					int w = adjNode[a];
+					if (isinf(dist[w])) {
+						dist[w] = float(dist[u] + uniformCosts);
+						queue[tail++] = w;
+					}
+				}
+			}
+		}
+
+		minDistances[pivot] = 0;
+		for (int i = 0; i < n; ++i) {
+			minDistances[i] = min(minDistances[i], double(dist[i]));
+			if (minDistances[i] > minDistances[pivot]) {
+				pivot = i;
+			}
+		}
+
+		if (q % batchSize == batchSize - 1 || q == k - 1) {
+			const int first = q - q % batchSize;
+			for (int i = 0; i < n; ++i) {
+				for (int r = first; r <= q; ++r) {
+					m_pivotDist[i*k + r] = batch[(r - first) * n + i];
+				}
+			}
+		}
+	}
+}
+
+
+void SparseStressModel::majorize(
+	Array<double> &x,
+	Array<double> &y,
+	Array<double> *z,
+	bool fixX,
+	bool fixY,
+	bool fixZ) const
+{
+	const int n = m_termStart.size() - 1;
+	fixZ = fixZ || z == nullptr;
+
+	for (int i = 0; i < n; ++i) {
+		double newX = 0, newY = 0, newZ = 0, totalWeight = 0;
+		const double xi = x[i], yi = y[i], zi = z ? (*z)[i] : 0.0;
+		forEachTerm(i, [&](int j, double desDistance, double weight) {
+			double xDiff = xi - x[j];
+			double yDiff = yi - y[j];
+			double zDiff = z ? zi - (*z)[j] : 0.0;
+			double euclideanDist = sqrt(xDiff * xDiff + yDiff * yDiff + zDiff * zDiff);
+			double scale = (euclideanDist != 0) ? desDistance / euclideanDist : 0;
+			newX += weight * (x[j] + scale * xDiff);
+			newY += weight * (y[j] + scale * yDiff);
+			if (!fixZ) {
+				newZ += weight * ((*z)[j] + scale * zDiff);
+			}
+			totalWeight += weight;
+		});
+		if (totalWeight != 0) {
+			if (!fixX) {
+				x[i] = newX / totalWeight;
+			}
+			if (!fixY) {
+				y[i] = newY / totalWeight;
+			}
+			if (!fixZ) {
+				(*z)[i] = newZ / totalWeight;
+			}
+		}
+	}
+}
+
+
+double SparseStressModel::stress(const Array<double> &x, const Array<double> &y, const Array<double> *z) const
+{
+	const int n = m_termStart.size() - 1;
+	double stress = 0;
+	for (int i = 0; i < n; ++i) {
+		forEachTerm(i, [&](int j, double desDistance, double weight) {
+			double xDiff = x[i] - x[j];
+			double yDiff = y[i] - y[j];
+			double zDiff = z ? (*z)[i] - (*z)[j] : 0.0;
+			double dist = sqrt(xDiff * xDiff + yDiff * yDiff + zDiff * zDiff);
+			stress += weight * (desDistance - dist) * (desDistance - dist);
+		});
+	}
+	return stress;
+}
+
+
 void StressMinimization::call(GraphAttributes& GA)
 {
 	const Graph& G = GA.constGraph();
@@ -60,9 +376,14 @@ void StressMinimization::call(GraphAttributes& GA)
 		OGDF_THROW(PreconditionViolatedException);
 		return;
 	}
-	NodeArray<NodeArray<double> > shortestPathMatrix(G);
-	NodeArray<NodeArray<double> > weightMatrix(G);
-	initMatrices(G, shortestPathMatrix, weightMatrix);
+	if (m_sparseStress) {
+		callSparse(GA);
+		return;
+	}
+	NodeMatrix<double> shortestPathMatrix;
+	NodeMatrix<double> weightMatrix(G, 0);
+	// the rows of the shortest path matrix are computed in parallel
+	CSRGraph C(G);
 	// if the edge costs are defined by the attribute copy it to an array and
 	// construct the proper shortest path matrix
 	if (m_hasEdgeCostsAttribute) {
@@ -70,11 +391,18 @@ void StressMinimization::call(GraphAttributes& GA)
 			OGDF_THROW(PreconditionViolatedException);
 			return;
 		}
-		m_avgEdgeCosts = dijkstra_SPAP(GA, shortestPathMatrix);
+		EdgeArray<double> edgeCosts(G);
+		double totalCosts = 0;
+		for (edge e : G.edges) {
+			edgeCosts[e] = GA.doubleWeight(e);
+			totalCosts += edgeCosts[e];
+		}
+		m_avgEdgeCosts = totalCosts / G.numberOfEdges();
 		// compute shortest path all pairs
+		dijkstra_SPAP(C, shortestPathMatrix, edgeCosts, 0);
 	} else {
 		m_avgEdgeCosts = m_edgeCosts;
-		bfs_SPAP(G, shortestPathMatrix, m_edgeCosts);
+		bfs_SPAP(C, shortestPathMatrix, m_edgeCosts, 0);
 	}
 	call(GA, shortestPathMatrix, weightMatrix);
 }
@@ -82,8 +410,8 @@ void StressMinimization::call(GraphAttributes& GA)
 
 void StressMinimization::call(
 	GraphAttributes& GA,
-	NodeArray<NodeArray<double> >& shortestPathMatrix,
-	NodeArray<NodeArray<double> >& weightMatrix)
+	NodeMatrix<double>& shortestPathMatrix,
+	NodeMatrix<double>& weightMatrix)
 {
 	// compute the initial layout if necessary
 	if (!m_hasInitialLayout) {
@@ -104,6 +432,85 @@ void StressMinimization::call(
 }
 
 
+void StressMinimization::callSparse(GraphAttributes& GA)
+{
+	const Graph& G = GA.constGraph();
+	EdgeArray<double> edgeCosts;
+	if (m_hasEdgeCostsAttribute) {
+		if (!GA.has(GraphAttributes::edgeDoubleWeight)) {
+			OGDF_THROW(PreconditionViolatedException);
+			return;
+		}
+		edgeCosts.init(G);
+		double totalCosts = 0;
+		for (edge e : G.edges) {
+			edgeCosts[e] = GA.doubleWeight(e);
+			totalCosts += edgeCosts[e];
+		}
+		m_avgEdgeCosts = (G.numberOfEdges() > 0) ? totalCosts / G.numberOfEdges() : m_edgeCosts;
+	} else {
+		m_avgEdgeCosts = m_edgeCosts;
+	}
+
+	// compute the initial layout if necessary
+	if (!m_hasInitialLayout) {
+		computeInitialLayout(GA);
+	}
+
+	// nodes in different components are kept at distance sqrt(n) as in the full model
+	CSRGraph C(G);
+	const int n = C.numberOfNodes();
+	SparseStressModel model(C, m_hasEdgeCostsAttribute ? &edgeCosts : nullptr, m_edgeCosts,
+		m_numberOfPivots, m_neighborhoodDepth, m_avgEdgeCosts * sqrt((double)n));
+
+	const bool threeD = GA.has(GraphAttributes::threeD);
+	Array<double> x(n), y(n), z(threeD ? n : 0);
+	for (int i = 0; i < n; ++i) {
+		node v = C.original(i);
+		x[i] = GA.x(v);
+		y[i] = GA.y(v);
+		if (threeD) {
+			z[i] = GA.z(v);
+		}
+	}
+
+	int numberOfPerformedIterations = 0;
+	double prevStress = numeric_limits<double>::max();
+	double curStress = numeric_limits<double>::max();
+	if (m_terminationCriterion == STRESS) {
+		curStress = model.stress(x, y, threeD ? &z : nullptr);
+	}
+
+	NodeArray<double> newX;
+	NodeArray<double> newY;
+	if (m_terminationCriterion == POSITION_DIFFERENCE) {
+		newX.init(G);
+		newY.init(G);
+	}
+	do {
+		if (m_terminationCriterion == POSITION_DIFFERENCE) {
+			copyLayout(GA, newX, newY);
+		}
+		model.majorize(x, y, threeD ? &z : nullptr, m_fixXCoords, m_fixYCoords, m_fixZCoords);
+		for (int i = 0; i < n; ++i) {
+			node v = C.original(i);
+			GA.x(v) = x[i];
+			GA.y(v) = y[i];
+			if (threeD) {
+				GA.z(v) = z[i];
+			}
+		}
+		if (m_terminationCriterion == STRESS) {
+			prevStress = curStress;
+			curStress = model.stress(x, y, threeD ? &z : nullptr);
+		}
+	} while (!finished(GA, ++numberOfPerformedIterations, newX, newY, prevStress, curStress));
+
+	Logger::slout() << "Iteration count:\t" << numberOfPerformedIterations
+		<< "\tSparse stress:\t" << model.stress(x, y, threeD ? &z : nullptr) << endl;
+}
+
+
 void StressMinimization::computeInitialLayout(GraphAttributes& GA)
 {
 	PivotMDS* pivMDS = new PivotMDS();
@@ -125,15 +532,16 @@ void StressMinimization::computeInitialLayout(GraphAttributes& GA)
 
 
 void StressMinimization::replaceInfinityDistances(
-	NodeArray<NodeArray<double> >& shortestPathMatrix,
+	NodeMatrix<double>& shortestPathMatrix,
 	double newVal)
 {
-	const Graph &G = *shortestPathMatrix.graphOf();
+	const int n = shortestPathMatrix.size();
 
-	for(node v : G.nodes) {
-		for(node w : G.nodes) {
-			if (v != w && isinf(shortestPathMatrix[v][w])) {
-				shortestPathMatrix[v][w] = newVal;
+	for (int i = 0; i < n; ++i) {
+		double *dist = shortestPathMatrix.row(i);
+		for (int j = 0; j < n; ++j) {
+			if (i != j && isinf(dist[j])) {
+				dist[j] = newVal;
 			}
 		}
 	}
@@ -143,15 +551,17 @@ void StressMinimization::replaceInfinityDistances(
 void StressMinimization::calcWeights(
 	const Graph& G,
 	const int dimension,
-	NodeArray<NodeArray<double> >& shortestPathMatrix,
-	NodeArray<NodeArray<double> >& weightMatrix)
+	NodeMatrix<double>& shortestPathMatrix,
+	NodeMatrix<double>& weightMatrix)
 {
-	for (node v : G.nodes) {
-		for (node w : G.nodes) {
-			if (v != w) {
+	const int n = shortestPathMatrix.size();
+	for (int i = 0; i < n; ++i) {
+		const double *dist = shortestPathMatrix.row(i);
+		double *weight = weightMatrix.row(i);
+		for (int j = 0; j < n; ++j) {
+			if (i != j) {
 				// w_ij = d_ij^-2
-				weightMatrix[v][w] = 1
-					/ (shortestPathMatrix[v][w] * shortestPathMatrix[v][w]);
+				weight[j] = 1 / (dist[j] * dist[j]);
 			}
 		}
 	}
@@ -160,12 +570,15 @@ void StressMinimization::calcWeights(
 
 double StressMinimization::calcStress(
 	const GraphAttributes& GA,
-	NodeArray<NodeArray<double> >& shortestPathMatrix,
-	NodeArray<NodeArray<double> >& weightMatrix)
+	NodeMatrix<double>& shortestPathMatrix,
+	NodeMatrix<double>& weightMatrix)
 {
 	double stress = 0;
-	for (node v = GA.constGraph().firstNode(); v != nullptr; v = v->succ()) {
-		for (node w = v->succ(); w != nullptr; w = w->succ()) {
+	const int n = shortestPathMatrix.size();
+	for (int i = 0; i < n; ++i) {
+		node v = shortestPathMatrix.original(i);
+		for (int j = i + 1; j < n; ++j) {
+			node w = shortestPathMatrix.original(j);
 			double xDiff = GA.x(v) - GA.x(w);
 			double yDiff = GA.y(v) - GA.y(w);
 			double zDiff = 0.0;
@@ -175,8 +588,8 @@ double StressMinimization::calcStress(
 			}
 			double dist = sqrt(xDiff * xDiff + yDiff * yDiff + zDiff * zDiff);
 			if (dist != 0) {
-				stress += weightMatrix[v][w] * (shortestPathMatrix[v][w] - dist)
-					* (shortestPathMatrix[v][w] - dist);//
+				stress += weightMatrix(i, j) * (shortestPathMatrix(i, j) - dist)
+					* (shortestPathMatrix(i, j) - dist);
 			}
 		}
 	}
@@ -216,8 +629,8 @@ void StressMinimization::copyLayout(
 
 void StressMinimization::minimizeStress(
 	GraphAttributes& GA,
-	NodeArray<NodeArray<double> >& shortestPathMatrix,
-	NodeArray<NodeArray<double> >& weightMatrix)
+	NodeMatrix<double>& shortestPathMatrix,
+	NodeMatrix<double>& weightMatrix)
 {
 	const Graph& G = GA.constGraph();
 	int numberOfPerformedIterations = 0;
@@ -259,13 +672,16 @@ void StressMinimization::minimizeStress(
 
 void StressMinimization::nextIteration(
 	GraphAttributes& GA,
-	NodeArray<NodeArray<double> >& shortestPathMatrix,
-	NodeArray<NodeArray<double> >& weights)
+	NodeMatrix<double>& shortestPathMatrix,
+	NodeMatrix<double>& weights)
 {
 	const Graph& G = GA.constGraph();
 
 	for (node v : G.nodes)
 	{
+		const double *vWeights = weights.row(weights.id(v));
+		const double *vDistances = shortestPathMatrix.row(shortestPathMatrix.id(v));
+		int j = 0;
 		double newXCoord = 0.0;
 		double newYCoord = 0.0;
 		double newZCoord = 0.0;
@@ -274,6 +690,8 @@ void StressMinimization::nextIteration(
 		double totalWeight = 0;
 		for (node w : G.nodes)
 		{
+			// the matrix ids follow the order of the node list
+			const int wId = j++;
 			if (v == w) {
 				continue;
 			}
@@ -283,9 +701,9 @@ void StressMinimization::nextIteration(
 			double zDiff = (GA.has(GraphAttributes::threeD)) ? GA.z(v) - GA.z(w) : 0.0;
 			double euclideanDist = sqrt(xDiff * xDiff + yDiff * yDiff + zDiff * zDiff);
 			// get the weight
-			double weight = weights[v][w];
+			double weight = vWeights[wId];
 			// get the desired distance
-			double desDistance = shortestPathMatrix[v][w];
+			double desDistance = vDistances[wId];
 			// reset the voted x coordinate
 			// if x is not fixed
 			if (!m_fixXCoords) {
@@ -379,18 +797,4 @@ bool StressMinimization::finished(
 	}
 }
 
-
-void StressMinimization::initMatrices(const Graph& G,
-	NodeArray<NodeArray<double> >& shortestPathMatrix,
-	NodeArray<NodeArray<double> >& weightMatrix)
-{
-	// init shortest path matrix by infinity distances
-	for (node v : G.nodes)
-	{
-		shortestPathMatrix[v].init(G, std::numeric_limits<double>::infinity());
-		shortestPathMatrix[v][v] = 0;
-		weightMatrix[v].init(G, 0);
-	}
-}
-
 }
@@ -33,9 +33,12 @@
  ***************************************************************/
 
 #include <ogdf/energybased/multilevelmixer/BarycenterPlacer.h>
+#include <ogdf/basic/TaskScheduler.h>
 
 namespace ogdf {
 
+static const int NODES_PER_TASK = 256;
+
 void BarycenterPlacer::placeOneLevel(MultilevelGraph &MLG)
 {
 	int level = MLG.getLevel();
@@ -74,6 +77,44 @@ void BarycenterPlacer::placeOneNode(MultilevelGraph &MLG)
 }
 
 
+void BarycenterPlacer::prolongateOneLevel(MultilevelGraph &MLG)
+{
+	std::vector<node> inserted, representatives;
+	MLG.expandCompactLevel(inserted, representatives);
+
+	// reinserted neighbours are not placed yet, their representatives stand in for them
+	NodeArray<node> standIn(MLG.getGraph(), nullptr);
+	for (size_t i = 0; i < inserted.size(); i++) {
+		standIn[inserted[i]] = representatives[i];
+	}
+
+	std::vector<double> x(inserted.size()), y(inserted.size());
+	TaskScheduler::global().parallelFor(0, (int)inserted.size(), NODES_PER_TASK, [&](int begin, int end) {
+		for (int k = begin; k < end; k++) {
+			double sumX = 0.0;
+			double sumY = 0.0;
+			double i = 0.0;
+			for(adjEntry adj : inserted[k]->adjEntries) {
+				node w = adj->twinNode();
+				if (standIn[w] != nullptr) {
+					w = standIn[w];
+				}
+				double weight = m_weightedPositions ? 1.0 / MLG.weight(adj->theEdge()) : 1.0;
+				i += weight;
+				sumX += MLG.x(w) * weight;
+				sumY += MLG.y(w) * weight;
+			}
+
+			OGDF_ASSERT(i > 0);
+			x[k] = sumX / i;
+			y[k] = sumY / i;
+		}
+	});
+
+	placeInserted(MLG, inserted, x, y);
+}
+
+
 BarycenterPlacer::BarycenterPlacer()
 :m_weightedPositions(false)
 {
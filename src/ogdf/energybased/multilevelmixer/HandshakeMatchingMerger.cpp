@@ -0,0 +1,352 @@
+/** \file
+ * \brief Implementation of HandshakeMatchingMerger
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.txt in the root directory of the OGDF installation for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ *
+ * \see  http://www.gnu.org/copyleft/gpl.html
+ ***************************************************************/
+
+#pragma once
+
+#include <ogdf/energybased/multilevelmixer/HandshakeMatchingMerger.h>
+#include <ogdf/basic/TaskScheduler.h>
+#include <algorithm>
+#include <limits>
+
+namespace ogdf {
+
+static const int NODES_PER_TASK = 1024;
+static const int MAX_MATCHING_ROUNDS = 16;
+static const double MIN_REDUCTION = 0.05;
+
+// Scrambles the position of an edge for breaking ties between equally rated edges.
+static inline unsigned int edgeHash(unsigned int k, unsigned int salt)
+{
+	unsigned int h = (k ^ salt) * 0x9E3779B1u;
+	h ^= h >> 16;
+	h *= 0x85EBCA6Bu;
+	h ^= h >> 13;
+	return h;
+}
+
+
+// Returns the binary logarithm of \a w, rounded down.
+// Rating edges by exact merge weights leads to long chains of proposals that
+// are matched one per round; classes of powers of two leave ties to the hash.
+static inline int weightClass(long long w)
+{
+	int c = 0;
+	while (w > 1) {
+		w >>= 1;
+		c++;
+	}
+	return c;
+}
+
+
+HandshakeMatchingMerger::HandshakeMatchingMerger()
+:m_numberOfThreads(0)
+{
+}
+
+
+void HandshakeMatchingMerger::buildAllLevels(MultilevelGraph &MLG)
+{
+	m_numLevels = 1;
+	MLG.updateReverseIndizes();
+	MLG.updateMergeWeights();
+
+	std::vector<CompactLevel> levels(1);
+	MLG.compactGraph(levels.back().m_graph);
+
+	CompactGraph coarse;
+	while (coarsen(levels.back().m_graph, levels.back().m_parent, coarse)) {
+		m_numLevels++;
+		levels.push_back(CompactLevel());
+		std::swap(levels.back().m_graph, coarse);
+	}
+
+	// the coarsest graph has no parents and becomes the current graph
+	CompactGraph coarsest;
+	std::swap(coarsest, levels.back().m_graph);
+	levels.pop_back();
+	if (!levels.empty()) {
+		MLG.contract(levels, coarsest);
+	}
+	MLG.updateReverseIndizes();
+}
+
+
+bool HandshakeMatchingMerger::buildOneLevel(MultilevelGraph &MLG)
+{
+	std::vector<CompactLevel> levels(1);
+	MLG.compactGraph(levels.back().m_graph);
+
+	CompactGraph coarse;
+	if (!coarsen(levels.back().m_graph, levels.back().m_parent, coarse)) {
+		return false;
+	}
+	MLG.contract(levels, coarse);
+	return true;
+}
+
+
+void HandshakeMatchingMerger::computeMatching(const CompactGraph &fine, std::vector<int> &mate, std::vector<int> &matchEdge)
+{
+	TaskScheduler &scheduler = TaskScheduler::global();
+	const int n = fine.numberOfNodes();
+	const unsigned int salt = (unsigned int)randomNumber(0, std::numeric_limits<int>::max());
+
+	mate.assign(n, -1);
+	matchEdge.assign(n, -1);
+	std::vector<int> proposal(n);
+
+	for (int round = 0; round < MAX_MATCHING_ROUNDS; round++) {
+		// every unmatched node proposes the best edge to an unmatched neighbour;
+		// the edges are totally ordered, so at least the best proposed edge is mutual
+		int numProposals = scheduler.parallelReduce(0, n, NODES_PER_TASK, 0, [&](int begin, int end) {
+			int count = 0;
+			for (int v = begin; v < end; v++) {
+				proposal[v] = -1;
+				if (mate[v] >= 0) {
+					continue;
+				}
+				int bestClass = 0;
+				unsigned int bestHash = 0;
+				for (int a = fine.m_adjStart[v]; a < fine.m_adjStart[v+1]; a++) {
+					int u = fine.m_adjNode[a];
+					if (mate[u] >= 0) {
+						continue;
+					}
+					int k = fine.m_adjEdge[a];
+					int weight = weightClass((long long)fine.m_mergeWeight[v] * fine.m_mergeWeight[u]);
+					unsigned int hash = edgeHash(k, salt);
+					if (proposal[v] < 0
+					 || weight < bestClass
+					 || (weight == bestClass && (hash < bestHash
+					  || (hash == bestHash && k < fine.m_adjEdge[proposal[v]])))) {
+						proposal[v] = a;
+						bestClass = weight;
+						bestHash = hash;
+					}
+				}
+				if (proposal[v] >= 0) {
+					count++;
+				}
+			}
+			return count;
+		}, [](int x, int y) { return x + y; }, m_numberOfThreads);
+
+		if (numProposals == 0) {
+			break;
+		}
+
+		// the smaller node of a mutual proposal writes the match
+		scheduler.parallelFor(0, n, NODES_PER_TASK, [&](int begin, int end) {
+			for (int v = begin; v < end; v++) {
+				int a = proposal[v];
+				if (a < 0) {
+					continue;
+				}
+				int u = fine.m_adjNode[a];
+				int b = proposal[u];
+				if (u > v && b >= 0 && fine.m_adjEdge[b] == fine.m_adjEdge[a]) {
+					mate[v] = u;
+					mate[u] = v;
+					matchEdge[v] = matchEdge[u] = fine.m_adjEdge[a];
+				}
+			}
+		}, m_numberOfThreads);
+	}
+}
+
+
+bool HandshakeMatchingMerger::coarsen(const CompactGraph &fine, std::vector<int> &parent, CompactGraph &coarse)
+{
+	TaskScheduler &scheduler = TaskScheduler::global();
+	const int n = fine.numberOfNodes();
+
+	if (n <= 3) {
+		return false;
+	}
+
+	std::vector<int> mate, matchEdge;
+	computeMatching(fine, mate, matchEdge);
+
+	// number the coarse nodes, the representative is the node of higher degree
+	std::vector<int> coarseOf(n);
+	std::vector<int> representative, partner;
+	for (int v = 0; v < n; v++) {
+		int u = mate[v];
+		if (u < 0 || v < u) {
+			coarseOf[v] = (int)representative.size();
+			int degV = fine.m_adjStart[v+1] - fine.m_adjStart[v];
+			int degU = u < 0 ? -1 : fine.m_adjStart[u+1] - fine.m_adjStart[u];
+			representative.push_back(degU > degV ? u : v);
+			partner.push_back(degU > degV ? v : u);
+		} else {
+			coarseOf[v] = coarseOf[u];
+		}
+	}
+
+	const int nc = (int)representative.size();
+	if (nc > (1.0 - MIN_REDUCTION) * n) {
+		return false;
+	}
+
+	coarse.m_nodeIndex.resize(nc);
+	coarse.m_radius.resize(nc);
+	coarse.m_mergeWeight.resize(nc);
+	std::vector<double> matchLength(nc);
+
+	// the adjacencies of both nodes of a coarse node, as upper bound for its neighbours
+	std::vector<int> offset(nc+1, 0);
+	for (int c = 0; c < nc; c++) {
+		int r = representative[c];
+		int p = partner[c];
+		offset[c+1] = offset[c] + fine.m_adjStart[r+1] - fine.m_adjStart[r];
+		if (p >= 0) {
+			offset[c+1] += fine.m_adjStart[p+1] - fine.m_adjStart[p];
+		}
+	}
+
+	std::vector<int> neighbour(offset[nc]);
+	std::vector<int> edgeIndex(offset[nc]);
+	std::vector<double> weight(offset[nc]);
+	std::vector<int> numNeighbours(nc);
+
+	parent.resize(n);
+
+	scheduler.parallelFor(0, nc, NODES_PER_TASK, [&](int begin, int end) {
+		std::vector< std::pair<int, int> > adjacent; // coarse neighbour, fine edge
+		for (int c = begin; c < end; c++) {
+			int r = representative[c];
+			int p = partner[c];
+			coarse.m_nodeIndex[c] = fine.m_nodeIndex[r];
+			coarse.m_radius[c] = fine.m_radius[r];
+			coarse.m_mergeWeight[c] = fine.m_mergeWeight[r] + (p >= 0 ? fine.m_mergeWeight[p] : 0);
+			matchLength[c] = p >= 0 ? fine.m_weight[matchEdge[r]] : 0.0;
+
+			adjacent.clear();
+			for (int v : { r, p }) {
+				if (v < 0) {
+					continue;
+				}
+				for (int a = fine.m_adjStart[v]; a < fine.m_adjStart[v+1]; a++) {
+					int d = coarseOf[fine.m_adjNode[a]];
+					if (d != c) {
+						adjacent.push_back(std::make_pair(d, fine.m_adjEdge[a]));
+					}
+				}
+			}
+			std::sort(adjacent.begin(), adjacent.end());
+
+			// multiple edges are merged into one with their mean weight
+			// and the smallest index
+			int j = offset[c] - 1;
+			int count = 0;
+			for (size_t i = 0; i < adjacent.size(); i++) {
+				int k = adjacent[i].second;
+				if (i == 0 || adjacent[i].first != adjacent[i-1].first) {
+					if (count > 0) {
+						weight[j] /= count;
+					}
+					j++;
+					count = 0;
+					neighbour[j] = adjacent[i].first;
+					edgeIndex[j] = fine.m_edgeIndex[k];
+					weight[j] = 0.0;
+				}
+				edgeIndex[j] = min(edgeIndex[j], fine.m_edgeIndex[k]);
+				weight[j] += fine.m_weight[k];
+				count++;
+			}
+			if (count > 0) {
+				weight[j] /= count;
+			}
+			numNeighbours[c] = j + 1 - offset[c];
+		}
+	}, m_numberOfThreads);
+
+	scheduler.parallelFor(0, n, NODES_PER_TASK, [&](int begin, int end) {
+		for (int v = begin; v < end; v++) {
+			parent[v] = coarse.m_nodeIndex[coarseOf[v]];
+		}
+	}, m_numberOfThreads);
+
+	// every coarse edge belongs to its end node of smaller number, whose
+	// neighbours of greater number are the last ones in its sorted adjacencies
+	std::vector<int> firstOwned(nc);
+	std::vector<int> edgeStart(nc+1, 0);
+	coarse.m_adjStart.assign(nc+1, 0);
+	for (int c = 0; c < nc; c++) {
+		int first = offset[c];
+		int last = offset[c] + numNeighbours[c];
+		firstOwned[c] = int(std::upper_bound(neighbour.begin() + first, neighbour.begin() + last, c) - neighbour.begin());
+		edgeStart[c+1] = edgeStart[c] + last - firstOwned[c];
+		coarse.m_adjStart[c+1] = coarse.m_adjStart[c] + numNeighbours[c];
+	}
+
+	const int mc = edgeStart[nc];
+	coarse.m_adjNode.resize(coarse.m_adjStart[nc]);
+	coarse.m_adjEdge.resize(coarse.m_adjStart[nc]);
+	coarse.m_edgeIndex.resize(mc);
+	coarse.m_weight.resize(mc);
+	coarse.m_source.resize(mc);
+	coarse.m_target.resize(mc);
+
+	scheduler.parallelFor(0, nc, NODES_PER_TASK, [&](int begin, int end) {
+		for (int c = begin; c < end; c++) {
+			for (int i = 0; i < numNeighbours[c]; i++) {
+				int j = offset[c] + i;
+				int d = neighbour[j];
+				int a = coarse.m_adjStart[c] + i;
+				coarse.m_adjNode[a] = d;
+				if (d > c) {
+					int k = edgeStart[c] + j - firstOwned[c];
+					coarse.m_adjEdge[a] = k;
+					coarse.m_edgeIndex[k] = edgeIndex[j];
+					coarse.m_weight[k] = weight[j];
+					if (m_adjustEdgeLengths != 0) {
+						coarse.m_weight[k] += m_adjustEdgeLengths * 0.5 * (matchLength[c] + matchLength[d]);
+					}
+					coarse.m_source[k] = c;
+					coarse.m_target[k] = d;
+				} else {
+					int last = offset[d] + numNeighbours[d];
+					int pos = int(std::lower_bound(neighbour.begin() + firstOwned[d], neighbour.begin() + last, c) - neighbour.begin());
+					OGDF_ASSERT(pos < last && neighbour[pos] == c);
+					coarse.m_adjEdge[a] = edgeStart[d] + pos - firstOwned[d];
+				}
+			}
+		}
+	}, m_numberOfThreads);
+
+	return true;
+}
+
+} // namespace ogdf
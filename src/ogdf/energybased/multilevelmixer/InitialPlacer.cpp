@@ -0,0 +1,63 @@
+/** \file
+ * \brief Implementation of the bulk placement of InitialPlacer
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.txt in the root directory of the OGDF installation for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ *
+ * \see  http://www.gnu.org/copyleft/gpl.html
+ ***************************************************************/
+
+#pragma once
+
+#include <ogdf/energybased/multilevelmixer/InitialPlacer.h>
+
+namespace ogdf {
+
+void InitialPlacer::prolongateOneLevel(MultilevelGraph &MLG)
+{
+	std::vector<node> inserted, representatives;
+	MLG.expandCompactLevel(inserted, representatives);
+
+	std::vector<double> x(inserted.size()), y(inserted.size());
+	for (size_t i = 0; i < inserted.size(); i++) {
+		x[i] = MLG.x(representatives[i]);
+		y[i] = MLG.y(representatives[i]);
+	}
+	placeInserted(MLG, inserted, x, y);
+}
+
+
+void InitialPlacer::placeInserted(MultilevelGraph &MLG, const std::vector<node> &inserted,
+	const std::vector<double> &x, const std::vector<double> &y, double range)
+{
+	// the offsets are drawn in a fixed order to keep the layout reproducible
+	for (size_t i = 0; i < inserted.size(); i++) {
+		MLG.x(inserted[i], x[i] + ((m_randomOffset)?(float)randomDouble(-range, range):0.f));
+		MLG.y(inserted[i], y[i] + ((m_randomOffset)?(float)randomDouble(-range, range):0.f));
+	}
+}
+
+} // namespace ogdf
@@ -33,10 +33,26 @@
  ***************************************************************/
 
 #include <ogdf/energybased/multilevelmixer/MedianPlacer.h>
+#include <ogdf/basic/TaskScheduler.h>
 #include <vector>
 
 namespace ogdf {
 
+static const int NODES_PER_TASK = 256;
+
+// Returns the median of \a values, which are reordered.
+static double median(std::vector<double> &values)
+{
+	int i = (int)values.size();
+	std::nth_element(values.begin(), values.begin()+(i/2), values.end());
+	double m = values[i/2];
+	if (i % 2 == 0) {
+		std::nth_element(values.begin(), values.begin()+(i/2)-1, values.end());
+		m = (m + values[i/2 - 1]) / 2.0;
+	}
+	return m;
+}
+
 void MedianPlacer::placeOneLevel(MultilevelGraph &MLG)
 {
 	int level = MLG.getLevel();
@@ -50,28 +66,52 @@ void MedianPlacer::placeOneLevel(MultilevelGraph &MLG)
 void MedianPlacer::placeOneNode(MultilevelGraph &MLG)
 {
 	node merged = MLG.undoLastMerge();
-	int i = 0;
 	std::vector<double> xVector;
 	std::vector<double> yVector;
 	for(adjEntry adj : merged->adjEntries) {
-		i++;
 		xVector.push_back(MLG.x(adj->twinNode()));
 		yVector.push_back(MLG.y(adj->twinNode()));
 	}
-	std::nth_element(xVector.begin(), xVector.begin()+(i/2), xVector.end());
-	std::nth_element(yVector.begin(), yVector.begin()+(i/2), yVector.end());
-	double x = xVector[i/2];
-	double y = yVector[i/2];
-	if (i % 2 == 0) {
-		std::nth_element(xVector.begin(), xVector.begin()+(i/2)-1, xVector.end());
-		std::nth_element(yVector.begin(), yVector.begin()+(i/2)-1, yVector.end());
-		x += xVector[i/2 - 1];
-		y += yVector[i/2 - 1];
-		x /= 2.0;
-		y /= 2.0;
-	}
+	double x = median(xVector);
+	double y = median(yVector);
 	MLG.x(merged, x + ((m_randomOffset)?(float)randomDouble(-1.0, 1.0):0.f));
 	MLG.y(merged, y + ((m_randomOffset)?(float)randomDouble(-1.0, 1.0):0.f));
 }
 
+
+void MedianPlacer::prolongateOneLevel(MultilevelGraph &MLG)
+{
+	std::vector<node> inserted, representatives;
+	MLG.expandCompactLevel(inserted, representatives);
+
+	// reinserted neighbours are not placed yet, their representatives stand in for them
+	NodeArray<node> standIn(MLG.getGraph(), nullptr);
+	for (size_t i = 0; i < inserted.size(); i++) {
+		standIn[inserted[i]] = representatives[i];
+	}
+
+	std::vector<double> x(inserted.size()), y(inserted.size());
+	TaskScheduler::global().parallelFor(0, (int)inserted.size(), NODES_PER_TASK, [&](int begin, int end) {
+		std::vector<double> xVector;
+		std::vector<double> yVector;
+		for (int k = begin; k < end; k++) {
+			xVector.clear();
+			yVector.clear();
+			for(adjEntry adj : inserted[k]->adjEntries) {
+				node w = adj->twinNode();
+				if (standIn[w] != nullptr) {
+					w = standIn[w];
+				}
+				xVector.push_back(MLG.x(w));
+				yVector.push_back(MLG.y(w));
+			}
+			OGDF_ASSERT(!xVector.empty());
+			x[k] = median(xVector);
+			y[k] = median(yVector);
+		}
+	});
+
+	placeInserted(MLG, inserted, x, y);
+}
+
 } // namespace ogdf
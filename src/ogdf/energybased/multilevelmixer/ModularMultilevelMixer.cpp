@@ -142,7 +142,11 @@ void ModularMultilevelMixer::call(MultilevelGraph &MLG)
 			MLG.moveToZero();
 
 			int nNodes = G.numberOfNodes();
-			m_initialPlacement.get().placeOneLevel(MLG);
+			if (MLG.numberOfCompactLevels() > 0) {
+				m_initialPlacement.get().prolongateOneLevel(MLG);
+			} else {
+				m_initialPlacement.get().placeOneLevel(MLG);
+			}
 			m_coarseningRatio = double(G.numberOfNodes()) / nNodes;
 
 #ifdef OGDF_MMM_LEVEL_OUTPUTS
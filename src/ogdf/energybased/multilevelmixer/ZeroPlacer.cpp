@@ -67,4 +67,18 @@ void ZeroPlacer::placeOneNode(MultilevelGraph &MLG)
 	MLG.y(merged, MLG.y(parent) + ((m_randomOffset)?(float)randomDouble(-m_randomRange, m_randomRange):0.f));
 }
 
+
+void ZeroPlacer::prolongateOneLevel(MultilevelGraph &MLG)
+{
+	std::vector<node> inserted, representatives;
+	MLG.expandCompactLevel(inserted, representatives);
+
+	std::vector<double> x(inserted.size()), y(inserted.size());
+	for (size_t i = 0; i < inserted.size(); i++) {
+		x[i] = MLG.x(representatives[i]);
+		y[i] = MLG.y(representatives[i]);
+	}
+	placeInserted(MLG, inserted, x, y, m_randomRange);
+}
+
 } // namespace ogdf
@@ -108,33 +108,26 @@ std::string toString(const Graph::EdgeType &type)
 }
 
 
-// Map is lazily-evaluated (this could be avoided with C++11 constexpr).
-static Hashing<std::string, Attribute> attrMap;
-
+// The maps are built on first use; initializing local statics is thread-safe.
 Attribute toAttribute(const std::string &str)
 {
-	return toEnum(
-		str, attrMap, toString,
-		static_cast<Attribute>(0), a_unknown, a_unknown);
+	static const Hashing<std::string, Attribute> attrMap =
+		enumMap(toString, static_cast<Attribute>(0), a_unknown);
+	return toEnum(str, attrMap, a_unknown);
 }
 
 
-// Same as attrMap but with shapes.
-static Hashing<std::string, Shape> shapeMap;
-Shape toShape(const std::string &str) {
-	return toEnum(
-		str, shapeMap, toString,
-		shRect, shImage, shRect);
+Shape toShape(const std::string &str)
+{
+	static const Hashing<std::string, Shape> shapeMap = enumMap(toString, shRect, shImage);
+	return toEnum(str, shapeMap, shRect);
 }
 
-// Same as attrMap but with arrows.
-static Hashing<std::string, EdgeArrow> arrowMap;
 
 EdgeArrow toArrow(const std::string &str)
 {
-	return toEnum(
-		str, arrowMap, toString,
-		eaNone, eaUndefined, eaUndefined);
+	static const Hashing<std::string, EdgeArrow> arrowMap = enumMap(toString, eaNone, eaUndefined);
+	return toEnum(str, arrowMap, eaUndefined);
 }
 
 
@@ -96,33 +96,27 @@ std::string toString(const Shape &shape)
 }
 
 
-static Hashing<std::string, NodeAttribute> nodeAttrMap;
-
+// The maps are built on first use; initializing local statics is thread-safe.
 NodeAttribute toNodeAttribute(const std::string &str)
 {
-	return toEnum(
-		str, nodeAttrMap, toString,
-		static_cast<NodeAttribute>(0), na_unknown, na_unknown);
+	static const Hashing<std::string, NodeAttribute> nodeAttrMap =
+		enumMap(toString, static_cast<NodeAttribute>(0), na_unknown);
+	return toEnum(str, nodeAttrMap, na_unknown);
 }
 
 
-static Hashing<std::string, EdgeAttribute> edgeAttrMap;
-
 EdgeAttribute toEdgeAttribute(const std::string &str)
 {
-	return toEnum(
-		str, edgeAttrMap, toString,
-		static_cast<EdgeAttribute>(0), ea_unknown, ea_unknown);
+	static const Hashing<std::string, EdgeAttribute> edgeAttrMap =
+		enumMap(toString, static_cast<EdgeAttribute>(0), ea_unknown);
+	return toEnum(str, edgeAttrMap, ea_unknown);
 }
 
 
-static Hashing<std::string, Shape> shapeMap;
-
 Shape toShape(const std::string &str)
 {
-	return toEnum(
-		str, shapeMap, toString,
-		shRect, shImage, shRect);
+	static const Hashing<std::string, Shape> shapeMap = enumMap(toString, shRect, shImage);
+	return toEnum(str, shapeMap, shRect);
 }
 
 
@@ -721,8 +721,10 @@ bool GmlParser::read(Graph &G, GraphAttributes &AG)
 				AG.weight(m_mapToNode[vId]) = weight;
 			if (AG.has(GraphAttributes::nodeStyle))
 			{
-				AG.fillColor(m_mapToNode[vId]) = fill;
-				AG.strokeColor(m_mapToNode[vId]) = line;
+				if (!fill.empty())
+					AG.fillColor(m_mapToNode[vId]) = fill;
+				if (!line.empty())
+					AG.strokeColor(m_mapToNode[vId]) = line;
 				AG.setFillPattern(m_mapToNode[vId], intToFillPattern(pattern));
 				AG.setStrokeType(m_mapToNode[vId], intToStrokeType(stipple));
 				AG.strokeWidth(m_mapToNode[vId]) = lineWidth;
@@ -850,7 +852,8 @@ bool GmlParser::read(Graph &G, GraphAttributes &AG)
 
 			if (AG.has(GraphAttributes::edgeStyle))
 			{
-				AG.strokeColor(e) = fill;
+				if (!fill.empty())
+					AG.strokeColor(e) = fill;
 				AG.setStrokeType(e, intToStrokeType(stipple));
 				AG.strokeWidth(e) = lineWidth;
 			}
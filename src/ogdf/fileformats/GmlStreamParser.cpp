@@ -0,0 +1,853 @@
+/** \file
+ * \brief Implementation of class GmlStreamParser.
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.txt in the root directory of the OGDF installation for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ *
+ * \see  http://www.gnu.org/copyleft/gpl.html
+ ***************************************************************/
+
+#include <ogdf/fileformats/GmlStreamParser.h>
+#include <ogdf/fileformats/GraphIO.h>
+#include <cstring>
+
+
+namespace ogdf {
+
+GmlStreamParser::GmlStreamParser(istream &is)
+	: m_input(is)
+	, m_lineStart(true)
+	, m_int(0)
+	, m_double(0)
+	, m_string(nullptr)
+	, m_stringLength(0)
+	, m_key(kUnknown)
+	, m_minId(0)
+	, m_maxId(0)
+	, m_anyId(false)
+{ }
+
+
+bool GmlStreamParser::setError(const char *message)
+{
+	m_errorString = message;
+	GraphIO::logger.lout() << "GML error in line " << m_input.line() << ": " << message << endl;
+	return false;
+}
+
+
+GmlStreamParser::Key GmlStreamParser::toKey(const char *str, size_t len)
+{
+	struct Entry { const char *name; Key key; };
+	static const Entry keys[] = {
+		{ "id", kId }, { "label", kLabel }, { "graph", kGraph }, { "directed", kDirected },
+		{ "node", kNode }, { "edge", kEdge }, { "graphics", kGraphics },
+		{ "x", kX }, { "y", kY }, { "w", kW }, { "h", kH }, { "type", kType },
+		{ "width", kWidth }, { "height", kHeight }, { "source", kSource }, { "target", kTarget },
+		{ "arrow", kArrow }, { "Line", kLine }, { "line", kLineLower }, { "point", kPoint },
+		{ "generalization", kGeneralization }, { "subgraph", kSubgraph }, { "fill", kFill },
+		{ "cluster", kCluster }, { "rootcluster", kRootCluster }, { "vertex", kVertex },
+		{ "color", kColor }, { "stipple", kStipple }, { "pattern", kPattern },
+		{ "lineWidth", kLineWidth }, { "template", kTemplate }, { "weight", kWeight }
+	};
+
+	for (const Entry &entry : keys) {
+		if (entry.name[0] == str[0] && strlen(entry.name) == len && memcmp(entry.name, str, len) == 0) {
+			return entry.key;
+		}
+	}
+	return kUnknown;
+}
+
+
+GmlStreamParser::Symbol GmlStreamParser::nextSymbol()
+{
+	// skip whitespace and comment lines
+	for (;;) {
+		size_t len = m_input.span(InputBuffer::isWhitespace);
+		if (len > 0) {
+			m_lineStart |= memchr(m_input.pos(), '\n', len) != nullptr;
+			m_input.advance(len);
+		}
+		if (m_input.atEnd()) {
+			return sEOF;
+		}
+		if (*m_input.pos() != '#' || !m_lineStart) {
+			break;
+		}
+		m_input.advance(m_input.span([](char c) { return c != '\n' && c != '\0'; }));
+	}
+	m_lineStart = false;
+
+	if (*m_input.pos() == '\"') {
+		return scanString();
+	}
+
+	// all other symbols are delimited by whitespace
+	size_t len = m_input.span([](char c) { return c != '\0' && !InputBuffer::isWhitespace(c); });
+	const char *p = m_input.pos();
+	const unsigned char first = static_cast<unsigned char>(*p);
+
+	if (isalpha(first)) {
+		m_key = toKey(p, len);
+		m_input.advance(len);
+		return sKey;
+
+	} else if (first == '[') {
+		m_input.advance(len);
+		return sListBegin;
+
+	} else if (first == ']') {
+		m_input.advance(len);
+		return sListEnd;
+
+	} else if (first == '-' || isdigit(first)) {
+		return scanNumber(len);
+	}
+
+	setError("unknown symbol");
+	return sError;
+}
+
+
+GmlStreamParser::Symbol GmlStreamParser::scanNumber(size_t len)
+{
+	const char *p = m_input.pos();
+	const char *q = p + 1;
+	while (isdigit(static_cast<unsigned char>(*q))) {
+		++q;
+	}
+
+	// the number is followed by whitespace or the terminating '\0' of the window
+	if (*q == '.') {
+		m_double = strtod(p, nullptr);
+		m_input.advance(len);
+		return sDouble;
+	}
+
+	if (q != p + len) {
+		setError("malformed number");
+		return sError;
+	}
+
+	m_int = static_cast<int>(strtol(p, nullptr, 10));
+	m_input.advance(len);
+	return sInt;
+}
+
+
+GmlStreamParser::Symbol GmlStreamParser::scanString()
+{
+	// find the closing quote
+	size_t i = 1;
+	for (;;) {
+		const char *p = m_input.pos();
+		const char *end = m_input.end();
+		while (p + i < end && p[i] != '\"') {
+			i += (p[i] == '\\') ? 2 : 1;
+		}
+		if (p + i < end) {
+			break;
+		}
+		if (!m_input.fill(i + 1)) {
+			setError("unterminated string");
+			return sError;
+		}
+	}
+
+	// resolve escape sequences and line breaks in place
+	char *p = m_input.pos();
+	char *read = p + 1, *write = p + 1;
+	char *stop = p + i;
+	while (read < stop) {
+		char c = *read;
+		if (c == '\\') {
+			char d = read[1];
+			if (d == '\\' || d == '\"') {
+				*write++ = d;
+				read += 2;
+			} else if (d == '\n' || d == '\r') {
+				// line continuation
+				for (++read; read < stop && InputBuffer::isWhitespace(*read); ++read);
+			} else {
+				// other escape sequences are kept as they are
+				*write++ = c;
+				*write++ = d;
+				read += 2;
+			}
+		} else if (c == '\n' || c == '\r') {
+			// strings spanning several lines are joined without indentation
+			for (; read < stop && InputBuffer::isWhitespace(*read); ++read);
+		} else {
+			*write++ = *read++;
+		}
+	}
+
+	m_string = p + 1;
+	m_stringLength = write - m_string;
+	m_input.advance(i + 1);
+	return sString;
+}
+
+
+bool GmlStreamParser::skipValue(Symbol symbol)
+{
+	switch (symbol) {
+	case sInt:
+	case sDouble:
+	case sString:
+		return true;
+
+	case sListBegin:
+		for (int depth = 1; depth > 0; ) {
+			Symbol key = nextSymbol();
+			if (key == sListEnd) {
+				--depth;
+				continue;
+			}
+			if (key != sKey) {
+				return key == sError ? false : setError("key expected");
+			}
+
+			Symbol value = nextSymbol();
+			if (value == sListBegin) {
+				++depth;
+			} else if (value != sInt && value != sDouble && value != sString) {
+				return skipValue(value);
+			}
+		}
+		return true;
+
+	case sListEnd:
+		return setError("unexpected end of list");
+	case sKey:
+		return setError("unexpected key");
+	case sEOF:
+		return setError("missing value");
+	default:
+		return false;
+	}
+}
+
+
+bool GmlStreamParser::nextKey(Key &key, bool &listEnd)
+{
+	Symbol symbol = nextSymbol();
+	listEnd = symbol == sListEnd;
+	if (symbol == sKey) {
+		key = m_key;
+		return true;
+	}
+	return listEnd || (symbol != sError && setError("key expected"));
+}
+
+
+node GmlStreamParser::findNode(int id) const
+{
+	if (id >= 0 && size_t(id) < m_denseIds.size() && m_denseIds[id] != nullptr) {
+		return m_denseIds[id];
+	}
+	if (!m_sparseIds.empty()) {
+		auto it = m_sparseIds.find(id);
+		if (it != m_sparseIds.end()) {
+			return it->second;
+		}
+	}
+	return nullptr;
+}
+
+
+node GmlStreamParser::mapNode(Graph &G, int id, bool declared)
+{
+	if (declared) {
+		if (!m_anyId) {
+			m_minId = m_maxId = id;
+			m_anyId = true;
+		} else {
+			m_minId = min(m_minId, id);
+			m_maxId = max(m_maxId, id);
+		}
+	}
+
+	node v = findNode(id);
+	if (v == nullptr) {
+		v = G.newNode();
+		if (id >= 0 && id < 2 * G.numberOfNodes() + 1024) {
+			if (size_t(id) >= m_denseIds.size()) {
+				m_denseIds.resize(max(size_t(id) + 1, 2 * m_denseIds.size()), nullptr);
+			}
+			m_denseIds[id] = v;
+		} else {
+			m_sparseIds[id] = v;
+		}
+		if (!declared) {
+			m_implicitIds.push_back(id);
+		}
+	}
+
+	return v;
+}
+
+
+bool GmlStreamParser::doRead(Graph &G, GraphAttributes *GA, ClusterGraph *C, ClusterGraphAttributes *CA)
+{
+	OGDF_ASSERT(GA == nullptr || &GA->constGraph() == &G);
+	OGDF_ASSERT(C == nullptr || &C->constGraph() == &G);
+
+	G.clear();
+	m_denseIds.clear();
+	m_sparseIds.clear();
+	m_implicitIds.clear();
+	m_anyId = false;
+
+	bool graphRead = false, clustersRead = false;
+	for (;;) {
+		Symbol symbol = nextSymbol();
+		if (symbol == sEOF) {
+			break;
+		}
+		if (symbol != sKey) {
+			return symbol != sError && setError("key expected");
+		}
+
+		Key key = m_key;
+		Symbol value = nextSymbol();
+
+		if (key == kGraph && !graphRead) {
+			if (value != sListBegin) {
+				return setError("graph is not a list");
+			}
+			if (!readGraph(G, GA)) {
+				return false;
+			}
+			graphRead = true;
+
+		} else if (key == kRootCluster && C != nullptr && !clustersRead && value == sListBegin) {
+			if (!graphRead) {
+				return setError("rootcluster precedes graph");
+			}
+			if (!readCluster(*C, CA, C->rootCluster())) {
+				return false;
+			}
+			clustersRead = true;
+
+		} else if (!skipValue(value)) {
+			return false;
+		}
+	}
+
+	return graphRead || setError("graph not found");
+}
+
+
+bool GmlStreamParser::readGraph(Graph &G, GraphAttributes *GA)
+{
+	Key key;
+	bool listEnd;
+	while (nextKey(key, listEnd)) {
+		if (listEnd) {
+			// nodes only referenced by edges need an id in the range of the declared ones
+			for (int id : m_implicitIds) {
+				if (id < m_minId || id > m_maxId) {
+					return setError("source or target id out of range");
+				}
+			}
+			return true;
+		}
+
+		Symbol value = nextSymbol();
+		switch (key) {
+		case kNode:
+			if (value == sListBegin) {
+				if (!readNode(G, GA)) {
+					return false;
+				}
+				continue;
+			}
+			break;
+
+		case kEdge:
+			if (value == sListBegin) {
+				if (!readEdge(G, GA)) {
+					return false;
+				}
+				continue;
+			}
+			break;
+
+		case kDirected:
+			if (value == sInt && GA != nullptr) {
+				GA->setDirected(m_int > 0);
+			}
+			break;
+
+		default:
+			break;
+		}
+
+		if (!skipValue(value)) {
+			return false;
+		}
+	}
+
+	return false;
+}
+
+
+static Shape toShape(const string &str)
+{
+	struct Entry { const char *name; Shape shape; };
+	static const Entry shapes[] = {
+		{ "rectangle", shRect }, { "rect", shRect }, { "roundedRect", shRoundedRect },
+		{ "oval", shEllipse }, { "ellipse", shEllipse }, { "triangle", shTriangle },
+		{ "pentagon", shPentagon }, { "hexagon", shHexagon }, { "octagon", shOctagon },
+		{ "rhomb", shRhomb }, { "trapeze", shTrapeze }, { "parallelogram", shParallelogram },
+		{ "invTriangle", shInvTriangle }, { "invTrapeze", shInvTrapeze },
+		{ "invParallelogram", shInvParallelogram }, { "image", shImage }
+	};
+
+	for (const Entry &entry : shapes) {
+		if (str == entry.name) {
+			return entry.shape;
+		}
+	}
+	return shRect;
+}
+
+
+//! Sets \p color to the color given by \p str if it is valid.
+static void setColor(Color &color, const string &str)
+{
+	Color c;
+	if (c.fromString(str)) {
+		color = c;
+	}
+}
+
+
+bool GmlStreamParser::readNode(Graph &G, GraphAttributes *GA)
+{
+	int vId = 0;
+	bool hasId = false;
+	double x = 0, y = 0, w = 0, h = 0;
+	float lineWidth = 1.0f;
+	int pattern = 1, stipple = 1, weight = 0;
+	m_label.clear();
+	m_template.clear();
+	m_fill.clear();
+	m_stroke.clear();
+	m_shape.clear();
+
+	Key key;
+	bool listEnd;
+	while (nextKey(key, listEnd) && !listEnd) {
+		Symbol value = nextSymbol();
+
+		if (key == kId && value == sInt) {
+			vId = m_int;
+			hasId = true;
+			continue;
+		}
+
+		if (GA != nullptr) {
+			if (key == kGraphics && value == sListBegin) {
+				Key gKey;
+				bool gListEnd;
+				while (nextKey(gKey, gListEnd) && !gListEnd) {
+					Symbol gValue = nextSymbol();
+					if (gValue == sDouble) {
+						switch (gKey) {
+						case kX: x = m_double; continue;
+						case kY: y = m_double; continue;
+						case kW: w = m_double; continue;
+						case kH: h = m_double; continue;
+						case kLineWidth: lineWidth = static_cast<float>(m_double); continue;
+						default: break;
+						}
+					} else if (gValue == sString) {
+						switch (gKey) {
+						case kFill: m_fill.assign(m_string, m_stringLength); continue;
+						case kLineLower: m_stroke.assign(m_string, m_stringLength); continue;
+						case kType: m_shape.assign(m_string, m_stringLength); continue;
+						default: break;
+						}
+					} else if (gValue == sInt) {
+						switch (gKey) {
+						case kPattern: pattern = m_int; continue;
+						case kStipple: stipple = m_int; continue;
+						default: break;
+						}
+					}
+					if (!skipValue(gValue)) {
+						return false;
+					}
+				}
+				if (!gListEnd) {
+					return false;
+				}
+				continue;
+			}
+
+			if (value == sString && key == kLabel) {
+				m_label.assign(m_string, m_stringLength);
+				continue;
+			}
+			if (value == sString && key == kTemplate) {
+				m_template.assign(m_string, m_stringLength);
+				continue;
+			}
+			if (value == sInt && key == kWeight) {
+				weight = m_int;
+				continue;
+			}
+		}
+
+		if (!skipValue(value)) {
+			return false;
+		}
+	}
+
+	if (!listEnd) {
+		return false;
+	}
+	if (!hasId) {
+		return setError("node id not defined");
+	}
+
+	node v = mapNode(G, vId, true);
+	if (GA == nullptr) {
+		return true;
+	}
+
+	if (GA->has(GraphAttributes::nodeGraphics)) {
+		GA->x(v) = x;
+		GA->y(v) = y;
+		GA->width(v) = w;
+		GA->height(v) = h;
+		GA->shape(v) = toShape(m_shape);
+	}
+	if (GA->has(GraphAttributes::nodeLabel)) {
+		GA->label(v) = m_label;
+	}
+	if (GA->has(GraphAttributes::nodeTemplate)) {
+		GA->templateNode(v) = m_template;
+	}
+	if (GA->has(GraphAttributes::nodeId)) {
+		GA->idNode(v) = vId;
+	}
+	if (GA->has(GraphAttributes::nodeWeight)) {
+		GA->weight(v) = weight;
+	}
+	if (GA->has(GraphAttributes::nodeStyle)) {
+		setColor(GA->fillColor(v), m_fill);
+		setColor(GA->strokeColor(v), m_stroke);
+		GA->setFillPattern(v, intToFillPattern(pattern));
+		GA->setStrokeType(v, intToStrokeType(stipple));
+		GA->strokeWidth(v) = lineWidth;
+	}
+
+	return true;
+}
+
+
+bool GmlStreamParser::readEdge(Graph &G, GraphAttributes *GA)
+{
+	int sourceId = 0, targetId = 0;
+	bool hasSource = false, hasTarget = false;
+	int stipple = 1, subGraph = 0;
+	float lineWidth = 1.0f;
+	double weight = 1.0;
+	Graph::EdgeType type = Graph::association;
+	m_label.clear();
+	m_arrow.clear();
+	m_fill.clear();
+	m_bends.clear();
+
+	Key key;
+	bool listEnd;
+	while (nextKey(key, listEnd) && !listEnd) {
+		if (key == kSource || key == kTarget) {
+			bool &defined = (key == kSource) ? hasSource : hasTarget;
+			if (defined) {
+				return setError(key == kSource ? "ambiguous source encountered" : "ambiguous target encountered");
+			}
+			Symbol value = nextSymbol();
+			if (value == sInt) {
+				(key == kSource ? sourceId : targetId) = m_int;
+				defined = true;
+			} else if (!skipValue(value)) {
+				return false;
+			}
+			continue;
+		}
+
+		Symbol value = nextSymbol();
+		if (GA != nullptr) {
+			if (key == kGraphics && value == sListBegin) {
+				Key gKey;
+				bool gListEnd;
+				while (nextKey(gKey, gListEnd) && !gListEnd) {
+					Symbol gValue = nextSymbol();
+					if (gKey == kLine && gValue == sListBegin) {
+						if (!readLine(m_bends)) {
+							return false;
+						}
+						continue;
+					} else if (gValue == sString) {
+						switch (gKey) {
+						case kArrow: m_arrow.assign(m_string, m_stringLength); continue;
+						case kFill: m_fill.assign(m_string, m_stringLength); continue;
+						default: break;
+						}
+					} else if (gValue == sInt && gKey == kStipple) {
+						stipple = m_int;
+						continue;
+					} else if (gValue == sDouble) {
+						switch (gKey) {
+						case kLineWidth: lineWidth = static_cast<float>(m_double); continue;
+						case kWeight: weight = m_double; continue;
+						default: break;
+						}
+					}
+					if (!skipValue(gValue)) {
+						return false;
+					}
+				}
+				if (!gListEnd) {
+					return false;
+				}
+				continue;
+			}
+
+			if (value == sString && key == kLabel) {
+				m_label.assign(m_string, m_stringLength);
+				continue;
+			}
+			if (value == sInt && key == kSubgraph) {
+				subGraph = m_int;
+				continue;
+			}
+			if (value == sInt && key == kGeneralization) {
+				type = (m_int == 0) ? Graph::association : Graph::generalization;
+				continue;
+			}
+		}
+
+		if (!skipValue(value)) {
+			return false;
+		}
+	}
+
+	if (!listEnd) {
+		return false;
+	}
+	if (!hasSource || !hasTarget) {
+		return setError("source or target id not defined");
+	}
+
+	edge e = G.newEdge(mapNode(G, sourceId, false), mapNode(G, targetId, false));
+	if (GA == nullptr) {
+		return true;
+	}
+
+	if (GA->has(GraphAttributes::edgeGraphics)) {
+		GA->bends(e).conc(m_bends);
+	}
+	if (GA->has(GraphAttributes::edgeType)) {
+		GA->type(e) = type;
+	}
+	if (GA->has(GraphAttributes::edgeSubGraphs)) {
+		GA->subGraphBits(e) = subGraph;
+	}
+	if (GA->has(GraphAttributes::edgeLabel)) {
+		GA->label(e) = m_label;
+	}
+	if (GA->has(GraphAttributes::edgeArrow)) {
+		if (m_arrow == "none") {
+			GA->arrowType(e) = eaNone;
+		} else if (m_arrow == "last") {
+			GA->arrowType(e) = eaLast;
+		} else if (m_arrow == "first") {
+			GA->arrowType(e) = eaFirst;
+		} else if (m_arrow == "both") {
+			GA->arrowType(e) = eaBoth;
+		} else {
+			GA->arrowType(e) = eaUndefined;
+		}
+	}
+	if (GA->has(GraphAttributes::edgeStyle)) {
+		setColor(GA->strokeColor(e), m_fill);
+		GA->setStrokeType(e, intToStrokeType(stipple));
+		GA->strokeWidth(e) = lineWidth;
+	}
+	if (GA->has(GraphAttributes::edgeDoubleWeight)) {
+		GA->doubleWeight(e) = weight;
+	}
+
+	return true;
+}
+
+
+bool GmlStreamParser::readLine(DPolyline &bends)
+{
+	bends.clear();
+
+	Key key;
+	bool listEnd;
+	while (nextKey(key, listEnd) && !listEnd) {
+		Symbol value = nextSymbol();
+		if (key != kPoint || value != sListBegin) {
+			if (!skipValue(value)) {
+				return false;
+			}
+			continue;
+		}
+
+		DPoint dp;
+		Key pKey;
+		bool pListEnd;
+		while (nextKey(pKey, pListEnd) && !pListEnd) {
+			Symbol pValue = nextSymbol();
+			if (pValue == sDouble && pKey == kX) {
+				dp.m_x = m_double;
+			} else if (pValue == sDouble && pKey == kY) {
+				dp.m_y = m_double;
+			} else if (!skipValue(pValue)) {
+				return false;
+			}
+		}
+		if (!pListEnd) {
+			return false;
+		}
+		bends.pushBack(dp);
+	}
+
+	return listEnd;
+}
+
+
+bool GmlStreamParser::readCluster(ClusterGraph &C, ClusterGraphAttributes *CA, cluster c)
+{
+	// attributes of the root cluster are ignored
+	const bool attributes = CA != nullptr && c != C.rootCluster();
+
+	Key key;
+	bool listEnd;
+	while (nextKey(key, listEnd) && !listEnd) {
+		Symbol value = nextSymbol();
+
+		if (key == kCluster && value == sListBegin) {
+			if (!readCluster(C, CA, C.newCluster(c))) {
+				return false;
+			}
+
+		} else if (key == kVertex && value == sString) {
+			// vertices are given as "<id>" or, in older files, as "v<id>"
+			const char *p = m_string;
+			const char *end = m_string + m_stringLength;
+			if (p == end || (*p != 'v' && !isdigit(static_cast<unsigned char>(*p)))) {
+				return setError("invalid vertex");
+			}
+			if (*p == 'v') {
+				++p;
+			}
+			int id = 0;
+			for (; p < end && isdigit(static_cast<unsigned char>(*p)); ++p) {
+				id = 10 * id + (*p - '0');
+			}
+			node v = findNode(id);
+			if (v == nullptr) {
+				return setError("vertex does not refer to a node");
+			}
+			C.reassignNode(v, c);
+
+		} else if (attributes && key == kLabel && value == sString) {
+			CA->label(c).assign(m_string, m_stringLength);
+
+		} else if (attributes && key == kTemplate && value == sString) {
+			CA->templateCluster(c).assign(m_string, m_stringLength);
+
+		} else if (attributes && key == kGraphics && value == sListBegin) {
+			if (!readClusterGraphics(*CA, c)) {
+				return false;
+			}
+
+		} else if (!skipValue(value)) {
+			return false;
+		}
+	}
+
+	return listEnd;
+}
+
+
+bool GmlStreamParser::readClusterGraphics(ClusterGraphAttributes &CA, cluster c)
+{
+	float lineWidth = 1.0f;
+	int pattern = 1, stipple = 1;
+
+	Key key;
+	bool listEnd;
+	while (nextKey(key, listEnd) && !listEnd) {
+		Symbol value = nextSymbol();
+		if (value == sDouble) {
+			switch (key) {
+			case kX: CA.x(c) = m_double; continue;
+			case kY: CA.y(c) = m_double; continue;
+			case kWidth: CA.width(c) = m_double; continue;
+			case kHeight: CA.height(c) = m_double; continue;
+			case kLineWidth: lineWidth = static_cast<float>(m_double); continue;
+			default: break;
+			}
+		} else if (value == sString) {
+			switch (key) {
+			case kFill: m_fill.assign(m_string, m_stringLength); setColor(CA.fillColor(c), m_fill); continue;
+			case kColor: m_fill.assign(m_string, m_stringLength); setColor(CA.strokeColor(c), m_fill); continue;
+			default: break;
+			}
+		} else if (value == sInt) {
+			switch (key) {
+			case kPattern: pattern = m_int; continue;
+			case kStipple: stipple = m_int; continue;
+			default: break;
+			}
+		}
+		if (!skipValue(value)) {
+			return false;
+		}
+	}
+
+	if (!listEnd) {
+		return false;
+	}
+
+	CA.setStrokeType(c, intToStrokeType(stipple));
+	CA.strokeWidth(c) = lineWidth;
+	CA.setFillPattern(c, intToFillPattern(pattern));
+	return true;
+}
+
+}
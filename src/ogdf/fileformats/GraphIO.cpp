@@ -34,12 +34,15 @@
  ***************************************************************/
 
 #include <ogdf/basic/Logger.h>
+#include <ogdf/basic/Thread.h>
 #include <ogdf/basic/AdjacencyOracle.h>
 #include <ogdf/basic/simple_graph_alg.h>
 #include <ogdf/fileformats/GraphIO.h>
 #include <ogdf/fileformats/GmlParser.h>
+#include <ogdf/fileformats/GmlStreamParser.h>
 #include <ogdf/fileformats/OgmlParser.h>
 #include <ogdf/fileformats/GraphMLParser.h>
+#include <ogdf/fileformats/GraphMLStreamParser.h>
 #include <ogdf/fileformats/DotParser.h>
 #include <ogdf/fileformats/GexfParser.h>
 #include <ogdf/fileformats/GdfParser.h>
@@ -48,6 +51,7 @@
 #include <ogdf/fileformats/SvgPrinter.h>
 #include <sstream>
 #include <map>
+#include <atomic>
 
 // we use these data structures from the stdlib
 using std::map;
@@ -57,13 +61,15 @@ namespace ogdf {
 
 char GraphIO::s_indentChar  = ' ';
 int  GraphIO::s_indentWidth = 2;
-Logger GraphIO::logger;
+bool GraphIO::s_streamingParsers = false;
+GraphIO::IOLogger GraphIO::logger;
 
 typedef bool (*Reader)(Graph&, istream&);
 
 //! Supported formats for automated detection
-const int NUMBER_OF_READERS = 10;
+const int NUMBER_OF_READERS = 11;
 const Reader readers[NUMBER_OF_READERS] = {
+	GraphIO::readBinary,
 	GraphIO::readDOT,
 	GraphIO::readGML,
 	GraphIO::readTLP,
@@ -110,6 +116,180 @@ bool GraphIO::read(Graph &G, istream &is)
 	return false;
 }
 
+//---------------------------------------------------------
+// Batch processing
+//---------------------------------------------------------
+
+// Logging-output of the file processed by a batch thread.
+struct BatchLog {
+	std::ostringstream messages;
+	std::ostream discard;
+
+	BatchLog() : discard(nullptr) { }
+};
+
+static OGDF_DECL_THREAD BatchLog *s_batchLog = nullptr;
+
+std::ostream &GraphIO::IOLogger::lout(Level l) const
+{
+	if(s_batchLog != nullptr) {
+		return (l >= LL_DEFAULT) ? s_batchLog->messages : s_batchLog->discard;
+	}
+	return Logger::lout(l);
+}
+
+// Runs process(i) for each file i on up to numThreads threads and records the outcomes.
+// Failures that did not log anything get the generic message failure.
+static int runBatch(
+	const Array<string> &filenames,
+	Array<GraphIO::BatchResult> &results,
+	unsigned int numThreads,
+	const char *failure,
+	std::function<bool(int)> process)
+{
+	const int n = filenames.size();
+	results.init(n);
+
+	std::atomic<int> next(0), succeeded(0);
+
+	auto worker = [&] {
+		BatchLog log;
+		s_batchLog = &log;
+
+		for(int i = next++; i < n; i = next++) {
+			GraphIO::BatchResult &result = results[i];
+			result.filename = filenames[i];
+			log.messages.str("");
+
+			try {
+				result.success = process(i);
+			} catch(std::exception &e) {
+				log.messages << "Exception: " << e.what() << endl;
+				result.success = false;
+			} catch(...) {
+				log.messages << "Exception." << endl;
+				result.success = false;
+			}
+
+			result.message = log.messages.str();
+			if(result.success) {
+				++succeeded;
+			} else if(result.message.empty()) {
+				result.message = failure;
+			}
+		}
+
+		s_batchLog = nullptr;
+	};
+
+#ifdef OGDF_MEMORY_POOL_NTS
+	numThreads = 1;
+#else
+	if(numThreads == 0) {
+		numThreads = max(1u, Thread::hardware_concurrency());
+	}
+#endif
+	numThreads = min(numThreads, (unsigned int)max(n, 1));
+
+	Array<Thread> thread(numThreads - 1);
+	for(Thread &t : thread) {
+		t = Thread(worker);
+	}
+
+	worker();
+
+	for(Thread &t : thread) {
+		t.join();
+	}
+
+	return succeeded;
+}
+
+int GraphIO::readBatch(
+	const Array<string> &filenames,
+	Array<Graph> &graphs,
+	Array<BatchResult> &results,
+	ReaderFunc reader,
+	unsigned int numThreads)
+{
+	graphs.init(filenames.size());
+	const std::ios::openmode mode = (reader == static_cast<ReaderFunc>(readBinary)) ? std::ios::binary : std::ios::in;
+
+	return runBatch(filenames, results, numThreads, "Could not read file.", [&](int i) {
+		ifstream is(filenames[i], std::ios::in | mode);
+		if(!is.good()) {
+			logger.lout() << "Could not open file." << endl;
+			return false;
+		}
+		return reader ? reader(graphs[i], is) : read(graphs[i], is);
+	});
+}
+
+int GraphIO::readBatch(
+	const Array<string> &filenames,
+	long attributes,
+	Array<Graph> &graphs,
+	Array<GraphAttributes> &attrs,
+	Array<BatchResult> &results,
+	AttributesReaderFunc reader,
+	unsigned int numThreads)
+{
+	// attributes must not outlive their graphs
+	attrs.init(filenames.size());
+	graphs.init(filenames.size());
+	const std::ios::openmode mode = (reader == static_cast<AttributesReaderFunc>(readBinary)) ? std::ios::binary : std::ios::in;
+
+	return runBatch(filenames, results, numThreads, "Could not read file.", [&](int i) {
+		attrs[i].init(graphs[i], attributes);
+		ifstream is(filenames[i], std::ios::in | mode);
+		if(!is.good()) {
+			logger.lout() << "Could not open file." << endl;
+			return false;
+		}
+		return reader(attrs[i], graphs[i], is);
+	});
+}
+
+int GraphIO::writeBatch(
+	const Array<string> &filenames,
+	const Array<Graph> &graphs,
+	Array<BatchResult> &results,
+	WriterFunc writer,
+	unsigned int numThreads)
+{
+	OGDF_ASSERT(filenames.size() == graphs.size());
+	const std::ios::openmode mode = (writer == static_cast<WriterFunc>(writeBinary)) ? std::ios::binary : std::ios::out;
+
+	return runBatch(filenames, results, numThreads, "Could not write file.", [&](int i) {
+		ofstream os(filenames[i], std::ios::out | mode);
+		if(!os.good()) {
+			logger.lout() << "Could not open file." << endl;
+			return false;
+		}
+		return writer(graphs[i], os) && os.flush().good();
+	});
+}
+
+int GraphIO::writeBatch(
+	const Array<string> &filenames,
+	const Array<GraphAttributes> &attrs,
+	Array<BatchResult> &results,
+	AttributesWriterFunc writer,
+	unsigned int numThreads)
+{
+	OGDF_ASSERT(filenames.size() == attrs.size());
+	const std::ios::openmode mode = (writer == static_cast<AttributesWriterFunc>(writeBinary)) ? std::ios::binary : std::ios::out;
+
+	return runBatch(filenames, results, numThreads, "Could not write file.", [&](int i) {
+		ofstream os(filenames[i], std::ios::out | mode);
+		if(!os.good()) {
+			logger.lout() << "Could not open file." << endl;
+			return false;
+		}
+		return writer(attrs[i], os) && os.flush().good();
+	});
+}
+
 //---------------------------------------------------------
 // Graph: GML format
 //---------------------------------------------------------
@@ -123,6 +303,10 @@ bool GraphIO::readGML(Graph &G, const string &filename)
 bool GraphIO::readGML(Graph &G, istream &is)
 {
 	if(!is.good()) return false;
+	if(s_streamingParsers) {
+		GmlStreamParser parser(is);
+		return parser.read(G);
+	}
 	GmlParser parser(is);
 	if (parser.error()) return false;
 	return parser.read(G);
@@ -730,6 +914,10 @@ bool GraphIO::readGML(ClusterGraph &C, Graph &G, const string &filename)
 bool GraphIO::readGML(ClusterGraph &C, Graph &G, istream &is)
 {
 	if(!is.good()) return false;
+	if(s_streamingParsers) {
+		GmlStreamParser parser(is);
+		return parser.read(G, C);
+	}
 
 	GmlParser gml(is);
 	if (gml.error())
@@ -782,6 +970,10 @@ bool GraphIO::readGML(GraphAttributes &A, Graph &G, const string &filename)
 bool GraphIO::readGML(GraphAttributes &A, Graph &G, istream &is)
 {
 	if (!is.good()) return false;
+	if(s_streamingParsers) {
+		GmlStreamParser parser(is);
+		return parser.read(G, A);
+	}
 	GmlParser parser(is);
 	if (parser.error()) return false;
 	return parser.read(G, A);
@@ -912,6 +1104,10 @@ bool GraphIO::readGML(ClusterGraphAttributes &A, ClusterGraph &C, Graph &G, cons
 bool GraphIO::readGML(ClusterGraphAttributes &A, ClusterGraph &C, Graph &G, istream &is)
 {
 	if(!is.good()) return false;
+	if(s_streamingParsers) {
+		GmlStreamParser parser(is);
+		return parser.read(G, C, A);
+	}
 
 	GmlParser gml(is);
 	if (gml.error())
@@ -1327,6 +1523,10 @@ bool GraphIO::readGraphML(Graph &G, istream &is)
 	if(!is.good()) {
 		return false;
 	}
+	if(s_streamingParsers) {
+		GraphMLStreamParser parser(is);
+		return parser.read(G);
+	}
 	GraphMLParser parser(is);
 	return parser.read(G);
 }
@@ -1352,6 +1552,10 @@ bool GraphIO::readGraphML(ClusterGraph &C, Graph &G, istream &is)
 	if(!is.good()) {
 		return false;
 	}
+	if(s_streamingParsers) {
+		GraphMLStreamParser parser(is);
+		return parser.read(G, C);
+	}
 	GraphMLParser parser(is);
 	return parser.read(G, C);
 }
@@ -1377,6 +1581,10 @@ bool GraphIO::readGraphML(GraphAttributes &A, Graph &G, istream &is)
 	if(!is.good()) {
 		return false;
 	}
+	if(s_streamingParsers) {
+		GraphMLStreamParser parser(is);
+		return parser.read(G, A);
+	}
 	GraphMLParser parser(is);
 	return parser.read(G, A);
 }
@@ -1402,6 +1610,10 @@ bool GraphIO::readGraphML(ClusterGraphAttributes &A, ClusterGraph &C, Graph &G,
 
 bool GraphIO::readGraphML(ClusterGraphAttributes &A, ClusterGraph &C, Graph &G, istream &is)
 {
+	if(s_streamingParsers) {
+		GraphMLStreamParser parser(is);
+		return parser.read(G, C, A);
+	}
 	GraphMLParser parser(is);
 	return parser.read(G, C, A);
 }
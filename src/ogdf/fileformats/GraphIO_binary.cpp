@@ -0,0 +1,917 @@
+/** \file
+ * \brief Implements the binary graph format of GraphIO.
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.txt in the root directory of the OGDF installation for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ *
+ * \see  http://www.gnu.org/copyleft/gpl.html
+ ***************************************************************/
+
+#include <ogdf/fileformats/GraphIO.h>
+#include <cstring>
+#include <climits>
+#include <vector>
+
+#ifdef OGDF_SYSTEM_UNIX
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+
+namespace ogdf {
+
+namespace binary {
+
+const char magic[8] = { 'O', 'G', 'D', 'F', 'B', 'I', 'N', '\0' };
+const uint32_t version = 1;
+
+//! Flags stored in the header.
+enum Flag : uint32_t {
+	fDirected          = 0x1, //!< the graph is directed
+	fAttributes        = 0x2, //!< graph attributes follow the topology
+	fClusters          = 0x4, //!< a cluster tree follows the (graph) attributes
+	fClusterAttributes = 0x8  //!< cluster attributes follow the cluster tree
+};
+
+//! The header at the beginning of each file.
+struct Header {
+	char     m_magic[8];         //!< always binary::magic
+	uint32_t m_version;          //!< the version of the format
+	uint32_t m_flags;            //!< the flags (see Flag)
+	int64_t  m_numberOfNodes;    //!< the number of nodes
+	int64_t  m_numberOfEdges;    //!< the number of edges
+	int64_t  m_numberOfClusters; //!< the number of clusters (including the root cluster)
+	int64_t  m_attributes;       //!< the stored graph attributes (see GraphAttributes)
+	int64_t  m_reserved[2];
+};
+
+static_assert(sizeof(Header) == 64, "unexpected size of binary::Header");
+
+//! The stroke of a node, edge or cluster.
+struct StrokeRecord {
+	uint8_t m_color[4]; //!< red, green, blue and alpha
+	float   m_width;
+	int32_t m_type;
+};
+
+//! The fill of a node or cluster.
+struct FillRecord {
+	uint8_t m_color[4];   //!< red, green, blue and alpha
+	uint8_t m_bgColor[4]; //!< red, green, blue and alpha
+	int32_t m_pattern;
+};
+
+static_assert(sizeof(StrokeRecord) == 12 && sizeof(FillRecord) == 12, "unexpected size of binary records");
+
+inline bool littleEndian()
+{
+	const uint32_t one = 1;
+	return *reinterpret_cast<const uint8_t*>(&one) == 1;
+}
+
+inline size_t padded(size_t bytes)
+{
+	return (bytes + 7) & ~size_t(7);
+}
+
+inline void toBytes(const Color &c, uint8_t *rgba)
+{
+	rgba[0] = c.red(); rgba[1] = c.green(); rgba[2] = c.blue(); rgba[3] = c.alpha();
+}
+
+inline Color fromBytes(const uint8_t *rgba)
+{
+	return Color(rgba[0], rgba[1], rgba[2], rgba[3]);
+}
+
+
+//! Writes the arrays of a file to an output stream.
+class Writer {
+	ostream &m_os;
+
+public:
+	explicit Writer(ostream &os) : m_os(os) { }
+
+	//! Writes the \a n elements starting at \a data and pads them to a multiple of 8 bytes.
+	template<class T>
+	void write(const T *data, size_t n) {
+		size_t bytes = n * sizeof(T);
+		m_os.write(reinterpret_cast<const char*>(data), bytes);
+		pad(bytes);
+	}
+
+	//! Writes \a f(x) for all \a x in \a elements.
+	template<class T, class E, class F>
+	void writeEach(const Array<E> &elements, F f) {
+		Array<T> data(elements.size());
+		for (int i = 0; i < elements.size(); ++i)
+			data[i] = f(elements[i]);
+		write(data.begin(), data.size());
+	}
+
+	//! Writes the strings \a f(x) for all \a x in \a elements.
+	/**
+	 * The strings are stored as an array of n+1 offsets followed by the characters of all strings.
+	 */
+	template<class E, class F>
+	void writeStrings(const Array<E> &elements, F f) {
+		Array<uint64_t> offset(elements.size() + 1);
+		offset[0] = 0;
+		for (int i = 0; i < elements.size(); ++i)
+			offset[i+1] = offset[i] + f(elements[i]).size();
+		write(offset.begin(), offset.size());
+
+		for (int i = 0; i < elements.size(); ++i) {
+			const string &s = f(elements[i]);
+			m_os.write(s.data(), s.size());
+		}
+		pad(size_t(offset[elements.size()]));
+	}
+
+	//! Writes the strokes given by the functions \a color, \a width and \a type.
+	template<class E, class FC, class FW, class FT>
+	void writeStrokes(const Array<E> &elements, FC color, FW width, FT type) {
+		writeEach<StrokeRecord>(elements, [&](E x) {
+			StrokeRecord r;
+			toBytes(color(x), r.m_color);
+			r.m_width = width(x);
+			r.m_type = int32_t(type(x));
+			return r;
+		});
+	}
+
+	//! Writes the fills given by the functions \a color, \a bgColor and \a pattern.
+	template<class E, class FC, class FB, class FP>
+	void writeFills(const Array<E> &elements, FC color, FB bgColor, FP pattern) {
+		writeEach<FillRecord>(elements, [&](E x) {
+			FillRecord r;
+			toBytes(color(x), r.m_color);
+			toBytes(bgColor(x), r.m_bgColor);
+			r.m_pattern = int32_t(pattern(x));
+			return r;
+		});
+	}
+
+private:
+	//! Pads an array of \a bytes bytes to a multiple of 8 bytes.
+	void pad(size_t bytes) {
+		static const char zeros[8] = { 0 };
+		m_os.write(zeros, padded(bytes) - bytes);
+	}
+};
+
+
+//! Reads the arrays of a file from a memory block.
+class Reader {
+	const char *m_p;
+	const char *m_end;
+
+public:
+	Reader(const char *begin, const char *end) : m_p(begin), m_end(end) { }
+
+	//! Returns the next array of \a n elements, or nullptr if the block is too short.
+	template<class T>
+	const T *read(int64_t n) {
+		if (n < 0 || uint64_t(n) > size_t(m_end - m_p) / sizeof(T))
+			return nullptr;
+		size_t bytes = padded(size_t(n) * sizeof(T));
+		if (bytes > size_t(m_end - m_p))
+			return nullptr;
+		const T *p = reinterpret_cast<const T*>(m_p);
+		m_p += bytes;
+		return p;
+	}
+
+	//! Reads \a n strings and passes the i-th string to \a f(i, s), if \a apply is set.
+	template<class F>
+	bool readStrings(int64_t n, bool apply, F f) {
+		const uint64_t *offset = read<uint64_t>(n + 1);
+		if (offset == nullptr || offset[0] != 0)
+			return false;
+		for (int64_t i = 0; i < n; ++i)
+			if (offset[i+1] < offset[i])
+				return false;
+
+		const char *chars = read<char>(int64_t(offset[n]));
+		if (chars == nullptr)
+			return false;
+		if (apply) {
+			for (int64_t i = 0; i < n; ++i)
+				f(i, string(chars + offset[i], size_t(offset[i+1] - offset[i])));
+		}
+		return true;
+	}
+
+	//! Reads \a n elements of type \a T and passes the i-th element to \a f(i, x), if \a apply is set.
+	template<class T, class F>
+	bool readEach(int64_t n, bool apply, F f) {
+		const T *data = read<T>(n);
+		if (data == nullptr)
+			return false;
+		if (apply) {
+			for (int64_t i = 0; i < n; ++i)
+				f(i, data[i]);
+		}
+		return true;
+	}
+};
+
+
+//! The contents of a file, memory-mapped if possible.
+class FileContents {
+	const char *m_data;
+	size_t m_size;
+	bool m_mapped;
+	std::vector<char> m_buffer;
+
+public:
+	explicit FileContents(const string &filename) : m_data(nullptr), m_size(0), m_mapped(false) {
+#ifdef OGDF_SYSTEM_UNIX
+		int fd = open(filename.c_str(), O_RDONLY);
+		if (fd < 0)
+			return;
+
+		struct stat st;
+		if (fstat(fd, &st) == 0 && st.st_size > 0) {
+			void *p = mmap(nullptr, size_t(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+			if (p != MAP_FAILED) {
+				m_data = static_cast<const char*>(p);
+				m_size = size_t(st.st_size);
+				m_mapped = true;
+			}
+		}
+		close(fd);
+
+		if (m_mapped)
+			return;
+#endif
+		ifstream is(filename, std::ios::binary);
+		if (is.good())
+			readStream(is);
+	}
+
+	//! Reads the rest of \a is; \a prefix holds the \a prefixSize bytes already read.
+	FileContents(istream &is, const char *prefix, size_t prefixSize)
+		: m_data(nullptr), m_size(0), m_mapped(false), m_buffer(prefix, prefix + prefixSize)
+	{
+		readStream(is);
+	}
+
+	~FileContents() {
+#ifdef OGDF_SYSTEM_UNIX
+		if (m_mapped)
+			munmap(const_cast<char*>(m_data), m_size);
+#endif
+	}
+
+	const char *data() const { return m_data; }
+	size_t size() const { return m_size; }
+
+private:
+	void readStream(istream &is) {
+		const size_t chunkSize = 1 << 20;
+		while (is.good()) {
+			size_t oldSize = m_buffer.size();
+			m_buffer.resize(oldSize + chunkSize);
+			is.read(m_buffer.data() + oldSize, chunkSize);
+			m_buffer.resize(oldSize + size_t(is.gcount()));
+		}
+		m_data = m_buffer.data();
+		m_size = m_buffer.size();
+	}
+
+	// prevent copying
+	FileContents(const FileContents &);
+	FileContents &operator=(const FileContents &);
+};
+
+
+//! Collects the clusters of \a C in breadth-first order, so that each cluster is preceded by its parent.
+static void breadthFirstOrder(const ClusterGraph &C, Array<cluster> &clusters)
+{
+	clusters.init(C.numberOfClusters());
+	int i = 0;
+	clusters[i++] = C.rootCluster();
+	for (int j = 0; j < i; ++j) {
+		for (cluster child : clusters[j]->children)
+			clusters[i++] = child;
+	}
+}
+
+
+static bool write(
+	ostream &os,
+	const Graph &G,
+	const GraphAttributes *pA,
+	const ClusterGraph *pC,
+	const ClusterGraphAttributes *pCA)
+{
+	if (!os.good()) return false;
+
+	Array<node> nodes(G.numberOfNodes());
+	NodeArray<int> nodeIndex(G);
+	int i = 0;
+	for (node v : G.nodes) {
+		nodeIndex[v] = i;
+		nodes[i++] = v;
+	}
+
+	Array<edge> edges(G.numberOfEdges());
+	EdgeArray<int> edgeIndex(G);
+	i = 0;
+	for (edge e : G.edges) {
+		edgeIndex[e] = i;
+		edges[i++] = e;
+	}
+
+	Array<cluster> clusters;
+	if (pC != nullptr)
+		breadthFirstOrder(*pC, clusters);
+
+	Header header;
+	memcpy(header.m_magic, magic, sizeof(magic));
+	header.m_version = version;
+	header.m_flags = (pA == nullptr || pA->directed()) ? uint32_t(fDirected) : 0;
+	if (pA != nullptr) header.m_flags |= fAttributes;
+	if (pC != nullptr) header.m_flags |= fClusters;
+	if (pCA != nullptr) header.m_flags |= fClusterAttributes;
+	header.m_numberOfNodes = nodes.size();
+	header.m_numberOfEdges = edges.size();
+	header.m_numberOfClusters = clusters.size();
+	header.m_attributes = (pA != nullptr) ? pA->attributes() : 0;
+	header.m_reserved[0] = header.m_reserved[1] = 0;
+
+	Writer w(os);
+	w.write(&header, 1);
+
+	// topology
+	w.writeEach<int32_t>(edges, [&](edge e) { return nodeIndex[e->source()]; });
+	w.writeEach<int32_t>(edges, [&](edge e) { return nodeIndex[e->target()]; });
+
+	Array<int32_t> adjacencies(2 * edges.size());
+	i = 0;
+	for (node v : nodes) {
+		for (adjEntry adj : v->adjEntries) {
+			edge e = adj->theEdge();
+			adjacencies[i++] = 2 * edgeIndex[e] + (adj == e->adjTarget() ? 1 : 0);
+		}
+	}
+	w.write(adjacencies.begin(), adjacencies.size());
+
+	// graph attributes
+	if (pA != nullptr) {
+		const GraphAttributes &A = *pA;
+
+		if (A.has(GraphAttributes::nodeGraphics)) {
+			w.writeEach<double>(nodes, [&](node v) { return A.x(v); });
+			w.writeEach<double>(nodes, [&](node v) { return A.y(v); });
+			w.writeEach<double>(nodes, [&](node v) { return A.width(v); });
+			w.writeEach<double>(nodes, [&](node v) { return A.height(v); });
+			w.writeEach<int32_t>(nodes, [&](node v) { return A.shape(v); });
+		}
+		if (A.has(GraphAttributes::threeD)) {
+			w.writeEach<double>(nodes, [&](node v) { return A.z(v); });
+		}
+		if (A.has(GraphAttributes::nodeLabelPosition)) {
+			w.writeEach<double>(nodes, [&](node v) { return A.xLabel(v); });
+			w.writeEach<double>(nodes, [&](node v) { return A.yLabel(v); });
+			w.writeEach<double>(nodes, [&](node v) { return A.zLabel(v); });
+		}
+		if (A.has(GraphAttributes::nodeStyle)) {
+			w.writeStrokes(nodes,
+				[&](node v) { return A.strokeColor(v); },
+				[&](node v) { return A.strokeWidth(v); },
+				[&](node v) { return A.strokeType(v); });
+			w.writeFills(nodes,
+				[&](node v) { return A.fillColor(v); },
+				[&](node v) { return A.fillBgColor(v); },
+				[&](node v) { return A.fillPattern(v); });
+		}
+		if (A.has(GraphAttributes::nodeLabel)) {
+			w.writeStrings(nodes, [&](node v) -> const string& { return A.label(v); });
+		}
+		if (A.has(GraphAttributes::nodeTemplate)) {
+			w.writeStrings(nodes, [&](node v) -> const string& { return A.templateNode(v); });
+		}
+		if (A.has(GraphAttributes::nodeWeight)) {
+			w.writeEach<int32_t>(nodes, [&](node v) { return A.weight(v); });
+		}
+		if (A.has(GraphAttributes::nodeType)) {
+			w.writeEach<int32_t>(nodes, [&](node v) { return A.type(v); });
+		}
+		if (A.has(GraphAttributes::nodeId)) {
+			w.writeEach<int32_t>(nodes, [&](node v) { return A.idNode(v); });
+		}
+
+		if (A.has(GraphAttributes::edgeGraphics)) {
+			// offsets into the list of all bend points, followed by the coordinates
+			Array<uint64_t> offset(edges.size() + 1);
+			offset[0] = 0;
+			for (i = 0; i < edges.size(); ++i)
+				offset[i+1] = offset[i] + A.bends(edges[i]).size();
+			w.write(offset.begin(), offset.size());
+
+			Array<double> coords(int(2 * offset[edges.size()]));
+			i = 0;
+			for (edge e : edges) {
+				for (const DPoint &p : A.bends(e)) {
+					coords[i++] = p.m_x;
+					coords[i++] = p.m_y;
+				}
+			}
+			w.write(coords.begin(), coords.size());
+		}
+		if (A.has(GraphAttributes::edgeArrow)) {
+			w.writeEach<int32_t>(edges, [&](edge e) { return A.arrowType(e); });
+		}
+		if (A.has(GraphAttributes::edgeStyle)) {
+			w.writeStrokes(edges,
+				[&](edge e) { return A.strokeColor(e); },
+				[&](edge e) { return A.strokeWidth(e); },
+				[&](edge e) { return A.strokeType(e); });
+		}
+		if (A.has(GraphAttributes::edgeLabel)) {
+			w.writeStrings(edges, [&](edge e) -> const string& { return A.label(e); });
+		}
+		if (A.has(GraphAttributes::edgeIntWeight)) {
+			w.writeEach<int32_t>(edges, [&](edge e) { return A.intWeight(e); });
+		}
+		if (A.has(GraphAttributes::edgeDoubleWeight)) {
+			w.writeEach<double>(edges, [&](edge e) { return A.doubleWeight(e); });
+		}
+		if (A.has(GraphAttributes::edgeType)) {
+			w.writeEach<int32_t>(edges, [&](edge e) { return A.type(e); });
+		}
+		if (A.has(GraphAttributes::edgeSubGraphs)) {
+			w.writeEach<uint32_t>(edges, [&](edge e) { return A.subGraphBits(e); });
+		}
+	}
+
+	// cluster tree
+	if (pC != nullptr) {
+		ClusterArray<int> clusterIndex(*pC);
+		for (i = 0; i < clusters.size(); ++i)
+			clusterIndex[clusters[i]] = i;
+
+		w.writeEach<int32_t>(clusters, [&](cluster c) { return c == pC->rootCluster() ? -1 : clusterIndex[c->parent()]; });
+		w.writeEach<int32_t>(nodes, [&](node v) { return clusterIndex[pC->clusterOf(v)]; });
+	}
+
+	if (pCA != nullptr) {
+		const ClusterGraphAttributes &CA = *pCA;
+
+		w.writeEach<double>(clusters, [&](cluster c) { return CA.x(c); });
+		w.writeEach<double>(clusters, [&](cluster c) { return CA.y(c); });
+		w.writeEach<double>(clusters, [&](cluster c) { return CA.width(c); });
+		w.writeEach<double>(clusters, [&](cluster c) { return CA.height(c); });
+		w.writeStrokes(clusters,
+			[&](cluster c) { return CA.strokeColor(c); },
+			[&](cluster c) { return CA.strokeWidth(c); },
+			[&](cluster c) { return CA.strokeType(c); });
+		w.writeFills(clusters,
+			[&](cluster c) { return CA.fillColor(c); },
+			[&](cluster c) { return CA.fillBgColor(c); },
+			[&](cluster c) { return CA.fillPattern(c); });
+		w.writeStrings(clusters, [&](cluster c) -> const string& { return CA.label(c); });
+		w.writeStrings(clusters, [&](cluster c) -> const string& { return CA.templateCluster(c); });
+	}
+
+	return os.good();
+}
+
+
+//! Reads a file from memory; \a pA, \a pC and \a pCA may be nullptr.
+static bool read(
+	const char *data,
+	size_t size,
+	Graph &G,
+	GraphAttributes *pA,
+	ClusterGraph *pC,
+	ClusterGraphAttributes *pCA)
+{
+	if (data == nullptr || size < sizeof(Header)) return false;
+
+	Header header;
+	memcpy(&header, data, sizeof(Header));
+	if (memcmp(header.m_magic, magic, sizeof(magic)) != 0)
+		return false;
+
+	if (header.m_version != version) {
+		GraphIO::logger.lout() << "Unsupported version " << header.m_version << " of binary graph file." << endl;
+		return false;
+	}
+	if (!littleEndian()) {
+		GraphIO::logger.lout() << "Binary graph files can only be read on little-endian machines." << endl;
+		return false;
+	}
+
+	const int64_t n = header.m_numberOfNodes;
+	const int64_t m = header.m_numberOfEdges;
+	const int64_t numClusters = header.m_numberOfClusters;
+	if (n < 0 || n > INT_MAX || m < 0 || m > INT_MAX / 2 || numClusters < 0 || numClusters > INT_MAX) {
+		GraphIO::logger.lout() << "Invalid size of binary graph file." << endl;
+		return false;
+	}
+
+	Reader r(data + sizeof(Header), data + size);
+
+	const int32_t *source = r.read<int32_t>(m);
+	const int32_t *target = r.read<int32_t>(m);
+	const int32_t *adjacencies = r.read<int32_t>(2 * m);
+	if (source == nullptr || target == nullptr || adjacencies == nullptr) {
+		GraphIO::logger.lout() << "Unexpected end of binary graph file." << endl;
+		return false;
+	}
+
+	// check the topology before touching G
+	Array<int> degree(0, int(n) - 1, 0);
+	for (int64_t i = 0; i < m; ++i) {
+		if (source[i] < 0 || source[i] >= n || target[i] < 0 || target[i] >= n) {
+			GraphIO::logger.lout() << "Invalid node index in binary graph file." << endl;
+			return false;
+		}
+		degree[source[i]]++;
+		degree[target[i]]++;
+	}
+
+	Array<bool> used(0, int(2 * m) - 1, false);
+	int64_t pos = 0;
+	for (int64_t i = 0; i < n; ++i) {
+		for (int d = 0; d < degree[int(i)]; ++d, ++pos) {
+			int32_t code = adjacencies[pos];
+			if (code < 0 || code >= 2 * m || used[code]
+			 || ((code & 1) ? target[code >> 1] : source[code >> 1]) != i) {
+				GraphIO::logger.lout() << "Invalid adjacency list in binary graph file." << endl;
+				return false;
+			}
+			used[code] = true;
+		}
+	}
+
+	// create the graph
+	G.clear();
+
+	Array<std::pair<int,int>> edgeList(static_cast<int>(m));
+	for (int i = 0; i < m; ++i)
+		edgeList[i] = std::pair<int,int>(source[i], target[i]);
+
+	Array<node> nodes;
+	G.buildFromEdgeList(int(n), edgeList, nodes);
+
+	Array<edge> edges(static_cast<int>(m));
+	int k = 0;
+	for (edge e : G.edges)
+		edges[k++] = e;
+
+	// restore the order of adjacency entries where it differs from the order of creation
+	pos = 0;
+	List<adjEntry> newOrder;
+	for (node v : nodes) {
+		bool sameOrder = true;
+		int64_t first = pos;
+		for (adjEntry adj : v->adjEntries) {
+			int32_t code = adjacencies[pos++];
+			edge e = edges[code >> 1];
+			sameOrder &= adj == ((code & 1) ? e->adjTarget() : e->adjSource());
+		}
+
+		if (!sameOrder) {
+			newOrder.clear();
+			for (int64_t p = first; p < pos; ++p) {
+				edge e = edges[adjacencies[p] >> 1];
+				newOrder.pushBack((adjacencies[p] & 1) ? e->adjTarget() : e->adjSource());
+			}
+			G.sort(v, newOrder);
+		}
+	}
+
+	// graph attributes
+	if (header.m_flags & fAttributes) {
+		const long stored = long(header.m_attributes);
+		auto use = [&](long attr) {
+			return pA != nullptr && pA->has(attr);
+		};
+		bool ok = true;
+
+		if (pA != nullptr)
+			pA->setDirected((header.m_flags & fDirected) != 0);
+
+		if (stored & GraphAttributes::nodeGraphics) {
+			bool a = use(GraphAttributes::nodeGraphics);
+			ok = ok && r.readEach<double>(n, a, [&](int64_t i, double x) { pA->x(nodes[int(i)]) = x; });
+			ok = ok && r.readEach<double>(n, a, [&](int64_t i, double y) { pA->y(nodes[int(i)]) = y; });
+			ok = ok && r.readEach<double>(n, a, [&](int64_t i, double w) { pA->width(nodes[int(i)]) = w; });
+			ok = ok && r.readEach<double>(n, a, [&](int64_t i, double h) { pA->height(nodes[int(i)]) = h; });
+			ok = ok && r.readEach<int32_t>(n, a, [&](int64_t i, int32_t s) { pA->shape(nodes[int(i)]) = Shape(s); });
+		}
+		if (stored & GraphAttributes::threeD) {
+			bool a = use(GraphAttributes::threeD);
+			ok = ok && r.readEach<double>(n, a, [&](int64_t i, double z) { pA->z(nodes[int(i)]) = z; });
+		}
+		if (stored & GraphAttributes::nodeLabelPosition) {
+			bool a = use(GraphAttributes::nodeLabelPosition);
+			ok = ok && r.readEach<double>(n, a, [&](int64_t i, double x) { pA->xLabel(nodes[int(i)]) = x; });
+			ok = ok && r.readEach<double>(n, a, [&](int64_t i, double y) { pA->yLabel(nodes[int(i)]) = y; });
+			ok = ok && r.readEach<double>(n, a, [&](int64_t i, double z) { pA->zLabel(nodes[int(i)]) = z; });
+		}
+		if (stored & GraphAttributes::nodeStyle) {
+			bool a = use(GraphAttributes::nodeStyle);
+			ok = ok && r.readEach<StrokeRecord>(n, a, [&](int64_t i, const StrokeRecord &s) {
+				node v = nodes[int(i)];
+				pA->strokeColor(v) = fromBytes(s.m_color);
+				pA->strokeWidth(v) = s.m_width;
+				pA->setStrokeType(v, StrokeType(s.m_type));
+			});
+			ok = ok && r.readEach<FillRecord>(n, a, [&](int64_t i, const FillRecord &f) {
+				node v = nodes[int(i)];
+				pA->fillColor(v) = fromBytes(f.m_color);
+				pA->fillBgColor(v) = fromBytes(f.m_bgColor);
+				pA->setFillPattern(v, FillPattern(f.m_pattern));
+			});
+		}
+		if (stored & GraphAttributes::nodeLabel) {
+			bool a = use(GraphAttributes::nodeLabel);
+			ok = ok && r.readStrings(n, a, [&](int64_t i, string &&s) { pA->label(nodes[int(i)]) = std::move(s); });
+		}
+		if (stored & GraphAttributes::nodeTemplate) {
+			bool a = use(GraphAttributes::nodeTemplate);
+			ok = ok && r.readStrings(n, a, [&](int64_t i, string &&s) { pA->templateNode(nodes[int(i)]) = std::move(s); });
+		}
+		if (stored & GraphAttributes::nodeWeight) {
+			bool a = use(GraphAttributes::nodeWeight);
+			ok = ok && r.readEach<int32_t>(n, a, [&](int64_t i, int32_t x) { pA->weight(nodes[int(i)]) = x; });
+		}
+		if (stored & GraphAttributes::nodeType) {
+			bool a = use(GraphAttributes::nodeType);
+			ok = ok && r.readEach<int32_t>(n, a, [&](int64_t i, int32_t t) { pA->type(nodes[int(i)]) = Graph::NodeType(t); });
+		}
+		if (stored & GraphAttributes::nodeId) {
+			bool a = use(GraphAttributes::nodeId);
+			ok = ok && r.readEach<int32_t>(n, a, [&](int64_t i, int32_t x) { pA->idNode(nodes[int(i)]) = x; });
+		}
+
+		if (stored & GraphAttributes::edgeGraphics) {
+			const uint64_t *offset = ok ? r.read<uint64_t>(m + 1) : nullptr;
+			ok = offset != nullptr && offset[0] == 0;
+			for (int64_t i = 0; ok && i < m; ++i)
+				ok = offset[i] <= offset[i+1];
+			const double *coords = ok ? r.read<double>(int64_t(2 * offset[m])) : nullptr;
+			ok = coords != nullptr;
+
+			if (ok && use(GraphAttributes::edgeGraphics)) {
+				for (int i = 0; i < m; ++i) {
+					DPolyline &bends = pA->bends(edges[i]);
+					bends.clear();
+					for (uint64_t p = offset[i]; p < offset[i+1]; ++p)
+						bends.pushBack(DPoint(coords[2*p], coords[2*p+1]));
+				}
+			}
+		}
+		if (stored & GraphAttributes::edgeArrow) {
+			bool a = use(GraphAttributes::edgeArrow);
+			ok = ok && r.readEach<int32_t>(m, a, [&](int64_t i, int32_t x) { pA->arrowType(edges[int(i)]) = EdgeArrow(x); });
+		}
+		if (stored & GraphAttributes::edgeStyle) {
+			bool a = use(GraphAttributes::edgeStyle);
+			ok = ok && r.readEach<StrokeRecord>(m, a, [&](int64_t i, const StrokeRecord &s) {
+				edge e = edges[int(i)];
+				pA->strokeColor(e) = fromBytes(s.m_color);
+				pA->strokeWidth(e) = s.m_width;
+				pA->setStrokeType(e, StrokeType(s.m_type));
+			});
+		}
+		if (stored & GraphAttributes::edgeLabel) {
+			bool a = use(GraphAttributes::edgeLabel);
+			ok = ok && r.readStrings(m, a, [&](int64_t i, string &&s) { pA->label(edges[int(i)]) = std::move(s); });
+		}
+		if (stored & GraphAttributes::edgeIntWeight) {
+			bool a = use(GraphAttributes::edgeIntWeight);
+			ok = ok && r.readEach<int32_t>(m, a, [&](int64_t i, int32_t x) { pA->intWeight(edges[int(i)]) = x; });
+		}
+		if (stored & GraphAttributes::edgeDoubleWeight) {
+			bool a = use(GraphAttributes::edgeDoubleWeight);
+			ok = ok && r.readEach<double>(m, a, [&](int64_t i, double x) { pA->doubleWeight(edges[int(i)]) = x; });
+		}
+		if (stored & GraphAttributes::edgeType) {
+			bool a = use(GraphAttributes::edgeType);
+			ok = ok && r.readEach<int32_t>(m, a, [&](int64_t i, int32_t t) { pA->type(edges[int(i)]) = Graph::EdgeType(t); });
+		}
+		if (stored & GraphAttributes::edgeSubGraphs) {
+			bool a = use(GraphAttributes::edgeSubGraphs);
+			ok = ok && r.readEach<uint32_t>(m, a, [&](int64_t i, uint32_t x) { pA->subGraphBits(edges[int(i)]) = x; });
+		}
+
+		if (!ok) {
+			GraphIO::logger.lout() << "Unexpected end of graph attributes in binary graph file." << endl;
+			return false;
+		}
+	}
+
+	// cluster tree
+	if (header.m_flags & fClusters) {
+		const int32_t *parent = r.read<int32_t>(numClusters);
+		const int32_t *clusterOf = r.read<int32_t>(n);
+		bool ok = parent != nullptr && clusterOf != nullptr && numClusters > 0 && parent[0] == -1;
+		for (int64_t i = 1; ok && i < numClusters; ++i)
+			ok = 0 <= parent[i] && parent[i] < i;
+		for (int64_t i = 0; ok && i < n; ++i)
+			ok = 0 <= clusterOf[i] && clusterOf[i] < numClusters;
+		if (!ok) {
+			GraphIO::logger.lout() << "Invalid cluster tree in binary graph file." << endl;
+			return false;
+		}
+
+		if (pC == nullptr)
+			return true;
+
+		Array<cluster> clusters(static_cast<int>(numClusters));
+		clusters[0] = pC->rootCluster();
+		for (int i = 1; i < numClusters; ++i)
+			clusters[i] = pC->newCluster(clusters[parent[i]]);
+		for (int i = 0; i < n; ++i)
+			if (clusterOf[i] != 0)
+				pC->reassignNode(nodes[i], clusters[clusterOf[i]]);
+
+		if ((header.m_flags & fClusterAttributes) && pCA != nullptr) {
+			ClusterGraphAttributes &CA = *pCA;
+			const int64_t c = numClusters;
+			ok = r.readEach<double>(c, true, [&](int64_t i, double x) { CA.x(clusters[int(i)]) = x; })
+			  && r.readEach<double>(c, true, [&](int64_t i, double y) { CA.y(clusters[int(i)]) = y; })
+			  && r.readEach<double>(c, true, [&](int64_t i, double w) { CA.width(clusters[int(i)]) = w; })
+			  && r.readEach<double>(c, true, [&](int64_t i, double h) { CA.height(clusters[int(i)]) = h; })
+			  && r.readEach<StrokeRecord>(c, true, [&](int64_t i, const StrokeRecord &s) {
+					cluster cl = clusters[int(i)];
+					CA.strokeColor(cl) = fromBytes(s.m_color);
+					CA.strokeWidth(cl) = s.m_width;
+					CA.setStrokeType(cl, StrokeType(s.m_type));
+				})
+			  && r.readEach<FillRecord>(c, true, [&](int64_t i, const FillRecord &f) {
+					cluster cl = clusters[int(i)];
+					CA.fillColor(cl) = fromBytes(f.m_color);
+					CA.fillBgColor(cl) = fromBytes(f.m_bgColor);
+					CA.setFillPattern(cl, FillPattern(f.m_pattern));
+				})
+			  && r.readStrings(c, true, [&](int64_t i, string &&s) { CA.label(clusters[int(i)]) = std::move(s); })
+			  && r.readStrings(c, true, [&](int64_t i, string &&s) { CA.templateCluster(clusters[int(i)]) = std::move(s); });
+			if (!ok) {
+				GraphIO::logger.lout() << "Unexpected end of cluster attributes in binary graph file." << endl;
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+//! Reads a file from \a is, which is only consumed completely if it starts with the magic string.
+static bool read(
+	istream &is,
+	Graph &G,
+	GraphAttributes *pA,
+	ClusterGraph *pC,
+	ClusterGraphAttributes *pCA)
+{
+	char prefix[sizeof(magic)];
+	if (!is.good() || !is.read(prefix, sizeof(prefix)) || memcmp(prefix, magic, sizeof(magic)) != 0)
+		return false;
+
+	FileContents file(is, prefix, sizeof(prefix));
+	return read(file.data(), file.size(), G, pA, pC, pCA);
+}
+
+} // end namespace binary
+
+
+//---------------------------------------------------------
+// Graph
+//---------------------------------------------------------
+
+bool GraphIO::readBinary(Graph &G, const string &filename)
+{
+	binary::FileContents file(filename);
+	return binary::read(file.data(), file.size(), G, nullptr, nullptr, nullptr);
+}
+
+bool GraphIO::readBinary(Graph &G, istream &is)
+{
+	return binary::read(is, G, nullptr, nullptr, nullptr);
+}
+
+bool GraphIO::writeBinary(const Graph &G, const string &filename)
+{
+	ofstream os(filename, std::ios::binary);
+	return writeBinary(G, os);
+}
+
+bool GraphIO::writeBinary(const Graph &G, ostream &os)
+{
+	return binary::write(os, G, nullptr, nullptr, nullptr);
+}
+
+
+//---------------------------------------------------------
+// ClusterGraph
+//---------------------------------------------------------
+
+bool GraphIO::readBinary(ClusterGraph &C, Graph &G, const string &filename)
+{
+	binary::FileContents file(filename);
+	return binary::read(file.data(), file.size(), G, nullptr, &C, nullptr);
+}
+
+bool GraphIO::readBinary(ClusterGraph &C, Graph &G, istream &is)
+{
+	return binary::read(is, G, nullptr, &C, nullptr);
+}
+
+bool GraphIO::writeBinary(const ClusterGraph &C, const string &filename)
+{
+	ofstream os(filename, std::ios::binary);
+	return writeBinary(C, os);
+}
+
+bool GraphIO::writeBinary(const ClusterGraph &C, ostream &os)
+{
+	return binary::write(os, C.constGraph(), nullptr, &C, nullptr);
+}
+
+
+//---------------------------------------------------------
+// GraphAttributes
+//---------------------------------------------------------
+
+bool GraphIO::readBinary(GraphAttributes &A, Graph &G, const string &filename)
+{
+	binary::FileContents file(filename);
+	return binary::read(file.data(), file.size(), G, &A, nullptr, nullptr);
+}
+
+bool GraphIO::readBinary(GraphAttributes &A, Graph &G, istream &is)
+{
+	return binary::read(is, G, &A, nullptr, nullptr);
+}
+
+bool GraphIO::writeBinary(const GraphAttributes &A, const string &filename)
+{
+	ofstream os(filename, std::ios::binary);
+	return writeBinary(A, os);
+}
+
+bool GraphIO::writeBinary(const GraphAttributes &A, ostream &os)
+{
+	return binary::write(os, A.constGraph(), &A, nullptr, nullptr);
+}
+
+
+//---------------------------------------------------------
+// ClusterGraphAttributes
+//---------------------------------------------------------
+
+bool GraphIO::readBinary(ClusterGraphAttributes &A, ClusterGraph &C, Graph &G, const string &filename)
+{
+	binary::FileContents file(filename);
+	return binary::read(file.data(), file.size(), G, &A, &C, &A);
+}
+
+bool GraphIO::readBinary(ClusterGraphAttributes &A, ClusterGraph &C, Graph &G, istream &is)
+{
+	return binary::read(is, G, &A, &C, &A);
+}
+
+bool GraphIO::writeBinary(const ClusterGraphAttributes &A, const string &filename)
+{
+	ofstream os(filename, std::ios::binary);
+	return writeBinary(A, os);
+}
+
+bool GraphIO::writeBinary(const ClusterGraphAttributes &A, ostream &os)
+{
+	return binary::write(os, A.constGraph(), &A, &A.constClusterGraph(), &A);
+}
+
+} // end namespace ogdf
@@ -33,6 +33,7 @@
  ***************************************************************/
 
 #include <ogdf/fileformats/GraphML.h>
+#include <ogdf/fileformats/GraphIO.h>
 
 
 namespace ogdf {
@@ -145,74 +146,277 @@ std::string toString(const Graph::EdgeType &type)
 }
 
 
+// Maps the names of all enum values between first and last to the values.
 template <typename E>
-static inline E toEnum(
-	const std::string &str, // A string we want to convert.
-	Hashing<std::string, E> *&map, // A map to be lazily evaluated.
-	const E first, const E last, const E def) // Enum informations.
+static inline Hashing<std::string, E> enumMap(const E first, const E last)
 {
-	if(!map) {
-		map = new Hashing<std::string, E>();
+	Hashing<std::string, E> map;
 
-		// Iterating over enums is potentially unsafe... (fixable in C++11).
-		for(int it = first; it <= last; it++) {
-			const E e = static_cast<E>(it);
-			map->insert(toString(e), e);
-		}
+	// Iterating over enums is potentially unsafe... (fixable in C++11).
+	for(int it = first; it <= last; it++) {
+		const E e = static_cast<E>(it);
+		map.insert(toString(e), e);
 	}
 
-	HashElement<std::string, E> *elem = map->lookup(str);
-	return elem ? elem->info() : def;
+	return map;
 }
 
 
-// Map is lazily-evaluated (this could be avoided with C++11 constexpr).
-static Hashing<std::string, Attribute> *attrMap = nullptr;
+template <typename E>
+static inline E toEnum(
+	const std::string &str, // A string we want to convert.
+	const Hashing<std::string, E> &map, // A map created by enumMap().
+	const E def) // The value of unknown strings.
+{
+	HashElement<std::string, E> *elem = map.lookup(str);
+	return elem ? elem->info() : def;
+}
+
 
+// The maps are built on first use; initializing local statics is thread-safe.
 Attribute toAttribute(const std::string &str)
 {
-	return toEnum(
-		str, attrMap,
-		static_cast<Attribute>(0), a_unknown, a_unknown);
+	static const Hashing<std::string, Attribute> attrMap =
+		enumMap(static_cast<Attribute>(0), a_unknown);
+	return toEnum(str, attrMap, a_unknown);
 }
 
 
-// Same as attrMap but with shapes.
-static Hashing<std::string, Shape> *shapeMap = nullptr;
-
 Shape toShape(const std::string &str)
 {
-	return toEnum(str, shapeMap, shRect, shImage, shRect);
+	static const Hashing<std::string, Shape> shapeMap = enumMap(shRect, shImage);
+	return toEnum(str, shapeMap, shRect);
 }
 
 
-// Same as attrMap but with arrows.
-static Hashing<std::string, EdgeArrow> *arrowMap = nullptr;
-
 EdgeArrow toArrow(const std::string &str)
 {
-	return toEnum(str, arrowMap, eaNone, eaUndefined, eaUndefined);
+	static const Hashing<std::string, EdgeArrow> arrowMap = enumMap(eaNone, eaUndefined);
+	return toEnum(str, arrowMap, eaUndefined);
 }
 
 
-// Same as attrMap but with node types.
-static Hashing<std::string, Graph::NodeType> *nodeTypeMap = nullptr;
-
 Graph::NodeType toNodeType(const std::string &str)
 {
-	return toEnum(
-		str, nodeTypeMap,
-		static_cast<Graph::NodeType>(0), Graph::vertex, Graph::vertex);
+	static const Hashing<std::string, Graph::NodeType> nodeTypeMap =
+		enumMap(static_cast<Graph::NodeType>(0), Graph::vertex);
+	return toEnum(str, nodeTypeMap, Graph::vertex);
 }
 
-// Same as attrMap but with edge types.
-static Hashing<std::string, Graph::EdgeType> *edgeTypeMap = nullptr;
 
 Graph::EdgeType toEdgeType(const std::string &str)
 {
-	return toEnum(
-		str, edgeTypeMap,
-		static_cast<Graph::EdgeType>(0), Graph::dependency, Graph::association);
+	static const Hashing<std::string, Graph::EdgeType> edgeTypeMap =
+		enumMap(static_cast<Graph::EdgeType>(0), Graph::dependency);
+	return toEnum(str, edgeTypeMap, Graph::association);
+}
+
+
+// Converts data text to numbers like pugixml does.
+static inline double toDouble(const char *value)
+{
+	return strtod(value, nullptr);
+}
+
+static inline int toInt(const char *value)
+{
+	const char *p = value;
+	while (isspace(static_cast<unsigned char>(*p))) ++p;
+	if (*p == '-') ++p;
+
+	const int base = (p[0] == '0' && (p[1] == 'x' || p[1] == 'X')) ? 16 : 10;
+	return static_cast<int>(strtol(value, nullptr, base));
+}
+
+
+bool setAttribute(GraphAttributes &GA, node v, Attribute attr, const char *value)
+{
+	const long attrs = GA.attributes();
+
+	switch (attr) {
+	case a_nodeLabel:
+		if(attrs & GraphAttributes::nodeLabel) {
+			GA.label(v) = value;
+		}
+		break;
+	case a_x:
+		if(attrs & GraphAttributes::nodeGraphics) {
+			GA.x(v) = toDouble(value);
+		}
+		break;
+	case a_y:
+		if(attrs & GraphAttributes::nodeGraphics) {
+			GA.y(v) = toDouble(value);
+		}
+		break;
+	case a_width:
+		if(attrs & GraphAttributes::nodeGraphics) {
+			GA.width(v) = toDouble(value);
+		}
+		break;
+	case a_height:
+		if(attrs & GraphAttributes::nodeGraphics) {
+			GA.height(v) = toDouble(value);
+		}
+		break;
+	case a_size:
+		if(attrs & GraphAttributes::nodeGraphics) {
+			double size = toDouble(value);
+
+			// We want to set a new size only if width and height was not set.
+			if (GA.height(v) == GA.width(v)) {
+				GA.height(v) = GA.width(v) = size;
+			}
+		}
+		break;
+	case a_shape:
+		if(attrs & GraphAttributes::nodeGraphics) {
+			GA.shape(v) = toShape(value);
+		}
+		break;
+	case a_z:
+		if(attrs & GraphAttributes::threeD) {
+			GA.z(v) = toDouble(value);
+		}
+		break;
+	case a_r:
+		if (attrs & GraphAttributes::nodeStyle
+		 && !GraphIO::setColorValue(toInt(value), [&](uint8_t val) { GA.fillColor(v).red(val); })) {
+			return false;
+		}
+		break;
+	case a_g:
+		if(attrs & GraphAttributes::nodeStyle
+		 && !GraphIO::setColorValue(toInt(value), [&](uint8_t val) { GA.fillColor(v).green(val); })) {
+			return false;
+		}
+		break;
+	case a_b:
+		if(attrs & GraphAttributes::nodeStyle
+		 && !GraphIO::setColorValue(toInt(value), [&](uint8_t val) { GA.fillColor(v).blue(val); })) {
+			return false;
+		}
+		break;
+	case a_nodeFill:
+		if(attrs & GraphAttributes::nodeStyle) {
+			GA.fillColor(v) = value;
+		}
+		break;
+	case a_nodeStroke:
+		if(attrs & GraphAttributes::nodeStyle) {
+			GA.strokeColor(v) = value;
+		}
+		break;
+	case a_nodeType:
+		if(attrs & GraphAttributes::nodeType) {
+			GA.type(v) = toNodeType(value);
+		}
+		break;
+	case a_template:
+		if(attrs & GraphAttributes::nodeTemplate) {
+			GA.templateNode(v) = value;
+		}
+		break;
+	case a_nodeWeight:
+		if(attrs & GraphAttributes::nodeWeight) {
+			GA.weight(v) = toInt(value);
+		}
+		break;
+	default:
+		break;
+	}
+
+	return true;
+}
+
+
+bool setAttribute(GraphAttributes &GA, edge e, Attribute attr, const char *value)
+{
+	const long attrs = GA.attributes();
+
+	switch(attr) {
+	case a_edgeLabel:
+		if(attrs & GraphAttributes::edgeLabel) {
+			GA.label(e) = value;
+		}
+		break;
+	case a_edgeWeight:
+		if(attrs & GraphAttributes::edgeIntWeight) {
+			GA.intWeight(e) = toInt(value);
+		} else if(attrs & GraphAttributes::edgeDoubleWeight) {
+			GA.doubleWeight(e) = toDouble(value);
+		}
+		break;
+	case a_edgeType:
+		if(attrs & GraphAttributes::edgeType) {
+			GA.type(e) = toEdgeType(value);
+		}
+		break;
+	case a_edgeArrow:
+		if(attrs & GraphAttributes::edgeArrow) {
+			GA.arrowType(e) = toArrow(value);
+		}
+		break;
+	case a_edgeStroke:
+		if(attrs & GraphAttributes::edgeStyle) {
+			GA.strokeColor(e) = value;
+		}
+		break;
+	default:
+		break;
+	}
+
+	return true;
+}
+
+
+bool setAttribute(ClusterGraphAttributes &CA, cluster c, Attribute attr, const char *value)
+{
+	switch (attr) {
+	case a_nodeLabel:
+		CA.label(c) = value;
+		break;
+	case a_x:
+		CA.x(c) = toDouble(value);
+		break;
+	case a_y:
+		CA.y(c) = toDouble(value);
+		break;
+	case a_width:
+		CA.width(c) = toDouble(value);
+		break;
+	case a_height:
+		CA.height(c) = toDouble(value);
+		break;
+	case a_size:
+		// We want to set a new size only if width and height was not set.
+		if (CA.width(c) == CA.height(c)) {
+			CA.width(c) = CA.height(c) = toDouble(value);
+		}
+		break;
+	case a_r:
+		if (!GraphIO::setColorValue(toInt(value), [&](uint8_t val) { CA.fillColor(c).red(val); })) {
+			return false;
+		}
+		break;
+	case a_g:
+		if (!GraphIO::setColorValue(toInt(value), [&](uint8_t val) { CA.fillColor(c).green(val); })) {
+			return false;
+		}
+		break;
+	case a_b:
+		if (!GraphIO::setColorValue(toInt(value), [&](uint8_t val) { CA.fillColor(c).blue(val); })) {
+			return false;
+		}
+		break;
+	case a_clusterStroke:
+		CA.strokeColor(c) = value;
+		break;
+	default:
+		break;
+	}
+
+	return true;
 }
 
 
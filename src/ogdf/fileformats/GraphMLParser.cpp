@@ -101,104 +101,12 @@ bool GraphMLParser::readData(
 		return false;
 	}
 
-	const long attrs = GA.attributes();
-
-	pugi::xml_text text = nodeData.text();
-
-	switch (graphml::toAttribute(m_attrName[keyId.value()])) {
-	case graphml::a_nodeLabel:
-		if(attrs & GraphAttributes::nodeLabel) {
-			GA.label(v) = text.get();
-		}
-		break;
-	case graphml::a_x:
-		if(attrs & GraphAttributes::nodeGraphics) {
-			GA.x(v) = text.as_double();
-		}
-		break;
-	case graphml::a_y:
-		if(attrs & GraphAttributes::nodeGraphics) {
-			GA.y(v) = text.as_double();;
-		}
-		break;
-	case graphml::a_width:
-		if(attrs & GraphAttributes::nodeGraphics) {
-			GA.width(v) = text.as_double();
-		}
-		break;
-	case graphml::a_height:
-		if(attrs & GraphAttributes::nodeGraphics) {
-			GA.height(v) = text.as_double();
-		}
-		break;
-	case graphml::a_size:
-		if(attrs & GraphAttributes::nodeGraphics) {
-			double size = text.as_double();
-
-			// We want to set a new size only if width and height was not set.
-			if (GA.height(v) == GA.width(v)) {
-				GA.height(v) = GA.width(v) = size;
-			}
-		}
-		break;
-	case graphml::a_shape:
-		if(attrs & GraphAttributes::nodeGraphics) {
-			GA.shape(v) = graphml::toShape(text.get());
-		}
-		break;
-	case graphml::a_z:
-		if(attrs & GraphAttributes::threeD) {
-			GA.z(v) = text.as_double();
-		}
-		break;
-	case graphml::a_r:
-		if (attrs & GraphAttributes::nodeStyle
-		 && !GraphIO::setColorValue(text.as_int(), [&](uint8_t val) { GA.fillColor(v).red(val); })) {
-			return false;
-		}
-		break;
-	case graphml::a_g:
-		if(attrs & GraphAttributes::nodeStyle
-		 && !GraphIO::setColorValue(text.as_int(), [&](uint8_t val) { GA.fillColor(v).green(val); })) {
-			return false;
-		}
-		break;
-	case graphml::a_b:
-		if(attrs & GraphAttributes::nodeStyle
-		 && !GraphIO::setColorValue(text.as_int(), [&](uint8_t val) { GA.fillColor(v).blue(val); })) {
-			return false;
-		}
-		break;
-	case graphml::a_nodeFill:
-		if(attrs & GraphAttributes::nodeStyle) {
-			GA.fillColor(v) = text.get();
-		}
-		break;
-	case graphml::a_nodeStroke:
-		if(attrs & GraphAttributes::nodeStyle) {
-			GA.strokeColor(v) = text.get();
-		}
-		break;
-	case graphml::a_nodeType:
-		if(attrs & GraphAttributes::nodeType) {
-			GA.type(v) = graphml::toNodeType(text.get());
-		}
-		break;
-	case graphml::a_template:
-		if(attrs & GraphAttributes::nodeTemplate) {
-			GA.templateNode(v) = text.get();
-		}
-		break;
-	case graphml::a_nodeWeight:
-		if(attrs & GraphAttributes::nodeWeight) {
-			GA.weight(v) = text.as_int();
-		}
-		break;
-	default:
+	graphml::Attribute attr = graphml::toAttribute(m_attrName[keyId.value()]);
+	if (attr == graphml::a_unknown) {
 		GraphIO::logger.lout(Logger::LL_MINOR) << "Unknown node attribute: \"" << keyId.value() << "\"." << endl;
 	}
 
-	return true;
+	return graphml::setAttribute(GA, v, attr, nodeData.text().get());
 }
 
 
@@ -213,44 +121,14 @@ bool GraphMLParser::readData(
 		return false;
 	}
 
-	const long attrs = GA.attributes();
-	pugi::xml_text text = edgeData.text();
-
-	switch(graphml::toAttribute(m_attrName[keyId.value()])) {
-	case graphml::a_edgeLabel:
-		if(attrs & GraphAttributes::edgeLabel) {
-			GA.label(e) = text.get();
-		}
-		break;
-	case graphml::a_edgeWeight:
-		if(attrs & GraphAttributes::edgeIntWeight) {
-			GA.intWeight(e) = text.as_int();
-		} else if(attrs & GraphAttributes::edgeDoubleWeight) {
-			GA.doubleWeight(e) = text.as_double();
-		}
-		break;
-	case graphml::a_edgeType:
-		if(attrs & GraphAttributes::edgeType) {
-			GA.type(e) = graphml::toEdgeType(text.get());
-		}
-		break;
-	case graphml::a_edgeArrow:
-		if(attrs & GraphAttributes::edgeArrow) {
-			GA.arrowType(e) = graphml::toArrow(text.get());
-		}
-		break;
-	case graphml::a_edgeStroke:
-		if(attrs & GraphAttributes::edgeStyle) {
-			GA.strokeColor(e) = text.get();
-		}
-		break;
-	default:
+	graphml::Attribute attr = graphml::toAttribute(m_attrName[keyId.value()]);
+	if (attr == graphml::a_unknown) {
 		GraphIO::logger.lout(Logger::LL_MINOR) << "Unknown edge attribute with \""
 		             << keyId.value()
 		             << "\"." << endl;
 	}
 
-	return true;
+	return graphml::setAttribute(GA, e, attr, edgeData.text().get());
 }
 
 
@@ -265,56 +143,15 @@ bool GraphMLParser::readData(
 		return false;
 	}
 
-	pugi::xml_text text = clusterData.text();
-
-	using namespace graphml;
-	switch (toAttribute(m_attrName[keyId.value()])) {
-	case a_nodeLabel:
-		CA.label(c) = text.get();
-		break;
-	case a_x:
-		CA.x(c) = text.as_double();
-		break;
-	case a_y:
-		CA.y(c) = text.as_double();
-		break;
-	case a_width:
-		CA.width(c) = text.as_double();
-		break;
-	case a_height:
-		CA.height(c) = text.as_double();
-		break;
-	case a_size:
-		// We want to set a new size only if width and height was not set.
-		if (CA.width(c) == CA.height(c)) {
-			CA.width(c) = CA.height(c) = text.as_double();
-		}
-	case a_r:
-		if (!GraphIO::setColorValue(text.as_int(), [&](uint8_t val) { CA.fillColor(c).red(val); })) {
-			return false;
-		}
-		break;
-	case a_g:
-		if (!GraphIO::setColorValue(text.as_int(), [&](uint8_t val) { CA.fillColor(c).green(val); })) {
-			return false;
-		}
-		break;
-	case a_b:
-		if (!GraphIO::setColorValue(text.as_int(), [&](uint8_t val) { CA.fillColor(c).blue(val); })) {
-			return false;
-		}
-		break;
-	case a_clusterStroke:
-		CA.strokeColor(c) = text.get();
-		break;
-	default:
+	graphml::Attribute attr = graphml::toAttribute(m_attrName[keyId.value()]);
+	if (attr == graphml::a_unknown) {
 		GraphIO::logger.lout(Logger::LL_MINOR) << "Unknown cluster attribute with \""
 		             << keyId.value()
 		             << "--enum: " << m_attrName[keyId.value()] << "--"
 		             << "\"." << endl;
 	}
 
-	return true;
+	return graphml::setAttribute(CA, c, attr, clusterData.text().get());
 }
 
 
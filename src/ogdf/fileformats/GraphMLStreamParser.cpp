@@ -0,0 +1,801 @@
+/** \file
+ * \brief Implementation of class GraphMLStreamParser.
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.txt in the root directory of the OGDF installation for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ *
+ * \see  http://www.gnu.org/copyleft/gpl.html
+ ***************************************************************/
+
+#include <ogdf/fileformats/GraphMLStreamParser.h>
+#include <ogdf/fileformats/GraphIO.h>
+#include <algorithm>
+#include <cstring>
+
+
+namespace ogdf {
+
+GraphMLStreamParser::GraphMLStreamParser(istream &is)
+	: m_input(is)
+	, m_pendingEnd(false)
+	, m_tag(nullptr)
+{ }
+
+
+bool GraphMLStreamParser::setError(const char *message)
+{
+	GraphIO::logger.lout() << "XML parser error in line " << m_input.line() << ": " << message << endl;
+	return false;
+}
+
+
+//---------------------------------------------------------
+// XML scanner
+//---------------------------------------------------------
+
+static inline bool isNameChar(char c)
+{
+	return c != '\0' && c != '>' && c != '/' && c != '=' && !InputBuffer::isWhitespace(c);
+}
+
+
+// Appends the UTF-8 encoding of code point c.
+static char *writeUtf8(char *write, unsigned long c)
+{
+	if (c < 0x80) {
+		*write++ = char(c);
+	} else if (c < 0x800) {
+		*write++ = char(0xC0 | (c >> 6));
+		*write++ = char(0x80 | (c & 0x3F));
+	} else if (c < 0x10000) {
+		*write++ = char(0xE0 | (c >> 12));
+		*write++ = char(0x80 | ((c >> 6) & 0x3F));
+		*write++ = char(0x80 | (c & 0x3F));
+	} else {
+		*write++ = char(0xF0 | (c >> 18));
+		*write++ = char(0x80 | ((c >> 12) & 0x3F));
+		*write++ = char(0x80 | ((c >> 6) & 0x3F));
+		*write++ = char(0x80 | (c & 0x3F));
+	}
+	return write;
+}
+
+
+// Resolves entities and normalizes line breaks (and whitespace in attribute values)
+// like pugixml does. The result is never longer than the input, hence write may equal read.
+char *GraphMLStreamParser::decode(char *read, const char *stop, char *write, bool attribute)
+{
+	while (read < stop) {
+		char c = *read;
+
+		if (c == '&') {
+			const char *semicolon = static_cast<const char*>(memchr(read, ';', min<ptrdiff_t>(stop - read, 12)));
+			if (semicolon != nullptr) {
+				const char *name = read + 1;
+				const size_t len = semicolon - name;
+				char *next = write;
+				if (len == 2 && memcmp(name, "lt", 2) == 0) {
+					*next++ = '<';
+				} else if (len == 2 && memcmp(name, "gt", 2) == 0) {
+					*next++ = '>';
+				} else if (len == 3 && memcmp(name, "amp", 3) == 0) {
+					*next++ = '&';
+				} else if (len == 4 && memcmp(name, "quot", 4) == 0) {
+					*next++ = '\"';
+				} else if (len == 4 && memcmp(name, "apos", 4) == 0) {
+					*next++ = '\'';
+				} else if (len >= 2 && name[0] == '#') {
+					char *end;
+					unsigned long code = (name[1] == 'x')
+						? strtoul(name + 2, &end, 16)
+						: strtoul(name + 1, &end, 10);
+					if (end == semicolon && code <= 0x10FFFF) {
+						// a character reference is at least as long as its encoding
+						next = writeUtf8(write, code);
+					}
+				}
+				if (next != write) {
+					write = next;
+					read = const_cast<char*>(semicolon) + 1;
+					continue;
+				}
+			}
+			*write++ = *read++;
+
+		} else if (c == '\r') {
+			*write++ = attribute ? ' ' : '\n';
+			read += (read + 1 < stop && read[1] == '\n') ? 2 : 1;
+
+		} else if (attribute && (c == '\n' || c == '\t')) {
+			*write++ = ' ';
+			++read;
+
+		} else {
+			*write++ = *read++;
+		}
+	}
+	return write;
+}
+
+
+bool GraphMLStreamParser::startsWith(const char *seq) const
+{
+	const size_t n = strlen(seq);
+	return m_input.available() >= n && memcmp(m_input.pos(), seq, n) == 0;
+}
+
+
+size_t GraphMLStreamParser::find(const char *seq, size_t from)
+{
+	const size_t n = strlen(seq);
+	for (;;) {
+		const char *p = m_input.pos();
+		const size_t available = m_input.available();
+		if (from + n <= available) {
+			const char *hit = std::search(p + from, p + available, seq, seq + n);
+			if (hit != p + available) {
+				return hit - p;
+			}
+			from = available - (n - 1);
+		}
+		if (!m_input.fill(available + 1)) {
+			return string::npos;
+		}
+	}
+}
+
+
+GraphMLStreamParser::Event GraphMLStreamParser::nextEvent()
+{
+	if (m_pendingEnd) {
+		m_pendingEnd = false;
+		m_openTags.pop_back();
+		return evEnd;
+	}
+
+	for (;;) {
+		if (m_input.atEnd()) {
+			if (!m_openTags.empty()) {
+				setError("unexpected end of file");
+				return evError;
+			}
+			return evEOF;
+		}
+
+		if (*m_input.pos() != '<') {
+			bool isText;
+			if (!scanText(isText)) {
+				return evError;
+			}
+			if (isText && !m_openTags.empty()) {
+				return evText;
+			}
+			// whitespace and text outside of the root element are ignored
+			continue;
+		}
+
+		m_input.fill(9);
+		const char second = m_input.pos()[1];
+
+		if (second == '/') {
+			return scanEndTag();
+
+		} else if (second == '?') {
+			size_t end = find("?>", 2);
+			if (end == string::npos) {
+				setError("unterminated processing instruction");
+				return evError;
+			}
+			m_input.advance(end + 2);
+
+		} else if (second == '!') {
+			if (startsWith("<!--")) {
+				size_t end = find("-->", 4);
+				if (end == string::npos) {
+					setError("unterminated comment");
+					return evError;
+				}
+				m_input.advance(end + 3);
+
+			} else if (startsWith("<![CDATA[")) {
+				size_t end = find("]]>", 9);
+				if (end == string::npos) {
+					setError("unterminated CDATA section");
+					return evError;
+				}
+				m_text.assign(m_input.pos() + 9, end - 9);
+				m_input.advance(end + 3);
+				if (!m_openTags.empty()) {
+					return evText;
+				}
+
+			} else {
+				// document type declaration, possibly with internal subset
+				int depth = 0;
+				size_t len = m_input.span([&depth](char c) {
+					if (c == '<') {
+						++depth;
+					} else if (c == '>') {
+						--depth;
+					}
+					return c != '\0' && depth > 0;
+				});
+				if (!m_input.fill(len + 1)) {
+					setError("unterminated declaration");
+					return evError;
+				}
+				m_input.advance(len + 1);
+			}
+
+		} else {
+			return scanStartTag();
+		}
+	}
+}
+
+
+bool GraphMLStreamParser::scanText(bool &isText)
+{
+	size_t len = m_input.span([](char c) { return c != '<' && c != '\0'; });
+	if (len == 0) {
+		// a '\0' character
+		return setError("invalid character");
+	}
+
+	// text consisting of whitespace only is dropped like pugixml does
+	char *p = m_input.pos();
+	isText = !std::all_of(p, p + len, InputBuffer::isWhitespace);
+	if (isText) {
+		char *end = decode(p, p + len, p, false);
+		m_text.assign(p, end);
+	}
+	m_input.advance(len);
+
+	return true;
+}
+
+
+GraphMLStreamParser::Event GraphMLStreamParser::scanStartTag()
+{
+	// find the end of the tag, ignoring '>' in attribute values
+	size_t i = 1;
+	char quote = 0;
+	for (;;) {
+		const char *p = m_input.pos();
+		const size_t available = m_input.available();
+		for (; i < available; ++i) {
+			const char c = p[i];
+			if (quote != 0) {
+				if (c == quote) {
+					quote = 0;
+				}
+			} else if (c == '\"' || c == '\'') {
+				quote = c;
+			} else if (c == '>') {
+				break;
+			}
+		}
+		if (i < available) {
+			break;
+		}
+		if (!m_input.fill(available + 1)) {
+			setError("unterminated tag");
+			return evError;
+		}
+	}
+
+	char *p = m_input.pos();
+	char *const end = p + i; // the closing '>'
+
+	// element name
+	char *name = p + 1;
+	char *q = name;
+	while (q < end && isNameChar(*q)) {
+		++q;
+	}
+	if (q == name) {
+		setError("invalid tag name");
+		return evError;
+	}
+	char *nameEnd = q;
+
+	// attributes
+	m_attributes.clear();
+	bool selfClosing = false;
+	for (;;) {
+		while (q < end && InputBuffer::isWhitespace(*q)) {
+			++q;
+		}
+		if (q == end) {
+			break;
+		}
+		if (*q == '/') {
+			if (q + 1 != end) {
+				setError("invalid tag");
+				return evError;
+			}
+			selfClosing = true;
+			break;
+		}
+
+		char *attrName = q;
+		while (q < end && isNameChar(*q)) {
+			++q;
+		}
+		char *attrNameEnd = q;
+		while (q < end && InputBuffer::isWhitespace(*q)) {
+			++q;
+		}
+		if (attrName == attrNameEnd || q == end || *q != '=') {
+			setError("invalid attribute");
+			return evError;
+		}
+		for (++q; q < end && InputBuffer::isWhitespace(*q); ++q);
+		if (q == end || (*q != '\"' && *q != '\'')) {
+			setError("attribute value is not quoted");
+			return evError;
+		}
+		char *value = q + 1;
+		char *valueEnd = static_cast<char*>(memchr(value, *q, end - value));
+		if (valueEnd == nullptr) {
+			setError("invalid attribute");
+			return evError;
+		}
+		q = valueEnd + 1;
+
+		*decode(value, valueEnd, value, true) = '\0';
+		*attrNameEnd = '\0';
+		m_attributes.push_back(XmlAttribute{attrName, value});
+	}
+
+	*nameEnd = '\0';
+	m_tag = name;
+	m_openTags.push_back(name);
+	m_pendingEnd = selfClosing;
+	m_input.advance(i + 1);
+	return evStart;
+}
+
+
+GraphMLStreamParser::Event GraphMLStreamParser::scanEndTag()
+{
+	size_t end = m_input.span([](char c) { return c != '>' && c != '\0'; }, 2);
+	if (!m_input.fill(end + 1)) {
+		setError("unterminated tag");
+		return evError;
+	}
+
+	const char *name = m_input.pos() + 2;
+	size_t len = end - 2;
+	while (len > 0 && InputBuffer::isWhitespace(name[len - 1])) {
+		--len;
+	}
+
+	if (m_openTags.empty() || m_openTags.back().compare(0, string::npos, name, len) != 0) {
+		setError("end tag does not match start tag");
+		return evError;
+	}
+
+	m_openTags.pop_back();
+	m_input.advance(end + 1);
+	return evEnd;
+}
+
+
+const char *GraphMLStreamParser::attribute(const char *name) const
+{
+	for (const XmlAttribute &attr : m_attributes) {
+		if (strcmp(attr.name, name) == 0) {
+			return attr.value;
+		}
+	}
+	return nullptr;
+}
+
+
+bool GraphMLStreamParser::isTag(const char *name) const
+{
+	return strcmp(m_tag, name) == 0;
+}
+
+
+bool GraphMLStreamParser::skipElement()
+{
+	for (int depth = 0; ; ) {
+		switch (nextEvent()) {
+		case evStart:
+			++depth;
+			break;
+		case evEnd:
+			if (depth-- == 0) {
+				return true;
+			}
+			break;
+		case evText:
+			break;
+		default:
+			return false;
+		}
+	}
+}
+
+
+//---------------------------------------------------------
+// GraphML
+//---------------------------------------------------------
+
+bool GraphMLStreamParser::doRead(Graph &G, GraphAttributes *GA, ClusterGraph *C, ClusterGraphAttributes *CA)
+{
+	G.clear();
+	m_keys.clear();
+	m_nodeIds.clear();
+	m_pendingEdges.clear();
+
+	Event event;
+	while ((event = nextEvent()) == evText);
+	if (event == evEOF) {
+		return setError("no root element");
+	}
+	if (event != evStart) {
+		return false;
+	}
+	if (!isTag("graphml")) {
+		GraphIO::logger.lout() << "File root tag is not a <graphml>." << endl;
+		return false;
+	}
+
+	bool graphRead = false;
+	while ((event = nextEvent()) != evEnd) {
+		if (event == evText) {
+			continue;
+		}
+		if (event != evStart) {
+			return false;
+		}
+
+		if (isTag("key")) {
+			if (!readKey()) {
+				return false;
+			}
+		} else if (isTag("graph") && !graphRead) {
+			if (!readGraph(G, GA, C, CA, C == nullptr ? nullptr : C->rootCluster())
+			 || !readPendingEdges(G, GA)) {
+				return false;
+			}
+			graphRead = true;
+		} else if (!skipElement()) {
+			return false;
+		}
+	}
+
+	// check the rest of the document
+	while ((event = nextEvent()) != evEOF) {
+		if (event == evError || (event == evStart && !skipElement())) {
+			return false;
+		}
+	}
+
+	if (!graphRead) {
+		GraphIO::logger.lout() << "<graph> tag not found." << endl;
+		return false;
+	}
+
+	return true;
+}
+
+
+bool GraphMLStreamParser::readKey()
+{
+	const char *id = attribute("id");
+	const char *name = attribute("attr.name");
+
+	if (id == nullptr) {
+		GraphIO::logger.lout() << "Key does not have an id attribute." << endl;
+		return false;
+	}
+	if (name == nullptr) {
+		GraphIO::logger.lout() << "Key does not have an attr.name attribute." << endl;
+		return false;
+	}
+
+	graphml::Attribute attr = graphml::toAttribute(name);
+	auto it = std::find_if(m_keys.begin(), m_keys.end(),
+		[id](const std::pair<string, graphml::Attribute> &key) { return key.first == id; });
+	if (it == m_keys.end()) {
+		m_keys.emplace_back(id, attr);
+	} else {
+		it->second = attr;
+	}
+
+	return skipElement();
+}
+
+
+bool GraphMLStreamParser::readData(graphml::Attribute &attr, const char *element)
+{
+	const char *key = attribute("key");
+	if (key == nullptr) {
+		GraphIO::logger.lout() << element << " data does not have a key." << endl;
+		return false;
+	}
+
+	attr = graphml::a_unknown;
+	for (const std::pair<string, graphml::Attribute> &entry : m_keys) {
+		if (entry.first == key) {
+			attr = entry.second;
+			break;
+		}
+	}
+	if (attr == graphml::a_unknown) {
+		GraphIO::logger.lout(Logger::LL_MINOR) << "Unknown " << element << " attribute: \"" << key << "\"." << endl;
+	}
+
+	// the value is the first text of the element
+	m_data.clear();
+	bool found = false;
+	for (int depth = 0; ; ) {
+		switch (nextEvent()) {
+		case evText:
+			if (depth == 0 && !found) {
+				m_data.swap(m_text);
+				found = true;
+			}
+			break;
+		case evStart:
+			++depth;
+			break;
+		case evEnd:
+			if (depth-- == 0) {
+				return true;
+			}
+			break;
+		default:
+			return false;
+		}
+	}
+}
+
+
+bool GraphMLStreamParser::readGraph(Graph &G, GraphAttributes *GA, ClusterGraph *C, ClusterGraphAttributes *CA, cluster c)
+{
+	Event event;
+	while ((event = nextEvent()) != evEnd) {
+		if (event == evText) {
+			continue;
+		}
+		if (event != evStart) {
+			return false;
+		}
+
+		bool ok;
+		if (isTag("node")) {
+			ok = readNode(G, GA, C, CA, c);
+		} else if (isTag("edge")) {
+			ok = readEdge(G, GA);
+		} else {
+			ok = skipElement();
+		}
+		if (!ok) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+
+bool GraphMLStreamParser::readNode(Graph &G, GraphAttributes *GA, ClusterGraph *C, ClusterGraphAttributes *CA, cluster c)
+{
+	const char *id = attribute("id");
+
+	if (C == nullptr) {
+		if (id == nullptr) {
+			GraphIO::logger.lout() << "Node is missing id attribute." << endl;
+			return false;
+		}
+
+		const node v = G.newNode();
+		m_nodeIds[id] = v;
+
+		Event event;
+		while ((event = nextEvent()) != evEnd) {
+			if (event == evText) {
+				continue;
+			}
+			if (event != evStart) {
+				return false;
+			}
+
+			graphml::Attribute attr;
+			if (GA != nullptr && isTag("data")) {
+				if (!readData(attr, "Node") || !graphml::setAttribute(*GA, v, attr, m_data.c_str())) {
+					return false;
+				}
+			} else if (isTag("graph")) {
+				GraphIO::logger.lout(Logger::LL_MINOR) << "Nested graphs are read as part of the graph." << endl;
+				if (!readGraph(G, GA, nullptr, nullptr, nullptr)) {
+					return false;
+				}
+			} else if (!skipElement()) {
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	// With clusters, the node is a cluster if it contains a graph. As we do not
+	// know yet, the data is kept until the first nested graph or the end tag.
+	const bool hasId = id != nullptr;
+	const string nodeId = hasId ? id : "";
+	m_nodeData.clear();
+	cluster child = nullptr;
+
+	Event event;
+	while ((event = nextEvent()) != evEnd) {
+		if (event == evText) {
+			continue;
+		}
+		if (event != evStart) {
+			return false;
+		}
+
+		graphml::Attribute attr;
+		if (CA != nullptr && isTag("data")) {
+			if (!readData(attr, "Node")) {
+				return false;
+			}
+			if (child == nullptr) {
+				m_nodeData.emplace_back(attr, m_data);
+			} else if (!graphml::setAttribute(*CA, child, attr, m_data.c_str())) {
+				return false;
+			}
+
+		} else if (isTag("graph")) {
+			if (child == nullptr) {
+				child = C->newCluster(c);
+				for (const std::pair<graphml::Attribute, string> &data : m_nodeData) {
+					if (!graphml::setAttribute(*CA, child, data.first, data.second.c_str())) {
+						return false;
+					}
+				}
+				m_nodeData.clear();
+			}
+			if (!readGraph(G, GA, C, CA, child)) {
+				return false;
+			}
+
+		} else if (!skipElement()) {
+			return false;
+		}
+	}
+
+	if (child == nullptr) {
+		if (!hasId) {
+			GraphIO::logger.lout() << "Node is missing id attribute." << endl;
+			return false;
+		}
+
+		const node v = G.newNode();
+		m_nodeIds[nodeId] = v;
+		C->reassignNode(v, c);
+
+		if (GA != nullptr) {
+			for (const std::pair<graphml::Attribute, string> &data : m_nodeData) {
+				if (!graphml::setAttribute(*GA, v, data.first, data.second.c_str())) {
+					return false;
+				}
+			}
+		}
+	}
+
+	return true;
+}
+
+
+bool GraphMLStreamParser::readEdge(Graph &G, GraphAttributes *GA)
+{
+	const char *sourceId = attribute("source");
+	const char *targetId = attribute("target");
+
+	if (sourceId == nullptr) {
+		GraphIO::logger.lout() << "Edge is missing source node." << endl;
+		return false;
+	}
+	if (targetId == nullptr) {
+		GraphIO::logger.lout() << "Edge is missing target node." << endl;
+		return false;
+	}
+
+	edge e = nullptr;
+	auto sourceIt = m_nodeIds.find(sourceId);
+	auto targetIt = m_nodeIds.find(targetId);
+	if (sourceIt != m_nodeIds.end() && targetIt != m_nodeIds.end()) {
+		e = G.newEdge(sourceIt->second, targetIt->second);
+	} else {
+		m_pendingEdges.push_back(PendingEdge{sourceId, targetId, DataList()});
+	}
+
+	Event event;
+	while ((event = nextEvent()) != evEnd) {
+		if (event == evText) {
+			continue;
+		}
+		if (event != evStart) {
+			return false;
+		}
+
+		graphml::Attribute attr;
+		if (GA != nullptr && isTag("data")) {
+			if (!readData(attr, "Edge")) {
+				return false;
+			}
+			if (e != nullptr) {
+				if (!graphml::setAttribute(*GA, e, attr, m_data.c_str())) {
+					return false;
+				}
+			} else {
+				m_pendingEdges.back().data.emplace_back(attr, m_data);
+			}
+		} else if (!skipElement()) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+
+bool GraphMLStreamParser::readPendingEdges(Graph &G, GraphAttributes *GA)
+{
+	for (const PendingEdge &pending : m_pendingEdges) {
+		auto sourceIt = m_nodeIds.find(pending.source);
+		if (sourceIt == m_nodeIds.end()) {
+			GraphIO::logger.lout() << "Edge source node \"" << pending.source << "\" is incorrect." << endl;
+			return false;
+		}
+
+		auto targetIt = m_nodeIds.find(pending.target);
+		if (targetIt == m_nodeIds.end()) {
+			GraphIO::logger.lout() << "Edge target node \"" << pending.target << "\" is incorrect." << endl;
+			return false;
+		}
+
+		const edge e = G.newEdge(sourceIt->second, targetIt->second);
+		if (GA != nullptr) {
+			for (const std::pair<graphml::Attribute, string> &data : pending.data) {
+				if (!graphml::setAttribute(*GA, e, data.first, data.second.c_str())) {
+					return false;
+				}
+			}
+		}
+	}
+
+	m_pendingEdges.clear();
+	return true;
+}
+
+}
@@ -0,0 +1,93 @@
+/** \file
+ * \brief Implementation of class InputBuffer.
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.txt in the root directory of the OGDF installation for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ *
+ * \see  http://www.gnu.org/copyleft/gpl.html
+ ***************************************************************/
+
+#include <ogdf/fileformats/InputBuffer.h>
+#include <algorithm>
+#include <cstring>
+
+
+namespace ogdf {
+
+InputBuffer::InputBuffer(istream &is, size_t chunkSize)
+	: m_is(is)
+	, m_chunkSize(std::max(chunkSize, size_t(16)))
+	, m_buffer(m_chunkSize + 1)
+	, m_discardedLines(0)
+{
+	m_pos = m_end = m_buffer.data();
+	*m_end = '\0';
+}
+
+
+bool InputBuffer::fill(size_t n)
+{
+	while (available() < n) {
+		if (!m_is.good()) {
+			return false;
+		}
+
+		// discard the consumed part of the window
+		char *begin = m_buffer.data();
+		if (m_pos != begin) {
+			m_discardedLines += static_cast<int>(std::count(static_cast<const char*>(begin), static_cast<const char*>(m_pos), '\n'));
+			size_t rest = available();
+			memmove(begin, m_pos, rest);
+			m_pos = begin;
+			m_end = begin + rest;
+		}
+
+		// grow the window if a single token does not fit
+		size_t rest = available();
+		size_t capacity = m_buffer.size() - 1;
+		if (capacity - rest < m_chunkSize / 2) {
+			m_buffer.resize(std::max(2 * capacity, rest + m_chunkSize) + 1);
+			m_pos = m_buffer.data();
+			m_end = m_pos + rest;
+			capacity = m_buffer.size() - 1;
+		}
+
+		m_is.read(m_end, capacity - rest);
+		m_end += m_is.gcount();
+		*m_end = '\0';
+	}
+
+	return true;
+}
+
+
+int InputBuffer::line() const
+{
+	return m_discardedLines + 1
+		+ static_cast<int>(std::count(static_cast<const char*>(m_buffer.data()), static_cast<const char*>(m_pos), '\n'));
+}
+
+}
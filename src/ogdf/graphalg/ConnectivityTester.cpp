@@ -110,27 +110,25 @@ int ConnectivityTester::computeConnectivity(node v, node u)
 	return m_flowAlgo->computeValue(cap, v, u);
 }
 
-int ConnectivityTester::computeConnectivity(NodeArray<NodeArray<int>> &Connectivity)
+int ConnectivityTester::computeConnectivity(NodeMatrix<int> &Connectivity)
 {
-	node v = m_graph->firstNode();
+	const Graph &graph = m_graphCopied ? ((GraphCopy*)m_graph)->original() : *m_graph;
 	int result = m_graph->numberOfNodes();
 
-	if(m_graphCopied) {
-		v = ((GraphCopy*)m_graph)->original().firstNode();
-	}
+	Connectivity.init(graph);
 
-	for (; v != nullptr; v = v->succ()) {
-		Connectivity[v][v] = 0;
+	for (node v = graph.firstNode(); v != nullptr; v = v->succ()) {
+		Connectivity(v, v) = 0;
 
 		for (node u = v->succ(); u != nullptr; u = u->succ()) {
-			Connectivity[v][u] = computeConnectivity(copyOf(v, true), copyOf(u));
-			result = min(result, Connectivity[v][u]);
+			Connectivity(v, u) = computeConnectivity(copyOf(v, true), copyOf(u));
+			result = min(result, Connectivity(v, u));
 
 			if (m_directed) {
-				Connectivity[u][v] = computeConnectivity(copyOf(u, true), copyOf(v));
-				result = min(result, Connectivity[u][v]);
+				Connectivity(u, v) = computeConnectivity(copyOf(u, true), copyOf(v));
+				result = min(result, Connectivity(u, v));
 			} else {
-				Connectivity[u][v] = Connectivity[v][u];
+				Connectivity(u, v) = Connectivity(v, u);
 			}
 		}
 	}
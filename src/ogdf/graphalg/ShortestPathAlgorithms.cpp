@@ -34,9 +34,232 @@
 
 #include <ogdf/graphalg/ShortestPathAlgorithms.h>
 #include <ogdf/graphalg/Dijkstra.h>
+#include <ogdf/basic/TaskScheduler.h>
+#include <ogdf/basic/Thread.h>
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <queue>
 
 namespace ogdf {
 
+// Returns the number of threads to be used for n sources.
+static unsigned int numberOfThreads(unsigned int numThreads, int n)
+{
+#ifdef OGDF_MEMORY_POOL_NTS
+	return 1;
+#else
+	if (numThreads == 0) {
+		numThreads = max(1u, Thread::hardware_concurrency());
+	}
+	return max(1u, min(numThreads, (unsigned int)max(n, 1)));
+#endif
+}
+
+
+//! Computes the rows of a distance matrix by BFS.
+template<typename T>
+class BFSRows {
+	const CSRGraph &m_G;
+	T m_edgeCosts;
+	Array<int> m_queue;
+
+public:
+	BFSRows(const CSRGraph &G, T edgeCosts)
+		: m_G(G), m_edgeCosts(edgeCosts), m_queue(G.numberOfNodes()) { }
+
+	//! Computes the distances from \a src in \a dist, which must be filled with infinity.
+	void operator()(int src, T *dist) {
+		const int *adjStart = m_G.adjStart();
+		const int *adjNode  = m_G.adjNodes();
+		int head = 0, tail = 0;
+		m_queue[tail++] = src;
+		dist[src] = 0;
+		while (head < tail) {
+			int w = m_queue[head++];
+			T d = dist[w] + m_edgeCosts;
+			for (int a = adjStart[w]; a < adjStart[w+1]; ++a) {
+				int v = adjNode[a];
+				if (dist[v] == std::numeric_limits<T>::infinity()) {
+					dist[v] = d;
+					m_queue[tail++] = v;
+				}
+			}
+		}
+	}
+};
+
+
+//! Computes the rows of a distance matrix by Dijkstra's algorithm.
+template<typename T>
+class DijkstraRows {
+	typedef std::pair<double,int> Entry;
+
+	const CSRGraph &m_G;
+	const Array<double> &m_cost;
+	Array<double> m_dist;
+	std::vector<Entry> m_heap;
+
+public:
+	DijkstraRows(const CSRGraph &G, const Array<double> &cost)
+		: m_G(G), m_cost(cost), m_dist(0, G.numberOfNodes()-1, std::numeric_limits<double>::infinity()) { }
+
+	//! Computes the distances from \a src in \a dist, which must be filled with infinity.
+	void operator()(int src, T *dist) {
+		const int *adjStart = m_G.adjStart();
+		const int *adjNode  = m_G.adjNodes();
+		const int *adjEdge  = m_G.adjEdges();
+		std::greater<Entry> cmp;
+
+		// binary heap with lazy deletion: outdated entries are skipped when popped
+		m_dist.fill(std::numeric_limits<double>::infinity());
+		m_dist[src] = 0;
+		m_heap.clear();
+		m_heap.push_back(Entry(0, src));
+		while (!m_heap.empty()) {
+			std::pop_heap(m_heap.begin(), m_heap.end(), cmp);
+			Entry top = m_heap.back();
+			m_heap.pop_back();
+			int v = top.second;
+			if (top.first > m_dist[v]) continue;
+
+			dist[v] = T(top.first);
+			for (int a = adjStart[v]; a < adjStart[v+1]; ++a) {
+				int w = adjNode[a];
+				double d = top.first + m_cost[adjEdge[a]];
+				if (d < m_dist[w]) {
+					m_dist[w] = d;
+					m_heap.push_back(Entry(d, w));
+					std::push_heap(m_heap.begin(), m_heap.end(), cmp);
+				}
+			}
+		}
+	}
+};
+
+
+// Computes the distances from source(i) into row(i) for 0 <= i < numRows with \a numThreads copies of \a sssp.
+template<typename SSSP, typename Source, typename Row>
+static void parallelRows(int numRows, unsigned int numThreads, const SSSP &sssp, Source source, Row row)
+{
+	numThreads = min(numberOfThreads(numThreads, numRows), TaskScheduler::global().concurrency());
+
+	// rows are handed out in small chunks, since the rows of a component
+	// of the graph take time proportional to its size
+	const int chunkSize = 8;
+	std::atomic<int> nextRow(0);
+	std::function<void()> work = [&] {
+		SSSP localSSSP(sssp);
+		int first;
+		while ((first = nextRow.fetch_add(chunkSize)) < numRows) {
+			for (int i = first; i < min(first + chunkSize, numRows); ++i) {
+				localSSSP(source(i), row(i));
+			}
+		}
+	};
+
+	TaskScheduler::TaskGroup group;
+	for (unsigned int i = 1; i < numThreads; ++i) {
+		group.run(work);
+	}
+	work();
+	group.wait();
+}
+
+
+// Computes all rows of \a distance with \a numThreads copies of \a sssp.
+template<typename T, typename SSSP>
+static void parallelSPAP(const CSRGraph &G, NodeMatrix<T> &distance, unsigned int numThreads, const SSSP &sssp)
+{
+	distance.init(G.constGraph(), std::numeric_limits<T>::infinity());
+	parallelRows(G.numberOfNodes(), numThreads, sssp,
+		[](int i) { return i; },
+		[&](int i) { return distance.row(i); });
+}
+
+
+// Computes the rows of \a distance for \a sources with \a numThreads copies of \a sssp.
+template<typename T, typename SSSP>
+static void parallelSPMS(const CSRGraph &G, const Array<int> &sources, T *distance, unsigned int numThreads, const SSSP &sssp)
+{
+	const int n = G.numberOfNodes();
+	std::fill(distance, distance + static_cast<size_t>(sources.size()) * n, std::numeric_limits<T>::infinity());
+	parallelRows(sources.size(), numThreads, sssp,
+		[&](int i) { return sources[i]; },
+		[&](int i) { return distance + static_cast<size_t>(i) * n; });
+}
+
+
+// Copies the costs of the edges of the original graph to an array indexed by edge ids.
+static void edgeCostsOf(const CSRGraph &G, const EdgeArray<double> &edgeCosts, Array<double> &cost)
+{
+	cost.init(G.numberOfEdges());
+	for (int e = 0; e < G.numberOfEdges(); ++e) {
+		cost[e] = edgeCosts[G.originalEdge(e)];
+	}
+}
+
+
+void bfs_SPAP(const CSRGraph& G, NodeMatrix<double>& distance, double edgeCosts, unsigned int numThreads)
+{
+	parallelSPAP(G, distance, numThreads, BFSRows<double>(G, edgeCosts));
+}
+
+
+void bfs_SPAP(const CSRGraph& G, NodeMatrix<float>& distance, float edgeCosts, unsigned int numThreads)
+{
+	parallelSPAP(G, distance, numThreads, BFSRows<float>(G, edgeCosts));
+}
+
+
+void dijkstra_SPAP(const CSRGraph& G, NodeMatrix<double>& distance,
+	const EdgeArray<double>& edgeCosts, unsigned int numThreads)
+{
+	Array<double> cost;
+	edgeCostsOf(G, edgeCosts, cost);
+	parallelSPAP(G, distance, numThreads, DijkstraRows<double>(G, cost));
+}
+
+
+void dijkstra_SPAP(const CSRGraph& G, NodeMatrix<float>& distance,
+	const EdgeArray<double>& edgeCosts, unsigned int numThreads)
+{
+	Array<double> cost;
+	edgeCostsOf(G, edgeCosts, cost);
+	parallelSPAP(G, distance, numThreads, DijkstraRows<float>(G, cost));
+}
+
+
+void bfs_SPMS(const CSRGraph& G, const Array<int>& sources, double *distance, double edgeCosts, unsigned int numThreads)
+{
+	parallelSPMS(G, sources, distance, numThreads, BFSRows<double>(G, edgeCosts));
+}
+
+
+void bfs_SPMS(const CSRGraph& G, const Array<int>& sources, float *distance, float edgeCosts, unsigned int numThreads)
+{
+	parallelSPMS(G, sources, distance, numThreads, BFSRows<float>(G, edgeCosts));
+}
+
+
+void dijkstra_SPMS(const CSRGraph& G, const Array<int>& sources, double *distance,
+	const EdgeArray<double>& edgeCosts, unsigned int numThreads)
+{
+	Array<double> cost;
+	edgeCostsOf(G, edgeCosts, cost);
+	parallelSPMS(G, sources, distance, numThreads, DijkstraRows<double>(G, cost));
+}
+
+
+void dijkstra_SPMS(const CSRGraph& G, const Array<int>& sources, float *distance,
+	const EdgeArray<double>& edgeCosts, unsigned int numThreads)
+{
+	Array<double> cost;
+	edgeCostsOf(G, edgeCosts, cost);
+	parallelSPMS(G, sources, distance, numThreads, DijkstraRows<float>(G, cost));
+}
+
+
 void bfs_SPAP(const Graph& G, NodeArray<NodeArray<double> >& shortestPathMatrix,
 	double edgeCosts)
 {
@@ -103,6 +326,106 @@ void dijkstra_SPSS(node s, const Graph& G, NodeArray<double>& distance,
 }
 
 
+void bfs_SPAP(const CSRGraph& G, NodeArray<NodeArray<double> >& shortestPathMatrix,
+	double edgeCosts)
+{
+	for (int i = 0; i < G.numberOfNodes(); ++i) {
+		node v = G.original(i);
+		bfs_SPSS(v, G, shortestPathMatrix[v], edgeCosts);
+	}
+}
+
+
+void bfs_SPSS(node s, const CSRGraph& G, NodeArray<double>& distanceArray, double edgeCosts)
+{
+	const int n = G.numberOfNodes();
+	Array<int> level(0, n-1, -1);
+	Array<int> queue(n);
+	const int *adjStart = G.adjStart();
+	const int *adjNode  = G.adjNodes();
+
+	int head = 0, tail = 0;
+	int src = G.id(s);
+	queue[tail++] = src;
+	level[src] = 0;
+	while (head < tail) {
+		int w = queue[head++];
+		int d = level[w] + 1;
+		for (int a = adjStart[w]; a < adjStart[w+1]; ++a) {
+			int v = adjNode[a];
+			if (level[v] < 0) {
+				level[v] = d;
+				queue[tail++] = v;
+			}
+		}
+	}
+
+	// the distances of unreachable nodes are left untouched, like in the Graph variant
+	for (int i = 0; i < tail; ++i) {
+		int v = queue[i];
+		distanceArray[G.original(v)] = level[v] * edgeCosts;
+	}
+}
+
+
+void dijkstra_SPAP(const CSRGraph& G,
+	NodeArray<NodeArray<double> >& shortestPathMatrix,
+	const EdgeArray<double>& edgeCosts)
+{
+	for (int i = 0; i < G.numberOfNodes(); ++i) {
+		node v = G.original(i);
+		dijkstra_SPSS(v, G, shortestPathMatrix[v], edgeCosts);
+	}
+}
+
+
+void dijkstra_SPSS(node s, const CSRGraph& G, NodeArray<double>& distance,
+	const EdgeArray<double>& edgeCosts)
+{
+	typedef std::pair<double,int> Entry;
+
+	const int n = G.numberOfNodes();
+	const int m = G.numberOfEdges();
+	Array<double> dist(0, n-1, std::numeric_limits<double>::max());
+	Array<double> cost(m);
+	for (int e = 0; e < m; ++e) {
+		cost[e] = edgeCosts[G.originalEdge(e)];
+	}
+	const int *adjStart = G.adjStart();
+	const int *adjNode  = G.adjNodes();
+	const int *adjEdge  = G.adjEdges();
+
+	// binary heap with lazy deletion: outdated entries are skipped when popped
+	std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry> > queue;
+	int src = G.id(s);
+	dist[src] = 0;
+	queue.push(Entry(0, src));
+
+	while (!queue.empty()) {
+		Entry top = queue.top();
+		queue.pop();
+		int v = top.second;
+		if (top.first > dist[v]) continue;
+
+		for (int a = adjStart[v]; a < adjStart[v+1]; ++a) {
+			int w = adjNode[a];
+			double d = dist[v] + cost[adjEdge[a]];
+			if (d < dist[w]) {
+				dist[w] = d;
+				queue.push(Entry(d, w));
+			}
+		}
+	}
+
+	if (distance.graphOf() != &G.constGraph()) {
+		distance.init(G.constGraph());
+	}
+	for (int i = 0; i < n; ++i) {
+		distance[G.original(i)] = dist[i];
+	}
+}
+
+
 void floydWarshall_SPAP(NodeArray<NodeArray<double> >& shortestPathMatrix,
 	const Graph& G)
 {
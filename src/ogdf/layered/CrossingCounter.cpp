@@ -0,0 +1,286 @@
+/** \file
+ * \brief Implementation of class CrossingCounter.
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.txt in the root directory of the OGDF installation for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ *
+ * \see  http://www.gnu.org/copyleft/gpl.html
+ ***************************************************************/
+
+#include <ogdf/layered/CrossingCounter.h>
+#include <algorithm>
+
+namespace ogdf {
+
+int CrossingCounter::swapDifference(const int *left, int nLeft, const int *right, int nRight)
+{
+	int less = 0, lessOrEqual = 0, delta = 0;
+	for (int a = 0; a < nLeft; ++a) {
+		const int x = left[a];
+		while (less < nRight && right[less] < x) ++less;
+		if (lessOrEqual < less) lessOrEqual = less;
+		while (lessOrEqual < nRight && right[lessOrEqual] <= x) ++lessOrEqual;
+		// edges of the right node ending left of x cross it now, those ending right of x afterwards
+		delta += (nRight - lessOrEqual) - less;
+	}
+	return delta;
+}
+
+
+CrossingCounter::CrossingCounter(const HierarchyLevelsBase &levels) : m_total(0)
+{
+	const int numLevels = levels.size();
+
+	m_levelStart.resize(numLevels+1);
+	m_levelStart[0] = 0;
+	int maxIndex = -1;
+	for (int i = 0; i < numLevels; ++i) {
+		const LevelBase &L = levels[i];
+		m_levelStart[i+1] = m_levelStart[i] + L.size();
+		for (int j = 0; j < L.size(); ++j)
+			maxIndex = max(maxIndex, L[j]->index());
+	}
+
+	const int n = m_levelStart[numLevels];
+	m_order.resize(n);
+	m_pos.resize(n);
+	m_id.assign(maxIndex+1, -1);
+	for (int i = 0; i < numLevels; ++i) {
+		const LevelBase &L = levels[i];
+		for (int j = 0; j < L.size(); ++j) {
+			int v = m_levelStart[i] + j;
+			m_order[v] = v;
+			m_pos[v] = j;
+			m_id[L[j]->index()] = v;
+		}
+	}
+
+	// upper neighbours are taken from the levels, lower ones by reversing them
+	m_upperStart.assign(n+1, 0);
+	m_lowerStart.assign(n+1, 0);
+	for (int i = 0; i < numLevels-1; ++i) {
+		const LevelBase &L = levels[i];
+		for (int j = 0; j < L.size(); ++j) {
+			int v = m_levelStart[i] + j;
+			for (node u : levels.adjNodes(L[j], HierarchyLevelsBase::upward)) {
+				int w = m_id[u->index()];
+				m_upper.push_back(w);
+				m_lowerStart[w+1]++;
+			}
+			m_upperStart[v+1] = (int)m_upper.size();
+		}
+	}
+	for (int v = 0; v < n; ++v) {
+		m_upperStart[v+1] = max(m_upperStart[v+1], m_upperStart[v]);
+		m_lowerStart[v+1] += m_lowerStart[v];
+	}
+
+	m_lower.resize(m_upper.size());
+	std::vector<int> next(m_lowerStart.begin(), m_lowerStart.end() - 1);
+	for (int v = 0; v < n; ++v) {
+		for (int a = m_upperStart[v]; a < m_upperStart[v+1]; ++a)
+			m_lower[next[m_upper[a]]++] = v;
+	}
+
+	m_crossings.resize(max(numLevels-1, 0));
+	for (int i = 0; i < numLevels-1; ++i) {
+		m_crossings[i] = count(i);
+		m_total += m_crossings[i];
+	}
+}
+
+
+// Counts the crossings with a binary indexed tree over the upper positions: the edges
+// of every node are first looked up and then inserted, so edges sharing a node need
+// not be sorted.
+int CrossingCounter::count(int i)
+{
+	const int nUpper = levelSize(i+1);
+	m_tree.assign(nUpper+1, 0);
+
+	int nc = 0;
+	int inserted = 0;
+	for (int k = m_levelStart[i]; k < m_levelStart[i+1]; ++k) {
+		const int v = m_order[k];
+		for (int a = m_upperStart[v]; a < m_upperStart[v+1]; ++a) {
+			int notRight = 0;
+			for (int x = m_pos[m_upper[a]] + 1; x > 0; x -= x & -x)
+				notRight += m_tree[x];
+			nc += inserted - notRight;
+		}
+		for (int a = m_upperStart[v]; a < m_upperStart[v+1]; ++a) {
+			for (int x = m_pos[m_upper[a]] + 1; x <= nUpper; x += x & -x)
+				m_tree[x]++;
+			inserted++;
+		}
+	}
+
+	return nc;
+}
+
+
+int CrossingCounter::update(const HierarchyLevelsBase &levels)
+{
+	const int numLevels = numberOfLevels();
+	OGDF_ASSERT(levels.size() == numLevels);
+
+	std::vector<bool> changed(numLevels, false);
+	for (int i = 0; i < numLevels; ++i) {
+		const LevelBase &L = levels[i];
+		OGDF_ASSERT(L.size() == levelSize(i));
+		for (int j = 0; j < L.size(); ++j) {
+			int v = m_id[L[j]->index()];
+			int k = m_levelStart[i] + j;
+			if (m_order[k] != v) {
+				m_order[k] = v;
+				m_pos[v] = j;
+				changed[i] = true;
+			}
+		}
+	}
+
+	for (int i = 0; i < numLevels-1; ++i) {
+		if (changed[i] || changed[i+1]) {
+			m_total -= m_crossings[i];
+			m_crossings[i] = count(i);
+			m_total += m_crossings[i];
+		}
+	}
+
+	return m_total;
+}
+
+
+void CrossingCounter::sortedPositions(const std::vector<int> &start, const std::vector<int> &adj, int v, std::vector<int> &sorted) const
+{
+	sorted.clear();
+	for (int a = start[v]; a < start[v+1]; ++a)
+		sorted.push_back(m_pos[adj[a]]);
+	std::sort(sorted.begin(), sorted.end());
+}
+
+
+void CrossingCounter::swapDeltas(int v, int w, int &upperDelta, int &lowerDelta) const
+{
+	sortedPositions(m_upperStart, m_upper, v, m_sortedV);
+	sortedPositions(m_upperStart, m_upper, w, m_sortedW);
+	upperDelta = swapDifference(m_sortedV.data(), (int)m_sortedV.size(), m_sortedW.data(), (int)m_sortedW.size());
+
+	sortedPositions(m_lowerStart, m_lower, v, m_sortedV);
+	sortedPositions(m_lowerStart, m_lower, w, m_sortedW);
+	lowerDelta = swapDifference(m_sortedV.data(), (int)m_sortedV.size(), m_sortedW.data(), (int)m_sortedW.size());
+}
+
+
+int CrossingCounter::swapDelta(int i, int p) const
+{
+	OGDF_ASSERT(0 <= p && p+1 < levelSize(i));
+
+	int upperDelta, lowerDelta;
+	swapDeltas(m_order[m_levelStart[i]+p], m_order[m_levelStart[i]+p+1], upperDelta, lowerDelta);
+	return upperDelta + lowerDelta;
+}
+
+
+void CrossingCounter::swap(int i, int p)
+{
+	OGDF_ASSERT(0 <= p && p+1 < levelSize(i));
+
+	const int k = m_levelStart[i] + p;
+	int upperDelta, lowerDelta;
+	swapDeltas(m_order[k], m_order[k+1], upperDelta, lowerDelta);
+
+	if (i < numberOfLevels()-1)
+		m_crossings[i] += upperDelta;
+	if (i > 0)
+		m_crossings[i-1] += lowerDelta;
+	m_total += upperDelta + lowerDelta;
+
+	std::swap(m_order[k], m_order[k+1]);
+	m_pos[m_order[k]] = p;
+	m_pos[m_order[k+1]] = p+1;
+}
+
+
+int CrossingCounter::moveDelta(int i, int from, int to) const
+{
+	OGDF_ASSERT(0 <= from && from < levelSize(i));
+	OGDF_ASSERT(0 <= to && to < levelSize(i));
+
+	const int *order = &m_order[m_levelStart[i]];
+	const int v = order[from];
+	int delta = 0, upperDelta, lowerDelta;
+
+	// the node passes every node in between, the other pairs keep their order
+	for (int p = from+1; p <= to; ++p) {
+		swapDeltas(v, order[p], upperDelta, lowerDelta);
+		delta += upperDelta + lowerDelta;
+	}
+	for (int p = to; p < from; ++p) {
+		swapDeltas(order[p], v, upperDelta, lowerDelta);
+		delta += upperDelta + lowerDelta;
+	}
+
+	return delta;
+}
+
+
+void CrossingCounter::move(int i, int from, int to)
+{
+	OGDF_ASSERT(0 <= from && from < levelSize(i));
+	OGDF_ASSERT(0 <= to && to < levelSize(i));
+
+	int *order = &m_order[m_levelStart[i]];
+	const int v = order[from];
+	int upper = 0, lower = 0, upperDelta, lowerDelta;
+
+	for (int p = from+1; p <= to; ++p) {
+		swapDeltas(v, order[p], upperDelta, lowerDelta);
+		upper += upperDelta;
+		lower += lowerDelta;
+	}
+	for (int p = to; p < from; ++p) {
+		swapDeltas(order[p], v, upperDelta, lowerDelta);
+		upper += upperDelta;
+		lower += lowerDelta;
+	}
+
+	if (i < numberOfLevels()-1)
+		m_crossings[i] += upper;
+	if (i > 0)
+		m_crossings[i-1] += lower;
+	m_total += upper + lower;
+
+	if (from < to)
+		std::rotate(order + from, order + from + 1, order + to + 1);
+	else
+		std::rotate(order + to, order + from, order + from + 1);
+
+	for (int p = min(from, to); p <= max(from, to); ++p)
+		m_pos[order[p]] = p;
+}
+
+} // end namespace ogdf
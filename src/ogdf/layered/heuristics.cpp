@@ -39,6 +39,9 @@
 #include <ogdf/layered/GreedyInsertHeuristic.h>
 #include <ogdf/layered/GreedySwitchHeuristic.h>
 #include <ogdf/layered/SiftingHeuristic.h>
+#include <ogdf/layered/CrossingCounter.h>
+#include <ogdf/basic/TaskScheduler.h>
+#include <algorithm>
 
 
 namespace ogdf {
@@ -54,19 +57,21 @@ void BarycenterHeuristic::call (Level &L)
 {
 	const HierarchyLevels &levels = L.levels();
 
-	for (int i = 0; i <= L.high(); ++i) {
-		node v = L[i];
-		long sumpos = 0L;
+	TaskScheduler::global().parallelFor(0, L.size(), 1024, [&](int b, int e) {
+		for (int i = b; i < e; ++i) {
+			node v = L[i];
+			long sumpos = 0L;
 
-		const Array<node> &adjNodes = L.adjNodes(v);
-		for(int j = 0; j <= adjNodes.high(); ++j)
-			sumpos += levels.pos(adjNodes[j]);
+			const Array<node> &adjNodes = L.adjNodes(v);
+			for(int j = 0; j <= adjNodes.high(); ++j)
+				sumpos += levels.pos(adjNodes[j]);
 
-		m_weight[v] = (adjNodes.high() < 0) ? 0.0 :
-			double(sumpos) / double(adjNodes.size());
-	}
+			m_weight[v] = (adjNodes.high() < 0) ? 0.0 :
+				double(sumpos) / double(adjNodes.size());
+		}
+	}, m_numberOfThreads);
 
-	L.sort(m_weight);
+	L.sort(m_weight, m_numberOfThreads);
 }
 
 
@@ -80,20 +85,22 @@ void MedianHeuristic::call (Level &L)
 {
 	const HierarchyLevels &levels = L.levels();
 
-	for (int i = 0; i <= L.high(); ++i) {
-		node v = L[i];
+	TaskScheduler::global().parallelFor(0, L.size(), 1024, [&](int b, int e) {
+		for (int i = b; i < e; ++i) {
+			node v = L[i];
 
-		const Array<node> &adjNodes = L.adjNodes(v);
-		const int high = adjNodes.high();
+			const Array<node> &adjNodes = L.adjNodes(v);
+			const int high = adjNodes.high();
 
-		if (high < 0) m_weight[v] = 0;
-		else if (high & 1)
-			m_weight[v] = levels.pos(adjNodes[high/2]) + levels.pos(adjNodes[1+high/2]);
-		else
-			m_weight[v] = 2*levels.pos(adjNodes[high/2]);
-	}
+			if (high < 0) m_weight[v] = 0;
+			else if (high & 1)
+				m_weight[v] = levels.pos(adjNodes[high/2]) + levels.pos(adjNodes[1+high/2]);
+			else
+				m_weight[v] = 2*levels.pos(adjNodes[high/2]);
+		}
+	}, m_numberOfThreads);
 
-	L.sort(m_weight,0,2*levels.adjLevel(L.index()).high());
+	L.sort(m_weight, 0, 2*levels.adjLevel(L.index()).high(), m_numberOfThreads);
 }
 
 
@@ -178,36 +185,46 @@ void GreedyInsertHeuristic::call(Level &L)
 // crossing minimization
 //---------------------------------------------------------
 
-SiftingHeuristic::SiftingHeuristic() : m_crossingMatrix(nullptr), m_strategy(left_to_right) { }
+SiftingHeuristic::SiftingHeuristic() : m_strategy(left_to_right) { }
 
 SiftingHeuristic::SiftingHeuristic(const SiftingHeuristic &crossMin)
-: m_crossingMatrix(nullptr), m_strategy(crossMin.m_strategy) { }
+: m_strategy(crossMin.m_strategy) { }
 
 
-void SiftingHeuristic::init(const HierarchyLevels &levels)
-{
-	delete m_crossingMatrix;
-	m_crossingMatrix = new CrossingsMatrix(levels);
-}
-
-SiftingHeuristic::~SiftingHeuristic()
+void SiftingHeuristic::cleanup()
 {
-	delete m_crossingMatrix;
+	std::vector<int>().swap(m_adjStart);
+	std::vector<int>().swap(m_adjPos);
 }
 
-void SiftingHeuristic::cleanup()
+int SiftingHeuristic::swapDelta(int u, int v) const
 {
-	delete m_crossingMatrix;
+	return CrossingCounter::swapDifference(
+		m_adjPos.data() + m_adjStart[u], m_adjStart[u+1] - m_adjStart[u],
+		m_adjPos.data() + m_adjStart[v], m_adjStart[v+1] - m_adjStart[v]);
 }
 
 void SiftingHeuristic::call(Level &L)
 {
-	List<node> vertices;
-	int i;
-
+	const HierarchyLevels &levels = L.levels();
 	const int n = L.size();
 
-	m_crossingMatrix->init(L); // initialize crossing matrix
+	// the nodes are identified by their positions before sifting
+	List<node> vertices;
+	Array<int> index(n), order(n);
+	m_adjStart.resize(n+1);
+	m_adjPos.clear();
+
+	int i;
+	for (i = 0; i < n; i++) {
+		index[i] = order[i] = i;
+		m_adjStart[i] = (int)m_adjPos.size();
+		for (node u : L.adjNodes(L[i])) {
+			m_adjPos.push_back(levels.pos(u));
+		}
+		std::sort(m_adjPos.begin() + m_adjStart[i], m_adjPos.end());
+	}
+	m_adjStart[n] = (int)m_adjPos.size();
 
 	if (m_strategy == left_to_right || m_strategy == random) {
 		for (i = 0; i < n; i++) {
@@ -238,22 +255,34 @@ void SiftingHeuristic::call(Level &L)
 		}
 	}
 
-	for(i = 0; i< vertices.size(); i++) {
+	// the indices are taken before sifting starts
+	Array<int> siftOrder(n);
+	i = 0;
+	for (node v : vertices) {
+		siftOrder[i++] = levels.pos(v);
+	}
+
+	auto swapPositions = [&](int p) {
+		L.swap(p, p+1);
+		std::swap(order[p], order[p+1]);
+		index[order[p]] = p;
+		index[order[p+1]] = p+1;
+	};
+
+	for (int v : siftOrder) {
 		int dev = 0;
 
 		// sifting left
-		for(; i > 0; --i) {
-			dev = dev - (*m_crossingMatrix)(i-1,i) + (*m_crossingMatrix)(i,i-1);
-			L.swap(i-1,i);
-			m_crossingMatrix->swap(i-1,i);
+		for (i = index[v]; i > 0; --i) {
+			dev += swapDelta(order[i-1], v);
+			swapPositions(i-1);
 		}
 
 		// sifting right and searching optimal position
 		int opt = dev, opt_pos = 0;
 		for (; i < n-1; ++i) {
-			dev = dev - (*m_crossingMatrix)(i,i+1) + (*m_crossingMatrix)(i+1,i);
-			L.swap(i,i+1);
-			m_crossingMatrix->swap(i,i+1);
+			dev += swapDelta(v, order[i+1]);
+			swapPositions(i);
 			if (dev <= opt) {
 				opt = dev; opt_pos = i+1;
 			}
@@ -261,8 +290,7 @@ void SiftingHeuristic::call(Level &L)
 
 		// set optimal position
 		for (; i > opt_pos; --i) {
-			L.swap(i-1,i);
-			m_crossingMatrix->swap(i-1,i);
+			swapPositions(i-1);
 		}
 	}
 }
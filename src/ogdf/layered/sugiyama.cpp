@@ -35,6 +35,7 @@
 
 
 #include <ogdf/layered/Hierarchy.h>
+#include <ogdf/layered/CrossingCounter.h>
 #include <ogdf/layered/SugiyamaLayout.h>
 #include <ogdf/layered/LongestPathRanking.h>
 #include <ogdf/layered/BarycenterHeuristic.h>
@@ -43,6 +44,7 @@
 #include <ogdf/layered/OptimalHierarchyClusterLayout.h>
 #include <ogdf/packing/TileToRowsCCPacker.h>
 #include <ogdf/basic/simple_graph_alg.h>
+#include <ogdf/basic/TaskScheduler.h>
 #include <ogdf/basic/Thread.h>
 
 #include <mutex>
@@ -232,13 +234,13 @@ public:
 };
 
 
-void Level::sort(NodeArray<double> &weight)
+void Level::sort(NodeArray<double> &weight, unsigned int numThreads)
 {
 	SListPure<Tuple2<node,int> > isolated;
 	getIsolatedNodes(isolated);
 
 	WeightComparer<> cmp(&weight);
-	std::stable_sort(&m_nodes[0], &m_nodes[0]+m_nodes.size(), cmp);
+	TaskScheduler::global().parallelStableSort(&m_nodes[0], &m_nodes[0]+m_nodes.size(), cmp, 4096, numThreads);
 
 	if (!isolated.empty()) setIsolatedNodes(isolated);
 	recalcPos();
@@ -253,13 +255,19 @@ void Level::sortByWeightOnly(NodeArray<double> &weight)
 }
 
 
-void Level::sort(NodeArray<int> &weight, int minBucket, int maxBucket)
+void Level::sort(NodeArray<int> &weight, int minBucket, int maxBucket, unsigned int numThreads)
 {
 	SListPure<Tuple2<node,int> > isolated;
 	getIsolatedNodes(isolated);
 
-	WeightBucket bucketFunc(&weight);
-	bucketSort(m_nodes,minBucket,maxBucket,bucketFunc);
+	if (numThreads == 1) {
+		WeightBucket bucketFunc(&weight);
+		bucketSort(m_nodes,minBucket,maxBucket,bucketFunc);
+	} else {
+		// bucket sort is stable, so a stable sort gives the same order
+		WeightComparer<int> cmp(&weight);
+		TaskScheduler::global().parallelStableSort(&m_nodes[0], &m_nodes[0]+m_nodes.size(), cmp, 4096, numThreads);
+	}
 
 	if (!isolated.empty()) setIsolatedNodes(isolated);
 	recalcPos();
@@ -478,13 +486,7 @@ void HierarchyLevels::separateCCs(int numCC, const NodeArray<int> &component)
 
 int HierarchyLevelsBase::calculateCrossings() const
 {
-	int nCrossings = 0;
-
-	for(int i = 0; i < this -> high(); ++i) {
-		nCrossings += calculateCrossings(i);
-	}
-
-	return nCrossings;
+	return CrossingCounter(*this).totalCrossings();
 }
 
 
@@ -718,17 +720,22 @@ private:
 	void doTranspose(HierarchyLevels &levels, Array<bool> &levelChanged);
 	void doTransposeRev(HierarchyLevels &levels, Array<bool> &levelChanged);
 
+	//! Returns the crossings of \a levels, counted by \a pCounter unless subgraphs are drawn.
+	int calculateCrossings(const HierarchyLevels &levels, CrossingCounter *pCounter) const;
+
 	int traverseTopDown(
 		HierarchyLevels &levels,
 		LayerByLayerSweep *pCrossMin,
 		TwoLayerCrossMinSimDraw *pCrossMinSimDraw,
-		Array<bool>             *pLevelChanged);
+		Array<bool>             *pLevelChanged,
+		CrossingCounter         *pCounter);
 
 	int traverseBottomUp(
 		HierarchyLevels &levels,
 		LayerByLayerSweep *pCrossMin,
 		TwoLayerCrossMinSimDraw *pCrossMinSimDraw,
-		Array<bool>             *pLevelChanged);
+		Array<bool>             *pLevelChanged,
+		CrossingCounter         *pCounter);
 
 	int queryBestKnown() const { return m_bestCR; }
 	bool postNewResult(int cr, NodeArray<int> *pPos);
@@ -821,11 +828,19 @@ void LayerByLayerSweep::CrossMinMaster::doTransposeRev(HierarchyLevels &levels,
 }
 
 
+int LayerByLayerSweep::CrossMinMaster::calculateCrossings(const HierarchyLevels &levels, CrossingCounter *pCounter) const
+{
+	// only the pairs of levels changed by the last traversal are recounted
+	return (pCounter != nullptr) ? pCounter->update(levels) : levels.calculateCrossingsSimDraw(subgraphs());
+}
+
+
 int LayerByLayerSweep::CrossMinMaster::traverseTopDown(
 	HierarchyLevels           &levels,
 	LayerByLayerSweep          *pCrossMin,
 	TwoLayerCrossMinSimDraw   *pCrossMinSimDraw,
-	Array<bool>               *pLevelChanged)
+	Array<bool>               *pLevelChanged,
+	CrossingCounter           *pCounter)
 {
 	levels.direction(HierarchyLevels::downward);
 
@@ -841,7 +856,7 @@ int LayerByLayerSweep::CrossMinMaster::traverseTopDown(
 	if(arrangeCCs() == false)
 		levels.separateCCs(arrange_numCC(), arrange_compGC());
 
-	return (pCrossMin != nullptr) ? levels.calculateCrossings() : levels.calculateCrossingsSimDraw(subgraphs());
+	return calculateCrossings(levels, pCounter);
 }
 
 
@@ -849,7 +864,8 @@ int LayerByLayerSweep::CrossMinMaster::traverseBottomUp(
 	HierarchyLevels           &levels,
 	LayerByLayerSweep          *pCrossMin,
 	TwoLayerCrossMinSimDraw   *pCrossMinSimDraw,
-	Array<bool>               *pLevelChanged)
+	Array<bool>               *pLevelChanged,
+	CrossingCounter           *pCounter)
 {
 	levels.direction(HierarchyLevels::upward);
 
@@ -865,7 +881,7 @@ int LayerByLayerSweep::CrossMinMaster::traverseBottomUp(
 	if(arrangeCCs() == false)
 		levels.separateCCs(arrange_numCC(), arrange_compGC());
 
-	return (pCrossMin != nullptr) ? levels.calculateCrossings() : levels.calculateCrossingsSimDraw(subgraphs());
+	return calculateCrossings(levels, pCounter);
 }
 
 
@@ -880,12 +896,16 @@ void LayerByLayerSweep::CrossMinMaster::doWorkHelper(
 	if(permuteFirst)
 		levels.permute(rng);
 
-	int nCrossingsOld = (pCrossMin != nullptr) ? levels.calculateCrossings() : levels.calculateCrossingsSimDraw(subgraphs());
+	CrossingCounter *pCounter = (pCrossMin != nullptr) ? new CrossingCounter(levels) : nullptr;
+
+	int nCrossingsOld = calculateCrossings(levels, pCounter);
 	if(postNewResult(nCrossingsOld, &bestPos) == true)
 		levels.storePos(bestPos);
 
-	if(queryBestKnown() == 0)
+	if(queryBestKnown() == 0) {
+		delete pCounter;
 		return;
+	}
 
 	if(pCrossMin != nullptr)
 		pCrossMin->init(levels);
@@ -905,7 +925,7 @@ void LayerByLayerSweep::CrossMinMaster::doWorkHelper(
 		do {
 
 			// top-down traversal
-			int nCrossingsNew = traverseTopDown(levels, pCrossMin, pCrossMinSimDraw, pLevelChanged);
+			int nCrossingsNew = traverseTopDown(levels, pCrossMin, pCrossMinSimDraw, pLevelChanged, pCounter);
 			if(nCrossingsNew < nCrossingsOld) {
 				if(nCrossingsNew < queryBestKnown() && postNewResult(nCrossingsNew, &bestPos) == true)
 					levels.storePos(bestPos);
@@ -916,7 +936,7 @@ void LayerByLayerSweep::CrossMinMaster::doWorkHelper(
 				--nFails;
 
 			// bottom-up traversal
-			nCrossingsNew = traverseBottomUp(levels, pCrossMin, pCrossMinSimDraw, pLevelChanged);
+			nCrossingsNew = traverseBottomUp(levels, pCrossMin, pCrossMinSimDraw, pLevelChanged, pCounter);
 			if(nCrossingsNew < nCrossingsOld) {
 				if(nCrossingsNew < queryBestKnown() && postNewResult(nCrossingsNew, &bestPos) == true)
 					levels.storePos(bestPos);
@@ -933,12 +953,13 @@ void LayerByLayerSweep::CrossMinMaster::doWorkHelper(
 
 		levels.permute(rng);
 
-		nCrossingsOld = (pCrossMin != nullptr) ? levels.calculateCrossings() : levels.calculateCrossingsSimDraw(subgraphs());
+		nCrossingsOld = calculateCrossings(levels, pCounter);
 		if(nCrossingsOld < queryBestKnown() && postNewResult(nCrossingsOld, &bestPos) == true)
 			levels.storePos(bestPos);
 	}
 
 	delete pLevelChanged;
+	delete pCounter;
 
 	if(pCrossMin != nullptr)
 		pCrossMin->cleanup();
@@ -949,7 +970,7 @@ void LayerByLayerSweep::CrossMinMaster::doWorkHelper(
 
 // LayerByLayerSweep::CrossMinWorker
 
-class LayerByLayerSweep::CrossMinWorker : public Thread {
+class LayerByLayerSweep::CrossMinWorker {
 
 	LayerByLayerSweep::CrossMinMaster &m_master;
 	LayerByLayerSweep        *m_pCrossMin;
@@ -1330,7 +1351,7 @@ void SugiyamaLayout::reduceCrossings(HierarchyLevels &levels)
 	else
 		pCrossMinSimDraw = &m_crossMinSimDraw.get();
 
-	unsigned int nThreads = min(m_maxThreads, (unsigned int)m_runs);
+	unsigned int nThreads = min(min(m_maxThreads, (unsigned int)m_runs), TaskScheduler::global().concurrency());
 
 	minstd_rand rng(randomSeed());
 
@@ -1365,24 +1386,22 @@ const HierarchyLevels *LayerByLayerSweep::reduceCrossings(const SugiyamaLayout &
 
 	OGDF_ASSERT(sugi.runs() >= 1);
 
-	unsigned int nThreads = min(sugi.maxThreads(), (unsigned int) sugi.runs());
+	unsigned int nThreads = min(min(sugi.maxThreads(), (unsigned int) sugi.runs()), TaskScheduler::global().concurrency());
 
 	minstd_rand rng(randomSeed());
 
 	LayerByLayerSweep::CrossMinMaster master(sugi, levels->hierarchy(), sugi.runs() - nThreads);
 
 	Array<LayerByLayerSweep::CrossMinWorker *> worker(nThreads-1);
-	Array<Thread>                              thread(nThreads - 1);
+	TaskScheduler::TaskGroup group;
 	for (unsigned int i = 0; i < nThreads - 1; ++i) {
-		worker[i] = new LayerByLayerSweep::CrossMinWorker(master, clone(), nullptr);
-		thread[i] = Thread(*worker[i]);
+		LayerByLayerSweep::CrossMinWorker *pWorker = worker[i] = new LayerByLayerSweep::CrossMinWorker(master, clone(), nullptr);
+		group.run([pWorker] { (*pWorker)(); });
 	}
 
 	NodeArray<int> bestPos;
 	master.doWorkHelper(this, nullptr, *levels, bestPos, sugi.permuteFirst(), rng);
-
-	for (unsigned int i = 0; i < nThreads - 1; ++i )
-		thread[i].join();
+	group.wait();
 
 	master.restore(*levels, nCrossings);
 
@@ -1420,7 +1439,7 @@ const HierarchyLevelsBase *SugiyamaLayout::reduceCrossings(Hierarchy &H)
 
 	pCrossMinSimDraw = &m_crossMinSimDraw.get();
 
-	unsigned int nThreads = min(m_maxThreads, (unsigned int)m_runs);
+	unsigned int nThreads = min(min(m_maxThreads, (unsigned int)m_runs), TaskScheduler::global().concurrency());
 
 	int seed = rand();
 	minstd_rand rng(seed);
@@ -1428,19 +1447,17 @@ const HierarchyLevelsBase *SugiyamaLayout::reduceCrossings(Hierarchy &H)
 	LayerByLayerSweep::CrossMinMaster master(*this, levels.hierarchy(), m_runs - nThreads);
 
 	Array<LayerByLayerSweep::CrossMinWorker *> worker(nThreads - 1);
-	Array<Thread>                              thread(nThreads - 1);
+	TaskScheduler::TaskGroup group;
 	for (unsigned int i = 0; i < nThreads - 1; ++i) {
-		worker[i] = new LayerByLayerSweep::CrossMinWorker(master,
+		LayerByLayerSweep::CrossMinWorker *pWorker = worker[i] = new LayerByLayerSweep::CrossMinWorker(master,
 			(pCrossMin        != nullptr) ? pCrossMin       ->clone() : nullptr,
 			(pCrossMinSimDraw != nullptr) ? pCrossMinSimDraw->clone() : nullptr);
-		thread[i] = Thread(*worker[i]);
+		group.run([pWorker] { (*pWorker)(); });
 	}
 
 	NodeArray<int> bestPos;
 	master.doWorkHelper(pCrossMin, pCrossMinSimDraw, levels, bestPos, m_permuteFirst, rng);
-
-	for (unsigned int i = 0; i < nThreads - 1; ++i)
-		thread[i].join();
+	group.wait();
 
 	master.restore(levels, m_nCrossings);
 
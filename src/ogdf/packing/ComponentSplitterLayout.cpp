@@ -41,6 +41,10 @@
 //used for splitting
 #include <ogdf/basic/simple_graph_alg.h>
 #include <ogdf/basic/GraphCopy.h>
+#include <ogdf/basic/TaskScheduler.h>
+#include <algorithm>
+#include <memory>
+#include <mutex>
 
 
 namespace ogdf {
@@ -50,13 +54,55 @@ ComponentSplitterLayout::ComponentSplitterLayout()
 	m_packer.set(new TileToRowsCCPacker);
 	m_targetRatio = 1.f;
 	m_border = 30;
+	m_numberOfThreads = 0;
+}
+
+
+// Lays out the connected component \a nodes of the graph of \a GA with \a layout,
+// using \a GC as its copy; \a auxCopy is only accessed at the edges of the component.
+static void layoutComponent(GraphAttributes &GA, const List<node> &nodes,
+	GraphCopy &GC, EdgeArray<edge> &auxCopy, LayoutModule &layout)
+{
+	GC.initByNodes(nodes, auxCopy);
+	GraphAttributes cGA(GC, GA.attributes());
+	//copy information into copy GA
+	for(node v : GC.nodes)
+	{
+		cGA.width(v) = GA.width(GC.original(v));
+		cGA.height(v) = GA.height(GC.original(v));
+		cGA.x(v) = GA.x(GC.original(v));
+		cGA.y(v) = GA.y(GC.original(v));
+	}
+	// copy information on edges
+	if (GA.has(GraphAttributes::edgeDoubleWeight)) {
+		for (edge e : GC.edges) {
+			cGA.doubleWeight(e) = GA.doubleWeight(GC.original(e));
+		}
+	}
+	layout.call(cGA);
+
+	//copy layout information back into GA
+	for(node v : GC.nodes)
+	{
+		node w = GC.original(v);
+		if (w != nullptr)
+		{
+			GA.x(w) = cGA.x(v);
+			GA.y(w) = cGA.y(v);
+			if (GA.has(GraphAttributes::threeD)) {
+				GA.z(w) = cGA.z(v);
+			}
+		}
+	}
 }
 
 
 void ComponentSplitterLayout::call(GraphAttributes &GA)
 {
+	const bool parallel = m_layoutFactory && m_numberOfThreads != 1;
+
 	// Only do preparations and call if layout is valid
-	if (m_secondaryLayout.valid())
+	if (parallel || m_secondaryLayout.valid())
 	{
 		//first we split the graph into its components
 		const Graph& G = GA.constGraph();
@@ -73,46 +119,19 @@ void ComponentSplitterLayout::call(GraphAttributes &GA)
 		for(node v : G.nodes)
 			nodesInCC[componentNumber[v]].pushBack(v);
 
-		// Create copies of the connected components and corresponding
-		// GraphAttributes
-		GraphCopy GC;
-		GC.createEmpty(G);
+		if (parallel) {
+			layoutComponentsInParallel(GA, nodesInCC);
 
-		EdgeArray<edge> auxCopy(G);
+		} else {
+			// Create copies of the connected components and corresponding
+			// GraphAttributes
+			GraphCopy GC;
+			GC.createEmpty(G);
 
-		for (int i = 0; i < numberOfComponents; i++)
-		{
-			GC.initByNodes(nodesInCC[i],auxCopy);
-			GraphAttributes cGA(GC, GA.attributes());
-			//copy information into copy GA
-			for(node v : GC.nodes)
-			{
-				cGA.width(v) = GA.width(GC.original(v));
-				cGA.height(v) = GA.height(GC.original(v));
-				cGA.x(v) = GA.x(GC.original(v));
-				cGA.y(v) = GA.y(GC.original(v));
-			}
-			// copy information on edges
-			if (GA.has(GraphAttributes::edgeDoubleWeight)) {
-				for (edge e : GC.edges) {
-					cGA.doubleWeight(e) = GA.doubleWeight(GC.original(e));
-				}
-			}
-			m_secondaryLayout.get().call(cGA);
-
-			//copy layout information back into GA
-			for(node v : GC.nodes)
-			{
-				node w = GC.original(v);
-				if (w != nullptr)
-				{
-					GA.x(w) = cGA.x(v);
-					GA.y(w) = cGA.y(v);
-					if (GA.has(GraphAttributes::threeD)) {
-						GA.z(w) = cGA.z(v);
-					}
-				}
-			}
+			EdgeArray<edge> auxCopy(G);
+
+			for (int i = 0; i < numberOfComponents; i++)
+				layoutComponent(GA, nodesInCC[i], GC, auxCopy, m_secondaryLayout.get());
 		}
 
 		// rotate component drawings and call the packer
@@ -122,6 +141,64 @@ void ComponentSplitterLayout::call(GraphAttributes &GA)
 }
 
 
+void ComponentSplitterLayout::layoutComponentsInParallel(GraphAttributes &GA, const Array<List<node> > &nodesInCC)
+{
+	const Graph &G = GA.constGraph();
+	const int numberOfComponents = nodesInCC.size();
+
+	// hand out the components in order of decreasing size (nodes plus edges),
+	// so that the largest ones do not start last and delay the end
+	Array<int> size(numberOfComponents);
+	Array<int> order(numberOfComponents);
+	for (int i = 0; i < numberOfComponents; i++) {
+		int degrees = 0;
+		for (node v : nodesInCC[i])
+			degrees += v->degree();
+		size[i] = nodesInCC[i].size() + degrees / 2;
+		order[i] = i;
+	}
+	std::stable_sort(order.begin(), order.end(), [&](int i, int j) { return size[i] > size[j]; });
+
+	// every thread takes a copy of the graph and a layout module of its own from
+	// the pool; the components are disjoint, so the threads write to different
+	// entries of auxCopy and GA
+	struct ThreadData {
+		GraphCopy GC;
+		std::unique_ptr<LayoutModule> layout;
+	};
+	std::mutex poolMutex;
+	ArrayBuffer<ThreadData*> pool;
+	std::vector<std::unique_ptr<ThreadData>> allData;
+
+	EdgeArray<edge> auxCopy(G);
+
+	TaskScheduler::global().parallelFor(0, numberOfComponents, 1, [&](int begin, int end) {
+		ThreadData *data = nullptr;
+		{
+			std::lock_guard<std::mutex> guard(poolMutex);
+			if (!pool.empty()) {
+				data = pool.popRet();
+			}
+		}
+		if (data == nullptr) {
+			std::unique_ptr<ThreadData> newData(new ThreadData);
+			newData->GC.createEmpty(G);
+			newData->layout.reset(m_layoutFactory());
+			data = newData.get();
+
+			std::lock_guard<std::mutex> guard(poolMutex);
+			allData.push_back(std::move(newData));
+		}
+
+		for (int k = begin; k < end; k++)
+			layoutComponent(GA, nodesInCC[order[k]], data->GC, auxCopy, *data->layout);
+
+		std::lock_guard<std::mutex> guard(poolMutex);
+		pool.push(data);
+	}, m_numberOfThreads);
+}
+
+
 //-----------------
 // geometry helpers
 
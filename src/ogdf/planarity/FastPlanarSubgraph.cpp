@@ -44,7 +44,7 @@
 #include <ogdf/internal/planarity/PlanarSubgraphPQTree.h>
 #include <ogdf/internal/planarity/PlanarLeafKey.h>
 
-#include <ogdf/basic/Thread.h>
+#include <ogdf/basic/TaskScheduler.h>
 #include <mutex>
 #include <atomic>
 
@@ -274,7 +274,7 @@ Module::ReturnType FastPlanarSubgraph::doCall(
 	copyV.init();
 
 	int nRuns = max(1, m_nRuns);
-	unsigned int nThreads = min(maxThreads(), (unsigned int)nRuns);
+	unsigned int nThreads = min(min(maxThreads(), (unsigned int)nRuns), TaskScheduler::global().concurrency());
 
 	if(nThreads == 1)
 		seqCall(block, pCost, nRuns, (m_nRuns == 0), delEdges);
@@ -359,18 +359,17 @@ void FastPlanarSubgraph::parCall(const Array<BlockType> &block, const EdgeArray<
 	ThreadMaster master(block, pCost, nRuns-nThreads);
 
 	Array<Worker *> worker(nThreads-1);
-	Array<Thread> thread(nThreads-1);
+	TaskScheduler::TaskGroup group;
 	for(unsigned int i = 0; i < nThreads-1; ++i) {
-		worker[i] = new Worker(&master);
-		thread[i] = Thread(*worker[i]);
+		Worker *pWorker = worker[i] = new Worker(&master);
+		group.run([pWorker] { (*pWorker)(); });
 	}
 
 	doWorkHelper(master);
+	group.wait();
 
-	for(unsigned int i = 0; i < nThreads-1; ++i) {
-		thread[i].join();
+	for(unsigned int i = 0; i < nThreads-1; ++i)
 		delete worker[i];
-	}
 
 	master.buildSolution(delEdges);
 }
@@ -36,6 +36,7 @@
 #include <ogdf/internal/planarity/FixEdgeInserterCore.h>
 #include <ogdf/basic/FaceSet.h>
 #include <ogdf/basic/Queue.h>
+#include <ogdf/basic/MemoryArena.h>
 
 
 namespace ogdf {
@@ -433,6 +434,8 @@ namespace ogdf {
 		node t = m_pr.copy(eOrig->target());
 		OGDF_ASSERT(s != t);
 
+		// all temporary data of the search is released in one shot
+		ArenaScope scope;
 		NodeArray<edge> spPred(m_dual,nullptr);
 		QueuePure<edge> queue;
 		int oldIdCount = m_dual.maxEdgeIndex();
@@ -565,6 +568,8 @@ namespace ogdf {
 
 		int eSubgraph = (m_pSubgraph != nullptr) ? (*m_pSubgraph)[eOrig] : 0;
 
+		// all temporary data of the search is released in one shot
+		ArenaScope scope;
 		EdgeArray<int> costDual(m_dual, 0);
 		int maxCost = 0;
 		for(edge eDual : m_dual.edges) {
@@ -38,6 +38,7 @@
 #include <ogdf/basic/extended_graph_alg.h>
 #include <ogdf/internal/planarity/CrossingStructure.h>
 
+#include <ogdf/basic/TaskScheduler.h>
 #include <ogdf/basic/Thread.h>
 #include <mutex>
 #include <atomic>
@@ -325,7 +326,7 @@ Module::ReturnType SubgraphPlanarizer::doCall(
 	PlanarSubgraphModule &subgraph = m_subgraph.get();
 	EdgeInsertionModule  &inserter = m_inserter.get();
 
-	unsigned int nThreads = min(m_maxThreads, (unsigned int)m_permutations);
+	unsigned int nThreads = min(min(m_maxThreads, (unsigned int)m_permutations), TaskScheduler::global().concurrency());
 
 	int64_t startTime;
 	System::usedRealTime(startTime);
@@ -380,19 +381,18 @@ Module::ReturnType SubgraphPlanarizer::doCall(
 			m_permutations - nThreads,
 			stopTime);
 
-		Array<Worker *>    worker(nThreads-1);
-		Array<Thread> thread(nThreads-1);
+		Array<Worker *> worker(nThreads-1);
+		TaskScheduler::TaskGroup group;
 		for(unsigned int i = 0; i < nThreads-1; ++i) {
-			worker[i] = new Worker(i, &master, inserter.clone());
-			thread[i] = Thread(*worker[i]);
+			Worker *pWorker = worker[i] = new Worker(i, &master, inserter.clone());
+			group.run([pWorker] { (*pWorker)(); });
 		}
 
 		doWorkHelper(master, inserter, rng);
+		group.wait();
 
-		for(unsigned int i = 0; i < nThreads-1; ++i) {
-			thread[i].join();
+		for(unsigned int i = 0; i < nThreads-1; ++i)
 			delete worker[i];
-		}
 
 		master.restore(pr, crossingNumber);
 
@@ -38,7 +38,7 @@
 #include <ogdf/basic/extended_graph_alg.h>
 #include <ogdf/internal/planarity/CrossingStructure.h>
 
-#include <ogdf/basic/Thread.h>
+#include <ogdf/basic/TaskScheduler.h>
 #include <mutex>
 #include <atomic>
 
@@ -298,7 +298,7 @@ Module::ReturnType SubgraphPlanarizerUML::doCall(
 	PlanarSubgraphModule   &subgraph = m_subgraph.get();
 	UMLEdgeInsertionModule &inserter = m_inserter.get();
 
-	unsigned int nThreads = min(m_maxThreads, (unsigned int)m_permutations);
+	unsigned int nThreads = min(min(m_maxThreads, (unsigned int)m_permutations), TaskScheduler::global().concurrency());
 
 	int64_t startTime;
 	System::usedRealTime(startTime);
@@ -359,18 +359,17 @@ Module::ReturnType SubgraphPlanarizerUML::doCall(
 			stopTime);
 
 		Array<Worker *> worker(nThreads-1);
-		Array<Thread> thread(nThreads-1);
+		TaskScheduler::TaskGroup group;
 		for(unsigned int i = 0; i < nThreads-1; ++i) {
-			worker[i] = new Worker(i, &master, inserter.clone());
-			thread[i] = Thread(*worker[i]);
+			Worker *pWorker = worker[i] = new Worker(i, &master, inserter.clone());
+			group.run([pWorker] { (*pWorker)(); });
 		}
 
 		doWorkHelper(master, inserter, rng);
+		group.wait();
 
-		for(unsigned int i = 0; i < nThreads-1; ++i) {
-			thread[i].join();
+		for(unsigned int i = 0; i < nThreads-1; ++i)
 			delete worker[i];
-		}
 
 		master.restore(pr, crossingNumber);
 
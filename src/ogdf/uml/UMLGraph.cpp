@@ -688,7 +688,7 @@ void UMLGraph::writeGML(ostream &os)
 					if (has(edgeStyle))
 					{
 						// color edges, if specific color in attribut is set
-						os << "      fill \"" << m_edgeStroke[e].m_color << "\"\n";
+						os << "      fill \"" << strokeColor(e) << "\"\n";
 					}
 					else
 						if (m_upwardEdge[e->adjSource()])
@@ -0,0 +1,296 @@
+//*********************************************************
+//  Bandit tests for CSRGraph and the algorithms using it
+//*********************************************************
+
+#include <bandit/bandit.h>
+#include <ogdf/basic/CSRGraph.h>
+#include <ogdf/basic/simple_graph_alg.h>
+#include <ogdf/basic/graph_generators.h>
+#include <ogdf/graphalg/ShortestPathAlgorithms.h>
+
+using namespace bandit;
+using namespace ogdf;
+
+// Asserts that both numberings partition the non-loop edges of G into the same components.
+static void assertSamePartition(const Graph &G, const EdgeArray<int> &comp, int numComp, const EdgeArray<int> &other, int numOther)
+{
+	AssertThat(numOther, Equals(numComp));
+	Array<int> map(0, numComp-1, -1), mapBack(0, numComp-1, -1);
+	for(edge e : G.edges) {
+		if(e->isSelfLoop()) continue;
+		int c = comp[e], o = other[e];
+		AssertThat(o, IsGreaterThanOrEqualTo(0));
+		AssertThat(o, IsLessThan(numComp));
+		if(map[c] == -1) {
+			AssertThat(mapBack[o], Equals(-1));
+			map[c] = o;
+			mapBack[o] = c;
+		}
+		AssertThat(map[c], Equals(o));
+	}
+}
+
+// Generates a graph with several components, isolated nodes, self-loops and multi-edges.
+static void randomMixedGraph(Graph &G, int n)
+{
+	randomGraph(G, n, n + n/2);
+	node prev = G.newNode();
+	for(int i = 1; i < n/2; ++i) {
+		node v = G.newNode();
+		G.newEdge(prev, v);
+		prev = v;
+	}
+	for(int i = 0; i < 5; ++i) {
+		G.newNode();
+		G.newEdge(G.chooseNode(), G.chooseNode());
+	}
+	node v = G.chooseNode();
+	G.newEdge(v, v);
+	edge e = G.chooseEdge();
+	G.newEdge(e->source(), e->target());
+}
+
+go_bandit([](){
+	describe("CSRGraph", [](){
+		it("mirrors the topology of the original graph", [](){
+			Graph G;
+			randomGraph(G, 50, 120);
+			G.newEdge(G.firstNode(), G.firstNode());
+			G.delNode(G.lastNode());
+
+			CSRGraph C(G);
+			AssertThat(C.numberOfNodes(), Equals(G.numberOfNodes()));
+			AssertThat(C.numberOfEdges(), Equals(G.numberOfEdges()));
+
+			for(node v : G.nodes) {
+				int i = C.id(v);
+				AssertThat(C.original(i), Equals(v));
+				AssertThat(C.degree(i), Equals(v->degree()));
+				AssertThat(C.outdeg(i), Equals(v->outdeg()));
+				AssertThat(C.indeg(i), Equals(v->indeg()));
+
+				int a = C.adjBegin(i);
+				for(adjEntry adj : v->adjEntries) {
+					AssertThat(C.original(C.adjNode(a)), Equals(adj->twinNode()));
+					AssertThat(C.originalEdge(C.adjEdge(a)), Equals(adj->theEdge()));
+					++a;
+				}
+				AssertThat(a, Equals(C.adjEnd(i)));
+
+				for(a = C.outBegin(i); a < C.outEnd(i); ++a) {
+					AssertThat(C.originalEdge(C.outEdge(a))->source(), Equals(v));
+				}
+			}
+
+			for(edge e : G.edges) {
+				AssertThat(C.originalEdge(C.id(e)), Equals(e));
+				AssertThat(C.original(C.source(C.id(e))), Equals(e->source()));
+				AssertThat(C.original(C.target(C.id(e))), Equals(e->target()));
+			}
+		});
+
+		for(int n = 1; n < 60; n += 7) {
+			it(string("computes the same results as Graph on random graphs of size " + to_string(n)), [&](){
+				Graph G;
+				randomGraph(G, n, 3*n/2);
+				CSRGraph C(G);
+
+				NodeArray<int> comp(G), compC(G);
+				AssertThat(connectedComponents(C, compC), Equals(connectedComponents(G, comp)));
+				for(node v : G.nodes) {
+					AssertThat(compC[v], Equals(comp[v]));
+				}
+				AssertThat(isConnected(C), Equals(isConnected(G)));
+
+				EdgeArray<int> bicomp(G), bicompC(G);
+				AssertThat(biconnectedComponents(C, bicompC), Equals(biconnectedComponents(G, bicomp)));
+				for(edge e : G.edges) {
+					if(!e->isSelfLoop()) {
+						AssertThat(bicompC[e], Equals(bicomp[e]));
+					}
+				}
+
+				node cut, cutC;
+				AssertThat(isBiconnected(C, cutC), Equals(isBiconnected(G, cut)));
+				AssertThat(cutC, Equals(cut));
+
+				AssertThat(isAcyclic(C), Equals(isAcyclic(G)));
+				if(isAcyclic(G)) {
+					NodeArray<int> num(G), numC(G);
+					topologicalNumbering(G, num);
+					topologicalNumbering(C, numC);
+					for(node v : G.nodes) {
+						AssertThat(numC[v], Equals(num[v]));
+					}
+				}
+
+				EdgeArray<double> cost(G);
+				for(edge e : G.edges) {
+					cost[e] = randomDouble(1, 10);
+				}
+				NodeArray<NodeArray<double>> dist(G), distC(G);
+				dijkstra_SPAP(G, dist, cost);
+				dijkstra_SPAP(C, distC, cost);
+				for(node v : G.nodes) {
+					for(node w : G.nodes) {
+						AssertThat(distC[v][w], EqualsWithDelta(dist[v][w], 1e-9));
+					}
+				}
+
+				for(node v : G.nodes) {
+					dist[v].init(G, -1);
+					distC[v].init(G, -1);
+				}
+				bfs_SPAP(G, dist, 2.0);
+				bfs_SPAP(C, distC, 2.0);
+				for(node v : G.nodes) {
+					for(node w : G.nodes) {
+						AssertThat(distC[v][w], Equals(dist[v][w]));
+					}
+				}
+			});
+		}
+
+		it("computes a topological numbering of a DAG", [](){
+			Graph G;
+			randomSeriesParallelDAG(G, 80);
+			CSRGraph C(G);
+			AssertThat(isAcyclic(C), IsTrue());
+
+			NodeArray<int> num(G);
+			topologicalNumbering(C, num);
+			for(edge e : G.edges) {
+				AssertThat(num[e->source()], IsLessThan(num[e->target()]));
+			}
+		});
+	});
+
+	describe("parallel algorithms on CSRGraph", [](){
+		for(unsigned int numThreads : {2u, 3u, 8u}) {
+			for(int n : {20, 500, 12000}) {
+				it(string("computes connected and biconnected components of a graph of size ") + to_string(n)
+				 + " with " + to_string(numThreads) + " threads", [&](){
+					Graph G;
+					randomMixedGraph(G, n);
+					CSRGraph C(G);
+
+					NodeArray<int> comp(G), compPar(G);
+					AssertThat(connectedComponents(C, compPar, numThreads), Equals(connectedComponents(C, comp)));
+					for(node v : G.nodes) {
+						AssertThat(compPar[v], Equals(comp[v]));
+					}
+
+					EdgeArray<int> bicomp(G), bicompPar(G);
+					int numBicomp = biconnectedComponents(C, bicomp);
+					assertSamePartition(G, bicomp, numBicomp, bicompPar, biconnectedComponents(C, bicompPar, numThreads));
+				});
+
+				it(string("computes a topological numbering of a DAG of size ") + to_string(n)
+				 + " with " + to_string(numThreads) + " threads", [&](){
+					Graph G;
+					randomGraph(G, n, 3*n);
+					makeAcyclicByReverse(G);
+					makeLoopFree(G);
+					CSRGraph C(G);
+					AssertThat(isAcyclic(C, numThreads), IsTrue());
+
+					NodeArray<int> num(G);
+					topologicalNumbering(C, num, numThreads);
+					Array<bool> used(0, G.numberOfNodes()-1, false);
+					for(node v : G.nodes) {
+						AssertThat(used[num[v]], IsFalse());
+						used[num[v]] = true;
+					}
+					for(edge e : G.edges) {
+						AssertThat(num[e->source()], IsLessThan(num[e->target()]));
+					}
+
+					G.newEdge(G.lastNode(), G.firstNode());
+					G.newEdge(G.firstNode(), G.lastNode());
+					C.init(G);
+					AssertThat(isAcyclic(C, numThreads), IsFalse());
+				});
+			}
+
+			it(string("computes all-pairs shortest paths into a NodeMatrix with ") + to_string(numThreads) + " threads", [&](){
+				Graph G;
+				randomMixedGraph(G, 150);
+				CSRGraph C(G);
+				const double inf = numeric_limits<double>::infinity();
+
+				EdgeArray<double> cost(G);
+				for(edge e : G.edges) {
+					cost[e] = randomDouble(1, 10);
+				}
+				NodeArray<NodeArray<double>> dist(G);
+				NodeMatrix<double> distM, distSeq;
+				NodeMatrix<float> distF;
+				dijkstra_SPAP(C, dist, cost);
+				dijkstra_SPAP(C, distM, cost, numThreads);
+				dijkstra_SPAP(C, distSeq, cost);
+				dijkstra_SPAP(C, distF, cost, numThreads);
+				AssertThat(distM.size(), Equals(G.numberOfNodes()));
+				for(node v : G.nodes) {
+					for(node w : G.nodes) {
+						double expected = dist[v][w] == numeric_limits<double>::max() ? inf : dist[v][w];
+						AssertThat(distM(v, w), EqualsWithDelta(expected, 1e-9));
+						AssertThat(distM(v, w), Equals(distSeq(v, w)));
+						AssertThat(distF(v, w), Equals(float(distM(v, w))));
+					}
+				}
+
+				for(node v : G.nodes) {
+					dist[v].init(G, inf);
+				}
+				bfs_SPAP(C, dist, 2.0);
+				bfs_SPAP(C, distM, 2.0, numThreads);
+				bfs_SPAP(C, distF, 2.0f, numThreads);
+				for(node v : G.nodes) {
+					for(node w : G.nodes) {
+						AssertThat(distM(v, w), Equals(dist[v][w]));
+						AssertThat(distF(v, w), Equals(float(dist[v][w])));
+					}
+				}
+			});
+
+			it(string("computes shortest paths from several sources with ") + to_string(numThreads) + " threads", [&](){
+				Graph G;
+				randomMixedGraph(G, 150);
+				CSRGraph C(G);
+				const int n = G.numberOfNodes();
+
+				EdgeArray<double> cost(G);
+				for(edge e : G.edges) {
+					cost[e] = randomDouble(1, 10);
+				}
+				Array<int> sources(7);
+				for(int i = 0; i < sources.size(); ++i) {
+					sources[i] = (i * 37) % n;
+				}
+				Array<double> dist(sources.size() * n);
+				Array<float> distF(sources.size() * n);
+				NodeMatrix<double> distM;
+
+				dijkstra_SPAP(C, distM, cost);
+				dijkstra_SPMS(C, sources, &dist[0], cost, numThreads);
+				dijkstra_SPMS(C, sources, &distF[0], cost, numThreads);
+				for(int i = 0; i < sources.size(); ++i) {
+					for(int w = 0; w < n; ++w) {
+						AssertThat(dist[i * n + w], Equals(distM(sources[i], w)));
+						AssertThat(distF[i * n + w], Equals(float(distM(sources[i], w))));
+					}
+				}
+
+				bfs_SPAP(C, distM, 2.0);
+				bfs_SPMS(C, sources, &dist[0], 2.0, numThreads);
+				bfs_SPMS(C, sources, &distF[0], 2.0f, numThreads);
+				for(int i = 0; i < sources.size(); ++i) {
+					for(int w = 0; w < n; ++w) {
+						AssertThat(dist[i * n + w], Equals(distM(sources[i], w)));
+						AssertThat(distF[i * n + w], Equals(float(distM(sources[i], w))));
+					}
+				}
+			});
+		}
+	});
+});
@@ -338,6 +338,772 @@ void describeFormat(const std::string name, ReaderFunc reader, WriterFunc writer
 	});
 }
 
+/**
+ * Checks whether \a G1 and \a G2 are equal including the order of nodes, edges and adjacency entries.
+ */
+bool sameTopology(const Graph &G1, const Graph &G2)
+{
+	if (G1.numberOfNodes() != G2.numberOfNodes() || G1.numberOfEdges() != G2.numberOfEdges()) {
+		return false;
+	}
+
+	NodeArray<int> index1(G1), index2(G2);
+	int i = 0;
+	for (node v : G1.nodes) index1[v] = i++;
+	i = 0;
+	for (node v : G2.nodes) index2[v] = i++;
+
+	EdgeArray<int> edgeIndex1(G1), edgeIndex2(G2);
+	i = 0;
+	for (edge e : G1.edges) edgeIndex1[e] = i++;
+	i = 0;
+	for (edge e : G2.edges) edgeIndex2[e] = i++;
+
+	for (edge e1 = G1.firstEdge(), e2 = G2.firstEdge(); e1 != nullptr; e1 = e1->succ(), e2 = e2->succ()) {
+		if (index1[e1->source()] != index2[e2->source()] || index1[e1->target()] != index2[e2->target()]) {
+			return false;
+		}
+	}
+
+	for (node v1 = G1.firstNode(), v2 = G2.firstNode(); v1 != nullptr; v1 = v1->succ(), v2 = v2->succ()) {
+		if (v1->degree() != v2->degree()) {
+			return false;
+		}
+		for (adjEntry adj1 = v1->firstAdj(), adj2 = v2->firstAdj(); adj1 != nullptr; adj1 = adj1->succ(), adj2 = adj2->succ()) {
+			if (edgeIndex1[adj1->theEdge()] != edgeIndex2[adj2->theEdge()] || (adj1->theNode() == adj1->theEdge()->source()) != (adj2->theNode() == adj2->theEdge()->source())) {
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+/**
+ * Tests the binary format beyond the generic format tests.
+ */
+void describeBinaryFormat()
+{
+	describe("Binary format", [](){
+		it("preserves the order of nodes, edges and adjacency entries", [](){
+			Graph G, Gtest;
+			randomGraph(G, 100, 300);
+			G.newEdge(G.firstNode(), G.firstNode());
+			G.delNode(G.firstNode()->succ());
+			for (node v : G.nodes) {
+				if (randomNumber(0, 1) == 1) {
+					G.reverseAdjEdges(v);
+				}
+			}
+
+			std::ostringstream write;
+			AssertThat(GraphIO::writeBinary(G, write), IsTrue());
+			std::istringstream read(write.str());
+			AssertThat(GraphIO::readBinary(Gtest, read), IsTrue());
+			AssertThat(sameTopology(G, Gtest), IsTrue());
+		});
+
+		for_each_file("fileformats/gml/valid", [](const string &filename){
+			it(string("reads the same graph as GML from " + filename), [&](){
+				Graph G, Gtest;
+				AssertThat(GraphIO::readGML(G, filename), IsTrue());
+
+				std::ostringstream write;
+				AssertThat(GraphIO::writeBinary(G, write), IsTrue());
+				std::istringstream read(write.str());
+				AssertThat(GraphIO::readBinary(Gtest, read), IsTrue());
+				AssertThat(sameTopology(G, Gtest), IsTrue());
+			});
+		});
+
+		it("writes and reads all graph attributes", [](){
+			Graph G, Gtest;
+			randomGraph(G, 30, 60);
+			const long attributes = GraphAttributes::nodeGraphics | GraphAttributes::edgeGraphics
+				| GraphAttributes::edgeIntWeight | GraphAttributes::edgeDoubleWeight
+				| GraphAttributes::edgeLabel | GraphAttributes::nodeLabel
+				| GraphAttributes::edgeType | GraphAttributes::nodeType
+				| GraphAttributes::nodeId | GraphAttributes::edgeArrow
+				| GraphAttributes::edgeStyle | GraphAttributes::nodeStyle
+				| GraphAttributes::nodeTemplate | GraphAttributes::edgeSubGraphs
+				| GraphAttributes::nodeWeight | GraphAttributes::threeD
+				| GraphAttributes::nodeLabelPosition;
+			GraphAttributes A(G, attributes), Atest(Gtest, attributes);
+			A.setDirected(false);
+
+			for (node v : G.nodes) {
+				A.x(v) = randomDouble(-100, 100);
+				A.y(v) = randomDouble(-100, 100);
+				A.z(v) = randomDouble(-100, 100);
+				A.width(v) = randomDouble(1, 10);
+				A.height(v) = randomDouble(1, 10);
+				A.xLabel(v) = randomDouble(-1, 1);
+				A.yLabel(v) = randomDouble(-1, 1);
+				A.zLabel(v) = randomDouble(-1, 1);
+				A.shape(v) = shEllipse;
+				A.label(v) = "node " + to_string(v->index());
+				A.templateNode(v) = (v->index() % 2) ? "" : "template";
+				A.weight(v) = randomNumber(-5, 5);
+				A.type(v) = Graph::dummy;
+				A.idNode(v) = 2 * v->index();
+				A.strokeColor(v) = Color(randomNumber(0, 255), 1, 2, 3);
+				A.strokeWidth(v) = 2.5f;
+				A.setStrokeType(v, stDash);
+				A.fillColor(v) = Color::Red;
+				A.fillBgColor(v) = Color(4, 5, 6, 7);
+				A.setFillPattern(v, fpCross);
+			}
+
+			for (edge e : G.edges) {
+				for (int i = randomNumber(0, 3); i > 0; --i) {
+					A.bends(e).pushBack(DPoint(randomDouble(-10, 10), randomDouble(-10, 10)));
+				}
+				A.label(e) = (e->index() % 3) ? "" : "edge";
+				A.intWeight(e) = randomNumber(-100, 100);
+				A.doubleWeight(e) = randomDouble(-100, 100);
+				A.type(e) = Graph::generalization;
+				A.arrowType(e) = eaBoth;
+				A.strokeColor(e) = Color::Blue;
+				A.strokeWidth(e) = 0.5f;
+				A.setStrokeType(e, stDot);
+				A.subGraphBits(e) = (uint32_t) randomNumber(0, 1 << 20);
+			}
+
+			std::ostringstream write;
+			AssertThat(GraphIO::writeBinary(A, write), IsTrue());
+			std::istringstream read(write.str());
+			AssertThat(GraphIO::readBinary(Atest, Gtest, read), IsTrue());
+			AssertThat(sameTopology(G, Gtest), IsTrue());
+			AssertThat(Atest.directed(), IsFalse());
+
+			for (node v = G.firstNode(), w = Gtest.firstNode(); v != nullptr; v = v->succ(), w = w->succ()) {
+				AssertThat(Atest.x(w), Equals(A.x(v)));
+				AssertThat(Atest.y(w), Equals(A.y(v)));
+				AssertThat(Atest.z(w), Equals(A.z(v)));
+				AssertThat(Atest.width(w), Equals(A.width(v)));
+				AssertThat(Atest.height(w), Equals(A.height(v)));
+				AssertThat(Atest.xLabel(w), Equals(A.xLabel(v)));
+				AssertThat(Atest.yLabel(w), Equals(A.yLabel(v)));
+				AssertThat(Atest.zLabel(w), Equals(A.zLabel(v)));
+				AssertThat(Atest.shape(w), Equals(A.shape(v)));
+				AssertThat(Atest.label(w), Equals(A.label(v)));
+				AssertThat(Atest.templateNode(w), Equals(A.templateNode(v)));
+				AssertThat(Atest.weight(w), Equals(A.weight(v)));
+				AssertThat(Atest.type(w), Equals(A.type(v)));
+				AssertThat(Atest.idNode(w), Equals(A.idNode(v)));
+				AssertThat(Atest.strokeColor(w), Equals(A.strokeColor(v)));
+				AssertThat(Atest.strokeWidth(w), Equals(A.strokeWidth(v)));
+				AssertThat(Atest.strokeType(w), Equals(A.strokeType(v)));
+				AssertThat(Atest.fillColor(w), Equals(A.fillColor(v)));
+				AssertThat(Atest.fillBgColor(w), Equals(A.fillBgColor(v)));
+				AssertThat(Atest.fillPattern(w), Equals(A.fillPattern(v)));
+			}
+
+			for (edge e = G.firstEdge(), f = Gtest.firstEdge(); e != nullptr; e = e->succ(), f = f->succ()) {
+				AssertThat(Atest.bends(f).size(), Equals(A.bends(e).size()));
+				for (ListConstIterator<DPoint> p = A.bends(e).begin(), q = Atest.bends(f).begin(); p.valid(); ++p, ++q) {
+					AssertThat(*q, Equals(*p));
+				}
+				AssertThat(Atest.label(f), Equals(A.label(e)));
+				AssertThat(Atest.intWeight(f), Equals(A.intWeight(e)));
+				AssertThat(Atest.doubleWeight(f), Equals(A.doubleWeight(e)));
+				AssertThat(Atest.type(f), Equals(A.type(e)));
+				AssertThat(Atest.arrowType(f), Equals(A.arrowType(e)));
+				AssertThat(Atest.strokeColor(f), Equals(A.strokeColor(e)));
+				AssertThat(Atest.strokeWidth(f), Equals(A.strokeWidth(e)));
+				AssertThat(Atest.strokeType(f), Equals(A.strokeType(e)));
+				AssertThat(Atest.subGraphBits(f), Equals(A.subGraphBits(e)));
+			}
+		});
+
+		it("reads only the attributes enabled in the target", [](){
+			Graph G, Gtest;
+			randomGraph(G, 20, 40);
+			GraphAttributes A(G, GraphAttributes::nodeGraphics | GraphAttributes::nodeLabel | GraphAttributes::edgeDoubleWeight);
+			GraphAttributes Atest(Gtest, GraphAttributes::edgeDoubleWeight);
+			for (edge e : G.edges) {
+				A.doubleWeight(e) = e->index();
+			}
+
+			std::ostringstream write;
+			AssertThat(GraphIO::writeBinary(A, write), IsTrue());
+			std::istringstream read(write.str());
+			AssertThat(GraphIO::readBinary(Atest, Gtest, read), IsTrue());
+			AssertThat(sameTopology(G, Gtest), IsTrue());
+			for (edge e = G.firstEdge(), f = Gtest.firstEdge(); e != nullptr; e = e->succ(), f = f->succ()) {
+				AssertThat(Atest.doubleWeight(f), Equals(A.doubleWeight(e)));
+			}
+		});
+
+		it("writes and reads a clustered graph with attributes", [](){
+			Graph G, Gtest;
+			randomGraph(G, 40, 80);
+			ClusterGraph C(G), Ctest(Gtest);
+			randomClusterGraph(C, G, 8);
+			ClusterGraphAttributes A(C, GraphAttributes::nodeGraphics), Atest(Ctest, GraphAttributes::nodeGraphics);
+			for (cluster c : C.clusters) {
+				A.x(c) = randomDouble(0, 100);
+				A.height(c) = randomDouble(1, 100);
+				A.label(c) = "cluster " + to_string(c->index());
+				A.fillColor(c) = Color::Green;
+				A.setStrokeType(c, stDashdot);
+			}
+
+			std::ostringstream write;
+			AssertThat(GraphIO::writeBinary(A, write), IsTrue());
+			std::istringstream read(write.str());
+			AssertThat(GraphIO::readBinary(Atest, Ctest, Gtest, read), IsTrue());
+			AssertThat(sameTopology(G, Gtest), IsTrue());
+			AssertThat(Ctest.numberOfClusters(), Equals(C.numberOfClusters()));
+
+			// clusters are identified by their labels
+			std::unordered_map<string, cluster> byLabel;
+			for (cluster c : Ctest.clusters) {
+				byLabel[Atest.label(c)] = c;
+			}
+			for (cluster c : C.clusters) {
+				cluster d = byLabel[A.label(c)];
+				AssertThat(d, !IsNull());
+				AssertThat(d->nodes.size(), Equals(c->nodes.size()));
+				AssertThat(d->children.size(), Equals(c->children.size()));
+				AssertThat(Atest.x(d), Equals(A.x(c)));
+				AssertThat(Atest.height(d), Equals(A.height(c)));
+				AssertThat(Atest.fillColor(d), Equals(A.fillColor(c)));
+				AssertThat(Atest.strokeType(d), Equals(A.strokeType(c)));
+				if (c != C.rootCluster()) {
+					AssertThat(Atest.label(d->parent()), Equals(A.label(c->parent())));
+				}
+			}
+			for (node v = G.firstNode(), w = Gtest.firstNode(); v != nullptr; v = v->succ(), w = w->succ()) {
+				AssertThat(Atest.label(Ctest.clusterOf(w)), Equals(A.label(C.clusterOf(v))));
+			}
+		});
+
+		it("reads a file written to disk", [](){
+			Graph G, Gtest;
+			randomGraph(G, 200, 1000);
+			const string filename = "binary-format-test.ogdfbin";
+			AssertThat(GraphIO::writeBinary(G, filename), IsTrue());
+			AssertThat(GraphIO::readBinary(Gtest, filename), IsTrue());
+			AssertThat(sameTopology(G, Gtest), IsTrue());
+
+			Gtest.clear();
+			AssertThat(GraphIO::read(Gtest, filename), IsTrue());
+			AssertThat(sameTopology(G, Gtest), IsTrue());
+			std::remove(filename.c_str());
+		});
+
+		it("detects truncated and corrupted files", [](){
+			Graph G, Gtest;
+			randomGraph(G, 20, 50);
+			GraphAttributes A(G, GraphAttributes::nodeGraphics | GraphAttributes::edgeGraphics | GraphAttributes::nodeLabel);
+			std::ostringstream write;
+			AssertThat(GraphIO::writeBinary(A, write), IsTrue());
+			const string data = write.str();
+
+			GraphAttributes Atest(Gtest, A.attributes());
+			for (size_t length = 0; length < data.size(); length += 7) {
+				std::istringstream read(data.substr(0, length));
+				AssertThat(GraphIO::readBinary(Atest, Gtest, read), IsFalse());
+			}
+
+			string corrupted = data;
+			corrupted[64] = '\x7f'; // the first source node
+			std::istringstream read(corrupted);
+			AssertThat(GraphIO::readBinary(Gtest, read), IsFalse());
+		});
+	});
+}
+
+/**
+ * Reads a graph using the streaming variant of \a reader.
+ */
+template<ReaderFunc reader>
+bool readStreaming(Graph &G, istream &is)
+{
+	GraphIO::setStreamingParsers(true);
+	bool result = reader(G, is);
+	GraphIO::setStreamingParsers(false);
+	return result;
+}
+
+/**
+ * Assigns random values to all attributes enabled in \a A.
+ */
+void randomizeAttributes(GraphAttributes &A)
+{
+	const Graph &G = A.constGraph();
+
+	for (node v : G.nodes) {
+		if (A.has(GraphAttributes::nodeGraphics)) {
+			A.x(v) = randomDouble(-100, 100);
+			A.y(v) = randomDouble(-100, 100);
+			A.width(v) = randomDouble(1, 10);
+			A.height(v) = randomDouble(1, 10);
+			A.shape(v) = (v->index() % 2) ? shEllipse : shHexagon;
+		}
+		if (A.has(GraphAttributes::threeD)) {
+			A.z(v) = randomDouble(-100, 100);
+		}
+		if (A.has(GraphAttributes::nodeLabel)) {
+			A.label(v) = "node \"" + to_string(v->index()) + "\" & <label>";
+		}
+		if (A.has(GraphAttributes::nodeTemplate)) {
+			A.templateNode(v) = (v->index() % 3) ? "" : "template\\" + to_string(v->index());
+		}
+		if (A.has(GraphAttributes::nodeWeight)) {
+			A.weight(v) = randomNumber(-5, 5);
+		}
+		if (A.has(GraphAttributes::nodeType)) {
+			A.type(v) = Graph::dummy;
+		}
+		if (A.has(GraphAttributes::nodeId)) {
+			A.idNode(v) = 2 * v->index() + 1;
+		}
+		if (A.has(GraphAttributes::nodeStyle)) {
+			A.strokeColor(v) = Color(randomNumber(0, 255), 1, 2);
+			A.strokeWidth(v) = 2.5f;
+			A.setStrokeType(v, stDash);
+			A.fillColor(v) = Color::Red;
+		}
+	}
+
+	for (edge e : G.edges) {
+		if (A.has(GraphAttributes::edgeGraphics)) {
+			for (int i = randomNumber(0, 3); i > 0; --i) {
+				A.bends(e).pushBack(DPoint(randomDouble(-10, 10), randomDouble(-10, 10)));
+			}
+		}
+		if (A.has(GraphAttributes::edgeLabel)) {
+			A.label(e) = (e->index() % 3) ? "" : "edge " + to_string(e->index());
+		}
+		if (A.has(GraphAttributes::edgeIntWeight)) {
+			A.intWeight(e) = randomNumber(-100, 100);
+		}
+		if (A.has(GraphAttributes::edgeDoubleWeight)) {
+			A.doubleWeight(e) = randomDouble(-100, 100);
+		}
+		if (A.has(GraphAttributes::edgeType)) {
+			A.type(e) = (e->index() % 2) ? Graph::generalization : Graph::association;
+		}
+		if (A.has(GraphAttributes::edgeArrow)) {
+			A.arrowType(e) = (e->index() % 2) ? eaBoth : eaFirst;
+		}
+		if (A.has(GraphAttributes::edgeStyle)) {
+			A.strokeColor(e) = Color::Blue;
+			A.strokeWidth(e) = 0.5f;
+			A.setStrokeType(e, stDot);
+		}
+		if (A.has(GraphAttributes::edgeSubGraphs)) {
+			A.subGraphBits(e) = (uint32_t) randomNumber(0, 1 << 20);
+		}
+	}
+}
+
+/**
+ * Asserts that \a A1 and \a A2 agree in all attributes enabled in \a A1.
+ *
+ * The graphs of both attributes are required to have the same topology.
+ */
+void assertSameAttributes(const GraphAttributes &A1, const GraphAttributes &A2)
+{
+	const Graph &G1 = A1.constGraph(), &G2 = A2.constGraph();
+	AssertThat(sameTopology(G1, G2), IsTrue());
+
+	for (node v = G1.firstNode(), w = G2.firstNode(); v != nullptr; v = v->succ(), w = w->succ()) {
+		if (A1.has(GraphAttributes::nodeGraphics)) {
+			AssertThat(A2.x(w), EqualsWithDelta(A1.x(v), 1e-9));
+			AssertThat(A2.y(w), EqualsWithDelta(A1.y(v), 1e-9));
+			AssertThat(A2.width(w), EqualsWithDelta(A1.width(v), 1e-9));
+			AssertThat(A2.height(w), EqualsWithDelta(A1.height(v), 1e-9));
+			AssertThat(A2.shape(w), Equals(A1.shape(v)));
+		}
+		if (A1.has(GraphAttributes::threeD)) {
+			AssertThat(A2.z(w), EqualsWithDelta(A1.z(v), 1e-9));
+		}
+		if (A1.has(GraphAttributes::nodeLabel)) {
+			AssertThat(A2.label(w), Equals(A1.label(v)));
+		}
+		if (A1.has(GraphAttributes::nodeTemplate)) {
+			AssertThat(A2.templateNode(w), Equals(A1.templateNode(v)));
+		}
+		if (A1.has(GraphAttributes::nodeWeight)) {
+			AssertThat(A2.weight(w), Equals(A1.weight(v)));
+		}
+		if (A1.has(GraphAttributes::nodeType)) {
+			AssertThat(A2.type(w), Equals(A1.type(v)));
+		}
+		if (A1.has(GraphAttributes::nodeId)) {
+			AssertThat(A2.idNode(w), Equals(A1.idNode(v)));
+		}
+		if (A1.has(GraphAttributes::nodeStyle)) {
+			AssertThat(A2.strokeColor(w), Equals(A1.strokeColor(v)));
+			AssertThat(A2.strokeWidth(w), Equals(A1.strokeWidth(v)));
+			AssertThat(A2.strokeType(w), Equals(A1.strokeType(v)));
+			AssertThat(A2.fillColor(w), Equals(A1.fillColor(v)));
+			AssertThat(A2.fillPattern(w), Equals(A1.fillPattern(v)));
+		}
+	}
+
+	for (edge e = G1.firstEdge(), f = G2.firstEdge(); e != nullptr; e = e->succ(), f = f->succ()) {
+		if (A1.has(GraphAttributes::edgeGraphics)) {
+			AssertThat(A2.bends(f).size(), Equals(A1.bends(e).size()));
+			for (ListConstIterator<DPoint> p = A1.bends(e).begin(), q = A2.bends(f).begin(); p.valid(); ++p, ++q) {
+				AssertThat((*q).m_x, EqualsWithDelta((*p).m_x, 1e-9));
+				AssertThat((*q).m_y, EqualsWithDelta((*p).m_y, 1e-9));
+			}
+		}
+		if (A1.has(GraphAttributes::edgeLabel)) {
+			AssertThat(A2.label(f), Equals(A1.label(e)));
+		}
+		if (A1.has(GraphAttributes::edgeIntWeight)) {
+			AssertThat(A2.intWeight(f), Equals(A1.intWeight(e)));
+		}
+		if (A1.has(GraphAttributes::edgeDoubleWeight)) {
+			AssertThat(A2.doubleWeight(f), EqualsWithDelta(A1.doubleWeight(e), 1e-9));
+		}
+		if (A1.has(GraphAttributes::edgeType)) {
+			AssertThat(A2.type(f), Equals(A1.type(e)));
+		}
+		if (A1.has(GraphAttributes::edgeArrow)) {
+			AssertThat(A2.arrowType(f), Equals(A1.arrowType(e)));
+		}
+		if (A1.has(GraphAttributes::edgeStyle)) {
+			AssertThat(A2.strokeColor(f), Equals(A1.strokeColor(e)));
+			AssertThat(A2.strokeWidth(f), Equals(A1.strokeWidth(e)));
+			AssertThat(A2.strokeType(f), Equals(A1.strokeType(e)));
+		}
+		if (A1.has(GraphAttributes::edgeSubGraphs)) {
+			AssertThat(A2.subGraphBits(f), Equals(A1.subGraphBits(e)));
+		}
+	}
+}
+
+/**
+ * Asserts that the cluster trees below \a c1 and \a c2 agree in structure, node membership and cluster attributes.
+ *
+ * Nodes are identified by their position in the node lists, child clusters by their position in the lists of children.
+ */
+void assertSameClusters(const ClusterGraphAttributes &A1, cluster c1, const ClusterGraphAttributes &A2, cluster c2)
+{
+	auto positions = [](const Graph &G, cluster c) {
+		NodeArray<int> index(G);
+		int i = 0;
+		for (node v : G.nodes) index[v] = i++;
+
+		std::vector<int> result;
+		for (node v : c->nodes) result.push_back(index[v]);
+		std::sort(result.begin(), result.end());
+		return result;
+	};
+
+	AssertThat(positions(A2.constGraph(), c2) == positions(A1.constGraph(), c1), IsTrue());
+	AssertThat(c2->children.size(), Equals(c1->children.size()));
+	if (c1 != A1.constClusterGraph().rootCluster()) {
+		AssertThat(A2.label(c2), Equals(A1.label(c1)));
+		AssertThat(A2.x(c2), EqualsWithDelta(A1.x(c1), 1e-9));
+		AssertThat(A2.y(c2), EqualsWithDelta(A1.y(c1), 1e-9));
+		AssertThat(A2.width(c2), EqualsWithDelta(A1.width(c1), 1e-9));
+		AssertThat(A2.height(c2), EqualsWithDelta(A1.height(c1), 1e-9));
+		AssertThat(A2.strokeColor(c2), Equals(A1.strokeColor(c1)));
+		AssertThat(A2.fillColor(c2), Equals(A1.fillColor(c1)));
+	}
+
+	for (ListConstIterator<cluster> it1 = c1->cBegin(), it2 = c2->cBegin(); it1.valid(); ++it1, ++it2) {
+		assertSameClusters(A1, *it1, A2, *it2);
+	}
+}
+
+typedef bool (*AttributeReaderFunc)(GraphAttributes&, Graph&, istream&);
+typedef bool (*AttributeWriterFunc)(const GraphAttributes&, ostream&);
+typedef bool (*ClusterReaderFunc)(ClusterGraphAttributes&, ClusterGraph&, Graph&, istream&);
+typedef bool (*ClusterWriterFunc)(const ClusterGraphAttributes&, ostream&);
+
+/**
+ * Tests that the streaming parser of a format yields the same results as the tree-based parser.
+ *
+ * \param name The name of the format, used to locate the resource files.
+ * \param attributes The attributes supported by the format.
+ * \param clusterWriter The writer used to produce clustered input, or \c nullptr if there is none.
+ */
+void describeStreamingParser(const std::string name, long attributes,
+	AttributeReaderFunc reader, AttributeWriterFunc writer,
+	ClusterReaderFunc clusterReader, ClusterWriterFunc clusterWriter)
+{
+	std::string lowerCaseName = name;
+	std::transform(lowerCaseName.begin(), lowerCaseName.end(), lowerCaseName.begin(), ::tolower);
+
+	// reads the same input with both parsers and compares the results
+	auto compareAttributes = [=](const string &input) {
+		Graph G1, G2;
+		GraphAttributes A1(G1, attributes), A2(G2, attributes);
+		std::istringstream read1(input), read2(input);
+		AssertThat(reader(A1, G1, read1), IsTrue());
+		GraphIO::setStreamingParsers(true);
+		bool result = reader(A2, G2, read2);
+		GraphIO::setStreamingParsers(false);
+		AssertThat(result, IsTrue());
+		assertSameAttributes(A1, A2);
+	};
+
+	auto compareClusters = [=](const string &input) {
+		Graph G1, G2;
+		ClusterGraph C1(G1), C2(G2);
+		ClusterGraphAttributes A1(C1, attributes), A2(C2, attributes);
+		std::istringstream read1(input), read2(input);
+		AssertThat(clusterReader(A1, C1, G1, read1), IsTrue());
+		GraphIO::setStreamingParsers(true);
+		bool result = clusterReader(A2, C2, G2, read2);
+		GraphIO::setStreamingParsers(false);
+		AssertThat(result, IsTrue());
+		assertSameAttributes(A1, A2);
+		assertSameClusters(A1, C1.rootCluster(), A2, C2.rootCluster());
+	};
+
+	describe(name + " streaming parser", [&](){
+		for_each_file("fileformats/" + lowerCaseName + "/valid", [&](const string &filename){
+			it(string("reads the same attributes as the tree parser from " + filename), [&](){
+				std::ifstream is(filename);
+				std::stringstream input;
+				input << is.rdbuf();
+				// the tree parsers flatten nested graphs only when reading clusters
+				if (filename.find("nested") == string::npos) {
+					compareAttributes(input.str());
+				}
+				compareClusters(input.str());
+			});
+		});
+
+		it("reads the same attributes as the tree parser from a large graph", [&](){
+			Graph G;
+			randomGraph(G, 2000, 6000);
+			GraphAttributes A(G, attributes);
+			randomizeAttributes(A);
+
+			std::ostringstream write;
+			AssertThat(writer(A, write), IsTrue());
+			AssertThat(write.str().size(), IsGreaterThan(1u << 16));
+			compareAttributes(write.str());
+		});
+
+		// the GraphML writer does not produce readable cluster hierarchies
+		if (clusterWriter == nullptr) {
+			return;
+		}
+
+		it("reads the same clusters as the tree parser", [&](){
+			Graph G;
+			randomGraph(G, 300, 600);
+			ClusterGraph C(G);
+			randomClusterGraph(C, G, 30);
+			ClusterGraphAttributes A(C, attributes);
+			randomizeAttributes(A);
+			for (cluster c : C.clusters) {
+				A.x(c) = randomDouble(0, 100);
+				A.y(c) = randomDouble(0, 100);
+				A.width(c) = randomDouble(1, 100);
+				A.height(c) = randomDouble(1, 100);
+				A.label(c) = "cluster " + to_string(c->index());
+				A.strokeColor(c) = Color::Green;
+				A.fillColor(c) = Color(1, 2, 3);
+			}
+
+			std::ostringstream write;
+			AssertThat(clusterWriter(A, write), IsTrue());
+			compareClusters(write.str());
+		});
+
+		for_each_file("fileformats/" + lowerCaseName + "/invalid", [&](const string &filename){
+			it(string("detects errors in " + filename), [&](){
+				Graph G;
+				GraphAttributes A(G, attributes);
+				std::ifstream input(filename);
+				GraphIO::setStreamingParsers(true);
+				bool result = reader(A, G, input);
+				GraphIO::setStreamingParsers(false);
+				AssertThat(result, IsFalse());
+			});
+		});
+	});
+}
+
+/**
+ * Tests input that is handled by the streaming parsers only.
+ */
+void describeStreamingParserSpecifics()
+{
+	describe("Streaming parsers", [](){
+		it("read long GML strings with escape sequences", [](){
+			Graph G;
+			G.newNode();
+			GraphAttributes A(G, GraphAttributes::nodeLabel);
+			string label;
+			for (int i = 0; i < 1000; ++i) {
+				label += (i % 7) ? "x" : "\\\"";
+			}
+			A.label(G.firstNode()) = label;
+
+			std::ostringstream write;
+			AssertThat(GraphIO::writeGML(A, write), IsTrue());
+
+			Graph Gtest;
+			GraphAttributes Atest(Gtest, GraphAttributes::nodeLabel);
+			std::istringstream read(write.str());
+			GraphIO::setStreamingParsers(true);
+			AssertThat(GraphIO::readGML(Atest, Gtest, read), IsTrue());
+			GraphIO::setStreamingParsers(false);
+			AssertThat(Atest.label(Gtest.firstNode()), Equals(label));
+		});
+
+		it("resolve GraphML edges to nodes declared later", [](){
+			std::istringstream read(
+				"<?xml version=\"1.0\"?>\n"
+				"<!-- nodes after edges -->\n"
+				"<graphml xmlns=\"http://graphml.graphdrawing.org/xmlns\">\n"
+				"<key id=\"d0\" for=\"node\" attr.name=\"label\" attr.type=\"string\"/>\n"
+				"<graph edgedefault=\"directed\">\n"
+				"<edge source=\"b\" target=\"a\"/>\n"
+				"<node id=\"a\"><data key=\"d0\">A &amp; &#x42;</data></node>\n"
+				"<node id=\"b\"><data key=\"d0\"><![CDATA[<b>]]></data></node>\n"
+				"</graph>\n"
+				"</graphml>\n");
+
+			Graph G;
+			GraphAttributes A(G, GraphAttributes::nodeLabel);
+			GraphIO::setStreamingParsers(true);
+			bool result = GraphIO::readGraphML(A, G, read);
+			GraphIO::setStreamingParsers(false);
+			AssertThat(result, IsTrue());
+			AssertThat(G.numberOfNodes(), Equals(2));
+			AssertThat(G.numberOfEdges(), Equals(1));
+			node a = G.firstNode();
+			AssertThat(A.label(a), Equals(string("A & B")));
+			AssertThat(A.label(a->succ()), Equals(string("<b>")));
+			AssertThat(G.firstEdge()->target(), Equals(a));
+		});
+
+		it("read all nodes and edges of nested GraphML graphs", [](){
+			Graph G;
+			GraphIO::setStreamingParsers(true);
+			bool result = GraphIO::readGraphML(G, RESOURCE_DIR + "/fileformats/graphml/valid/nested");
+			GraphIO::setStreamingParsers(false);
+			AssertThat(result, IsTrue());
+			AssertThat(G.numberOfNodes(), Equals(14));
+			AssertThat(G.numberOfEdges(), Equals(12));
+		});
+
+		it("reject GraphML with mismatched tags", [](){
+			std::istringstream read(
+				"<graphml><graph><node id=\"a\"></graph></node></graphml>");
+			Graph G;
+			GraphIO::setStreamingParsers(true);
+			bool result = GraphIO::readGraphML(G, read);
+			GraphIO::setStreamingParsers(false);
+			AssertThat(result, IsFalse());
+		});
+	});
+}
+
+/**
+ * Tests reading and writing many files concurrently.
+ */
+void describeBatchProcessing()
+{
+	describe("Batch processing", [](){
+		it("writes and reads graphs concurrently", [](){
+			const int n = 40;
+			Array<string> filenames(n);
+			Array<Graph> graphs(n), graphsTest;
+			for (int i = 0; i < n; ++i) {
+				filenames[i] = "batch-test-" + to_string(i) + ".gml";
+				randomGraph(graphs[i], 10 + 3*i, 20 + 7*i);
+			}
+
+			Array<GraphIO::BatchResult> results;
+			AssertThat(GraphIO::writeBatch(filenames, graphs, results, GraphIO::writeGML, 4), Equals(n));
+			AssertThat(results.size(), Equals(n));
+
+			AssertThat(GraphIO::readBatch(filenames, graphsTest, results, GraphIO::readGML, 4), Equals(n));
+			AssertThat(graphsTest.size(), Equals(n));
+			for (int i = 0; i < n; ++i) {
+				AssertThat(results[i].filename, Equals(filenames[i]));
+				AssertThat(results[i].success, IsTrue());
+				AssertThat(results[i].message, IsEmpty());
+				AssertThat(sameTopology(graphs[i], graphsTest[i]), IsTrue());
+				std::remove(filenames[i].c_str());
+			}
+		});
+
+		it("detects the format of each file", [](){
+			Array<string> filenames;
+			for (const string &format : { "gml", "graphml", "dot", "gexf", "tlp", "leda", "chaco", "dl", "gdf" }) {
+				for_each_file("fileformats/" + format + "/valid", [&](const string &filename){
+					filenames.grow(1, filename);
+				});
+			}
+
+			Array<Graph> graphs;
+			Array<GraphIO::BatchResult> results;
+			AssertThat(GraphIO::readBatch(filenames, graphs, results), Equals(filenames.size()));
+			for (int i = 0; i < filenames.size(); ++i) {
+				Graph G;
+				AssertThat(GraphIO::read(G, filenames[i]), IsTrue());
+				AssertThat(sameTopology(G, graphs[i]), IsTrue());
+			}
+		});
+
+		it("reports errors per file", [](){
+			Array<string> filenames;
+			for_each_file("fileformats/gml/invalid", [&](const string &filename){
+				filenames.grow(1, filename);
+			});
+			const int invalid = filenames.size();
+			filenames.grow(1, "batch-test-missing.gml");
+			for_each_file("fileformats/gml/valid", [&](const string &filename){
+				filenames.grow(1, filename);
+			});
+
+			Array<Graph> graphs;
+			Array<GraphIO::BatchResult> results;
+			AssertThat(GraphIO::readBatch(filenames, graphs, results, GraphIO::readGML, 3), Equals(filenames.size() - invalid - 1));
+			for (int i = 0; i < filenames.size(); ++i) {
+				AssertThat(results[i].success, Equals(i > invalid));
+				AssertThat(results[i].message.empty(), Equals(i > invalid));
+			}
+			AssertThat(results[invalid].message, Contains("Could not open file"));
+		});
+
+		it("writes and reads attributes concurrently", [](){
+			const int n = 20;
+			const long attributes = GraphAttributes::nodeGraphics | GraphAttributes::nodeLabel;
+			Array<string> filenames(n);
+			Array<Graph> graphs(n), graphsTest;
+			Array<GraphAttributes> attrs(n), attrsTest;
+			for (int i = 0; i < n; ++i) {
+				filenames[i] = "batch-test-" + to_string(i) + ".graphml";
+				randomGraph(graphs[i], 20, 40);
+				attrs[i].init(graphs[i], attributes);
+				for (node v : graphs[i].nodes) {
+					attrs[i].x(v) = i;
+					attrs[i].label(v) = to_string(v->index());
+				}
+			}
+
+			Array<GraphIO::BatchResult> results;
+			AssertThat(GraphIO::writeBatch(filenames, attrs, results, GraphIO::writeGraphML), Equals(n));
+			AssertThat(GraphIO::readBatch(filenames, attributes, graphsTest, attrsTest, results, GraphIO::readGraphML), Equals(n));
+			for (int i = 0; i < n; ++i) {
+				AssertThat(sameTopology(graphs[i], graphsTest[i]), IsTrue());
+				for (node v = graphs[i].firstNode(), w = graphsTest[i].firstNode(); v != nullptr; v = v->succ(), w = w->succ()) {
+					AssertThat(attrsTest[i].x(w), Equals(attrs[i].x(v)));
+					AssertThat(attrsTest[i].label(w), Equals(attrs[i].label(v)));
+				}
+				std::remove(filenames[i].c_str());
+			}
+		});
+	});
+}
+
 go_bandit([](){
 describe("GraphIO", [](){
 	describeSTP<int>("int");
@@ -359,6 +1125,28 @@ describe("GraphIO", [](){
 	describeFormat("TLP", GraphIO::readTLP, GraphIO::writeTLP, false);
 	describeFormat("DL", GraphIO::readDL, GraphIO::writeDL, false);
 	describeFormat("Graph6", GraphIO::readGraph6, GraphIO::writeGraph6, false);
+	describeFormat("Binary", GraphIO::readBinary, GraphIO::writeBinary, false);
+
+	describeBinaryFormat();
+
+	describe("streaming", [](){
+		describeFormat("GML", readStreaming<GraphIO::readGML>, GraphIO::writeGML, false);
+		describeFormat("GraphML", readStreaming<GraphIO::readGraphML>, GraphIO::writeGraphML, true);
+	});
+
+	const long commonAttributes = GraphAttributes::nodeGraphics | GraphAttributes::edgeGraphics
+		| GraphAttributes::nodeLabel | GraphAttributes::edgeLabel
+		| GraphAttributes::nodeTemplate | GraphAttributes::nodeWeight
+		| GraphAttributes::nodeStyle | GraphAttributes::edgeStyle
+		| GraphAttributes::edgeType | GraphAttributes::edgeArrow
+		| GraphAttributes::edgeDoubleWeight | GraphAttributes::edgeSubGraphs;
+	describeStreamingParser("GML", commonAttributes | GraphAttributes::nodeId,
+		GraphIO::readGML, GraphIO::writeGML, GraphIO::readGML, GraphIO::writeGML);
+	describeStreamingParser("GraphML", commonAttributes | GraphAttributes::threeD | GraphAttributes::nodeType,
+		GraphIO::readGraphML, GraphIO::writeGraphML, GraphIO::readGraphML, nullptr);
+	describeStreamingParserSpecifics();
+
+	describeBatchProcessing();
 
 	describe("generic reader", []() {
 		std::function<void (const string&)> genericTest = [](const string &filename) {
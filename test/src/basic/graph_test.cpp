@@ -33,8 +33,11 @@
  ***************************************************************/
 
 #include <bandit/bandit.h>
+#include <thread>
+#include <vector>
 
 #include <ogdf/basic/Graph.h>
+#include <ogdf/basic/graph_generators.h>
 #include <resources.h>
 
 using namespace ogdf;
@@ -246,6 +249,87 @@ describe("Graph Class", [](){
 		delete[] visited;
 	});
 
+	it("builds a graph from an edge list", [](){
+		Graph graph;
+		node u = graph.newNode();
+		NodeArray<int> nodeLabel(graph, 7);
+		EdgeArray<int> edgeLabel(graph, 3);
+
+		Array<std::pair<int,int>> edgeList(500);
+		for(int i = 0; i < edgeList.size(); i++) {
+			edgeList[i] = std::pair<int,int>(i % 100, (7*i) % 100);
+		}
+
+		Array<node> newNodes;
+		graph.buildFromEdgeList(100, edgeList, newNodes);
+
+		AssertThat(graph.numberOfNodes(), Equals(101));
+		AssertThat(graph.numberOfEdges(), Equals(500));
+		AssertThat(newNodes.size(), Equals(100));
+		AssertThat(newNodes[0], !Equals(u));
+		AssertThat(graph.consistencyCheck(), IsTrue());
+
+		int i = 0;
+		for(edge e : graph.edges) {
+			AssertThat(e->source(), Equals(newNodes[edgeList[i].first]));
+			AssertThat(e->target(), Equals(newNodes[edgeList[i].second]));
+			AssertThat(edgeLabel[e], Equals(3));
+			i++;
+		}
+		for(node v : graph.nodes) {
+			AssertThat(nodeLabel[v], Equals(7));
+		}
+	});
+
+	it("reserves space for nodes and edges", [](){
+		Graph graph;
+		NodeArray<int> nodeLabel(graph, 1);
+		EdgeArray<int> edgeLabel(graph, 2);
+
+		graph.reserveNodes(1000);
+		graph.reserveEdges(3000);
+		AssertThat(graph.nodeArrayTableSize(), IsGreaterThan(999));
+		AssertThat(graph.edgeArrayTableSize(), IsGreaterThan(2999));
+
+		for(int i = 0; i < 1000; i++) {
+			graph.newNode();
+		}
+		for(int i = 0; i < 3000; i++) {
+			graph.newEdge(graph.firstNode(), graph.lastNode());
+		}
+
+		AssertThat(nodeLabel[graph.lastNode()], Equals(1));
+		AssertThat(edgeLabel[graph.lastEdge()], Equals(2));
+	});
+
+	it("keeps arrays registered from several threads up to date", [](){
+		Graph graph;
+		randomGraph(graph, 10, 20);
+
+		const int numThreads = 4;
+		Array<NodeArray<int>*> arrays(numThreads);
+		std::vector<std::thread> threads;
+		for(int i = 0; i < numThreads; i++) {
+			threads.push_back(std::thread([&graph, &arrays, i](){
+				for(int j = 0; j < 100; j++) {
+					NodeArray<int> tmp(graph, j);
+				}
+				arrays[i] = new NodeArray<int>(graph, i);
+			}));
+		}
+		for(std::thread &t : threads) {
+			t.join();
+		}
+
+		for(int i = 0; i < 1000; i++) {
+			graph.newNode();
+		}
+		for(int i = 0; i < numThreads; i++) {
+			AssertThat((*arrays[i])[graph.lastNode()], Equals(i));
+			delete arrays[i];
+		}
+	});
+
 	it("doesn't duplicate self-loops", [](){
 		Graph graph;
 
@@ -220,22 +220,21 @@ describe("graph attributes",[&](){
 			20, 42,
 			Type::nodeGraphics, "width of a node");
 
-		it("it assings width using a NodeArray",[&](){
+		it("assigns width using the node geometry",[&](){
 #ifdef OGDF_DEBUG
-			AssertThrows(PreconditionViolatedException, grattr.width());
+			AssertThrows(PreconditionViolatedException, grattr.geometry());
 #endif
 			grattr.initAttributes(Type::nodeGraphics);
-			NodeArray<double> widthNA(graph,42);
-			AssertThat(cGrattr.width().graphOf(), Equals(&graph));
-			AssertThat(grattr.width().graphOf(), Equals(&graph));
-			AssertThat(cGrattr.width()[v], Equals(LayoutStandards::defaultNodeWidth()));
-			AssertThat(grattr.width()[v], Equals(LayoutStandards::defaultNodeWidth()));
-			grattr.width() = widthNA;
-			AssertThat(cGrattr.width()[v], Equals(42));
-			AssertThat(grattr.width()[v], Equals(42));
+			AssertThat(cGrattr.geometry().graphOf(), Equals(&graph));
+			AssertThat(grattr.geometry().graphOf(), Equals(&graph));
+			AssertThat(cGrattr.geometry()[v].m_width, Equals(LayoutStandards::defaultNodeWidth()));
+			AssertThat(grattr.geometry()[v].m_width, Equals(LayoutStandards::defaultNodeWidth()));
+			grattr.geometry()[v].m_width = 42;
+			AssertThat(cGrattr.width(v), Equals(42));
+			AssertThat(grattr.width(v), Equals(42));
 			grattr.setAllWidth(1337);
-			AssertThat(cGrattr.width(v), Equals(1337));
-			AssertThat(grattr.width(v), Equals(1337));
+			AssertThat(cGrattr.geometry()[v].m_width, Equals(1337));
+			AssertThat(grattr.geometry()[v].m_width, Equals(1337));
 		});
 
 		testAttribute<double>(
@@ -244,20 +243,31 @@ describe("graph attributes",[&](){
 			20, 42,
 			Type::nodeGraphics, "height of a node");
 
-		it("it assigns height using a NodeArray",[&](){
+		it("assigns height using the node geometry",[&](){
 #ifdef OGDF_DEBUG
-			AssertThrows(PreconditionViolatedException, grattr.height());
+			AssertThrows(PreconditionViolatedException, grattr.geometry());
 #endif
 			grattr.initAttributes(Type::nodeGraphics);
-			NodeArray<double> heightNA(graph,42);
-			AssertThat(cGrattr.height().graphOf(), Equals(&graph));
-			AssertThat(grattr.height().graphOf(), Equals(&graph));
-			grattr.height() = heightNA;
-			AssertThat(cGrattr.height()[v], Equals(42));
-			AssertThat(grattr.height()[v], Equals(42));
+			AssertThat(cGrattr.geometry()[v].m_height, Equals(LayoutStandards::defaultNodeHeight()));
+			grattr.geometry()[v].m_height = 42;
+			AssertThat(cGrattr.height(v), Equals(42));
+			AssertThat(grattr.height(v), Equals(42));
 			grattr.setAllHeight(1337);
-			AssertThat(cGrattr.height(v), Equals(1337));
-			AssertThat(grattr.height(v), Equals(1337));
+			AssertThat(cGrattr.geometry()[v].m_height, Equals(1337));
+			AssertThat(grattr.geometry()[v].m_height, Equals(1337));
+		});
+
+		it("stores positions and sizes interleaved",[&](){
+			grattr.initAttributes(Type::nodeGraphics);
+			grattr.x(v) = 1;
+			grattr.y(v) = 2;
+			grattr.width(v) = 3;
+			grattr.height(v) = 4;
+			const GraphAttributes::NodeGeometry &g = cGrattr.geometry()[v];
+			AssertThat(g.m_x, Equals(1));
+			AssertThat(g.m_y, Equals(2));
+			AssertThat(g.m_width, Equals(3));
+			AssertThat(g.m_height, Equals(4));
 		});
 
 		testAttribute<int>(
@@ -371,13 +381,11 @@ describe("graph attributes",[&](){
 			AssertThat(grattr.fillPattern(v), Equals(FillPattern::fpCross));
 		});
 
-		grattr.initAttributes(Type::nodeId);
 		testAttribute<int>(
 			[&]() -> int& { return grattr.idNode(v); },
 			[&]() { return cGrattr.idNode(v); },
-			grattr.idNode(v), 42,
+			-1, 42,
 			Type::nodeId, "idNode");
-		grattr.destroyAttributes(Type::nodeId);
 
 		it("(in|add|remove)SubGraph",[&](){
 #ifdef OGDF_DEBUG
@@ -418,6 +426,29 @@ describe("graph attributes",[&](){
 			[&](){ return cGrattr.templateNode(v); },
 			"",  "ogdf" ,
 			Type::nodeTemplate, "template node");
+
+		it("keeps the defaults of labels and styles that were never written",[&](){
+			grattr.initAttributes(Type::nodeGraphics | Type::nodeStyle | Type::nodeLabel | Type::edgeGraphics);
+			for (node u : graph.nodes) {
+				AssertThat(cGrattr.label(u), IsEmpty());
+				AssertThat(cGrattr.fillColor(u), Equals(LayoutStandards::defaultNodeFill().m_color));
+			}
+
+			grattr.label(v) = "v";
+			grattr.fillColor(v) = Color::Name::Red;
+			node w = graph.newNode();
+			AssertThat(cGrattr.label(w), IsEmpty());
+			AssertThat(cGrattr.fillColor(w), Equals(LayoutStandards::defaultNodeFill().m_color));
+			for (node u : graph.nodes) {
+				AssertThat(cGrattr.label(u), Equals(u == v ? "v" : ""));
+			}
+
+			grattr.translate(1, 1);
+			AssertThat(cGrattr.bends(e).empty(), IsTrue());
+			grattr.bends(e).pushBack(DPoint(1, 2));
+			grattr.translate(1, 1);
+			AssertThat(cGrattr.bends(e).front(), Equals(DPoint(2, 3)));
+		});
 	});
 
 	describe("change position of elements",[&](){
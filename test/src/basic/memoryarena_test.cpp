@@ -0,0 +1,157 @@
+/** \file
+ * \brief Tests for MemoryArena and ArenaScope
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.txt in the root directory of the OGDF installation for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ *
+ * \see  http://www.gnu.org/copyleft/gpl.html
+ ***************************************************************/
+
+#include <bandit/bandit.h>
+#include <ogdf/basic/MemoryArena.h>
+#include <ogdf/basic/List.h>
+#include <ogdf/basic/SList.h>
+#include <ogdf/basic/NodeArray.h>
+#include <ogdf/basic/graph_generators.h>
+
+using namespace ogdf;
+using namespace bandit;
+
+go_bandit([](){
+	describe("MemoryArena", [](){
+		it("serves aligned allocations and reuses the most recent one", [](){
+			MemoryArena arena;
+			void *p = arena.allocate(3);
+			void *q = arena.allocate(8, 64);
+			AssertThat(reinterpret_cast<uintptr_t>(q) % 64, Equals(0u));
+			AssertThat(arena.numberOfAllocations(), Equals(2u));
+
+			arena.deallocate(q, 8);
+			AssertThat(arena.allocate(8, 64), Equals(q));
+			AssertThat(arena.reallocate(q, 8, 32, 64), Equals(q));
+			AssertThat(p, !Equals(q));
+		});
+
+		it("handles requests larger than a chunk", [](){
+			MemoryArena arena;
+			char *p = static_cast<char*>(arena.allocate(4 * MemoryArena::eMaxChunkSize));
+			p[4 * MemoryArena::eMaxChunkSize - 1] = 'x';
+			AssertThat(arena.memoryInChunks(), IsGreaterThanOrEqualTo(size_t(4 * MemoryArena::eMaxChunkSize)));
+			arena.release();
+			AssertThat(arena.memoryInChunks(), Equals(0u));
+		});
+	});
+
+	describe("ArenaScope", [](){
+		it("is used by containers created inside it", [](){
+			List<int> outside;
+			ArenaScope scope;
+			AssertThat(MemoryArena::current(), Equals(&scope.arena()));
+
+			List<int> L;
+			SList<int> S;
+			Array<int> A(100);
+			for (int i = 0; i < 100; ++i) {
+				L.pushBack(i);
+				S.pushFront(i);
+				outside.pushBack(i);
+				A[i] = i;
+			}
+			A.grow(100, 7);
+			size_t allocs = scope.arena().numberOfAllocations();
+			AssertThat(allocs, IsGreaterThanOrEqualTo(201u));
+
+			int sum = 0;
+			for (int x : L) sum += x;
+			for (int x : S) sum += x;
+			AssertThat(sum, Equals(2 * 4950));
+			AssertThat(A[150], Equals(7));
+		});
+
+		it("is not used after it ended", [](){
+			{
+				ArenaScope scope;
+			}
+			AssertThat(MemoryArena::current(), IsNull());
+		});
+
+		it("does nothing when disabled", [](){
+			ArenaScope::setEnabled(false);
+			{
+				ArenaScope scope;
+				AssertThat(MemoryArena::current(), IsNull());
+				List<int> L;
+				L.pushBack(1);
+				AssertThat(scope.arena().numberOfAllocations(), Equals(0u));
+			}
+			ArenaScope::setEnabled(true);
+		});
+
+		it("lets nested containers inherit the arena of their container", [](){
+			List<List<int>> outer;
+			ArenaScope scope;
+			outer.emplaceBack();
+			outer.back().pushBack(42);
+			AssertThat(scope.arena().numberOfAllocations(), Equals(0u));
+
+			Graph G;
+			randomGraph(G, 20, 40);
+			NodeArray<SListPure<node>> adjacent(G);
+			for (edge e : G.edges) {
+				adjacent[e->source()].pushBack(e->target());
+			}
+			size_t allocs = scope.arena().numberOfAllocations();
+			AssertThat(allocs, IsGreaterThanOrEqualTo(size_t(G.numberOfEdges())));
+
+			for (node v : G.nodes) {
+				AssertThat(adjacent[v].size(), Equals(v->outdeg()));
+			}
+		});
+
+		it("moves elements between containers of different arenas", [](){
+			List<int> L;
+			Array<List<int>> A;
+			{
+				ArenaScope scope;
+				List<int> M;
+				Array<List<int>> B(3);
+				for (int i = 0; i < 10; ++i) {
+					M.pushBack(i);
+					B[i % 3].pushBack(i);
+				}
+				L = std::move(M);
+				A = std::move(B);
+				L.conc(M);
+			}
+			AssertThat(L.size(), Equals(10));
+			AssertThat(L.back(), Equals(9));
+			AssertThat(A.size(), Equals(3));
+			AssertThat(A[1].size(), Equals(3));
+			L.clear();
+			A[1].pushBack(1);
+		});
+	});
+});
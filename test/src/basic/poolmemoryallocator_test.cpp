@@ -0,0 +1,128 @@
+/** \file
+ * \brief Tests for the pool memory allocator
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.txt in the root directory of the OGDF installation for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ *
+ * \see  http://www.gnu.org/copyleft/gpl.html
+ ***************************************************************/
+
+#include <bandit/bandit.h>
+#include <ogdf/basic/memory.h>
+#include <ogdf/basic/List.h>
+#include <thread>
+
+using namespace ogdf;
+using namespace bandit;
+
+struct PoolElem {
+	double m_x[5];
+	OGDF_NEW_DELETE
+};
+
+go_bandit([](){
+describe("PoolMemoryAllocator", [](){
+	int sc = PoolMemoryAllocator::sizeClass(sizeof(PoolElem));
+
+	it("maps sizes to word-sized classes", [](){
+		for(size_t n = 1; n < PoolMemoryAllocator::eTableSize; ++n) {
+			int c = PoolMemoryAllocator::sizeClass(n);
+			AssertThat(c, IsLessThan((int)PoolMemoryAllocator::eNumSizeClasses));
+			AssertThat(PoolMemoryAllocator::sliceSize(c), IsGreaterThan(n - 1));
+			AssertThat(PoolMemoryAllocator::sliceSize(c) % PoolMemoryAllocator::eMinBytes, Equals(0u));
+		}
+	});
+
+	it("counts allocations and bytes in use", [&](){
+		PoolMemoryAllocator::SizeClassStatistics before = PoolMemoryAllocator::statistics(sc);
+
+		const int n = 1000;
+		PoolElem *elems[n];
+		for(int i = 0; i < n; ++i) {
+			elems[i] = new PoolElem;
+		}
+
+		PoolMemoryAllocator::SizeClassStatistics during = PoolMemoryAllocator::statistics(sc);
+		AssertThat(during.m_allocations - before.m_allocations, Equals(size_t(n)));
+		AssertThat(during.m_bytesInUse - before.m_bytesInUse, Equals(n * during.m_sliceSize));
+		AssertThat(during.m_peakBytesInUse, IsGreaterThan(during.m_bytesInUse - 1));
+
+		for(int i = 0; i < n; ++i) {
+			delete elems[i];
+		}
+
+		PoolMemoryAllocator::SizeClassStatistics after = PoolMemoryAllocator::statistics(sc);
+		AssertThat(after.m_bytesInUse, Equals(before.m_bytesInUse));
+		AssertThat(after.m_peakBytesInUse, Equals(during.m_peakBytesInUse));
+	});
+
+	it("counts elements released as a list", [](){
+		int lsc = PoolMemoryAllocator::sizeClass(sizeof(ListElement<int>));
+		size_t inUse = PoolMemoryAllocator::statistics(lsc).m_bytesInUse;
+		{
+			List<int> L;
+			for(int i = 0; i < 5000; ++i) {
+				L.pushBack(i);
+			}
+		}
+		AssertThat(PoolMemoryAllocator::statistics(lsc).m_bytesInUse, Equals(inUse));
+	});
+
+	it("keeps the thread cache bounded", [&](){
+		const int n = 100000;
+		PoolElem **elems = new PoolElem*[n];
+		for(int i = 0; i < n; ++i) {
+			elems[i] = new PoolElem;
+		}
+		for(int i = 0; i < n; ++i) {
+			delete elems[i];
+		}
+		delete[] elems;
+
+		AssertThat(PoolMemoryAllocator::memoryInThreadFreeList(), IsLessThan(
+			size_t(PoolMemoryAllocator::eNumSizeClasses) * PoolMemoryAllocator::eMaxCachedBytes + 1));
+	});
+
+	it("returns the cache of an exited std::thread to the global pool", [&](){
+		size_t globalBefore = 0;
+
+		std::thread worker([&](){
+			List<PoolElem*> elems;
+			for(int i = 0; i < 100; ++i) {
+				elems.pushBack(new PoolElem);
+			}
+			globalBefore = PoolMemoryAllocator::statistics(sc).m_bytesInGlobalFreeList;
+			for(PoolElem *p : elems) {
+				delete p;
+			}
+		});
+		worker.join();
+
+		AssertThat(PoolMemoryAllocator::statistics(sc).m_bytesInGlobalFreeList,
+			IsGreaterThan(globalBefore + 100 * PoolMemoryAllocator::sliceSize(sc) - 1));
+	});
+});
+});
@@ -0,0 +1,182 @@
+/** \file
+ * \brief Tests for TaskScheduler
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.txt in the root directory of the OGDF installation for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ *
+ * \see  http://www.gnu.org/copyleft/gpl.html
+ ***************************************************************/
+
+#include <bandit/bandit.h>
+#include <ogdf/basic/TaskScheduler.h>
+#include <ogdf/basic/Barrier.h>
+#include <ogdf/basic/Thread.h>
+#include <ogdf/basic/List.h>
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+using namespace ogdf;
+using namespace bandit;
+
+go_bandit([](){
+	describe("TaskScheduler", [](){
+		it("runs a parallel loop over every index exactly once", [](){
+			for (unsigned int numWorkers : {0u, 1u, 3u}) {
+				TaskScheduler scheduler(numWorkers);
+				AssertThat(scheduler.concurrency(), Equals(numWorkers + 1));
+
+				Array<std::atomic<int>> count(10000);
+				for (std::atomic<int> &c : count) {
+					c = 0;
+				}
+				scheduler.parallelFor(0, 10000, 7, [&](int begin, int end) {
+					for (int i = begin; i < end; ++i) {
+						++count[i];
+					}
+				});
+				for (const std::atomic<int> &c : count) {
+					AssertThat(c.load(), Equals(1));
+				}
+			}
+		});
+
+		it("reduces in an order independent of the number of threads", [](){
+			auto sum = [](TaskScheduler &scheduler) {
+				return scheduler.parallelReduce(0, 100000, 64, 0.0,
+					[](int begin, int end) {
+						double s = 0.0;
+						for (int i = begin; i < end; ++i) {
+							s += 1.0 / (i + 1);
+						}
+						return s;
+					},
+					[](double x, double y) { return x + y; });
+			};
+			TaskScheduler sequential(0), parallel(3);
+			double expected = sum(sequential);
+			AssertThat(expected, IsGreaterThan(12.0));
+			AssertThat(sum(parallel), Equals(expected));
+		});
+
+		it("sorts stably independent of the number of threads", [](){
+			std::vector<std::pair<int,int>> expected;
+			for (int i = 0; i < 10000; ++i) {
+				expected.push_back(std::make_pair(randomNumber(0, 99), i));
+			}
+			std::vector<std::pair<int,int>> values = expected;
+			auto byFirst = [](const std::pair<int,int> &a, const std::pair<int,int> &b) { return a.first < b.first; };
+			std::stable_sort(expected.begin(), expected.end(), byFirst);
+
+			TaskScheduler scheduler(3);
+			scheduler.parallelStableSort(values.begin(), values.end(), byFirst, 300);
+			AssertThat(values == expected, IsTrue());
+		});
+
+		it("executes nested parallel loops with its own workers", [](){
+			TaskScheduler scheduler(2);
+			std::atomic<int> count(0);
+			scheduler.parallelFor(0, 40, 1, [&](int begin, int end) {
+				for (int i = begin; i < end; ++i) {
+					scheduler.parallelFor(0, 500, 10, [&](int b, int e) {
+						// use the memory manager in the workers as well
+						List<int> L;
+						for (int j = b; j < e; ++j) {
+							L.pushBack(j);
+						}
+						count += L.size();
+					});
+				}
+			});
+			AssertThat(count.load(), Equals(40 * 500));
+		});
+
+		it("rethrows exceptions of tasks", [](){
+			TaskScheduler scheduler(2);
+			TaskScheduler::TaskGroup group(scheduler);
+			std::atomic<int> finished(0);
+			for (int i = 0; i < 10; ++i) {
+				group.run([&finished, i] {
+					if (i == 5) {
+						throw std::runtime_error("task failed");
+					}
+					++finished;
+				});
+			}
+			AssertThrows(std::runtime_error, group.wait());
+			AssertThat(finished.load(), Equals(9));
+
+			AssertThrows(std::runtime_error, scheduler.parallelFor(0, 100, 1, [](int begin, int) {
+				if (begin == 42) {
+					throw std::runtime_error("loop failed");
+				}
+			}));
+		});
+
+		it("runs the threads of a gang concurrently", [](){
+			TaskScheduler scheduler(3);
+			TaskScheduler::Gang gang(8, scheduler);
+			AssertThat(gang.size(), Equals(4u));
+
+			// the threads would block forever at the barrier if they ran one after another
+			Barrier barrier(gang.size());
+			Array<int> round(gang.size());
+			for (int r = 0; r < 3; ++r) {
+				gang.run([&](unsigned int i) {
+					barrier.threadSync();
+					round[i] = r;
+					barrier.threadSync();
+				});
+			}
+			for (int x : round) {
+				AssertThat(x, Equals(2));
+			}
+
+			// all workers are reserved, but tasks are still executed by the waiting thread
+			TaskScheduler::Gang other(8, scheduler);
+			AssertThat(other.size(), Equals(1u));
+			std::atomic<int> count(0);
+			scheduler.parallelFor(0, 100, 1, [&](int begin, int end) { count += end - begin; });
+			AssertThat(count.load(), Equals(100));
+
+			gang.shrink(2);
+			AssertThat(gang.size(), Equals(2u));
+			TaskScheduler::Gang third(8, scheduler);
+			AssertThat(third.size(), Equals(3u));
+		});
+
+		it("provides a global scheduler", [](){
+			TaskScheduler &scheduler = TaskScheduler::global();
+			AssertThat(&scheduler, Equals(&TaskScheduler::global()));
+#ifdef OGDF_MEMORY_POOL_NTS
+			AssertThat(scheduler.numberOfWorkers(), Equals(0u));
+#else
+			AssertThat(scheduler.concurrency(), Equals(max(1u, Thread::hardware_concurrency())));
+#endif
+		});
+	});
+});
@@ -380,10 +380,10 @@ describe(title, [&]()
 			Graph graph;
 			initializer(graph, n);
 
-			NodeArray<NodeArray<int>> edgeCon(graph, NodeArray<int>(graph));
-			NodeArray<NodeArray<int>> nodeCon(graph, NodeArray<int>(graph));
-			NodeArray<NodeArray<int>> edgeDirCon(graph, NodeArray<int>(graph));
-			NodeArray<NodeArray<int>> nodeDirCon(graph, NodeArray<int>(graph));
+			NodeMatrix<int> edgeCon;
+			NodeMatrix<int> nodeCon;
+			NodeMatrix<int> edgeDirCon;
+			NodeMatrix<int> nodeDirCon;
 
 			// compute the connectivity
 			edgeAlgo.computeConnectivity(graph, edgeCon);
@@ -406,22 +406,22 @@ describe(title, [&]()
 			for (node v : graph.nodes) {
 				for (node w : graph.nodes) {
 					if (v == w) {
-						AssertThat(nodeCon[v][w], Equals(0));
+						AssertThat(nodeCon(v, w), Equals(0));
 					} else {
 						// compare with expected values
-						AssertThat(nodeCon[v][w], IsGreaterThan(expected - 1));
-						AssertThat(nodeCon[v][w], IsGreaterThan(minConnectivity - 1));
+						AssertThat(nodeCon(v, w), IsGreaterThan(expected - 1));
+						AssertThat(nodeCon(v, w), IsGreaterThan(minConnectivity - 1));
 
 						// edge connectivity is least restrictive
-						AssertThat(edgeCon[v][w], IsGreaterThan(nodeCon[v][w] - 1));
-						AssertThat(edgeCon[v][w], IsGreaterThan(edgeDirCon[v][w] - 1));
+						AssertThat(edgeCon(v, w), IsGreaterThan(nodeCon(v, w) - 1));
+						AssertThat(edgeCon(v, w), IsGreaterThan(edgeDirCon(v, w) - 1));
 
 						// (node) connectivity might never be greater than edge connectivity
-						AssertThat(edgeCon[v][w], IsGreaterThan(edgeDirCon[v][w] - 1));
+						AssertThat(edgeCon(v, w), IsGreaterThan(edgeDirCon(v, w) - 1));
 
 						// directed connectivity is most restrictive
-						AssertThat(nodeCon[v][w], IsGreaterThan(nodeDirCon[v][w] - 1));
-						AssertThat(edgeDirCon[v][w], IsGreaterThan(nodeDirCon[v][w] - 1));
+						AssertThat(nodeCon(v, w), IsGreaterThan(nodeDirCon(v, w) - 1));
+						AssertThat(edgeDirCon(v, w), IsGreaterThan(nodeDirCon(v, w) - 1));
 					}
 				}
 			}
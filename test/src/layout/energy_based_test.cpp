@@ -5,6 +5,9 @@
 //    - GEMLayout
 //    - DavidsonHarelLayout
 //    - PivotMDS
+//    - StressMinimization
+//    - SpringEmbedderKK
+//    - SpringEmbedderFRExact
 //
 //  Author: Carsten Gutwenger, Tilo Wiedera
 //*********************************************************
@@ -16,6 +19,17 @@
 #include <ogdf/energybased/GEMLayout.h>
 #include <ogdf/energybased/DavidsonHarelLayout.h>
 #include <ogdf/energybased/PivotMDS.h>
+#include <ogdf/energybased/StressMinimization.h>
+#include <ogdf/energybased/SpringEmbedderKK.h>
+#include <ogdf/energybased/SpringEmbedderFRExact.h>
+#include <ogdf/energybased/FastMultipoleEmbedder.h>
+#include <ogdf/internal/energybased/LinearQuadtreeExpansion.h>
+#include <ogdf/internal/energybased/LinearQuadtreeBuilder.h>
+#include <ogdf/internal/energybased/FMEMultipoleKernel.h>
+#include <ogdf/energybased/multilevelmixer/ModularMultilevelMixer.h>
+#include <ogdf/energybased/multilevelmixer/HandshakeMatchingMerger.h>
+#include <ogdf/energybased/multilevelmixer/ZeroPlacer.h>
+#include <ogdf/packing/ComponentSplitterLayout.h>
 #include <ogdf/basic/graph_generators.h>
 #include <ogdf/basic/simple_graph_alg.h>
 
@@ -24,23 +38,360 @@
 using namespace ogdf;
 
 go_bandit([](){ bandit::describe("Energy-based layouts", [](){
-	FMMMLayout                fmmm, fmmmNice, fmmmHQ;
-	SpringEmbedderGridVariant frl, frlHQ;
+	FMMMLayout                fmmm, fmmmNice, fmmmHQ, fmmmThreads;
+	SpringEmbedderGridVariant frl, frlHQ, frlThreads;
 	GEMLayout                 gem;
 	DavidsonHarelLayout       dhl;
-	PivotMDS                  pmds;
+	PivotMDS                  pmds, pmdsFloat, pmdsThreads;
+	StressMinimization        stress, sparseStress;
+	SpringEmbedderKK          kk;
+	SpringEmbedderFRExact     frExact, frExactFloat;
+	ComponentSplitterLayout   parallelSplitter;
+	FastMultipoleEmbedder     fme;
+	ModularMultilevelMixer    mmmHandshake;
 
 	fmmmHQ.qualityVersusSpeed(FMMMLayout::qvsGorgeousAndEfficient);
 	fmmmHQ.useHighLevelOptions(true);
 	fmmmNice.qualityVersusSpeed(FMMMLayout::qvsNiceAndIncredibleSpeed);
+	fmmmThreads.numberOfThreads(4);
 	frlHQ.iterations(1000);
+	frlThreads.maxThreads(4);
+	sparseStress.useSparseStress(true);
+	frExactFloat.singlePrecision(true);
+	pmdsFloat.useSinglePrecision(true);
+	pmdsThreads.setNumberOfThreads(3);
+	parallelSplitter.setLayoutModuleFactory([] { return new FMMMLayout; });
+	mmmHandshake.setMultilevelBuilder(new HandshakeMatchingMerger);
 
 	describeLayoutModule("Fast Multipole Multilevel Embedder", fmmm);
 	describeLayoutModule("Fast Multipole Multilevel Embedder with high quality settings", fmmmHQ);
 	describeLayoutModule("Fast Multipole Multilevel Embedder with nice quality and incredible speed", fmmmHQ);
+	describeLayoutModule("Fast Multipole Multilevel Embedder on several threads", fmmmThreads);
 	describeLayoutModule("Spring Embedder grid variant", frl);
 	describeLayoutModule("Spring Embedder grid variant with high quality settings", fmmmHQ);
+	describeLayoutModule("Spring Embedder grid variant on several threads", frlThreads);
 	describeLayoutModule("GEM layout", gem);
 	describeLayoutModule("Davidson-Harel layout", dhl);
 	describeLayoutModule("PivotMDS layout", pmds, 0, GR_CONNECTED);
+	describeLayoutModule("PivotMDS layout in single precision", pmdsFloat, 0, GR_CONNECTED);
+	describeLayoutModule("PivotMDS layout on several threads", pmdsThreads, 0, GR_CONNECTED);
+	describeLayoutModule("Stress minimization", stress, 0, GR_ALL, 100);
+	describeLayoutModule("Stress minimization with the sparse stress model", sparseStress);
+	describeLayoutModule("Spring Embedder Kamada-Kawai", kk, 0, GR_CONNECTED, 100);
+	describeLayoutModule("Spring Embedder Fruchterman-Reingold (exact)", frExact, 0, GR_ALL, 100);
+	describeLayoutModule("Spring Embedder Fruchterman-Reingold (exact) in single precision", frExactFloat, 0, GR_ALL, 100);
+	describeLayoutModule("Component splitter with parallel layouts of the components", parallelSplitter);
+	describeLayoutModule("Fast Multipole Embedder", fme);
+	describeLayoutModule("Modular multilevel mixer with handshake matchings", mmmHandshake);
+
+	bandit::it("draws a grid like the full stress model when using the sparse stress model", [&](){
+		Graph G;
+		gridGraph(G, 20, 20, false, false);
+		auto averageEdgeLength = [&](LayoutModule &L) {
+			GraphAttributes GA(G);
+			L.call(GA);
+			double totalLength = 0;
+			for(edge e : G.edges) {
+				double dx = GA.x(e->source()) - GA.x(e->target());
+				double dy = GA.y(e->source()) - GA.y(e->target());
+				totalLength += sqrt(dx*dx + dy*dy);
+			}
+			return totalLength / G.numberOfEdges();
+		};
+
+		StressMinimization fullStress;
+		double expected = averageEdgeLength(fullStress);
+		AssertThat(averageEdgeLength(sparseStress), EqualsWithDelta(expected, 0.05 * expected));
+	});
+
+	bandit::it("draws the same layout with parallel and sequential layouts of the components", [&](){
+		Graph G;
+		for(int k = 1; k <= 6; ++k) {
+			Graph H;
+			gridGraph(H, 2*k, k+1, false, false);
+			insertGraph(G, H);
+		}
+		auto layout = [&](ComponentSplitterLayout &csl, GraphAttributes &GA) {
+			int i = 0;
+			for(node v : G.nodes) {
+				GA.x(v) = (i * 37) % 101;
+				GA.y(v) = (i * 53) % 97;
+				++i;
+			}
+			csl.call(GA);
+		};
+
+		ComponentSplitterLayout sequential, parallel;
+		sequential.setLayoutModule(new SpringEmbedderKK);
+		parallel.setLayoutModuleFactory([] { return new SpringEmbedderKK; });
+		parallel.setNumberOfThreads(4);
+
+		GraphAttributes expected(G), GA(G);
+		layout(sequential, expected);
+		layout(parallel, GA);
+		for(node v : G.nodes) {
+			AssertThat(GA.x(v), Equals(expected.x(v)));
+			AssertThat(GA.y(v), Equals(expected.y(v)));
+		}
+	});
+
+	bandit::it("draws the same layout with Kamada-Kawai on several threads", [&](){
+		Graph G;
+		gridGraph(G, 24, 25, false, false);
+		auto layout = [&](unsigned int numThreads, GraphAttributes &GA) {
+			int i = 0;
+			for(node v : G.nodes) {
+				GA.x(v) = (i * 37) % 101;
+				GA.y(v) = (i * 53) % 97;
+				++i;
+			}
+			SpringEmbedderKK skk;
+			skk.setNumberOfThreads(numThreads);
+			skk.call(GA);
+		};
+
+		GraphAttributes expected(G), GA(G);
+		layout(1, expected);
+		layout(3, GA);
+		for(node v : G.nodes) {
+			AssertThat(GA.x(v), Equals(expected.x(v)));
+			AssertThat(GA.y(v), Equals(expected.y(v)));
+		}
+	});
+
+	bandit::it("draws the same layout with exact Fruchterman-Reingold on several threads", [&](){
+		Graph G;
+		gridGraph(G, 32, 40, false, false);
+		auto layout = [&](unsigned int numThreads, GraphAttributes &GA) {
+			int i = 0;
+			for(node v : G.nodes) {
+				GA.x(v) = (i * 37) % 101;
+				GA.y(v) = (i * 53) % 97;
+				++i;
+			}
+			SpringEmbedderFRExact fr;
+			fr.iterations(50);
+			fr.numberOfThreads(numThreads);
+			fr.call(GA);
+		};
+
+		GraphAttributes expected(G), GA(G);
+		layout(1, expected);
+		layout(2, GA);
+		for(node v : G.nodes) {
+			AssertThat(GA.x(v), Equals(expected.x(v)));
+			AssertThat(GA.y(v), Equals(expected.y(v)));
+		}
+	});
+
+	bandit::it("draws the same layout with the Fast Multipole Multilevel Embedder on any number of threads", [&](){
+		Graph G;
+		gridGraph(G, 30, 30, false, false);
+		auto layout = [&](unsigned int numThreads, GraphAttributes &GA) {
+			FMMMLayout fmmmLayout;
+			fmmmLayout.numberOfThreads(numThreads);
+			fmmmLayout.call(GA);
+		};
+
+		GraphAttributes expected(G), GA(G);
+		layout(2, expected);
+		layout(4, GA);
+		for(node v : G.nodes) {
+			AssertThat(GA.x(v), Equals(expected.x(v)));
+			AssertThat(GA.y(v), Equals(expected.y(v)));
+		}
+	});
+
+	bandit::it("contracts and expands the levels of handshake matchings alike on any number of threads", [&](){
+		Graph G;
+		randomSimpleGraph(G, 300, 900);
+		GraphAttributes GA(G);
+
+		auto assertSameGraph = [](MultilevelGraph &expected, MultilevelGraph &MLG) {
+			AssertThat(MLG.getGraph().numberOfNodes(), Equals(expected.getGraph().numberOfNodes()));
+			AssertThat(MLG.getGraph().numberOfEdges(), Equals(expected.getGraph().numberOfEdges()));
+			for(node v : expected.getGraph().nodes) {
+				node w = MLG.getNode(v->index());
+				AssertThat(w, !IsNull());
+				AssertThat(MLG.mergeWeight(w), Equals(expected.mergeWeight(v)));
+			}
+			for(edge e : expected.getGraph().edges) {
+				edge f = MLG.getEdge(e->index());
+				AssertThat(f, !IsNull());
+				AssertThat(f->source()->index(), Equals(e->source()->index()));
+				AssertThat(f->target()->index(), Equals(e->target()->index()));
+				AssertThat(MLG.weight(f), Equals(expected.weight(e)));
+			}
+		};
+		auto buildLevels = [](unsigned int numThreads, MultilevelGraph &MLG) {
+			setSeed(42);
+			HandshakeMatchingMerger merger;
+			merger.numberOfThreads(numThreads);
+			merger.buildAllLevels(MLG);
+			return merger.getNumLevels();
+		};
+
+		MultilevelGraph original(GA), expected(GA), MLG(GA);
+		original.updateReverseIndizes();
+		int numLevels = buildLevels(1, expected);
+		AssertThat(numLevels, IsGreaterThan(2));
+		AssertThat(buildLevels(3, MLG), Equals(numLevels));
+		AssertThat(MLG.getLevel(), Equals(numLevels - 1));
+		assertSameGraph(expected, MLG);
+
+		ZeroPlacer placer;
+		while (MLG.getLevel() > 0) {
+			placer.prolongateOneLevel(MLG);
+		}
+		AssertThat(MLG.numberOfCompactLevels(), Equals(0));
+		assertSameGraph(original, MLG);
+	});
+
+	bandit::it("evaluates the expansions of the Fast Multipole Embedder alike with every instruction set", [&](){
+		std::vector<FMEExpansionKernels> kernels;
+#ifdef OGDF_SSE2_EXTENSIONS
+		kernels.push_back(fmeExpansionKernels<FMESSE2DoubleOps, FMESSE2FloatOps>());
+#endif
+#ifdef OGDF_AVX2_EXTENSIONS
+		if(System::cpuSupports(cpufAVX2) && System::cpuSupports(cpufFMA)) {
+			kernels.push_back(fmeExpansionKernelsAVX2());
+		}
+#endif
+#ifdef OGDF_AVX512_EXTENSIONS
+		if(System::cpuSupports(cpufAVX512F)) {
+			kernels.push_back(fmeExpansionKernelsAVX512());
+		}
+#endif
+		const FMEExpansionKernels scalar = fmeExpansionKernels<FMEScalarDoubleOps, FMEScalarFloatOps>();
+		std::minstd_rand rng(randomSeed());
+		std::uniform_real_distribution<> coord(-1.0, 1.0);
+
+		for(uint32_t p : { 1, 4, 5, 9 }) {
+			std::vector<float> x(1), y(1), s(1);
+			LinearQuadtree tree(1, x.data(), y.data(), s.data());
+			LinearQuadtreeExpansion expansions(p, tree);
+			const FMEExpansionTables &t = expansions.tables();
+
+			std::vector<double> source(t.stride, 0.0);
+			for(uint32_t i = 0; i < 2*p; ++i) {
+				source[i] = coord(rng);
+			}
+			auto compare = [&](const std::vector<double> &expected, const std::vector<double> &actual) {
+				for(uint32_t i = 0; i < t.stride; ++i) {
+					AssertThat(actual[i], IsGreaterThanOrEqualTo(expected[i] - 1e-9));
+					AssertThat(actual[i], IsLessThanOrEqualTo(expected[i] + 1e-9));
+				}
+			};
+			auto evaluate = [&](const FMEExpansionKernels &k) {
+				std::vector<double> result(5*t.stride, 0.0);
+				double fx = 0.0, fy = 0.0;
+				k.p2m(t, result.data(), 0.3, -0.2, 1.5);
+				k.m2m(t, result.data() + t.stride, source.data(), 0.25, 0.1);
+				k.m2l(t, result.data() + 2*t.stride, source.data(), 3.0, -2.5);
+				k.l2l(t, result.data() + 3*t.stride, source.data(), -0.2, 0.35);
+				k.l2p(t, source.data(), 0.15, 0.4, fx, fy);
+				result[4*t.stride] = fx;
+				result[4*t.stride + 1] = fy;
+				return result;
+			};
+
+			const std::vector<double> expected = evaluate(scalar);
+			for(auto &k : kernels) {
+				compare(expected, evaluate(k));
+			}
+		}
+
+		const uint32_t n = 37;
+		std::vector<float> x(n), y(n), s(n);
+		for(uint32_t i = 0; i < n; ++i) {
+			x[i] = float(coord(rng));
+			y[i] = float(coord(rng));
+			s[i] = 1.0f;
+		}
+		auto direct = [&](const FMEExpansionKernels &k) {
+			std::vector<float> f(4*n, 0.0f);
+			k.direct(x.data(), y.data(), s.data(), f.data(), f.data() + n, n);
+			k.directPair(x.data(), y.data(), s.data(), f.data() + 2*n, f.data() + 3*n, 11,
+			             x.data() + 11, y.data() + 11, s.data() + 11, f.data() + 2*n + 11, f.data() + 3*n + 11, n - 11);
+			return f;
+		};
+		const std::vector<float> expected = direct(scalar);
+		for(auto &k : kernels) {
+			std::vector<float> actual = direct(k);
+			for(uint32_t i = 0; i < 4*n; ++i) {
+				float tolerance = 1e-4f * (1.0f + std::fabs(expected[i]));
+				AssertThat(actual[i], IsGreaterThanOrEqualTo(expected[i] - tolerance));
+				AssertThat(actual[i], IsLessThanOrEqualTo(expected[i] + tolerance));
+			}
+		}
+	});
+
+	bandit::it("builds the same quadtree for the Fast Multipole Embedder incrementally and from scratch", [&](){
+		const uint32_t n = 2000;
+		std::vector<float> x(n), y(n), s(n);
+		LinearQuadtree incremental(n, x.data(), y.data(), s.data());
+		LinearQuadtree scratch(n, x.data(), y.data(), s.data());
+		std::minstd_rand rng(randomSeed());
+		std::uniform_int_distribution<uint32_t> coord(0, (1 << 24) - 1);
+		std::uniform_int_distribution<int> offset(-64, 64);
+		std::vector<uint32_t> ix(n), iy(n);
+		for(uint32_t i = 0; i < n; ++i) {
+			// a few clusters of points on the same grid cells give a deep tree with multiple points per leaf
+			ix[i] = i % 3 ? coord(rng) : (coord(rng) >> 18) + 1000;
+			iy[i] = i % 3 ? coord(rng) : (coord(rng) >> 18) + 1000;
+		}
+
+		for(int round = 0; round < 6; ++round) {
+			for(uint32_t i = 0; i < n; ++i) {
+				LinearQuadtree::LQPoint &p = incremental.point(i);
+				p.mortonNr = mortonNumber<uint64_t, uint32_t>(ix[p.ref], iy[p.ref]);
+			}
+			FMEMultipoleKernel::sort_presorted(incremental.pointArray(), n, LQPointComparer);
+			AssertThat(std::is_sorted(incremental.pointArray(), incremental.pointArray() + n, LQPointComparer), IsTrue());
+			for(uint32_t i = 0; i < n; ++i) {
+				scratch.point(i) = incremental.point(i);
+			}
+			LinearQuadtreeBuilder(incremental).update();
+			LinearQuadtreeBuilder builder(scratch);
+			builder.prepareTree();
+			builder.build();
+
+			AssertThat(incremental.root(), Equals(scratch.root()));
+			AssertThat(incremental.numberOfLeaves(), Equals(scratch.numberOfLeaves()));
+			AssertThat(incremental.numberOfInnerNodes(), Equals(scratch.numberOfInnerNodes()));
+			LinearQuadtree::NodeID v = incremental.firstInnerNode();
+			AssertThat(v, Equals(scratch.firstInnerNode()));
+			for(uint32_t i = 0; i < incremental.numberOfInnerNodes(); ++i, v = incremental.nextNode(v)) {
+				AssertThat(incremental.nextNode(v), Equals(scratch.nextNode(v)));
+				AssertThat(incremental.level(v), Equals(scratch.level(v)));
+				AssertThat(incremental.firstPoint(v), Equals(scratch.firstPoint(v)));
+				AssertThat(incremental.numberOfPoints(v), Equals(scratch.numberOfPoints(v)));
+				AssertThat(incremental.numberOfChilds(v), Equals(scratch.numberOfChilds(v)));
+				for(uint32_t j = 0; j < incremental.numberOfChilds(v); ++j) {
+					AssertThat(incremental.child(v, j), Equals(scratch.child(v, j)));
+				}
+			}
+			v = incremental.firstLeaf();
+			AssertThat(v, Equals(scratch.firstLeaf()));
+			for(uint32_t i = 0; i < incremental.numberOfLeaves(); ++i, v = incremental.nextNode(v)) {
+				AssertThat(incremental.nextNode(v), Equals(scratch.nextNode(v)));
+				AssertThat(incremental.isLeaf(v), IsTrue());
+				AssertThat(incremental.numberOfPoints(v), Equals(scratch.numberOfPoints(v)));
+			}
+			for(uint32_t i = 0; i < n; ++i) {
+				AssertThat(incremental.pointLeaf(i), Equals(scratch.pointLeaf(i)));
+			}
+
+			// move some points a little and a few far away
+			for(uint32_t i = 0; i < n; ++i) {
+				if(rng() % 10 == 0) {
+					ix[i] = std::min<uint32_t>((1 << 24) - 1, std::max(0, int(ix[i]) + offset(rng)));
+					iy[i] = std::min<uint32_t>((1 << 24) - 1, std::max(0, int(iy[i]) + offset(rng)));
+				} else if(rng() % 200 == 0) {
+					ix[i] = coord(rng);
+					iy[i] = coord(rng);
+				}
+			}
+		}
+	});
 }); });
@@ -1,6 +1,8 @@
 //*********************************************************
 // Tested classes:
 //    - SugiyamaLayout
+//    - CrossingCounter
+//    - SiftingHeuristic
 //
 //  Author: Carsten Gutwenger, Tilo Wiedera
 //*********************************************************
@@ -11,11 +13,15 @@
 #include <ogdf/layered/FastHierarchyLayout.h>
 #include <ogdf/layered/MedianHeuristic.h>
 #include <ogdf/layered/BarycenterHeuristic.h>
+#include <ogdf/layered/SiftingHeuristic.h>
 #include <ogdf/layered/OptimalHierarchyLayout.h>
 #include <ogdf/layered/OptimalRanking.h>
 #include <ogdf/layered/LongestPathRanking.h>
 #include <ogdf/layered/GreedyCycleRemoval.h>
 #include <ogdf/layered/DfsAcyclicSubgraph.h>
+#include <ogdf/layered/HierarchyLevels.h>
+#include <ogdf/layered/CrossingCounter.h>
+#include <ogdf/basic/graph_generators.h>
 
 #include "layout_helpers.h"
 
@@ -44,4 +50,132 @@ go_bandit([](){ bandit::describe("Sugiyama layouts", [](){
 
 	sugiRuns.runs(40);
 	describeLayoutModule("Sugiyama with 40 runs", sugiRuns, 0, GR_ALL, 50);
+
+	bandit::it("counts crossings incrementally like from scratch", [](){
+		Graph G;
+		randomHierarchy(G, 80, 160, false, false, true);
+		NodeArray<int> rank(G);
+		LongestPathRanking ranking;
+		ranking.call(G, rank);
+		Hierarchy H(G, rank);
+		HierarchyLevels levels(H);
+		CrossingCounter counter(levels);
+
+		auto crossings = [&]() {
+			levels.buildAdjNodes();
+			int nc = 0;
+			for(int i = 0; i < levels.high(); ++i) {
+				nc += levels.calculateCrossings(i);
+			}
+			return nc;
+		};
+		AssertThat(counter.totalCrossings(), Equals(crossings()));
+
+		for(int k = 0; k < 100; ++k) {
+			int i = randomNumber(0, levels.high());
+			Level &L = levels[i];
+			if(L.size() < 2) {
+				continue;
+			}
+
+			int p = randomNumber(0, L.high()-1);
+			int expected = counter.totalCrossings() + counter.swapDelta(i, p);
+			counter.swap(i, p);
+			L.swap(p, p+1);
+			AssertThat(counter.totalCrossings(), Equals(expected));
+			AssertThat(counter.totalCrossings(), Equals(crossings()));
+
+			int from = randomNumber(0, L.high());
+			int to = randomNumber(0, L.high());
+			expected = counter.totalCrossings() + counter.moveDelta(i, from, to);
+			counter.move(i, from, to);
+			for(int q = from; q < to; ++q) {
+				L.swap(q, q+1);
+			}
+			for(int q = from; q > to; --q) {
+				L.swap(q-1, q);
+			}
+			AssertThat(counter.totalCrossings(), Equals(expected));
+			AssertThat(counter.totalCrossings(), Equals(crossings()));
+		}
+
+		levels.permute();
+		AssertThat(counter.update(levels), Equals(crossings()));
+		AssertThat(levels.calculateCrossings(), Equals(counter.totalCrossings()));
+	});
+
+	bandit::it("sorts levels in parallel like sequentially", [](){
+		// three wide levels, so that the parallel sort splits them into several runs
+		const int width = 10000;
+		Graph G;
+		NodeArray<int> rank(G);
+		Array<node> nodes(3 * width);
+		for(int i = 0; i < 3 * width; ++i) {
+			nodes[i] = G.newNode();
+			rank[nodes[i]] = i / width;
+		}
+		for(int k = 0; k < 4 * width; ++k) {
+			int r = randomNumber(0, 1);
+			G.newEdge(nodes[r * width + randomNumber(0, width - 1)], nodes[(r + 1) * width + randomNumber(0, width - 1)]);
+		}
+		Hierarchy H(G, rank);
+
+		auto sweep = [&](LayerByLayerSweep &crossMin, HierarchyLevels &levels) {
+			crossMin.init(levels);
+			for(int i = 1; i <= levels.high(); ++i) {
+				crossMin.call(levels[i]);
+			}
+			crossMin.cleanup();
+		};
+
+		for(int median = 0; median < 2; ++median) {
+			HierarchyLevels sequential(H), parallel(H);
+			if(median) {
+				MedianHeuristic crossMin;
+				sweep(crossMin, sequential);
+				crossMin.numberOfThreads(4);
+				sweep(crossMin, parallel);
+			} else {
+				BarycenterHeuristic crossMin;
+				sweep(crossMin, sequential);
+				crossMin.numberOfThreads(4);
+				sweep(crossMin, parallel);
+			}
+			const GraphCopy &GC = H;
+			for(node v : GC.nodes) {
+				AssertThat(parallel.pos(v), Equals(sequential.pos(v)));
+			}
+		}
+	});
+
+	bandit::it("sifts wide levels without increasing the crossings", [](){
+		const int width = 2000;
+		Graph G;
+		NodeArray<int> rank(G);
+		Array<node> nodes(2 * width);
+		for(int i = 0; i < 2 * width; ++i) {
+			nodes[i] = G.newNode();
+			rank[nodes[i]] = i / width;
+		}
+		for(int k = 0; k < 2 * width; ++k) {
+			G.newEdge(nodes[randomNumber(0, width - 1)], nodes[width + randomNumber(0, width - 1)]);
+		}
+		Hierarchy H(G, rank);
+
+		for(auto strategy : {SiftingHeuristic::left_to_right, SiftingHeuristic::desc_degree, SiftingHeuristic::random}) {
+			HierarchyLevels levels(H);
+			int before = levels.calculateCrossings();
+
+			SiftingHeuristic sifting;
+			sifting.strategy(strategy);
+			sifting.init(levels);
+			sifting.call(levels[1]);
+			sifting.cleanup();
+
+			levels.buildAdjNodes();
+			int after = levels.calculateCrossings(0);
+			AssertThat(after, IsLessThan(before));
+			AssertThat(levels.calculateCrossings(), Equals(after));
+		}
+	});
 }); });